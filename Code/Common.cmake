@@ -1,8 +1,12 @@
 set(COMMON_SOURCES
+    ${CODE_DIR}/Common/Checksum.cpp
+    ${CODE_DIR}/Common/Checksum.hpp
     ${CODE_DIR}/Common/FileDialogs.cpp
     ${CODE_DIR}/Common/FileDialogs.hpp
     ${CODE_DIR}/Common/Filesystem.cpp
     ${CODE_DIR}/Common/Filesystem.hpp
+    ${CODE_DIR}/Common/Hash.hpp
+    ${CODE_DIR}/Common/Parallel.hpp
     ${CODE_DIR}/Common/Platform.hpp
     ${CODE_DIR}/Common/Result.hpp
     ${CODE_DIR}/Common/Str.hpp
@@ -0,0 +1,106 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "Checksum.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #define X_CRC32C_HARDWARE
+    #include <nmmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define X_TARGET_SSE42
+    #else
+        #include <cpuid.h>
+        #define X_TARGET_SSE42 __attribute__((target("sse4.2")))
+    #endif
+#endif
+
+namespace x {
+    static constexpr u32 kCrc32cPolynomial = 0x82F63B78;  // Reversed Castagnoli polynomial
+
+    // Slicing-by-8 tables: kCrc32cTables[0] is the classic byte-at-a-time table, table k advances a byte k positions
+    static constexpr auto kCrc32cTables = []() {
+        std::array<std::array<u32, 256>, 8> tables {};
+        for (u32 i = 0; i < 256; ++i) {
+            u32 crc = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc >> 1) ^ ((crc & 1) ? kCrc32cPolynomial : 0);
+            }
+            tables[0][i] = crc;
+        }
+        for (u32 i = 0; i < 256; ++i) {
+            for (size_t k = 1; k < tables.size(); ++k) {
+                tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+            }
+        }
+        return tables;
+    }();
+
+    static u32 Crc32cSoftware(const u8* data, size_t size, u32 crc) {
+        const auto& t = kCrc32cTables;
+        while (size >= 8) {
+            u64 word;
+            std::memcpy(&word, data, sizeof(word));
+            word ^= crc;
+            crc = t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^ t[5][(word >> 16) & 0xFF] ^
+                  t[4][(word >> 24) & 0xFF] ^ t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^
+                  t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+            data += 8;
+            size -= 8;
+        }
+        while (size-- > 0) {
+            crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+        }
+        return crc;
+    }
+
+#ifdef X_CRC32C_HARDWARE
+    X_TARGET_SSE42 static u32 Crc32cHardware(const u8* data, size_t size, u32 crc) {
+        u64 crc64 = crc;
+        while (size >= 8) {
+            u64 word;
+            std::memcpy(&word, data, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+            data += 8;
+            size -= 8;
+        }
+        crc = CAST<u32>(crc64);
+        while (size-- > 0) {
+            crc = _mm_crc32_u8(crc, *data++);
+        }
+        return crc;
+    }
+
+    static bool HasSse42() {
+    #if defined(_MSC_VER)
+        int info[4] {};
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+    #else
+        unsigned eax {0}, ebx {0}, ecx {0}, edx {0};
+        return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2) != 0;
+    #endif
+    }
+#endif
+
+    bool Crc32cIsHardwareAccelerated() {
+#ifdef X_CRC32C_HARDWARE
+        static const bool hasSse42 = HasSse42();
+        return hasSse42;
+#else
+        return false;
+#endif
+    }
+
+    u32 Crc32c(std::span<const u8> data, u32 seed) {
+        const u32 crc = ~seed;
+#ifdef X_CRC32C_HARDWARE
+        if (Crc32cIsHardwareAccelerated()) { return ~Crc32cHardware(data.data(), data.size(), crc); }
+#endif
+        return ~Crc32cSoftware(data.data(), data.size(), crc);
+    }
+}  // namespace x
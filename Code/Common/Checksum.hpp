@@ -0,0 +1,18 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Typedefs.hpp"
+#include <span>
+
+namespace x {
+    /// @brief CRC32C (Castagnoli). Uses the SSE4.2 crc32 instruction when the CPU supports it and a table-driven
+    /// implementation otherwise, both produce the same result so it's safe to persist. Pass a previous result as `seed`
+    /// to checksum several buffers as one.
+    u32 Crc32c(std::span<const u8> data, u32 seed = 0);
+
+    /// @brief Returns true if Crc32c runs on the CPU's crc32 instruction rather than the table fallback.
+    bool Crc32cIsHardwareAccelerated();
+}  // namespace x
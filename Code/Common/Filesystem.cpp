@@ -21,6 +21,8 @@
     #endif
 #else
     #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
 #endif
 
 namespace x {
@@ -74,6 +76,18 @@ namespace x {
         const std::streamsize fileSize = file.tellg();
         return fileSize;
     }
+
+    u64 FileReader::QueryModifiedTime(const Path& path) {
+#ifdef _WIN32
+        WIN32_FILE_ATTRIBUTE_DATA attributes {};
+        if (!::GetFileAttributesExA(path.CStr(), GetFileExInfoStandard, &attributes)) { return 0; }
+        return (CAST<u64>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+#else
+        struct stat info {};
+        if (stat(path.CStr(), &info) != 0) { return 0; }
+        return CAST<u64>(info.st_mtim.tv_sec) * 1000000000ull + info.st_mtim.tv_nsec;
+#endif
+    }
 #pragma endregion
 
 #pragma region FileWriter
@@ -258,6 +272,12 @@ namespace x {
         return mStream.good();
     }
 
+    bool StreamWriter::Write(std::span<const u8> buffer) {
+        if (!IsOpen() || buffer.empty()) return false;
+        mStream.write(RCAST<cstr>(buffer.data()), (std::streamsize)buffer.size());
+        return mStream.good();
+    }
+
     bool StreamWriter::WriteLine(const str& line) {
         if (!IsOpen()) return false;
         mStream << line << '\n';
@@ -293,6 +313,139 @@ namespace x {
     }
 #pragma endregion
 
+#pragma region MemoryMappedFile
+    MemoryMappedFile::MemoryMappedFile(const Path& path) {
+        Open(path);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile() {
+        Close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+        : mData(other.mData), mSize(other.mSize), mFile(other.mFile)
+#ifdef _WIN32
+          ,
+          mMapping(other.mMapping)
+#endif
+    {
+        other.mData = nullptr;
+        other.mSize = 0;
+#ifdef _WIN32
+        other.mFile    = INVALID_HANDLE_VALUE;
+        other.mMapping = nullptr;
+#else
+        other.mFile = -1;
+#endif
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            mData = other.mData;
+            mSize = other.mSize;
+            mFile = other.mFile;
+
+            other.mData = nullptr;
+            other.mSize = 0;
+#ifdef _WIN32
+            mMapping       = other.mMapping;
+            other.mFile    = INVALID_HANDLE_VALUE;
+            other.mMapping = nullptr;
+#else
+            other.mFile = -1;
+#endif
+        }
+        return *this;
+    }
+
+    bool MemoryMappedFile::Open(const Path& path) {
+        Close();
+
+#ifdef _WIN32
+        mFile = ::CreateFileA(path.CStr(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+                              nullptr);
+        if (mFile == INVALID_HANDLE_VALUE) { return false; }
+
+        LARGE_INTEGER fileSize {};
+        if (!::GetFileSizeEx(mFile, &fileSize) || fileSize.QuadPart == 0) {
+            // Empty files can't be mapped
+            Close();
+            return false;
+        }
+
+        mMapping = ::CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mMapping) {
+            Close();
+            return false;
+        }
+
+        mData = CAST<const u8*>(::MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+        if (!mData) {
+            Close();
+            return false;
+        }
+        mSize = CAST<size_t>(fileSize.QuadPart);
+#else
+        mFile = ::open(path.CStr(), O_RDONLY);
+        if (mFile < 0) { return false; }
+
+        struct stat info {};
+        if (::fstat(mFile, &info) != 0 || info.st_size == 0) {
+            Close();
+            return false;
+        }
+
+        void* mapping = ::mmap(nullptr, CAST<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, mFile, 0);
+        if (mapping == MAP_FAILED) {
+            Close();
+            return false;
+        }
+        mData = CAST<const u8*>(mapping);
+        mSize = CAST<size_t>(info.st_size);
+#endif
+
+        return true;
+    }
+
+    void MemoryMappedFile::Close() {
+#ifdef _WIN32
+        if (mData) { ::UnmapViewOfFile(mData); }
+        if (mMapping) { ::CloseHandle(mMapping); }
+        if (mFile != INVALID_HANDLE_VALUE) { ::CloseHandle(mFile); }
+        mMapping = nullptr;
+        mFile    = INVALID_HANDLE_VALUE;
+#else
+        if (mData) { ::munmap(CCAST<u8*>(mData), mSize); }
+        if (mFile >= 0) { ::close(mFile); }
+        mFile = -1;
+#endif
+        mData = nullptr;
+        mSize = 0;
+    }
+
+    bool MemoryMappedFile::IsOpen() const {
+        return mData != nullptr;
+    }
+
+    size_t MemoryMappedFile::Size() const {
+        return mSize;
+    }
+
+    const u8* MemoryMappedFile::Data() const {
+        return mData;
+    }
+
+    std::span<const u8> MemoryMappedFile::Bytes() const {
+        return {mData, mSize};
+    }
+#pragma endregion
+
 #pragma region Path
     Path Path::Current() {
         char buffer[MAX_PATH];
@@ -39,6 +39,9 @@ namespace x {
         static std::vector<str> ReadLines(const Path& path);
         static std::vector<u8> ReadBlock(const Path& path, size_t size, u64 offset = 0);
         static size_t QueryFileSize(const Path& path);
+        /// @brief Last write time in the platform's native units (100ns ticks on Windows, nanoseconds elsewhere), only
+        /// meant to be compared against other values from this function. 0 if the file doesn't exist.
+        static u64 QueryModifiedTime(const Path& path);
     };
 
     class FileWriter {
@@ -125,6 +128,7 @@ namespace x {
 
         bool Write(const std::vector<u8>& buffer);
         bool Write(const std::vector<u8>& buffer, size_t size);
+        bool Write(std::span<const u8> buffer);
         bool WriteLine(const str& line);
         bool Flush();
 
@@ -137,6 +141,39 @@ namespace x {
         std::ofstream mStream;
     };
 
+    /// @brief Read-only view of an entire file mapped into the address space. Pages are faulted in by the OS on first
+    /// access, so reading many small blocks from a large file doesn't require any open/seek/read calls.
+    class MemoryMappedFile {
+    public:
+        MemoryMappedFile() = default;
+        explicit MemoryMappedFile(const Path& path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&)            = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        bool Open(const Path& path);
+        void Close();
+
+        X_NODISCARD bool IsOpen() const;
+        X_NODISCARD size_t Size() const;
+        X_NODISCARD const u8* Data() const;
+        X_NODISCARD std::span<const u8> Bytes() const;
+
+    private:
+        const u8* mData = nullptr;
+        size_t mSize    = 0;
+#ifdef _WIN32
+        HANDLE mFile    = INVALID_HANDLE_VALUE;
+        HANDLE mMapping = nullptr;
+#else
+        int mFile = -1;
+#endif
+    };
+
     class DirectoryIterator;
     class DirectoryEntries;
 
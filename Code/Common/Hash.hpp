@@ -0,0 +1,40 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Typedefs.hpp"
+#include <span>
+#include <string_view>
+
+namespace x {
+    static constexpr u64 kFnv1aOffsetBasis = 14695981039346656037ULL;
+    static constexpr u64 kFnv1aPrime       = 1099511628211ULL;
+
+    /// @brief 64-bit FNV-1a. Not cryptographic, but fast and stable across runs and platforms, so it's safe to persist.
+    /// Pass a previous result as `seed` to hash several buffers as one.
+    constexpr u64 HashFnv1a64(std::span<const u8> data, u64 seed = kFnv1aOffsetBasis) {
+        u64 hash = seed;
+        for (const u8 byte : data) {
+            hash ^= byte;
+            hash *= kFnv1aPrime;
+        }
+        return hash;
+    }
+
+    constexpr u64 HashFnv1a64(std::string_view text, u64 seed = kFnv1aOffsetBasis) {
+        u64 hash = seed;
+        for (const char c : text) {
+            hash ^= CAST<u8>(c);
+            hash *= kFnv1aPrime;
+        }
+        return hash;
+    }
+
+    /// @brief Mixes a trivially copyable value (sizes, enums, version numbers) into an existing hash.
+    template<typename T>
+    u64 HashCombine(u64 seed, const T& value) {
+        return HashFnv1a64(std::span(RCAST<const u8*>(&value), sizeof(T)), seed);
+    }
+}  // namespace x
@@ -0,0 +1,131 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Typedefs.hpp"
+#include "Macros.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace x {
+    /// @brief Returns the number of worker threads to use when the caller doesn't ask for a specific count.
+    inline u32 DefaultJobCount() {
+        const u32 cores = std::thread::hardware_concurrency();
+        return cores > 0 ? cores : 1;
+    }
+
+    /// @brief Calls func(i) for every i in [0, count) across up to `jobs` threads (0 = one per core). Indices are
+    /// handed out dynamically so a few slow items don't stall a whole thread's share of the work. Blocks until every
+    /// index has been processed; func must be safe to call concurrently for different indices.
+    template<typename Func>
+    void ParallelFor(size_t count, u32 jobs, Func&& func) {
+        if (count == 0) { return; }
+        if (jobs == 0) { jobs = DefaultJobCount(); }
+        jobs = CAST<u32>(X_MIN(CAST<size_t>(jobs), count));
+
+        if (jobs == 1) {
+            for (size_t i = 0; i < count; ++i) {
+                func(i);
+            }
+            return;
+        }
+
+        std::atomic<size_t> next {0};
+        auto worker = [&]() {
+            for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                func(i);
+            }
+        };
+
+        vector<std::thread> threads;
+        threads.reserve(jobs - 1);
+        for (u32 i = 0; i < jobs - 1; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();  // calling thread does its share too
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /// @brief Calls produce(i) for every i in [0, count) on up to `jobs` worker threads (0 = one per core), and
+    /// consume(i) on the calling thread in index order as soon as each one is produced. Workers keep pulling indices
+    /// rather than waiting on each other, so a slow item only holds up consumption; they stop at most `window` indices
+    /// ahead of it, which bounds how many produced items are waiting at once. Returns false as soon as consume does,
+    /// without producing anything else. produce must be safe to call concurrently for different indices.
+    template<typename Produce, typename Consume>
+    bool ParallelForOrdered(size_t count, u32 jobs, size_t window, Produce&& produce, Consume&& consume) {
+        if (count == 0) { return true; }
+        if (jobs == 0) { jobs = DefaultJobCount(); }
+        jobs   = CAST<u32>(X_MIN(CAST<size_t>(jobs), count));
+        window = X_MAX(window, CAST<size_t>(jobs));
+
+        if (jobs == 1) {
+            for (size_t i = 0; i < count; ++i) {
+                produce(i);
+                if (!consume(i)) { return false; }
+            }
+            return true;
+        }
+
+        std::mutex mutex;
+        std::condition_variable produced;  // An index is done
+        std::condition_variable consumed;  // The window moved, or it's stopping
+        vector<u8> done(count, 0);
+        size_t next {0};
+        size_t consumedCount {0};
+        bool stopping {false};
+
+        auto worker = [&]() {
+            for (;;) {
+                size_t i;
+                {
+                    std::unique_lock lock(mutex);
+                    consumed.wait(lock, [&]() { return stopping || next >= count || next < consumedCount + window; });
+                    if (stopping || next >= count) { return; }
+                    i = next++;
+                }
+
+                produce(i);
+                {
+                    std::lock_guard lock(mutex);
+                    done[i] = 1;
+                }
+                produced.notify_one();  // Only the calling thread waits on it
+            }
+        };
+
+        // The calling thread only consumes, which is usually I/O, so every job gets a thread of its own
+        vector<std::thread> threads;
+        threads.reserve(jobs);
+        for (u32 i = 0; i < jobs; ++i) {
+            threads.emplace_back(worker);
+        }
+
+        bool completed {true};
+        for (size_t i = 0; i < count && completed; ++i) {
+            {
+                std::unique_lock lock(mutex);
+                produced.wait(lock, [&]() { return done[i] != 0; });
+            }
+
+            completed = consume(i);
+            {
+                std::lock_guard lock(mutex);
+                consumedCount = i + 1;
+                stopping      = !completed;
+            }
+            consumed.notify_all();
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return completed;
+    }
+}  // namespace x
@@ -3,23 +3,50 @@
 //
 
 #include "AssetManager.hpp"
+#include <future>
+#include <limits>
+#include <numeric>
 #include <ranges>
 
 #ifndef X_USE_PAK_FILE
-    #include "Tools/XPak/ScriptCompiler.hpp"
+    #include "MaterialParser.hpp"
+    #include "Tools/XPak/TextureBaker.hpp"
 #endif
 
 namespace x {
+#ifndef X_USE_PAK_FILE
+    // Scripts, meshes and PNG/TGA textures are compiled/baked on load, the same way xpakc does it, so the loaders
+    // only ever see one format
+    static bool IsBakedOnLoad(AssetType type, const Path& source) {
+        return type == kAssetType_Script || type == kAssetType_Mesh ||
+               (type == kAssetType_Texture && TextureBaker::IsSourceImage(source.Extension()));
+    }
+
+    // Textures are only ever baked on the prefetcher's and the resource manager's workers, which already run several
+    // at once, so a single texture doesn't fan out over more threads. Normal maps are baked as such, like xpakc does.
+    static TextureBakeOptions GetTextureBakeOptions(bool normalMap) {
+        TextureBakeOptions options;
+        options.mNormalMap = normalMap;
+        options.mJobs      = 1;
+        return options;
+    }
+#endif
+
     optional<vector<u8>> AssetManager::GetAssetData(AssetId id) {
         if (!mLoaded) {
             X_LOG_ERROR("AssetManager::GetAssetData - Not Loaded");
             return std::nullopt;
         }
 
+        RecordAccess(id);
+
+        if (const auto future = mPrefetcher.Find(id)) {
+            if (const auto buffer = future->get()) { return *buffer; }
+        }
+
 #ifdef X_USE_PAK_FILE
-        if (auto it = mAssets.find(id); it != mAssets.end()) {
-            const auto& [id, asset] = *it;
-            auto assetData          = XPak::FetchAssetData(Path(X_PAK_FILE), asset);
+        if (const auto asset = mPaks.Find(id)) {
+            auto assetData = asset->mMount->FetchAssetData(asset->mEntry);
             return assetData;
         } else {
             X_LOG_ERROR("AssetManager::GetAssetData - Not Found");
@@ -33,10 +60,19 @@ namespace x {
 
             const auto type = AssetDescriptor::GetTypeFromId(id);
             if (type == kAssetType_Script) {
-                // Compile bytecode and return that
-                const auto scriptSource = FileReader::ReadText(fullPath);
-                vector<u8> bytecode     = ScriptCompiler::Compile(scriptSource, fullPath.Str());
-                return bytecode;
+                // Compile bytecode (or take it from the cache if the script hasn't changed) and return that
+                return mScripts.CompileFile(fullPath);
+            }
+
+            if (type == kAssetType_Mesh) {
+                // Baked the same way xpakc does it (or taken from the cache if the mesh hasn't changed), so the
+                // loaders only ever see one format
+                return mBakes.BakeMesh(FileReader::ReadBytes(fullPath), fullPath.Extension());
+            }
+
+            if (type == kAssetType_Texture && IsBakedOnLoad(type, fullPath)) {
+                return mBakes.BakeTexture(FileReader::ReadBytes(fullPath),
+                                          GetTextureBakeOptions(mNormalMaps.contains(id)));
             }
 
             return FileReader::ReadBytes(fullPath);
@@ -47,6 +83,111 @@ namespace x {
 #endif
     }
 
+    vector<AssetFuture> AssetManager::PrefetchAssets(std::span<const AssetId> ids) {
+        if (!mLoaded) {
+            X_LOG_ERROR("AssetManager::PrefetchAssets - Not Loaded");
+            std::promise<AssetBuffer> failed;
+            failed.set_value(nullptr);
+            return vector<AssetFuture>(ids.size(), failed.get_future().share());
+        }
+
+#ifdef X_USE_PAK_FILE
+        // Sorted by pak first and offset within it, so each pak in the stack is swept through once
+        vector<std::pair<u32, u64>> locations(ids.size());
+        for (size_t i = 0; i < ids.size(); ++i) {
+            const auto asset = mPaks.Find(ids[i]);
+            locations[i]     = asset.has_value() ? std::pair {asset->mLayer, asset->mEntry.mOffset}
+                                                 : std::pair {std::numeric_limits<u32>::max(), u64 {0}};
+        }
+
+        vector<size_t> order(ids.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(order, {}, [&locations](size_t i) { return locations[i]; });
+
+        vector<AssetId> sorted;
+        sorted.reserve(ids.size());
+        for (const auto i : order) {
+            sorted.push_back(ids[i]);
+        }
+
+        // Hand the futures back in the order they were asked for
+        auto sortedFutures = mPrefetcher.Prefetch(sorted);
+        vector<AssetFuture> futures(ids.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            futures[order[i]] = std::move(sortedFutures[i]);
+        }
+        return futures;
+#else
+        return mPrefetcher.Prefetch(ids);
+#endif
+    }
+
+    vector<AssetId> AssetManager::GetDependencies(AssetId id) {
+        if (!mLoaded) {
+            X_LOG_ERROR("AssetManager::GetDependencies - Not Loaded");
+            return {};
+        }
+
+#ifdef X_USE_PAK_FILE
+        if (const auto asset = mPaks.Find(id)) { return asset->mMount->GetDependencies(asset->mEntry); }
+#endif
+        return {};
+    }
+
+    std::span<const u8> AssetManager::GetAssetView(AssetId id) {
+        if (!mLoaded) {
+            X_LOG_ERROR("AssetManager::GetAssetView - Not Loaded");
+            return {};
+        }
+
+        RecordAccess(id);
+
+#ifdef X_USE_PAK_FILE
+        if (const auto asset = mPaks.Find(id)) { return asset->mMount->GetAssetView(asset->mEntry); }
+#endif
+        return {};
+    }
+
+    optional<vector<u8>> AssetManager::GetAssetDataRange(AssetId id, u64 offset, u64 size) {
+        if (!mLoaded) {
+            X_LOG_ERROR("AssetManager::GetAssetDataRange - Not Loaded");
+            return std::nullopt;
+        }
+
+        RecordAccess(id);
+
+#ifdef X_USE_PAK_FILE
+        if (const auto asset = mPaks.Find(id)) {
+            if (offset > asset->mEntry.mSize || size > asset->mEntry.mSize - offset) {
+                X_LOG_ERROR("AssetManager::GetAssetDataRange - Range out of bounds");
+                return std::nullopt;
+            }
+            return asset->mMount->FetchAssetRange(asset->mEntry, offset, size);
+        }
+#else
+        if (auto it = mAssets.find(id); it != mAssets.end()) {
+            // A byte range of the source file wouldn't mean anything for assets that are compiled/baked on load
+            const auto type     = AssetDescriptor::GetTypeFromId(id);
+            const auto fullPath = mWorkingDirectory / "Content" / it->second.Str();
+            if (!IsBakedOnLoad(type, fullPath)) {
+                auto data = FileReader::ReadBlock(fullPath, size, offset);
+                if (data.size() == size) { return data; }
+                X_LOG_ERROR("AssetManager::GetAssetDataRange - Range out of bounds");
+                return std::nullopt;
+            }
+
+            auto data = GetAssetData(id);
+            if (!data.has_value() || offset > data->size() || size > data->size() - offset) {
+                X_LOG_ERROR("AssetManager::GetAssetDataRange - Range out of bounds");
+                return std::nullopt;
+            }
+            return vector<u8>(data->begin() + offset, data->begin() + offset + size);
+        }
+#endif
+        X_LOG_ERROR("AssetManager::GetAssetDataRange - Not Found");
+        return std::nullopt;
+    }
+
     vector<AssetDescriptor> AssetManager::GetAssetDescriptors() {
         vector<AssetDescriptor> assetDescriptors;
 #ifdef X_USE_PAK_FILE
@@ -59,11 +200,70 @@ namespace x {
         return assetDescriptors;
     }
 
+    bool AssetManager::MountPak(const Path& pakFile, i32 priority) {
+#ifdef X_USE_PAK_FILE
+        // Cached and in-flight data may come from entries the new pak overrides
+        mPrefetcher.Clear();
+        if (!mPaks.Mount(pakFile, priority)) {
+            X_LOG_ERROR("AssetManager::MountPak - Failed to mount '%s'", pakFile.CStr());
+            return false;
+        }
+        return true;
+#else
+        X_LOG_ERROR("AssetManager::MountPak - Not available when not using pak files");
+        return false;
+#endif
+    }
+
     void AssetManager::ReloadAssets() {
+        // Anything in flight still reads from the old pak/content directory, so it has to finish first
+        mPrefetcher.Clear();
+#ifdef X_USE_PAK_FILE
+        mPaks.UnmountAll();
+#else
         mAssets.clear();
+        mNormalMaps.clear();
+#endif
         LoadAssets(mWorkingDirectory);
     }
 
+    void AssetManager::BeginAccessTrace() {
+        std::lock_guard lock(mTraceMutex);
+        mTrace.clear();
+        mTrace.emplace_back("# Asset access trace, see xpakc pack --layout-trace");
+        mTracing = true;
+    }
+
+    bool AssetManager::EndAccessTrace(const Path& filename) {
+        std::lock_guard lock(mTraceMutex);
+        if (!mTracing) {
+            X_LOG_ERROR("AssetManager::EndAccessTrace - Not tracing");
+            return false;
+        }
+        mTracing = false;
+
+        if (!FileWriter::WriteLines(filename, mTrace)) {
+            X_LOG_ERROR("AssetManager::EndAccessTrace - Failed to write '%s'", filename.CStr());
+            return false;
+        }
+
+        X_LOG_INFO("AssetManager::EndAccessTrace - Wrote %zu line(s) to '%s'", mTrace.size(), filename.CStr());
+        mTrace.clear();
+        return true;
+    }
+
+    void AssetManager::MarkAccessTrace(const str& label) {
+        if (!mTracing) { return; }
+        std::lock_guard lock(mTraceMutex);
+        if (mTracing) { mTrace.push_back("# " + label); }
+    }
+
+    void AssetManager::RecordAccess(AssetId id) {
+        if (!mTracing) { return; }
+        std::lock_guard lock(mTraceMutex);
+        if (mTracing) { mTrace.push_back(std::to_string(id)); }
+    }
+
     bool AssetManager::LoadAssets(const Path& workingDir) {
         mWorkingDirectory = workingDir;
 #ifdef X_USE_PAK_FILE
@@ -73,7 +273,35 @@ namespace x {
             return false;
         }
 
-        mAssets = XPak::ReadPakTable(pakFile);
+    #ifdef X_PAK_NO_VERIFY
+        mPaks.SetVerifyChecksums(false);
+    #endif
+
+        // Map the pak once; the table and all asset data are read straight out of the mapping from here on
+        if (!mPaks.Mount(pakFile, 0)) {
+            X_LOG_ERROR("AssetManager::LoadAssets - Failed to mount pak file");
+            return false;
+        }
+
+    #ifdef X_PAK_PATCH_DIR
+        // Patches (see `xpakc diff`) are stacked over the base pak in filename order, later ones win
+        const auto patchDir = Path(X_PAK_PATCH_DIR);
+        if (patchDir.Exists()) {
+            vector<Path> patches;
+            for (const Path& file : patchDir.Entries()) {
+                if (file.IsFile() && file.HasExtension() && file.Extension() == "xpak") { patches.push_back(file); }
+            }
+            std::ranges::sort(patches, {}, &Path::Str);
+
+            for (size_t i = 0; i < patches.size(); ++i) {
+                if (!mPaks.Mount(patches[i], CAST<i32>(i + 1))) {
+                    X_LOG_ERROR("AssetManager::LoadAssets - Failed to mount patch '%s'", patches[i].CStr());
+                    continue;
+                }
+                X_LOG_INFO("Mounted patch '%s'", patches[i].CStr());
+            }
+        }
+    #endif
 #else
         const auto contentDir = workingDir / "Content";
         if (!contentDir.Exists()) {
@@ -93,6 +321,39 @@ namespace x {
                 X_LOG_INFO("Loaded asset '%s'", descriptor.mFilename.c_str());
             }
         }
+
+        // Textures bound to a material's normal slot are baked as normal maps, the same classification xpakc makes
+        for (const auto& [id, assetFile] : mAssets) {
+            if (AssetDescriptor::GetTypeFromId(id) != kAssetType_Material) { continue; }
+            MaterialDescriptor material;
+            if (!MaterialParser::Parse(contentDir / assetFile.Str(), material)) { continue; }
+            for (const auto& texture : material.mTextures) {
+                if (texture.mName == "normal") { mNormalMaps.insert(texture.mAssetId); }
+            }
+        }
+
+        // Compile every script up front, in parallel, so scene loads only ever hit the cache. After the first run this
+        // is a stat per script unless some have changed.
+        if (!mScripts.Open(workingDir / ".xpakcache")) {
+            X_LOG_WARN("AssetManager::LoadAssets - Failed to open script cache, compiled scripts won't be persisted");
+        }
+        if (!mBakes.Open(workingDir / ".xpakcache")) {
+            X_LOG_WARN("AssetManager::LoadAssets - Failed to open bake cache, baked assets won't be persisted");
+        }
+        vector<Path> scripts;
+        for (const auto& [id, assetFile] : mAssets) {
+            if (AssetDescriptor::GetTypeFromId(id) == kAssetType_Script) {
+                scripts.push_back(contentDir / assetFile.Str());
+            }
+        }
+        mScripts.ResetStats();
+        mScripts.CompileFiles(scripts);
+
+        const auto stats = mScripts.GetStats();
+        X_LOG_INFO("AssetManager::LoadAssets - Scripts: %u cached, %u compiled, %u failed",
+                   stats.mMemoryHits + stats.mDiskHits,
+                   stats.mCompiled,
+                   stats.mFailed);
 #endif
 
         mLoaded = true;
@@ -107,9 +368,80 @@ namespace x {
         }
 
         vector<AssetId> scenes;
+#ifdef X_USE_PAK_FILE
+        for (const auto& id : mPaks.GetEntries() | std::views::keys) {
+            if (AssetDescriptor::GetTypeFromId(id) == kAssetType_Scene) { scenes.emplace_back(id); }
+        }
+        std::ranges::sort(scenes);
+#else
         for (const auto& id : mAssets | std::views::keys) {
             if (AssetDescriptor::GetTypeFromId(id) == kAssetType_Scene) { scenes.emplace_back(id); }
         }
+#endif
         return scenes;
     }
+
+    optional<vector<u8>> AssetManager::ReadAssetBytes(AssetId id) {
+#ifdef X_USE_PAK_FILE
+        // Copying the stored payload out of the mapping is what faults it in from disk
+        const auto asset = mPaks.Find(id);
+        if (!asset.has_value()) { return std::nullopt; }
+
+        const auto bytes = asset->mMount->GetEntryBytes(asset->mEntry);
+        if (bytes.size() != asset->mEntry.mCompressedSize) { return std::nullopt; }
+        return vector<u8>(bytes.begin(), bytes.end());
+#else
+        const auto it = mAssets.find(id);
+        if (it == mAssets.end()) { return std::nullopt; }
+
+        const auto fullPath = mWorkingDirectory / "Content" / it->second.Str();
+        if (!fullPath.Exists()) { return std::nullopt; }
+        return FileReader::ReadBytes(fullPath);
+#endif
+    }
+
+    optional<vector<u8>> AssetManager::DecodeAssetBytes(AssetId id, vector<u8> bytes) {
+#ifdef X_USE_PAK_FILE
+        const auto asset = mPaks.Find(id);
+        if (!asset.has_value()) { return std::nullopt; }
+
+        // Stored as-is, the bytes read are already the asset's data once they've been checked
+        const auto& entry = asset->mEntry;
+        if (!CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Compressed)) {
+            if (!asset->mMount->VerifyOnce(entry, bytes)) { return std::nullopt; }
+            return bytes;
+        }
+
+        // Several assets are decoded at once already, so chunked entries don't fan out over more threads
+        auto data = asset->mMount->DecodeAssetData(entry, bytes, 1);
+        if (data.size() != entry.mSize) { return std::nullopt; }
+        return data;
+#else
+        const auto type = AssetDescriptor::GetTypeFromId(id);
+        const auto it   = mAssets.find(id);
+        if (it == mAssets.end()) { return std::nullopt; }
+
+        const auto fullPath = mWorkingDirectory / "Content" / it->second.Str();
+        if (IsBakedOnLoad(type, fullPath)) {
+            if (type == kAssetType_Mesh) { return mBakes.BakeMesh(bytes, fullPath.Extension()); }
+            if (type == kAssetType_Texture) {
+                return mBakes.BakeTexture(bytes, GetTextureBakeOptions(mNormalMaps.contains(id)));
+            }
+
+            // Compile bytecode (or take it from the cache if the script hasn't changed) and return that
+            return mScripts.Compile(bytes, fullPath.Str());
+        }
+
+        return bytes;
+#endif
+    }
+
+    AssetId AssetManager::ResolvePayload(AssetId id) {
+#ifdef X_USE_PAK_FILE
+        // Assets xpakc deduplicated share a payload, they're loaded and cached once under the same ID
+        return mPaks.GetPayloadId(id);
+#else
+        return id;
+#endif
+    }
 }  // namespace x
\ No newline at end of file
@@ -6,15 +6,25 @@
 
 #include "EngineCommon.hpp"
 #include "Common/Typedefs.hpp"
+#include "AssetPrefetcher.hpp"
 #include "Tools/XPak/AssetDescriptor.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
 #ifdef X_USE_PAK_FILE
     #ifndef X_PAK_FILE
         #error "X_USE_PAK_FILE is defined, but X_PAK_FILE is not. You nust define the pak file to use."
     #endif
 
+    // Define X_PAK_NO_VERIFY (VERIFY_PAK_FILE=OFF) to skip checksum verification, e.g. for shipping builds
+
     #include "Tools/XPak/XPak.hpp"
+    #include "Tools/XPak/XPakMountStack.hpp"
 #else
+    #include "Tools/XPak/ScriptCache.hpp"
+    #include "Tools/XPak/BakeCache.hpp"
 #endif
 
 namespace x {
@@ -26,21 +36,89 @@ namespace x {
         AssetManager() = default;
 
     public:
+        /// @brief Returns the asset's data, decoded. Assets that were prefetched are taken from the prefetch cache (or
+        /// waited on if they're still in flight) instead of being loaded again.
         static optional<vector<u8>> GetAssetData(AssetId id);
+
+        /// @brief Starts loading the given assets in the background and returns a future for each, in the same order.
+        /// A future resolves to null if its asset couldn't be loaded. See AssetPrefetcher.
+        ///
+        /// When using a pak file the reads are issued in the order the assets are laid out in it, so a batch is read
+        /// front to back in a single pass regardless of the order it was requested in.
+        static vector<AssetFuture> PrefetchAssets(std::span<const AssetId> ids);
+
+        /// @brief Returns every asset the given one needs in order to be loaded, as resolved when the pak was built.
+        /// For a scene that's its meshes, materials and scripts along with the materials' textures. Always empty when
+        /// not using a pak file.
+        static vector<AssetId> GetDependencies(AssetId id);
+
+        /// @brief Returns a view of the asset's bytes straight from the mounted pak file, without copying.
+        ///
+        /// Only uncompressed (streamable) pak entries can be viewed like this. An empty span is returned for
+        /// compressed entries and when not using a pak file, in which case callers should fall back to GetAssetData.
+        /// Views are invalidated by ReloadAssets.
+        static std::span<const u8> GetAssetView(AssetId id);
+
+        /// @brief Returns `size` bytes of the asset's data starting at `offset`. For chunked pak entries only the
+        /// frames covering the range are decompressed.
+        static optional<vector<u8>> GetAssetDataRange(AssetId id, u64 offset, u64 size);
         static vector<AssetDescriptor> GetAssetDescriptors();
+
+        /// @brief Not safe while anything else is reading assets. Prefetches are drained here, but a ResourceManager's
+        /// loads have to be cancelled first (see ResourceManager::CancelLoads and Game::ReloadAssets).
         static void ReloadAssets();
 
+        /// @brief Mounts another pak over the ones already loaded, e.g. a patch or DLC pak. Its entries override those
+        /// with the same ID in paks of lower (or equal, since it's mounted later) priority. The base pak is mounted at
+        /// priority 0 and patches found in X_PAK_PATCH_DIR above it. Only available when using a pak file.
+        ///
+        /// Call on the main thread. Loads already running on other threads (prefetches, resource manager workers) can
+        /// carry on: each lookup sees either the old set of paks or the new one, see XPakMountStack. The prefetch
+        /// cache is dropped, since it may hold data the new pak overrides.
+        static bool MountPak(const Path& pakFile, i32 priority);
+
+        /// @brief Starts recording every asset fetched through GetAssetData, GetAssetView and GetAssetDataRange, in the
+        /// order they're fetched. Pass the written trace to `xpakc pack --layout-trace` to lay the pak out in load
+        /// order.
+        static void BeginAccessTrace();
+
+        /// @brief Stops recording and writes the trace to `filename`, one asset ID per line.
+        static bool EndAccessTrace(const Path& filename);
+
+        /// @brief Adds a comment to the trace, e.g. the scene about to be loaded. Does nothing when not tracing.
+        static void MarkAccessTrace(const str& label);
+
     private:
         inline static bool mLoaded {false};
         static bool LoadAssets(const Path& workingDir = Path::Current());
         static vector<AssetId> GetScenes();
 
+        // The two halves of loading an asset, split so the prefetcher can run them on different threads
+        static optional<vector<u8>> ReadAssetBytes(AssetId id);
+        static optional<vector<u8>> DecodeAssetBytes(AssetId id, vector<u8> bytes);
+        static AssetId ResolvePayload(AssetId id);
+
+        static void RecordAccess(AssetId id);
+
         inline static Path mWorkingDirectory;
+        inline static AssetPrefetcher mPrefetcher {&ReadAssetBytes, &DecodeAssetBytes, &ResolvePayload};
+
+        inline static std::atomic<bool> mTracing {false};
+        inline static std::mutex mTraceMutex;
+        inline static vector<str> mTrace;
 
 #ifdef X_USE_PAK_FILE
-        inline static AssetTable mAssets;
+        // The base pak and any patches mounted over it, looked up through the stack's merged index
+        inline static XPakMountStack mPaks;
 #else
         inline static unordered_map<AssetId, Path> mAssets;
+        // Scripts are compiled from source on load, this keeps unchanged ones from being compiled again across reloads
+        // and runs (stored next to the project, in the same .xpakcache directory xpakc uses)
+        inline static ScriptCache mScripts;
+        // Same for meshes and PNG/TGA textures, which are baked on load
+        inline static BakeCache mBakes;
+        // Textures some material uses as its normal map, found when the assets are loaded
+        inline static std::unordered_set<AssetId> mNormalMaps;
 #endif
     };
 }  // namespace x
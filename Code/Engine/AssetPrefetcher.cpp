@@ -0,0 +1,207 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "AssetPrefetcher.hpp"
+#include "Common/Parallel.hpp"
+
+#include <exception>
+
+namespace x {
+    AssetPrefetcher::AssetPrefetcher(ReadFunc read, DecodeFunc decode, ResolveFunc resolve, size_t budget, u32 workers)
+        : mRead(std::move(read)), mDecode(std::move(decode)), mResolve(std::move(resolve)), mBudget(budget),
+          mWorkerCount(workers == 0 ? X_MAX(DefaultJobCount() / 2, 1u) : workers) {}
+
+    AssetPrefetcher::~AssetPrefetcher() {
+        {
+            std::lock_guard lock(mMutex);
+            mStopping = true;
+        }
+        mReadReady.notify_all();
+        mDecodeReady.notify_all();
+
+        if (mIOThread.joinable()) { mIOThread.join(); }
+        for (auto& worker : mWorkers) {
+            worker.join();
+        }
+    }
+
+    AssetFuture AssetPrefetcher::Prefetch(AssetId id) {
+        AssetFuture future;
+        {
+            std::lock_guard lock(mMutex);
+            future = PrefetchLocked(id);
+        }
+        mReadReady.notify_one();
+        return future;
+    }
+
+    vector<AssetFuture> AssetPrefetcher::Prefetch(std::span<const AssetId> ids) {
+        vector<AssetFuture> futures;
+        futures.reserve(ids.size());
+        {
+            std::lock_guard lock(mMutex);
+            for (const auto id : ids) {
+                futures.push_back(PrefetchLocked(id));
+            }
+        }
+        mReadReady.notify_one();
+        return futures;
+    }
+
+    optional<AssetFuture> AssetPrefetcher::Find(AssetId id) {
+        id = Resolve(id);
+        std::lock_guard lock(mMutex);
+        if (const auto it = mCache.find(id); it != mCache.end()) {
+            mRecent.splice(mRecent.begin(), mRecent, it->second.mRecent);
+            return it->second.mFuture;
+        }
+        if (const auto it = mInFlight.find(id); it != mInFlight.end()) { return it->second.mFuture; }
+        return std::nullopt;
+    }
+
+    void AssetPrefetcher::Clear() {
+        vector<std::promise<AssetBuffer>> cancelled;
+        {
+            std::unique_lock lock(mMutex);
+            for (const auto id : mReadQueue) {
+                auto it = mInFlight.find(id);
+                cancelled.push_back(std::move(it->second.mPromise));
+                mInFlight.erase(it);
+            }
+            mReadQueue.clear();
+
+            // Reads and decodes that already started still depend on the asset source, so let them finish
+            mIdle.wait(lock, [this]() { return mInFlight.empty(); });
+
+            mCache.clear();
+            mRecent.clear();
+            mCachedBytes = 0;
+        }
+
+        for (auto& promise : cancelled) {
+            promise.set_value(nullptr);
+        }
+    }
+
+    size_t AssetPrefetcher::GetCachedBytes() const {
+        std::lock_guard lock(mMutex);
+        return mCachedBytes;
+    }
+
+    AssetId AssetPrefetcher::Resolve(AssetId id) const {
+        return mResolve ? mResolve(id) : id;
+    }
+
+    AssetFuture AssetPrefetcher::PrefetchLocked(AssetId id) {
+        id = Resolve(id);
+        if (const auto it = mCache.find(id); it != mCache.end()) {
+            mRecent.splice(mRecent.begin(), mRecent, it->second.mRecent);
+            return it->second.mFuture;
+        }
+        if (const auto it = mInFlight.find(id); it != mInFlight.end()) { return it->second.mFuture; }
+
+        StartLocked();
+
+        auto& request   = mInFlight[id];
+        request.mFuture = request.mPromise.get_future().share();
+        mReadQueue.push_back(id);
+        return request.mFuture;
+    }
+
+    void AssetPrefetcher::StartLocked() {
+        if (mIOThread.joinable()) { return; }
+
+        mIOThread = std::thread([this]() { IOThread(); });
+        mWorkers.reserve(mWorkerCount);
+        for (u32 i = 0; i < mWorkerCount; ++i) {
+            mWorkers.emplace_back([this]() { WorkerThread(); });
+        }
+    }
+
+    void AssetPrefetcher::IOThread() {
+        for (;;) {
+            AssetId id;
+            {
+                std::unique_lock lock(mMutex);
+                mReadReady.wait(lock, [this]() { return mStopping || !mReadQueue.empty(); });
+                if (mStopping) { return; }
+                id = mReadQueue.front();
+                mReadQueue.pop_front();
+            }
+
+            // A throw would terminate the process and leave the asset's future unset, so it fails like a missing asset
+            optional<vector<u8>> bytes;
+            try {
+                bytes = mRead(id);
+            } catch (const std::exception& e) {
+                X_LOG_ERROR("Failed to read asset %llu: %s", id, e.what());
+            }
+            if (!bytes.has_value()) {
+                Complete(id, nullptr);
+                continue;
+            }
+
+            {
+                std::lock_guard lock(mMutex);
+                mDecodeQueue.emplace_back(id, std::move(*bytes));
+            }
+            mDecodeReady.notify_one();
+        }
+    }
+
+    void AssetPrefetcher::WorkerThread() {
+        for (;;) {
+            std::pair<AssetId, vector<u8>> job;
+            {
+                std::unique_lock lock(mMutex);
+                mDecodeReady.wait(lock, [this]() { return mStopping || !mDecodeQueue.empty(); });
+                if (mStopping) { return; }
+                job = std::move(mDecodeQueue.front());
+                mDecodeQueue.pop_front();
+            }
+
+            optional<vector<u8>> data;
+            try {
+                data = mDecode(job.first, std::move(job.second));
+            } catch (const std::exception& e) {
+                X_LOG_ERROR("Failed to decode asset %llu: %s", job.first, e.what());
+            }
+            Complete(job.first, data.has_value() ? make_shared<const vector<u8>>(std::move(*data)) : nullptr);
+        }
+    }
+
+    void AssetPrefetcher::Complete(AssetId id, AssetBuffer buffer) {
+        std::promise<AssetBuffer> promise;
+        {
+            std::lock_guard lock(mMutex);
+            auto it = mInFlight.find(id);
+            if (it == mInFlight.end()) { return; }
+
+            // Cached before it leaves the in-flight list so Find never misses it in between. Failures aren't cached,
+            // the next request simply tries again.
+            if (buffer) { InsertLocked(id, it->second.mFuture, buffer->size()); }
+            promise = std::move(it->second.mPromise);
+            mInFlight.erase(it);
+        }
+
+        promise.set_value(std::move(buffer));
+        mIdle.notify_all();
+    }
+
+    void AssetPrefetcher::InsertLocked(AssetId id, const AssetFuture& future, size_t size) {
+        // Anything bigger than the whole budget is handed to its waiters without being cached
+        if (size > mBudget) { return; }
+
+        while (mCachedBytes + size > mBudget && !mRecent.empty()) {
+            const auto it = mCache.find(mRecent.back());
+            mCachedBytes -= it->second.mSize;
+            mCache.erase(it);
+            mRecent.pop_back();
+        }
+
+        mRecent.push_front(id);
+        mCache[id] = {future, size, mRecent.begin()};
+        mCachedBytes += size;
+    }
+}  // namespace x
@@ -0,0 +1,111 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "EngineCommon.hpp"
+#include "Common/Typedefs.hpp"
+#include "Tools/XPak/AssetDescriptor.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+
+namespace x {
+    /// @brief Decoded asset data shared between the prefetch cache and everyone waiting on it. Null if the asset
+    /// couldn't be loaded.
+    using AssetBuffer = std::shared_ptr<const vector<u8>>;
+    using AssetFuture = std::shared_future<AssetBuffer>;
+
+    /// @brief Loads assets in the background ahead of when they're needed.
+    ///
+    /// Reads are issued in request order from a dedicated I/O thread and handed to a pool of workers to be decoded
+    /// (decompressed, compiled, etc.), so reading one asset overlaps with decoding the ones before it. Requesting an
+    /// asset that's already in flight returns the same future instead of loading it twice. Finished buffers are kept
+    /// in a cache bounded by a byte budget, evicting the least recently used first.
+    class AssetPrefetcher {
+    public:
+        static constexpr size_t kDefaultBudget = X_MEGABYTES(64);
+
+        /// @brief Runs on the I/O thread and returns the asset's bytes as stored, or nullopt if it doesn't exist.
+        using ReadFunc = std::function<optional<vector<u8>>(AssetId id)>;
+        /// @brief Runs on a worker and turns the stored bytes into the asset's data. Must be safe to call concurrently.
+        using DecodeFunc = std::function<optional<vector<u8>>(AssetId id, vector<u8> bytes)>;
+        /// @brief Maps an ID to the one its data is loaded and cached under. Assets with identical data (see
+        /// XPakMountStack::GetPayloadId) resolve to the same ID, so they're read, decoded and cached once between them.
+        using ResolveFunc = std::function<AssetId(AssetId id)>;
+
+        /// @brief `workers` is the number of decode threads (0 = half the cores). No threads are started until the
+        /// first request. Without a `resolve` function every ID is loaded separately.
+        AssetPrefetcher(ReadFunc read,
+                        DecodeFunc decode,
+                        ResolveFunc resolve = nullptr,
+                        size_t budget       = kDefaultBudget,
+                        u32 workers         = 0);
+        ~AssetPrefetcher();
+
+        X_CLASS_PREVENT_MOVES_COPIES(AssetPrefetcher)
+
+        AssetFuture Prefetch(AssetId id);
+        vector<AssetFuture> Prefetch(std::span<const AssetId> ids);
+
+        /// @brief Returns the future for an asset that's cached or in flight, without requesting it.
+        optional<AssetFuture> Find(AssetId id);
+
+        /// @brief Cancels queued reads, waits for the ones already started to finish and empties the cache. Must be
+        /// called before the assets the read/decode functions depend on go away (e.g. unmounting the pak).
+        void Clear();
+
+        X_NODISCARD size_t GetCachedBytes() const;
+
+    private:
+        struct CacheEntry {
+            AssetFuture mFuture;
+            size_t mSize {0};
+            std::list<AssetId>::iterator mRecent;
+        };
+
+        struct InFlight {
+            std::promise<AssetBuffer> mPromise;
+            AssetFuture mFuture;
+        };
+
+        ReadFunc mRead;
+        DecodeFunc mDecode;
+        ResolveFunc mResolve;
+        size_t mBudget {0};
+        u32 mWorkerCount {0};
+
+        mutable std::mutex mMutex;
+        std::condition_variable mReadReady;
+        std::condition_variable mDecodeReady;
+        std::condition_variable mIdle;
+        bool mStopping {false};
+
+        std::deque<AssetId> mReadQueue;
+        std::deque<std::pair<AssetId, vector<u8>>> mDecodeQueue;
+        unordered_map<AssetId, InFlight> mInFlight;
+
+        unordered_map<AssetId, CacheEntry> mCache;
+        std::list<AssetId> mRecent;  // Most recently used first
+        size_t mCachedBytes {0};
+
+        std::thread mIOThread;
+        vector<std::thread> mWorkers;
+
+        AssetId Resolve(AssetId id) const;
+        AssetFuture PrefetchLocked(AssetId id);
+        void StartLocked();
+        void IOThread();
+        void WorkerThread();
+        void Complete(AssetId id, AssetBuffer buffer);
+        void InsertLocked(AssetId id, const AssetFuture& future, size_t size);
+    };
+}  // namespace x
@@ -0,0 +1,189 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Common/Typedefs.hpp"
+#include "EngineCommon.hpp"
+#include "MemoryTracker.hpp"
+#include "Resource.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <utility>
+
+namespace x {
+    class ResourceLoaderBase;
+
+    enum class ResourceState : u8 {
+        Pending,
+        Ready,
+        Failed,
+    };
+
+    /// @brief Whatever a loader produces off the main thread (fetched, decompressed and decoded data) for its finalize
+    /// stage to create GPU objects from. Loaders derive their own, see ResourceLoader.
+    class ResourceStaging {
+    public:
+        virtual ~ResourceStaging() = default;
+
+        /// @brief Bytes it holds, counted against MemoryTag::Loaders until it's destroyed.
+        X_NODISCARD virtual size_t GetSize() const {
+            return 0;
+        }
+
+        void TrackMemory() {
+            mMemory = MemoryAllocation(MemoryTag::Loaders, GetSize());
+        }
+
+    private:
+        MemoryAllocation mMemory;
+    };
+
+    /// @brief One asynchronous load, shared between the ResourceManager, its workers and every AsyncResource for it.
+    /// Apart from mStaging, which only the worker preparing it touches until it's handed back, everything here is only
+    /// read or written on the main thread.
+    struct ResourceLoadState {
+        u64 mId {0};
+        ResourceLoaderBase* mLoader {nullptr};
+        ResourceState mState {ResourceState::Pending};
+        bool mCancelled {false};
+        unique_ptr<ResourceStaging> mStaging;
+        ResourceRef mResource;  // Holds a reference, so nothing evicts it while anyone is waiting
+        vector<std::function<void()>> mWaiters;
+    };
+
+    /// @brief Base for the awaiters below. Lives in the coroutine frame while it's suspended, so it can tell the
+    /// waiters it registered that the coroutine was destroyed (e.g. a scene unloaded mid-load) and must not be resumed.
+    class ResourceAwaiter {
+    public:
+        ResourceAwaiter() = default;
+
+        ~ResourceAwaiter() {
+            *mAlive = false;
+        }
+
+        ResourceAwaiter(const ResourceAwaiter&)            = delete;
+        ResourceAwaiter& operator=(const ResourceAwaiter&) = delete;
+
+    protected:
+        shared_ptr<bool> mAlive {make_shared<bool>(true)};
+    };
+
+    /// @brief A set of asynchronous loads to wait on together. `co_await` resumes once every one of them is either
+    /// ready or has failed.
+    class AsyncResourceGroup {
+    public:
+        template<typename AsyncResourceT>
+        AsyncResourceGroup& Add(const AsyncResourceT& resource) {
+            if (resource.GetLoadState()) { mStates.push_back(resource.GetLoadState()); }
+            return *this;
+        }
+
+        X_NODISCARD bool IsDone() const {
+            for (const auto& state : mStates) {
+                if (state->mState == ResourceState::Pending) { return false; }
+            }
+            return true;
+        }
+
+        X_NODISCARD size_t GetFailedCount() const {
+            size_t failed {0};
+            for (const auto& state : mStates) {
+                if (state->mState == ResourceState::Failed) { failed++; }
+            }
+            return failed;
+        }
+
+        X_NODISCARD size_t Size() const {
+            return mStates.size();
+        }
+
+        auto operator co_await() const {
+            struct Awaiter : ResourceAwaiter {
+                const AsyncResourceGroup& mGroup;
+
+                explicit Awaiter(const AsyncResourceGroup& group) : mGroup(group) {}
+
+                bool await_ready() const {
+                    return mGroup.IsDone();
+                }
+
+                void await_suspend(std::coroutine_handle<> handle) const {
+                    // Loads finish on the main thread, so the count doesn't need to be atomic
+                    auto remaining = make_shared<size_t>(0);
+                    for (const auto& state : mGroup.mStates) {
+                        if (state->mState != ResourceState::Pending) { continue; }
+                        (*remaining)++;
+                        state->mWaiters.emplace_back([remaining, handle, alive = mAlive]() {
+                            if (*alive && --(*remaining) == 0) { handle.resume(); }
+                        });
+                    }
+                }
+
+                void await_resume() const {}
+            };
+            return Awaiter {*this};
+        }
+
+    private:
+        vector<shared_ptr<ResourceLoadState>> mStates;
+    };
+
+    /// @brief Return type for coroutines that `co_await` resources, e.g. Scene::LoadAsync. Starts running straight
+    /// away and is resumed from ResourceManager::Update as the resources it waits on finish, so it always runs on the
+    /// main thread. Destroying the task destroys the coroutine wherever it's suspended.
+    class LoadTask {
+    public:
+        struct promise_type {
+            LoadTask get_return_object() {
+                return LoadTask(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_never initial_suspend() noexcept {
+                return {};
+            }
+
+            // Kept around once finished, so IsDone can be checked
+            std::suspend_always final_suspend() noexcept {
+                return {};
+            }
+
+            void return_void() {}
+
+            void unhandled_exception() {
+                std::terminate();
+            }
+        };
+
+        LoadTask() = default;
+
+        ~LoadTask() {
+            if (mHandle) { mHandle.destroy(); }
+        }
+
+        LoadTask(const LoadTask&)            = delete;
+        LoadTask& operator=(const LoadTask&) = delete;
+
+        LoadTask(LoadTask&& other) noexcept : mHandle(std::exchange(other.mHandle, {})) {}
+
+        LoadTask& operator=(LoadTask&& other) noexcept {
+            if (this != &other) {
+                if (mHandle) { mHandle.destroy(); }
+                mHandle = std::exchange(other.mHandle, {});
+            }
+            return *this;
+        }
+
+        X_NODISCARD bool IsDone() const {
+            return !mHandle || mHandle.done();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> mHandle;
+
+        explicit LoadTask(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+    };
+}  // namespace x
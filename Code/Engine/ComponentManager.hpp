@@ -6,13 +6,25 @@
 
 #include "Common/Typedefs.hpp"
 #include "EntityId.hpp"
+#include "MemoryTracker.hpp"
 
 namespace x {
     template<typename T>
     class ComponentManager {
-        vector<T> mComponents;
-        unordered_map<EntityId, size_t> mEntityToIndex;
-        vector<EntityId> mIndexToEntity;
+        // Storage is counted against MemoryTag::Components
+        template<typename U>
+        using TrackedVector = vector<U, TrackingAllocator<U, MemoryTag::Components>>;
+
+        using IndexAllocator = TrackingAllocator<std::pair<const EntityId, size_t>, MemoryTag::Components>;
+        using IndexMap       = unordered_map<EntityId,
+                                             size_t,
+                                             std::hash<EntityId>,
+                                             std::equal_to<EntityId>,
+                                             IndexAllocator>;
+
+        TrackedVector<T> mComponents;
+        IndexMap mEntityToIndex;
+        TrackedVector<EntityId> mIndexToEntity;
 
     public:
         struct ComponentView {
@@ -42,12 +54,12 @@ namespace x {
         };
 
         class Iterator {
-            vector<T>& mComponents;
-            vector<EntityId>& mEntities;
+            TrackedVector<T>& mComponents;
+            TrackedVector<EntityId>& mEntities;
             size_t mIndex;
 
         public:
-            Iterator(vector<T>& components, vector<EntityId>& entities, size_t index)
+            Iterator(TrackedVector<T>& components, TrackedVector<EntityId>& entities, size_t index)
                 : mComponents(components), mEntities(entities), mIndex(index) {}
 
             ComponentView operator*() const {
@@ -73,12 +85,12 @@ namespace x {
         };
 
         class ConstIterator {
-            const vector<T>& mComponents;
-            const vector<EntityId>& mEntities;
+            const TrackedVector<T>& mComponents;
+            const TrackedVector<EntityId>& mEntities;
             size_t mIndex;
 
         public:
-            ConstIterator(const vector<T>& components, const vector<EntityId>& entities, size_t index)
+            ConstIterator(const TrackedVector<T>& components, const TrackedVector<EntityId>& entities, size_t index)
                 : mComponents(components), mEntities(entities), mIndex(index) {}
 
             ConstComponentView operator*() const {
@@ -198,7 +210,7 @@ namespace x {
             return EntityId {0};
         }
 
-        const vector<T>& GetRawComponents() const {
+        const TrackedVector<T>& GetRawComponents() const {
             return mComponents;
         }
     };
@@ -7,6 +7,7 @@
 #include <imgui.h>
 
 #include "AssetManager.hpp"
+#include "MemoryTracker.hpp"
 #include "ShaderManager.hpp"
 #include "StaticResources.hpp"
 
@@ -15,7 +16,14 @@ extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg
 namespace x {
     void Game::Update() {
         mClock.Tick();
-        if (!mIsPaused || !mIsFocused) { GetActiveScene()->Update(mClock.GetDeltaTime()); }
+        // A scene that's still loading is updated regardless, that's what moves the load along
+        if (!mIsPaused || !mIsFocused || GetActiveScene()->IsLoading()) {
+            GetActiveScene()->Update(mClock.GetDeltaTime());
+        }
+
+        // Lua allocates through its own allocator, so its heap is sampled instead of counted
+        MemoryTracker::Set(MemoryTag::Scripts, MemoryKind::Cpu, mScriptEngine.GetMemoryUsage());
+        MemoryTracker::EndFrame();
     }
 
     void Game::RenderDepthOnly(const SceneState& state) const {
@@ -33,9 +41,16 @@ namespace x {
         }
     }
 
+    void Game::ReloadAssets() {
+        // The resource manager's workers read through the AssetManager, which can't be swapped out under them. What
+        // it has cached may have been reimported, so it goes too (the active scene's handles keep theirs alive).
+        mResources.Clear();
+        AssetManager::ReloadAssets();
+    }
+
     void Game::ReloadSceneCache() {
         // Find and load all of our scene descriptors
-        AssetManager::ReloadAssets();
+        ReloadAssets();
         mScenes.clear();
         const auto sceneIds = AssetManager::GetScenes();
         for (const auto& scene : sceneIds) {
@@ -43,6 +58,7 @@ namespace x {
             if (!sceneData || sceneData->size() == 0) { X_LOG_FATAL("Failed to load scene data!"); }
             SceneDescriptor descriptor;
             SceneParser::Parse(*sceneData, descriptor);
+            descriptor.mAssetIds = AssetManager::GetDependencies(scene);
             mScenes[descriptor.mName] = descriptor;
         }
     }
@@ -62,6 +78,8 @@ namespace x {
     void Game::RenderFrame() const {
         if (!mIsFocused) return;
 
+        if (mActiveScene->IsLoading()) return;
+
         const auto& state = mActiveScene->GetState();
 
         {
@@ -152,7 +170,7 @@ namespace x {
         mVolatiles.push_back(vol);
     }
 
-    Game::Game(RenderContext& context) : mRenderContext(context) {
+    Game::Game(RenderContext& context) : mResources(context, kResourceCacheBudget), mRenderContext(context) {
         RegisterEventHandlers();
     }
 
@@ -178,13 +196,14 @@ namespace x {
 
         mIsInitialized = true;
 
-        mActiveScene = make_unique<Scene>(mRenderContext, mScriptEngine);
+        mActiveScene = make_unique<Scene>(mRenderContext, mScriptEngine, mResources);
         X_LOG_INFO("Initialization complete")
     }
 
     void Game::Shutdown() {
         mRenderSystem.reset();
         mActiveScene.reset();  // probably isn't even necessary
+        mResources.Clear();
         mWindow = nullptr;
     }
 
@@ -248,26 +267,79 @@ namespace x {
               if (args.size() < 1) { return; }
               const auto& sceneName = args[0];
               const auto scenePath  = "Scenes\\" + sceneName + ".xscn";
-              TransitionScene(scenePath);
-          });
+              TransitionScene(scenePath, true);
+          })
+          .RegisterCommand("a_BeginTrace", [](auto) { AssetManager::BeginAccessTrace(); })
+          .RegisterCommand("a_EndTrace", [](auto args) {
+              // Written next to the executable unless a path is given
+              const auto filename = args.size() < 1 ? Path::Current() / "AssetTrace.txt" : Path(args[0]);
+              AssetManager::EndAccessTrace(filename);
+          })
+          .RegisterCommand("m_Stats", [this](auto) { LogMemoryStats(); })
+          .RegisterCommand("m_Dump", [](auto args) {
+              // JSON, written next to the executable unless a path is given
+              const auto filename = args.size() < 1 ? Path::Current() / "MemoryStats.json" : Path(args[0]);
+              MemoryTracker::WriteDump(filename);
+          })
+          .RegisterCommand("m_Budget", [this](auto args) {
+              // m_Budget <tag> <cpu|gpu> <megabytes>, 0 removes the budget
+              MemoryTag tag;
+              MemoryKind kind;
+              if (args.size() < 3 || !MemoryTracker::FindTag(args[0], tag) || !MemoryTracker::FindKind(args[1], kind)) {
+                  str tags;
+                  for (u8 i = 0; i < CAST<u8>(MemoryTag::Count); ++i) {
+                      if (i > 0) { tags += '|'; }
+                      tags += MemoryTracker::GetTagName(CAST<MemoryTag>(i));
+                  }
+                  mDevConsole.AddLog("Usage: m_Budget <%s> <Cpu|Gpu> <megabytes>", tags.c_str());
+                  return;
+              }
+              const auto megabytes = strtoull(args[2].c_str(), nullptr, 10);
+              MemoryTracker::SetBudget(tag, kind, CAST<size_t>(megabytes) * X_MEGABYTES(1));
+          })
+          .RegisterCommand("m_ResetPeaks", [](auto) { MemoryTracker::ResetHighWater(); });
+    }
+
+    void Game::LogMemoryStats() {
+        mDevConsole.AddLog(
+          "%-12s %-4s %12s %12s %12s %12s", "Tag", "Kind", "Current KB", "Peak KB", "Frame KB", "Budget KB");
+        for (u8 tag = 0; tag < CAST<u8>(MemoryTag::Count); ++tag) {
+            for (u8 kind = 0; kind < CAST<u8>(MemoryKind::Count); ++kind) {
+                const auto stats = MemoryTracker::GetStats(CAST<MemoryTag>(tag), CAST<MemoryKind>(kind));
+                mDevConsole.AddLog("%-12s %-4s %12.1f %12.1f %12.1f %12.1f",
+                                   MemoryTracker::GetTagName(CAST<MemoryTag>(tag)),
+                                   MemoryTracker::GetKindName(CAST<MemoryKind>(kind)),
+                                   CAST<f64>(stats.mCurrent) / X_KILOBYTES(1),
+                                   CAST<f64>(stats.mHighWater) / X_KILOBYTES(1),
+                                   CAST<f64>(stats.mFrameDelta) / X_KILOBYTES(1),
+                                   CAST<f64>(stats.mBudget) / X_KILOBYTES(1));
+            }
+        }
     }
 
-    bool Game::TransitionScene(const str& name) {
+    bool Game::TransitionScene(const str& name, bool async) {
         if (name.empty() || mScenes.empty()) {
             X_LOG_ERROR("Attempted to load blank or non-existent scene")
             return false;
         }
 
+        // Resources the new scene shares with the old one stay in the cache, so only the difference is loaded
         mActiveScene.reset();
-        mActiveScene = make_unique<Scene>(mRenderContext, mScriptEngine);
+        mActiveScene = make_unique<Scene>(mRenderContext, mScriptEngine, mResources);
 
-        if (const auto it = mScenes.find(name); it != mScenes.end()) {
-            mActiveScene->Load(it->second);
-        } else {
+        const auto it = mScenes.find(name);
+        if (it == mScenes.end()) {
             X_LOG_ERROR("Scene not found in scene cache. Engine may not have loaded it yet.")
             return false;
         }
 
+        // The scene finishes loading over the next frames, Update keeps it going and it isn't drawn until it's done
+        if (async) {
+            mActiveScene->BeginLoad(it->second);
+            return true;
+        }
+
+        mActiveScene->Load(it->second);
         mActiveScene->Update(0.0f);
         return true;
     }
@@ -279,7 +351,7 @@ namespace x {
         }
 
         mActiveScene.reset();
-        mActiveScene = make_unique<Scene>(mRenderContext, mScriptEngine);
+        mActiveScene = make_unique<Scene>(mRenderContext, mScriptEngine, mResources);
         mActiveScene->Load(scene);
         mActiveScene->Update(0.0f);
     }
@@ -311,6 +383,10 @@ namespace x {
         return mScriptEngine;
     }
 
+    ResourceManager& Game::GetResourceManager() {
+        return mResources;
+    }
+
     RenderSystem* Game::GetRenderSystem() const {
         return mRenderSystem.get();
     }
@@ -31,7 +31,8 @@ namespace x {
         void Update();
         void RenderFrame() const;
 
-        bool TransitionScene(const str& name);
+        /// @brief With `async` the scene loads in the background while frames keep running, see Scene::BeginLoad.
+        bool TransitionScene(const str& name, bool async = false);
         void TransitionScene(const SceneDescriptor& scene);
         void Resize(u32 width, u32 height) const;
         void Reset();
@@ -42,6 +43,7 @@ namespace x {
         X_NODISCARD bool SceneValid() const;
         X_NODISCARD PostProcessPass* GetPostProcess() const;
         X_NODISCARD ScriptEngine& GetScriptEngine();
+        X_NODISCARD ResourceManager& GetResourceManager();
         X_NODISCARD RenderSystem* GetRenderSystem() const;
         X_NODISCARD bool IsInitialized() const;
         X_NODISCARD SceneMap& GetSceneMap();
@@ -49,6 +51,9 @@ namespace x {
     private:
         friend class XEditor;
 
+        // Only caps what stays cached once nothing uses it, resources the active scene holds are never evicted
+        static constexpr size_t kResourceCacheBudget = X_MEGABYTES(512);
+
         bool mDebugUIEnabled {false};
         bool mIsRunning {false};
         bool mIsPaused {false};
@@ -56,6 +61,7 @@ namespace x {
         bool mIsInitialized {false};
         Clock mClock;
         unique_ptr<RenderSystem> mRenderSystem;
+        ResourceManager mResources;  // Shared by every scene, declared first so it outlives them
         unique_ptr<Scene> mActiveScene;
         std::unique_ptr<DebugUI> mDebugUI;
         vector<Volatile*> mVolatiles;
@@ -70,7 +76,11 @@ namespace x {
         void InitializeEngine();
 
         void RenderDepthOnly(const SceneState& state) const;
+        /// @brief Reloads the asset manager's pak/content index. The shared resource cache is cleared first, which also
+        /// cancels async loads still reading the old index.
+        void ReloadAssets();
         void ReloadSceneCache();
+        void LogMemoryStats();
 
         void RegisterEventHandlers();
         void OnResize(u32 width, u32 height) const;
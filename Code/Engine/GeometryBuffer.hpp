@@ -8,10 +8,11 @@ namespace x {
     class GeometryBuffer {
         ComPtr<ID3D11Buffer> mVertexBuffer;
         ComPtr<ID3D11Buffer> mIndexBuffer;
-        u32 mStride      = 0;
-        u32 mOffset      = 0;
-        u32 mIndexCount  = 0;
-        u32 mVertexCount = 0;
+        u32 mStride              = 0;
+        u32 mOffset              = 0;
+        u32 mIndexCount          = 0;
+        u32 mVertexCount         = 0;
+        DXGI_FORMAT mIndexFormat = DXGI_FORMAT_R32_UINT;
 
     public:
         GeometryBuffer() = default;
@@ -22,7 +23,52 @@ namespace x {
                     size_t vertexCount,
                     const u32* indexData,
                     size_t indexCount) {
-            mStride = vertexStride;
+            CreateBuffers(renderer, vertexData, vertexStride, vertexCount, indexData, indexCount, DXGI_FORMAT_R32_UINT);
+        }
+
+        /// @brief Same as above with 16-bit indices, for meshes with fewer than 65536 vertices.
+        void Create(const RenderContext& renderer,
+                    const void* vertexData,
+                    size_t vertexStride,
+                    size_t vertexCount,
+                    const u16* indexData,
+                    size_t indexCount) {
+            CreateBuffers(renderer, vertexData, vertexStride, vertexCount, indexData, indexCount, DXGI_FORMAT_R16_UINT);
+        }
+
+        void Bind(const RenderContext& renderer) const {
+            auto* context = renderer.GetDeviceContext();
+            context->IASetVertexBuffers(0, 1, mVertexBuffer.GetAddressOf(), &mStride, &mOffset);
+            context->IASetIndexBuffer(mIndexBuffer.Get(), mIndexFormat, 0);
+            context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        }
+
+        [[nodiscard]] ID3D11Buffer* GetVertexBuffer() {
+            return mVertexBuffer.Get();
+        }
+
+        [[nodiscard]] ID3D11Buffer* GetIndexBuffer() {
+            return mIndexBuffer.Get();
+        }
+
+        [[nodiscard]] u32 GetIndexCount() const {
+            return mIndexCount;
+        }
+
+        [[nodiscard]] u32 GetVertexCount() const {
+            return mVertexCount;
+        }
+
+    private:
+        void CreateBuffers(const RenderContext& renderer,
+                           const void* vertexData,
+                           size_t vertexStride,
+                           size_t vertexCount,
+                           const void* indexData,
+                           size_t indexCount,
+                           DXGI_FORMAT indexFormat) {
+            mStride      = vertexStride;
+            mIndexFormat = indexFormat;
 
             D3D11_BUFFER_DESC vbd {};
             vbd.Usage     = D3D11_USAGE_IMMUTABLE;
@@ -38,7 +84,7 @@ namespace x {
 
             D3D11_BUFFER_DESC ibd {};
             ibd.Usage     = D3D11_USAGE_IMMUTABLE;
-            ibd.ByteWidth = indexCount * sizeof(u32);
+            ibd.ByteWidth = indexCount * (indexFormat == DXGI_FORMAT_R16_UINT ? sizeof(u16) : sizeof(u32));
             ibd.BindFlags = D3D11_BIND_INDEX_BUFFER;
 
             D3D11_SUBRESOURCE_DATA id {};
@@ -50,28 +96,5 @@ namespace x {
             mIndexCount  = indexCount;
             mVertexCount = vertexCount;
         }
-
-        void Bind(const RenderContext& renderer) const {
-            auto* context = renderer.GetDeviceContext();
-            context->IASetVertexBuffers(0, 1, mVertexBuffer.GetAddressOf(), &mStride, &mOffset);
-            context->IASetIndexBuffer(mIndexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-            context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-        }
-
-        [[nodiscard]] ID3D11Buffer* GetVertexBuffer() {
-            return mVertexBuffer.Get();
-        }
-
-        [[nodiscard]] ID3D11Buffer* GetIndexBuffer() {
-            return mIndexBuffer.Get();
-        }
-
-        [[nodiscard]] u32 GetIndexCount() const {
-            return mIndexCount;
-        }
-
-        [[nodiscard]] u32 GetVertexCount() const {
-            return mVertexCount;
-        }
     };
 }  // namespace x
\ No newline at end of file
@@ -4,6 +4,9 @@
 
 #include "MaterialParser.hpp"
 #include "Common/XML.hpp"
+#include "Tools/XPak/DescriptorCompiler.hpp"
+
+#include <cstring>
 
 namespace x {
     static bool ParseDoc(const rapidxml::xml_document<>& doc, MaterialDescriptor& descriptor) {
@@ -33,6 +36,39 @@ namespace x {
         return false;
     }
 
+    // Reads a material compiled by xpakc
+    static bool ParseBinary(std::span<const u8> data, MaterialDescriptor& descriptor) {
+        BinaryMaterialHeader header;
+        std::memcpy(&header, data.data(), sizeof(BinaryMaterialHeader));
+        if (header.mVersion != kBinaryDescriptorVersion) {
+            X_LOG_ERROR("Unsupported compiled material version %u", header.mVersion);
+            return false;
+        }
+
+        const u64 texturesSize = CAST<u64>(header.mTextureCount) * sizeof(BinaryTexture);
+        if (sizeof(BinaryMaterialHeader) + texturesSize + header.mStringTableSize != data.size()) {
+            X_LOG_ERROR("Compiled material is truncated");
+            return false;
+        }
+
+        const auto records = data.subspan(sizeof(BinaryMaterialHeader), texturesSize);
+        const auto strings = data.subspan(sizeof(BinaryMaterialHeader) + texturesSize);
+
+        descriptor.mName         = str(DescriptorCompiler::GetString(strings, header.mName));
+        descriptor.mBaseMaterial = str(DescriptorCompiler::GetString(strings, header.mBaseMaterial));
+        descriptor.mTransparent  = CHECK_FLAG(header.mFlags, kBinaryMaterial_Transparent);
+
+        descriptor.mTextures.reserve(header.mTextureCount);
+        for (u32 i = 0; i < header.mTextureCount; ++i) {
+            BinaryTexture texture;
+            std::memcpy(&texture, records.data() + CAST<size_t>(i) * sizeof(BinaryTexture), sizeof(BinaryTexture));
+            descriptor.mTextures.emplace_back(str(DescriptorCompiler::GetString(strings, texture.mName)),
+                                              texture.mAssetId);
+        }
+
+        return true;
+    }
+
     bool MaterialParser::Parse(const Path& filename, MaterialDescriptor& descriptor) {
         if (!filename.Exists()) return false;
         rapidxml::xml_document<> doc;
@@ -42,6 +78,12 @@ namespace x {
 
     bool MaterialParser::Parse(std::span<const u8> data, MaterialDescriptor& descriptor) {
         if (data.empty()) return false;
+
+        // Paks store materials compiled to binary, loose content and the editor use the XML
+        if (DescriptorCompiler::IsCompiled(data, kBinaryMaterialMagic, sizeof(BinaryMaterialHeader))) {
+            return ParseBinary(data, descriptor);
+        }
+
         rapidxml::xml_document<> doc;
         vector<u8> buffer(data.begin(), data.end());
         buffer.push_back('\0');
@@ -0,0 +1,162 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "MemoryTracker.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <format>
+
+namespace x {
+    static constexpr auto kTagCount  = CAST<size_t>(MemoryTag::Count);
+    static constexpr auto kKindCount = CAST<size_t>(MemoryKind::Count);
+
+    static constexpr const char* kTagNames[]  = {"Models", "Textures", "Resources", "Loaders", "Components", "Scripts"};
+    static constexpr const char* kKindNames[] = {"Cpu", "Gpu"};
+
+    static_assert(std::size(kTagNames) == kTagCount, "Every memory tag needs a name");
+    static_assert(std::size(kKindNames) == kKindCount, "Every memory kind needs a name");
+
+    struct MemoryCounter {
+        std::atomic<i64> mCurrent {0};
+        std::atomic<i64> mHighWater {0};
+        i64 mFrameStart {0};  // Frame deltas, budgets and the flag below are only touched on the main thread
+        i64 mFrameDelta {0};
+        size_t mBudget {0};
+        bool mOverBudget {false};
+    };
+
+    static MemoryCounter sCounters[kTagCount][kKindCount];
+
+    static MemoryCounter& GetCounter(MemoryTag tag, MemoryKind kind) {
+        return sCounters[CAST<size_t>(tag)][CAST<size_t>(kind)];
+    }
+
+    static void UpdateHighWater(MemoryCounter& counter, i64 current) {
+        i64 highWater = counter.mHighWater.load();
+        while (current > highWater && !counter.mHighWater.compare_exchange_weak(highWater, current)) {}
+    }
+
+    void MemoryTracker::Allocate(MemoryTag tag, MemoryKind kind, size_t bytes) {
+        if (bytes == 0) { return; }
+        auto& counter = GetCounter(tag, kind);
+        UpdateHighWater(counter, counter.mCurrent.fetch_add(CAST<i64>(bytes)) + CAST<i64>(bytes));
+    }
+
+    void MemoryTracker::Free(MemoryTag tag, MemoryKind kind, size_t bytes) {
+        if (bytes == 0) { return; }
+        GetCounter(tag, kind).mCurrent.fetch_sub(CAST<i64>(bytes));
+    }
+
+    void MemoryTracker::Set(MemoryTag tag, MemoryKind kind, size_t bytes) {
+        auto& counter = GetCounter(tag, kind);
+        counter.mCurrent.store(CAST<i64>(bytes));
+        UpdateHighWater(counter, CAST<i64>(bytes));
+    }
+
+    void MemoryTracker::EndFrame() {
+        for (size_t tag = 0; tag < kTagCount; ++tag) {
+            for (size_t kind = 0; kind < kKindCount; ++kind) {
+                auto& counter       = sCounters[tag][kind];
+                const i64 current   = counter.mCurrent.load();
+                counter.mFrameDelta = current - counter.mFrameStart;
+                counter.mFrameStart = current;
+
+                const bool overBudget = counter.mBudget != 0 && CAST<size_t>(current) > counter.mBudget;
+                if (overBudget && !counter.mOverBudget) {
+                    X_LOG_WARN("Memory budget exceeded for %s (%s): %.2f MB of %.2f MB",
+                               kTagNames[tag],
+                               kKindNames[kind],
+                               CAST<f64>(current) / X_MEGABYTES(1),
+                               CAST<f64>(counter.mBudget) / X_MEGABYTES(1));
+                }
+                counter.mOverBudget = overBudget;
+            }
+        }
+    }
+
+    void MemoryTracker::SetBudget(MemoryTag tag, MemoryKind kind, size_t bytes) {
+        auto& counter       = GetCounter(tag, kind);
+        counter.mBudget     = bytes;
+        counter.mOverBudget = false;  // Warns again next frame if it's still over
+    }
+
+    void MemoryTracker::ResetHighWater() {
+        for (auto& counters : sCounters) {
+            for (auto& counter : counters) {
+                counter.mHighWater.store(counter.mCurrent.load());
+            }
+        }
+    }
+
+    MemoryStats MemoryTracker::GetStats(MemoryTag tag, MemoryKind kind) {
+        const auto& counter = GetCounter(tag, kind);
+        MemoryStats stats;
+        stats.mCurrent    = CAST<size_t>(X_MAX(counter.mCurrent.load(), CAST<i64>(0)));
+        stats.mHighWater  = CAST<size_t>(X_MAX(counter.mHighWater.load(), CAST<i64>(0)));
+        stats.mFrameDelta = counter.mFrameDelta;
+        stats.mBudget     = counter.mBudget;
+        return stats;
+    }
+
+    const char* MemoryTracker::GetTagName(MemoryTag tag) {
+        return kTagNames[CAST<size_t>(tag)];
+    }
+
+    const char* MemoryTracker::GetKindName(MemoryKind kind) {
+        return kKindNames[CAST<size_t>(kind)];
+    }
+
+    bool MemoryTracker::FindTag(const str& name, MemoryTag& tag) {
+        for (size_t i = 0; i < kTagCount; ++i) {
+            if (_stricmp(name.c_str(), kTagNames[i]) == 0) {
+                tag = CAST<MemoryTag>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool MemoryTracker::FindKind(const str& name, MemoryKind& kind) {
+        for (size_t i = 0; i < kKindCount; ++i) {
+            if (_stricmp(name.c_str(), kKindNames[i]) == 0) {
+                kind = CAST<MemoryKind>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    str MemoryTracker::Dump() {
+        // {"tags": [{"name": "Models", "cpu": {"current": 0, ...}, "gpu": {...}}, ...]}
+        str json = "{\"tags\": [";
+        for (size_t tag = 0; tag < kTagCount; ++tag) {
+            if (tag > 0) { json += ", "; }
+            json += std::format("{{\"name\": \"{}\"", kTagNames[tag]);
+            for (size_t kind = 0; kind < kKindCount; ++kind) {
+                const auto stats = GetStats(CAST<MemoryTag>(tag), CAST<MemoryKind>(kind));
+                json += std::format(", \"{}\": {{\"current\": {}, \"highWater\": {}, \"frameDelta\": {}, "
+                                    "\"budget\": {}}}",
+                                    kind == CAST<size_t>(MemoryKind::Cpu) ? "cpu" : "gpu",
+                                    stats.mCurrent,
+                                    stats.mHighWater,
+                                    stats.mFrameDelta,
+                                    stats.mBudget);
+            }
+            json += "}";
+        }
+        json += "]}";
+        return json;
+    }
+
+    bool MemoryTracker::WriteDump(const Path& filename) {
+        if (!FileWriter::WriteText(filename, Dump())) {
+            X_LOG_ERROR("MemoryTracker::WriteDump - Failed to write '%s'", filename.CStr());
+            return false;
+        }
+
+        X_LOG_INFO("MemoryTracker::WriteDump - Wrote '%s'", filename.CStr());
+        return true;
+    }
+}  // namespace x
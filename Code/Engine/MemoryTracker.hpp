@@ -0,0 +1,145 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "EngineCommon.hpp"
+#include "Common/Typedefs.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace x {
+    enum class MemoryTag : u8 {
+        Models,      // Loaded models, their vertex and index buffers on the GPU
+        Textures,    // Loaded textures
+        Resources,   // Loaded resources of any other type, see ResourceMemoryTag
+        Loaders,     // Data loaders have prepared on the worker threads and not finalized yet
+        Components,  // Component storage in scene states
+        Scripts,     // The Lua heap, sampled once a frame
+        Count,
+    };
+
+    enum class MemoryKind : u8 {
+        Cpu,
+        Gpu,
+        Count,
+    };
+
+    struct MemoryStats {
+        size_t mCurrent {0};
+        size_t mHighWater {0};
+        i64 mFrameDelta {0};  // Change over the last frame
+        size_t mBudget {0};   // 0 if there isn't one
+    };
+
+    /// @brief Counts memory by what it's used for (its tag) and whether it lives on the CPU or GPU. Every counter
+    /// keeps the current total, its high-water mark and how much it changed over the last frame. Allocations can be
+    /// counted from any thread; EndFrame, budgets and the stats are main thread only.
+    ///
+    /// Budgets aren't enforced by failing allocations, going over one logs a warning at the end of the frame.
+    class MemoryTracker {
+        X_CLASS_PREVENT_MOVES_COPIES(MemoryTracker)
+        MemoryTracker() = default;
+
+    public:
+        static void Allocate(MemoryTag tag, MemoryKind kind, size_t bytes);
+        static void Free(MemoryTag tag, MemoryKind kind, size_t bytes);
+        /// @brief For memory that's sampled rather than counted as it's allocated, e.g. the Lua heap.
+        static void Set(MemoryTag tag, MemoryKind kind, size_t bytes);
+
+        /// @brief Call once a frame. Works out the per-frame deltas and checks the budgets.
+        static void EndFrame();
+
+        static void SetBudget(MemoryTag tag, MemoryKind kind, size_t bytes);
+        static void ResetHighWater();
+
+        X_NODISCARD static MemoryStats GetStats(MemoryTag tag, MemoryKind kind);
+        X_NODISCARD static const char* GetTagName(MemoryTag tag);
+        X_NODISCARD static const char* GetKindName(MemoryKind kind);
+        /// @brief Case insensitive, returns false if there's no tag (or kind) by that name.
+        static bool FindTag(const str& name, MemoryTag& tag);
+        static bool FindKind(const str& name, MemoryKind& kind);
+
+        /// @brief Every counter as JSON, for tooling and tracking budgets over time.
+        X_NODISCARD static str Dump();
+        static bool WriteDump(const Path& filename);
+    };
+
+    /// @brief Counts its bytes against a tag for as long as it's alive, for memory owned by something with a clear
+    /// lifetime (a resource, a loader's staging data).
+    class MemoryAllocation {
+    public:
+        MemoryAllocation() = default;
+
+        MemoryAllocation(MemoryTag tag, size_t cpuBytes, size_t gpuBytes = 0)
+            : mTag(tag), mCpuBytes(cpuBytes), mGpuBytes(gpuBytes) {
+            MemoryTracker::Allocate(mTag, MemoryKind::Cpu, mCpuBytes);
+            MemoryTracker::Allocate(mTag, MemoryKind::Gpu, mGpuBytes);
+        }
+
+        ~MemoryAllocation() {
+            Reset();
+        }
+
+        MemoryAllocation(const MemoryAllocation&)            = delete;
+        MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+
+        MemoryAllocation(MemoryAllocation&& other) noexcept
+            : mTag(other.mTag), mCpuBytes(std::exchange(other.mCpuBytes, 0)),
+              mGpuBytes(std::exchange(other.mGpuBytes, 0)) {}
+
+        MemoryAllocation& operator=(MemoryAllocation&& other) noexcept {
+            if (this != &other) {
+                Reset();
+                mTag      = other.mTag;
+                mCpuBytes = std::exchange(other.mCpuBytes, 0);
+                mGpuBytes = std::exchange(other.mGpuBytes, 0);
+            }
+            return *this;
+        }
+
+        void Reset() {
+            MemoryTracker::Free(mTag, MemoryKind::Cpu, std::exchange(mCpuBytes, 0));
+            MemoryTracker::Free(mTag, MemoryKind::Gpu, std::exchange(mGpuBytes, 0));
+        }
+
+    private:
+        MemoryTag mTag {MemoryTag::Count};
+        size_t mCpuBytes {0};
+        size_t mGpuBytes {0};
+    };
+
+    /// @brief Standard allocator that counts everything it allocates against `Tag`, for containers.
+    template<typename T, MemoryTag Tag>
+    class TrackingAllocator {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind {
+            using other = TrackingAllocator<U, Tag>;
+        };
+
+        TrackingAllocator() = default;
+
+        template<typename U>
+        TrackingAllocator(const TrackingAllocator<U, Tag>&) noexcept {}
+
+        T* allocate(size_t count) {
+            T* memory = std::allocator<T> {}.allocate(count);
+            MemoryTracker::Allocate(Tag, MemoryKind::Cpu, count * sizeof(T));
+            return memory;
+        }
+
+        void deallocate(T* memory, size_t count) noexcept {
+            MemoryTracker::Free(Tag, MemoryKind::Cpu, count * sizeof(T));
+            std::allocator<T> {}.deallocate(memory, count);
+        }
+
+        friend bool operator==(const TrackingAllocator&, const TrackingAllocator&) {
+            return true;
+        }
+    };
+}  // namespace x
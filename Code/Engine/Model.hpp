@@ -13,6 +13,23 @@ namespace x {
               .Create(context, vertices.data(), sizeof(VSInputPBR), vertices.size(), indices.data(), indices.size());
         }
 
+        /// @brief Uploads vertices/indices that are already laid out as VSInputPBR, e.g. a baked mesh's blobs.
+        Mesh(const RenderContext& context,
+             const void* vertices,
+             size_t vertexCount,
+             const u32* indices,
+             size_t indexCount) {
+            mGeometryBuffer.Create(context, vertices, sizeof(VSInputPBR), vertexCount, indices, indexCount);
+        }
+
+        Mesh(const RenderContext& context,
+             const void* vertices,
+             size_t vertexCount,
+             const u16* indices,
+             size_t indexCount) {
+            mGeometryBuffer.Create(context, vertices, sizeof(VSInputPBR), vertexCount, indices, indexCount);
+        }
+
         void Draw(RenderContext& context) const {
             mGeometryBuffer.Bind(context);
             context.DrawIndexed(mGeometryBuffer.GetIndexCount());
@@ -2,92 +2,91 @@
 
 #include "Model.hpp"
 #include "ResourceManager.hpp"
-
-#include <assimp/mesh.h>
-#include <assimp/scene.h>
-#include <assimp/Importer.hpp>
-#include <assimp/postprocess.h>
+#include "Tools/XPak/MeshBaker.hpp"
 
 #include "AssetManager.hpp"
 
 namespace x {
-    class ModelLoader final : public ResourceLoader<Model> {
-        static constexpr u32 kProcessFlags =
-          aiProcess_Triangulate | aiProcess_ConvertToLeftHanded | aiProcess_GenNormals | aiProcess_CalcTangentSpace;
-
-        Model LoadImpl(RenderContext& context, const u64 id) override {
-            Model model;
-
-            const auto modelBytes = AssetManager::GetAssetData(id);
-            if (!modelBytes.has_value()) {
-                X_LOG_ERROR("Failed to load model from id {}", id);
-                return {};
-            }
-
-            Assimp::Importer importer;
-            const auto* scene = importer.ReadFileFromMemory(modelBytes->data(), modelBytes->size(), kProcessFlags);
-            if (!scene) {
-                X_LOG_ERROR("Failed to read model from id {}", id);
-                return {};
+    static_assert(sizeof(VSInputPBR) == sizeof(BakedMeshVertex), "Baked vertex layout doesn't match VSInputPBR");
+
+    /// @brief A baked mesh read and, if it's quantized, expanded on a worker thread, ready to upload.
+    struct ModelStaging final : ResourceStaging {
+        optional<vector<u8>> mBytes;  // Empty when the mesh is read straight out of the mapped pak
+        BakedMesh mMesh;
+        vector<vector<BakedMeshVertex>> mDecoded;  // Per submesh, only for quantized meshes
+
+        size_t GetSize() const override {
+            size_t size = mBytes.has_value() ? mBytes->size() : 0;
+            for (const auto& vertices : mDecoded) {
+                size += vertices.size() * sizeof(BakedMeshVertex);
             }
-
-            ProcessNode(context, scene->mRootNode, scene, model);
-
-            return model;
+            return size;
         }
+    };
 
-        void ProcessNode(const RenderContext& context, const aiNode* node, const aiScene* scene, Model& model) {
-            for (u32 i = 0; i < node->mNumMeshes; i++) {
-                const auto* mesh = scene->mMeshes[node->mMeshes[i]];
-                model.mMeshes.push_back(ProcessMesh(context, mesh));
+    class ModelLoader final : public ResourceLoader<Model, ModelStaging> {
+        unique_ptr<ModelStaging> PrepareImpl(const u64 id) override {
+            auto staging = make_unique<ModelStaging>();
+
+            // Meshes are baked by xpakc (or by the AssetManager when loading loose content), so this is just a matter
+            // of uploading the blobs. Uncompressed ones are read straight out of the mapped pak without a copy.
+            std::span<const u8> modelData = AssetManager::GetAssetView(id);
+            if (modelData.empty()) {
+                staging->mBytes = AssetManager::GetAssetData(id);
+                if (!staging->mBytes.has_value()) {
+                    X_LOG_ERROR("Failed to load model from id %llu", id);
+                    return nullptr;
+                }
+                modelData = *staging->mBytes;
             }
 
-            for (u32 i = 0; i < node->mNumChildren; i++) {
-                ProcessNode(context, node->mChildren[i], scene, model);
+            if (!staging->mMesh.Open(modelData)) {
+                X_LOG_ERROR("Failed to read model from id %llu, it isn't a baked mesh (rebuild the pak file)", id);
+                return nullptr;
             }
-        }
 
-        Mesh ProcessMesh(const RenderContext& context, const aiMesh* mesh) {
-            vector<VSInputPBR> vertices;
-            vector<u32> indices;
-
-            for (u32 i = 0; i < mesh->mNumVertices; ++i) {
-                VSInputPBR vertex;
-
-                vertex.mPosition.x = mesh->mVertices[i].x;
-                vertex.mPosition.y = mesh->mVertices[i].y;
-                vertex.mPosition.z = mesh->mVertices[i].z;
-
-                if (mesh->mTextureCoords[0]) {
-                    vertex.mTexCoord.x = mesh->mTextureCoords[0][i].x;
-                    vertex.mTexCoord.y = mesh->mTextureCoords[0][i].y;
-                }
-
-                if (mesh->HasNormals()) {
-                    vertex.mNormal.x = mesh->mNormals[i].x;
-                    vertex.mNormal.y = mesh->mNormals[i].y;
-                    vertex.mNormal.z = mesh->mNormals[i].z;
+            // The shaders take full precision attributes, so quantized vertices are expanded before uploading
+            if (staging->mMesh.IsQuantized()) {
+                for (const auto& submesh : staging->mMesh.GetSubmeshes()) {
+                    staging->mDecoded.push_back(staging->mMesh.DecodeVertices(submesh));
                 }
+            }
 
-                if (mesh->HasTangentsAndBitangents()) {
-                    vertex.mTangent.x = mesh->mTangents[i].x;
-                    vertex.mTangent.y = mesh->mTangents[i].y;
-                    vertex.mTangent.z = mesh->mTangents[i].z;
-                }
+            return staging;
+        }
 
-                vertices.push_back(vertex);
-            }
+        Model FinalizeImpl(RenderContext& context, const u64 id, ModelStaging& staging, size_t& size) override {
+            Model model;
 
-            for (u32 i = 0; i < mesh->mNumFaces; i++) {
-                const auto& face = mesh->mFaces[i];
-                for (u32 j = 0; j < face.mNumIndices; j++) {
-                    indices.push_back(face.mIndices[j]);
+            const auto& mesh     = staging.mMesh;
+            const auto submeshes = mesh.GetSubmeshes();
+            model.mMeshes.reserve(submeshes.size());
+            for (size_t i = 0; i < submeshes.size(); ++i) {
+                const auto& submesh  = submeshes[i];
+                const void* vertices = mesh.GetVertices(submesh);
+                const void* indices  = mesh.GetIndices(submesh);
+                if (mesh.IsQuantized()) { vertices = staging.mDecoded[i].data(); }
+                size += submesh.mVertexCount * sizeof(BakedMeshVertex) +
+                        submesh.mIndexCount * (mesh.HasIndex16() ? sizeof(u16) : sizeof(u32));
+
+                if (mesh.HasIndex16()) {
+                    model.mMeshes.emplace_back(context,
+                                               vertices,
+                                               submesh.mVertexCount,
+                                               CAST<const u16*>(indices),
+                                               submesh.mIndexCount);
+                } else {
+                    model.mMeshes.emplace_back(context,
+                                               vertices,
+                                               submesh.mVertexCount,
+                                               CAST<const u32*>(indices),
+                                               submesh.mIndexCount);
                 }
             }
 
-            return Mesh(context, vertices, indices);
+            return model;
         }
     };
 
     X_REGISTER_RESOURCE_LOADER(Model, ModelLoader)
-}  // namespace x
\ No newline at end of file
+}  // namespace x
@@ -2,4 +2,278 @@
 // Created: 1/13/2025.
 //
 
-#pragma once
\ No newline at end of file
+#pragma once
+
+#include "Common/Typedefs.hpp"
+#include "EngineCommon.hpp"
+#include "MemoryTracker.hpp"
+
+#include <atomic>
+#include <utility>
+
+namespace x {
+    /// @brief Small dense index for each resource type, handed out the first time the type is used. Picks the type's
+    /// pool and loader in place of RTTI.
+    class ResourceTypeIndex {
+    public:
+        static constexpr u32 kMaxTypes = 1u << 8;  // See ResourceKey
+
+        template<typename T>
+        static u32 Get() {
+            static const u32 index = sNext.fetch_add(1);
+            return index;
+        }
+
+    private:
+        inline static std::atomic<u32> sNext {0};
+    };
+
+    /// @brief Packs where a resource lives into 64 bits: its type index in the low 8, its slot in that type's pool in
+    /// the next 24 and the slot's generation in the high 32. A key to a destroyed resource has a stale generation, so
+    /// it can't resolve to whatever took its slot. 0 is never a valid key, generations start at 1.
+    class ResourceKey {
+    public:
+        static constexpr u32 kTypeBits = 8;
+        static constexpr u32 kSlotBits = 24;
+        static constexpr u32 kMaxSlots = 1u << kSlotBits;
+
+        static constexpr u64 Make(u32 type, u32 slot, u32 generation) {
+            return CAST<u64>(generation) << (kTypeBits + kSlotBits) | CAST<u64>(slot) << kTypeBits | type;
+        }
+
+        static constexpr u32 GetType(u64 key) {
+            return CAST<u32>(key & ((1u << kTypeBits) - 1));
+        }
+
+        static constexpr u32 GetSlot(u64 key) {
+            return CAST<u32>((key >> kTypeBits) & (kMaxSlots - 1));
+        }
+
+        static constexpr u32 GetGeneration(u64 key) {
+            return CAST<u32>(key >> (kTypeBits + kSlotBits));
+        }
+    };
+
+    class Model;
+    class Texture2D;
+
+    /// @brief Tag a resource type's memory is counted against, types without their own count as Resources.
+    template<typename T>
+    struct ResourceMemoryTag {
+        static constexpr MemoryTag kTag = MemoryTag::Resources;
+    };
+
+    template<>
+    struct ResourceMemoryTag<Model> {
+        static constexpr MemoryTag kTag = MemoryTag::Models;
+    };
+
+    template<>
+    struct ResourceMemoryTag<Texture2D> {
+        static constexpr MemoryTag kTag = MemoryTag::Textures;
+    };
+
+    struct ResourceSlot {
+        u32 mGeneration {1};
+        u32 mRefs {0};           // Handles to it, the manager's own ownership isn't counted
+        bool mOrphaned {false};  // Dropped by the manager while referenced, destroyed along with its last handle
+        MemoryAllocation mMemory;
+    };
+
+    /// @brief Every resource of one type, stored inline in a dense array and addressed by slot. Freed slots are reused
+    /// with their generation bumped. The array grows as resources are added, so pointers into it are only good until
+    /// the next resource of that type is created; hold keys (or handles) instead.
+    class ResourcePoolBase {
+    public:
+        virtual ~ResourcePoolBase() = default;
+
+        /// @brief Runs the resource's destructor and frees its slot, which invalidates every key to it.
+        virtual void Destroy(u32 slot) = 0;
+
+        /// @brief Null if the key is stale.
+        X_NODISCARD ResourceSlot* GetSlot(u64 key) {
+            const u32 slot = ResourceKey::GetSlot(key);
+            if (slot >= mSlots.size() || mSlots[slot].mGeneration != ResourceKey::GetGeneration(key)) {
+                return nullptr;
+            }
+            return &mSlots[slot];
+        }
+
+        X_NODISCARD size_t GetCount() const {
+            return mSlots.size() - mFree.size();
+        }
+
+    protected:
+        vector<ResourceSlot> mSlots;
+        vector<u32> mFree;
+
+        u32 AllocateSlot() {
+            if (!mFree.empty()) {
+                const u32 slot = mFree.back();
+                mFree.pop_back();
+                return slot;
+            }
+            X_ASSERT(mSlots.size() < ResourceKey::kMaxSlots)
+            mSlots.emplace_back();
+            return CAST<u32>(mSlots.size() - 1);
+        }
+
+        void FreeSlot(u32 slot) {
+            auto& info = mSlots[slot];
+            info.mGeneration++;
+            info.mRefs     = 0;
+            info.mOrphaned = false;
+            info.mMemory.Reset();
+            mFree.push_back(slot);
+        }
+    };
+
+    template<typename T>
+    class ResourcePool final : public ResourcePoolBase {
+    public:
+        /// @brief Returns the new resource's key. `gpuBytes` is what it holds on the GPU, see MemoryTracker.
+        u64 Add(T&& data, size_t gpuBytes) {
+            const u32 slot = AllocateSlot();
+            if (slot >= mData.size()) { mData.resize(slot + 1); }
+            mData[slot].emplace(std::move(data));
+            mSlots[slot].mMemory = MemoryAllocation(ResourceMemoryTag<T>::kTag, sizeof(T), gpuBytes);
+            return ResourceKey::Make(ResourceTypeIndex::Get<T>(), slot, mSlots[slot].mGeneration);
+        }
+
+        /// @brief Null if the key is stale. A matching generation means the slot is live, as freeing bumps it.
+        X_NODISCARD T* Get(u64 key) {
+            return GetSlot(key) ? &*mData[ResourceKey::GetSlot(key)] : nullptr;
+        }
+
+        void Destroy(u32 slot) override {
+            mData[slot].reset();
+            FreeSlot(slot);
+        }
+
+    private:
+        vector<optional<T>> mData;  // Parallel to mSlots
+    };
+
+    /// @brief Pools for every resource type a ResourceManager has loaded, indexed by ResourceTypeIndex. Shared with
+    /// every handle, so resources still referenced when their manager goes away stay valid until they're released.
+    /// Reference counts aren't atomic, handles are only copied and released on the main thread.
+    class ResourceStore {
+        X_CLASS_PREVENT_MOVES_COPIES(ResourceStore)
+
+    public:
+        ResourceStore() = default;
+
+        /// @brief Returns the new resource's key. Nothing references it yet.
+        template<typename T>
+        u64 Add(T data, size_t gpuBytes = 0) {
+            const u32 type = ResourceTypeIndex::Get<T>();
+            X_ASSERT(type < ResourceTypeIndex::kMaxTypes)
+            if (type >= mPools.size()) { mPools.resize(type + 1); }
+            if (!mPools[type]) { mPools[type] = make_unique<ResourcePool<T>>(); }
+
+            return CAST<ResourcePool<T>&>(*mPools[type]).Add(std::move(data), gpuBytes);
+        }
+
+        /// @brief O(1): an index into the type's pool and a generation check. Null if the key is stale.
+        template<typename T>
+        X_NODISCARD T* Resolve(u64 key) {
+            return CAST<ResourcePool<T>&>(*mPools[ResourceKey::GetType(key)]).Get(key);
+        }
+
+        /// @brief Null if the key is stale.
+        X_NODISCARD ResourceSlot* GetSlot(u64 key) {
+            const u32 type = ResourceKey::GetType(key);
+            if (type >= mPools.size() || !mPools[type]) { return nullptr; }
+            return mPools[type]->GetSlot(key);
+        }
+
+        void AddRef(u64 key) {
+            if (auto* slot = GetSlot(key)) { slot->mRefs++; }
+        }
+
+        void Release(u64 key) {
+            auto* slot = GetSlot(key);
+            if (slot && --slot->mRefs == 0 && slot->mOrphaned) { Destroy(key); }
+        }
+
+        /// @brief Destroys the resource straight away if nothing references it, otherwise once the last handle is
+        /// released.
+        void Drop(u64 key) {
+            auto* slot = GetSlot(key);
+            if (!slot) { return; }
+            if (slot->mRefs == 0) {
+                Destroy(key);
+            } else {
+                slot->mOrphaned = true;
+            }
+        }
+
+        X_NODISCARD u32 GetRefCount(u64 key) {
+            const auto* slot = GetSlot(key);
+            return slot ? slot->mRefs : 0;
+        }
+
+    private:
+        vector<unique_ptr<ResourcePoolBase>> mPools;
+
+        void Destroy(u64 key) {
+            mPools[ResourceKey::GetType(key)]->Destroy(ResourceKey::GetSlot(key));
+        }
+    };
+
+    /// @brief Untyped reference to a resource in a ResourceStore, which it keeps alive.
+    class ResourceRef {
+    public:
+        ResourceRef() = default;
+
+        ResourceRef(shared_ptr<ResourceStore> store, const u64 key) : mStore(std::move(store)), mKey(key) {
+            if (mStore) { mStore->AddRef(mKey); }
+        }
+
+        ~ResourceRef() {
+            Reset();
+        }
+
+        ResourceRef(const ResourceRef& other) : ResourceRef(other.mStore, other.mKey) {}
+
+        ResourceRef(ResourceRef&& other) noexcept
+            : mStore(std::move(other.mStore)), mKey(std::exchange(other.mKey, 0)) {}
+
+        ResourceRef& operator=(const ResourceRef& other) {
+            if (this != &other) { *this = ResourceRef(other); }
+            return *this;
+        }
+
+        ResourceRef& operator=(ResourceRef&& other) noexcept {
+            if (this != &other) {
+                Reset();
+                mStore = std::move(other.mStore);
+                mKey   = std::exchange(other.mKey, 0);
+            }
+            return *this;
+        }
+
+        void Reset() {
+            if (mStore) { mStore->Release(mKey); }
+            mStore.reset();
+            mKey = 0;
+        }
+
+        template<typename T>
+        X_NODISCARD T* Resolve() const {
+            return mStore ? mStore->Resolve<T>(mKey) : nullptr;
+        }
+
+        X_NODISCARD u64 GetKey() const {
+            return mKey;
+        }
+
+        explicit operator bool() const {
+            return mStore != nullptr;
+        }
+
+    private:
+        shared_ptr<ResourceStore> mStore;
+        u64 mKey {0};
+    };
+}  // namespace x
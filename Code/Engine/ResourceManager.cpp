@@ -1,3 +1,224 @@
 #include "ResourceManager.hpp"
+#include "Common/Parallel.hpp"
 
-namespace x {}
\ No newline at end of file
+namespace x {
+    ResourceManager::~ResourceManager() {
+        {
+            std::lock_guard lock(mQueueMutex);
+            mStopping = true;
+        }
+        mPrepareReady.notify_all();
+        for (auto& worker : mWorkers) {
+            worker.join();
+        }
+
+        Clear();
+    }
+
+    void ResourceManager::Touch(Entry& entry) {
+        mRecent.splice(mRecent.begin(), mRecent, entry.mRecent);
+    }
+
+    void ResourceManager::Insert(u64 id, u64 key, size_t size) {
+        // Room is made before it goes in, so a new resource can't be evicted before the caller gets to fetch it
+        Evict(size);
+
+        mUsedMemory += size;
+        mRecent.push_front(id);
+        mResources[id] = {key, size, mRecent.begin()};
+    }
+
+    void ResourceManager::Erase(std::unordered_map<u64, Entry>::iterator it) {
+        mUsedMemory -= it->second.mSize;
+        mRecent.erase(it->second.mRecent);
+        mStore->Drop(it->second.mKey);
+        mResources.erase(it);
+    }
+
+    void ResourceManager::Evict(size_t needed) {
+        auto recent = mRecent.end();
+        while (mUsedMemory + needed > mBudget && recent != mRecent.begin()) {
+            const auto candidate = std::prev(recent);
+            const auto it        = mResources.find(*candidate);
+
+            if (mStore->GetRefCount(it->second.mKey) > 0) {
+                recent = candidate;
+                continue;
+            }
+            Erase(it);
+        }
+    }
+
+    void ResourceManager::Trim() {
+        Evict(0);
+    }
+
+    void ResourceManager::Update(bool wait) {
+        vector<shared_ptr<ResourceLoadState>> prepared;
+        {
+            std::unique_lock lock(mQueueMutex);
+            if (wait && !mPending.empty()) {
+                mFinalizeReady.wait(lock, [this]() { return !mFinalizeQueue.empty(); });
+            }
+            prepared.swap(mFinalizeQueue);
+        }
+
+        for (const auto& state : prepared) {
+            if (state->mCancelled) { continue; }
+            mPending.erase(state->mId);
+
+            const auto staging = std::move(state->mStaging);
+            if (const auto it = mResources.find(state->mId); it != mResources.end()) {
+                // Loaded synchronously while this was being prepared
+                Touch(it->second);
+                state->mResource = ResourceRef(mStore, it->second.mKey);
+            } else if (staging) {
+                size_t size   = 0;
+                const u64 key = state->mLoader->Finalize(mRenderContext, state->mId, *staging, *mStore, size);
+                Insert(state->mId, key, size);
+                state->mResource = ResourceRef(mStore, key);
+            }
+            state->mState = state->mResource ? ResourceState::Ready : ResourceState::Failed;
+        }
+
+        // Only resumed once every finished load is in, since a coroutine may well go on to request more
+        for (const auto& state : prepared) {
+            if (state->mCancelled) { continue; }
+            const auto waiters = std::move(state->mWaiters);
+            state->mWaiters.clear();
+            for (const auto& waiter : waiters) {
+                waiter();
+            }
+        }
+    }
+
+    size_t ResourceManager::GetPendingCount() const {
+        return mPending.size();
+    }
+
+    bool ResourceManager::Contains(u64 id) const {
+        return mResources.contains(id);
+    }
+
+    size_t ResourceManager::GetResourceSize(u64 id) const {
+        const auto it = mResources.find(id);
+        return it != mResources.end() ? it->second.mSize : 0;
+    }
+
+    ResourceLoaderBase* ResourceManager::GetLoader(u32 type) const {
+        return type < mLoaders.size() ? mLoaders[type].get() : nullptr;
+    }
+
+    shared_ptr<ResourceLoadState> ResourceManager::LoadAsync(u64 id, u32 type) {
+        auto state = make_shared<ResourceLoadState>();
+        state->mId = id;
+
+        if (const auto it = mResources.find(id); it != mResources.end()) {
+            Touch(it->second);
+            state->mResource = ResourceRef(mStore, it->second.mKey);
+            state->mState    = ResourceState::Ready;
+            return state;
+        }
+
+        if (const auto it = mPending.find(id); it != mPending.end()) { return it->second; }
+
+        state->mLoader = GetLoader(type);
+        if (!state->mLoader) {
+            state->mState = ResourceState::Failed;  // no registered loader for type
+            return state;
+        }
+
+        mPending[id] = state;
+        {
+            std::lock_guard lock(mQueueMutex);
+            StartWorkers();
+            mPrepareQueue.push_back(state);
+        }
+        mPrepareReady.notify_one();
+
+        return state;
+    }
+
+    void ResourceManager::StartWorkers() {
+        if (!mWorkers.empty()) { return; }
+
+        // Same share of the cores as the asset prefetcher, which does the reading and decompression ahead of these
+        const u32 count = X_MAX(DefaultJobCount() / 2, 1u);
+        mWorkers.reserve(count);
+        for (u32 i = 0; i < count; ++i) {
+            mWorkers.emplace_back([this]() { WorkerThread(); });
+        }
+    }
+
+    void ResourceManager::WorkerThread() {
+        for (;;) {
+            shared_ptr<ResourceLoadState> state;
+            {
+                std::unique_lock lock(mQueueMutex);
+                mPrepareReady.wait(lock, [this]() { return mStopping || !mPrepareQueue.empty(); });
+                if (mStopping) { return; }
+
+                state = std::move(mPrepareQueue.front());
+                mPrepareQueue.pop_front();
+                mPreparing++;
+            }
+
+            auto staging = state->mLoader->Prepare(state->mId);
+            {
+                std::lock_guard lock(mQueueMutex);
+                state->mStaging = std::move(staging);
+                mFinalizeQueue.push_back(std::move(state));
+                mPreparing--;
+            }
+            mFinalizeReady.notify_one();
+            mPrepareIdle.notify_all();
+        }
+    }
+
+    void ResourceManager::CancelLoads() {
+        {
+            // Staging may hold views into the mounted pak, so it's released here rather than whenever Update runs
+            std::unique_lock lock(mQueueMutex);
+            mPrepareQueue.clear();
+            mPrepareIdle.wait(lock, [this]() { return mPreparing == 0; });
+            mFinalizeQueue.clear();
+        }
+
+        for (const auto& [id, state] : mPending) {
+            state->mCancelled = true;
+            state->mState     = ResourceState::Failed;
+            state->mStaging.reset();
+            state->mWaiters.clear();
+        }
+        mPending.clear();
+    }
+
+    void ResourceManager::Clear() {
+        CancelLoads();
+
+        // Referenced ones are left to their handles
+        for (const auto& [id, entry] : mResources) {
+            mStore->Drop(entry.mKey);
+        }
+        mResources.clear();
+        mRecent.clear();
+        mUsedMemory = 0;
+    }
+
+    void ResourceManager::SetBudget(size_t budget) {
+        mBudget = budget;
+        Trim();
+    }
+
+    size_t ResourceManager::GetBudget() const {
+        return mBudget;
+    }
+
+    size_t ResourceManager::GetUsedMemory() const {
+        return mUsedMemory;
+    }
+
+    size_t ResourceManager::GetResourceCount() const {
+        return mResources.size();
+    }
+}  // namespace x
@@ -1,10 +1,15 @@
 #pragma once
 
-#include <typeindex>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
 
 #include "Common/Typedefs.hpp"
-#include "ArenaAllocator.hpp"
+#include "AsyncResource.hpp"
 #include "EntityId.hpp"
+#include "Resource.hpp"
 #include "RenderContext.hpp"
 
 namespace x {
@@ -14,7 +19,7 @@ namespace x {
         friend class ResourceManager;
 
         using LoaderFactory = unique_ptr<ResourceLoaderBase> (*)();
-        using TypeMap       = std::unordered_map<std::type_index, LoaderFactory>;
+        using TypeMap       = std::unordered_map<u32, LoaderFactory>;  // By ResourceTypeIndex
 
         static TypeMap& GetLoaderFactories() {
             static TypeMap factories;
@@ -25,7 +30,7 @@ namespace x {
         template<typename ResourceT, typename LoaderT>
         struct Registrar {
             Registrar() {
-                ResourceRegistry::GetLoaderFactories()[std::type_index(typeid(ResourceT))] =
+                ResourceRegistry::GetLoaderFactories()[ResourceTypeIndex::Get<ResourceT>()] =
                   []() -> unique_ptr<ResourceLoaderBase> { return make_unique<LoaderT>(); };
             }
         };
@@ -40,137 +45,315 @@ namespace x {
         static const x::ResourceRegistry::Registrar<ResourceType, LoaderType> CONCAT(resourceRegistrar, __LINE__);     \
     }
 
-    class ResourceBase {
-    public:
-        virtual ~ResourceBase() = default;
-    };
-
-    template<typename T>
-    class Resource : public ResourceBase {
-    public:
-        T data;
-
-        template<typename... Args>
-        Resource(Args&&... args) : data(std::forward<Args>(args)...) {}
-    };
-
+    /// @brief Loading is split in two so the expensive part can run on a worker thread. Prepare does everything that
+    /// doesn't need the device (fetching, decompressing, decoding) and may be called from any thread, concurrently for
+    /// different IDs. Finalize creates the GPU objects from what Prepare produced and only runs on the main thread.
     class ResourceLoaderBase {
     public:
-        virtual ~ResourceLoaderBase()                                                               = default;
-        virtual ResourceBase* Load(RenderContext& context, ArenaAllocator& allocator, const u64 id) = 0;
+        virtual ~ResourceLoaderBase() = default;
+
+        /// @brief Returns null if the resource can't be loaded.
+        virtual unique_ptr<ResourceStaging> Prepare(const u64 id) = 0;
+        /// @brief Adds the resource to `store` and returns its key. `size` is set to the bytes it holds, GPU buffers
+        /// and textures included, which is what counts against the manager's budget.
+        virtual u64 Finalize(RenderContext& context,
+                             const u64 id,
+                             ResourceStaging& staging,
+                             ResourceStore& store,
+                             size_t& size) = 0;
+
+        /// @brief Both stages back to back on the calling thread. Returns 0 if the resource can't be loaded.
+        u64 Load(RenderContext& context, const u64 id, ResourceStore& store, size_t& size) {
+            const auto staging = Prepare(id);
+            if (!staging) { return 0; }
+            return Finalize(context, id, *staging, store, size);
+        }
     };
 
-    template<typename T>
+    template<typename T, typename StagingT = ResourceStaging>
     class ResourceLoader : public ResourceLoaderBase {
+        static_assert(std::is_base_of_v<ResourceStaging, StagingT>, "Staging data must derive from ResourceStaging");
+
     public:
-        ResourceBase* Load(RenderContext& context, ArenaAllocator& allocator, const u64 id) override {
-            void* memory = allocator.Allocate(sizeof(Resource<T>), alignof(Resource<T>));
-            if (!memory) return nullptr;
-            return new (memory) Resource<T>(LoadImpl(context, id));
+        unique_ptr<ResourceStaging> Prepare(const u64 id) override {
+            auto staging = PrepareImpl(id);
+            if (staging) { staging->TrackMemory(); }
+            return staging;
+        }
+
+        u64 Finalize(RenderContext& context,
+                     const u64 id,
+                     ResourceStaging& staging,
+                     ResourceStore& store,
+                     size_t& size) override {
+            size_t dataSize = 0;
+            T data          = FinalizeImpl(context, id, CAST<StagingT&>(staging), dataSize);
+            size            = sizeof(T) + dataSize;
+            return store.Add<T>(std::move(data), dataSize);
         }
 
     private:
-        virtual T LoadImpl(RenderContext& context, const u64 id) = 0;
+        virtual unique_ptr<StagingT> PrepareImpl(const u64 id) = 0;
+        /// @brief `size` is set to the bytes the loaded data holds beyond sizeof(T), i.e. its vertex buffers or
+        /// texture, which are counted as GPU memory.
+        virtual T FinalizeImpl(RenderContext& context, const u64 id, StagingT& staging, size_t& size) = 0;
     };
 
     template<typename T>
     class ResourceHandle;
 
+    template<typename T>
+    class AsyncResource;
+
+    /// @brief Loads resources by asset ID and hands out reference counted handles to them.
+    ///
+    /// Resources live in a ResourceStore, in one dense pool per type, and handles address them by key (type index,
+    /// slot and generation), so getting at a resource through a handle is an array index rather than a lookup or a
+    /// cast. The asset ID map is only used to find a resource's key when it's loaded or fetched.
+    ///
+    /// A resource lives until it's been dropped by the manager (evicted or cleared) and no handles to it are left.
+    /// Once the resources it holds go over the budget, unreferenced ones are evicted least recently used first.
+    /// Referenced resources are never evicted, so the budget can be exceeded while they're all in use. Handles share
+    /// the store, so they stay valid even if they outlive the manager.
+    ///
+    /// LoadResource does the whole load on the calling thread. LoadResourceAsync prepares the resource on one of the
+    /// manager's worker threads instead and finalizes it in the next Update once that's done, which also resumes any
+    /// coroutines waiting on it.
     class ResourceManager {
         X_CLASS_PREVENT_MOVES_COPIES(ResourceManager)
 
-        ArenaAllocator mAllocator;
+        struct Entry {
+            u64 mKey {0};
+            size_t mSize {0};
+            std::list<u64>::iterator mRecent;
+        };
+
         RenderContext& mRenderContext;
-        std::unordered_map<u64, ResourceBase*> mResources;
-        std::unordered_map<std::type_index, unique_ptr<ResourceLoaderBase>> mLoaders;
+        shared_ptr<ResourceStore> mStore {make_shared<ResourceStore>()};
+        size_t mBudget {0};
+        size_t mUsedMemory {0};
+        std::unordered_map<u64, Entry> mResources;        // By asset ID
+        std::list<u64> mRecent;                           // Most recently used first
+        vector<unique_ptr<ResourceLoaderBase>> mLoaders;  // By ResourceTypeIndex
+
+        // Asynchronous loads. mPending is only touched on the main thread, the queues are shared with the workers.
+        std::unordered_map<u64, shared_ptr<ResourceLoadState>> mPending;
+        std::mutex mQueueMutex;
+        std::condition_variable mPrepareReady;
+        std::condition_variable mFinalizeReady;
+        std::condition_variable mPrepareIdle;
+        std::deque<shared_ptr<ResourceLoadState>> mPrepareQueue;
+        vector<shared_ptr<ResourceLoadState>> mFinalizeQueue;
+        vector<std::thread> mWorkers;
+        u32 mPreparing {0};  // Loads a worker has taken off the queue and not handed back yet
+        bool mStopping {false};
+
+        void Touch(Entry& entry);
+        void Insert(u64 id, u64 key, size_t size);
+        void Erase(std::unordered_map<u64, Entry>::iterator it);
+        /// @brief Evicts until `needed` more bytes fit in the budget, or nothing unreferenced is left.
+        void Evict(size_t needed);
+
+        X_NODISCARD ResourceLoaderBase* GetLoader(u32 type) const;
+        shared_ptr<ResourceLoadState> LoadAsync(u64 id, u32 type);
+        void StartWorkers();
+        void WorkerThread();
 
     public:
-        explicit ResourceManager(RenderContext& context, const size_t arenaSize = X_GIGABYTES(1))
-            : mAllocator(arenaSize), mRenderContext(context) {
+        explicit ResourceManager(RenderContext& context, const size_t budget = X_GIGABYTES(1))
+            : mRenderContext(context), mBudget(budget) {
             for (const auto& [type, factory] : ResourceRegistry::GetLoaderFactories()) {
+                if (type >= mLoaders.size()) { mLoaders.resize(type + 1); }
                 mLoaders[type] = factory();
             }
         }
 
-        ~ResourceManager() {
-            mAllocator.Reset();
-        }
+        ~ResourceManager();
 
         template<typename T, typename LoaderT>
         void RegisterLoader() {
-            mLoaders[std::type_index(typeid(T))] = make_unique<LoaderT>();
+            const u32 type = ResourceTypeIndex::Get<T>();
+            if (type >= mLoaders.size()) { mLoaders.resize(type + 1); }
+            mLoaders[type] = make_unique<LoaderT>();
         }
 
         template<typename T>
         bool LoadResource(const u64 id) {
-            if (mResources.contains(id)) {
+            if (const auto it = mResources.find(id); it != mResources.end()) {
+                Touch(it->second);
                 return true;  // asset already exists
             }
 
-            auto loaderIt = mLoaders.find(std::type_index(typeid(T)));
-            if (loaderIt == mLoaders.end()) {
+            auto* loader = GetLoader(ResourceTypeIndex::Get<T>());
+            if (!loader) {
                 return false;  // no registered loader for type
             }
 
-            ResourceBase* resource = loaderIt->second->Load(mRenderContext, mAllocator, id);
-            if (!resource) {
+            size_t size   = 0;
+            const u64 key = loader->Load(mRenderContext, id, *mStore, size);
+            if (key == 0) {
                 return false;  // loading failed
             }
 
-            mResources[id] = resource;
+            Insert(id, key, size);
             return true;
         }
 
+        /// @brief Starts loading the resource in the background, or returns one that's already ready if it's loaded.
+        /// Requesting a resource that's already being loaded waits on the same load.
+        template<typename T>
+        AsyncResource<T> LoadResourceAsync(const u64 id) {
+            return AsyncResource<T>(LoadAsync(id, ResourceTypeIndex::Get<T>()));
+        }
+
         template<typename T>
         ResourceHandle<T> FetchResource(const u64 id) {
             auto it = mResources.find(id);
             if (it == mResources.end()) { return ResourceHandle<T> {}; }
 
-            Resource<T>* typedResource = DCAST<Resource<T>*>(it->second);
-            if (!typedResource) { return {}; }
+            // Loaded as some other type
+            if (ResourceKey::GetType(it->second.mKey) != ResourceTypeIndex::Get<T>()) { return {}; }
 
-            return ResourceHandle<T>(this, id, &typedResource->data);
+            Touch(it->second);
+            return ResourceHandle<T>(id, ResourceRef(mStore, it->second.mKey));
         }
 
-        void Clear() {
-            mResources.clear();
-            mAllocator.Reset();
-        }
+        /// @brief Finalizes every asynchronous load whose worker stage is done and resumes whatever is waiting on them.
+        /// Call once per frame on the main thread. With `wait`, blocks until at least one load is done first (unless
+        /// none are in progress).
+        void Update(bool wait = false);
 
-        const ArenaAllocator& GetAllocator() {
-            return mAllocator;
-        }
+        X_NODISCARD size_t GetPendingCount() const;
+
+        /// @brief Whether the resource is loaded and still in the manager, referenced or not.
+        X_NODISCARD bool Contains(u64 id) const;
+        /// @brief Bytes the resource holds, 0 if it isn't in the manager.
+        X_NODISCARD size_t GetResourceSize(u64 id) const;
+
+        /// @brief Evicts unreferenced resources, least recently used first, until usage is within the budget.
+        void Trim();
+
+        /// @brief Cancels every asynchronous load and marks it failed, without resuming anything waiting on it. Blocks
+        /// until the ones a worker is already preparing are done, so once it returns nothing is reading assets (or
+        /// holding views into a mounted pak) on the manager's behalf. Call before AssetManager::ReloadAssets.
+        void CancelLoads();
+
+        /// @brief Drops every resource. Those still referenced by handles are destroyed when their last handle is.
+        /// Loads in progress are cancelled as with CancelLoads.
+        void Clear();
+
+        /// @brief Lowering the budget evicts straight away if usage is over the new one.
+        void SetBudget(size_t budget);
+
+        X_NODISCARD size_t GetBudget() const;
+        /// @brief Bytes held by the resources currently in the manager, see ResourceLoaderBase::Finalize.
+        X_NODISCARD size_t GetUsedMemory() const;
+        X_NODISCARD size_t GetResourceCount() const;
     };
 
+    /// @brief Reference to a resource of type T. Resolving it is an index into T's pool plus a generation check, so
+    /// don't hold on to the pointer it gives back: loading another T can move it.
     template<typename T>
     class ResourceHandle {
-        ResourceManager* mManager;
         u64 mId {0};
-        T* mData;
+        ResourceRef mResource;
 
     public:
-        ResourceHandle() : mManager(nullptr), mData(nullptr) {}
+        ResourceHandle() = default;
 
-        ResourceHandle(ResourceManager* manager, const u64 id, T* data) : mManager(manager), mId(id), mData(data) {}
+        ResourceHandle(const u64 id, ResourceRef resource) : mId(id), mResource(std::move(resource)) {}
 
         T* Get() {
-            return mData;
+            return mResource.Resolve<T>();
         }
 
         const T* Get() const {
-            return mData;
+            return mResource.Resolve<T>();
         }
 
         T* operator->() {
-            return mData;
+            return Get();
         }
 
         const T* operator->() const {
-            return mData;
+            return Get();
+        }
+
+        /// @brief Drops this handle's reference, leaving it invalid.
+        void Reset() {
+            mResource.Reset();
+            mId = 0;
+        }
+
+        [[nodiscard]] u64 GetId() const {
+            return mId;
         }
 
         [[nodiscard]] bool Valid() const {
-            return (mManager != nullptr) && (mData != nullptr) && (mId != 0) && (EntityId {mId}.Valid());
+            return (mResource.Resolve<T>() != nullptr) && (mId != 0) && (EntityId {mId}.Valid());
+        }
+    };
+
+    /// @brief A resource being loaded by ResourceManager::LoadResourceAsync. Check its state or `co_await` it, which
+    /// resumes once the load is done and gives back the handle (invalid if it failed). Only use on the main thread.
+    template<typename T>
+    class AsyncResource {
+        shared_ptr<ResourceLoadState> mState;
+
+    public:
+        AsyncResource() = default;
+
+        explicit AsyncResource(shared_ptr<ResourceLoadState> state) : mState(std::move(state)) {}
+
+        X_NODISCARD ResourceState GetState() const {
+            return mState ? mState->mState : ResourceState::Failed;
+        }
+
+        X_NODISCARD bool IsPending() const {
+            return GetState() == ResourceState::Pending;
+        }
+
+        X_NODISCARD bool IsReady() const {
+            return GetState() == ResourceState::Ready;
+        }
+
+        X_NODISCARD bool IsFailed() const {
+            return GetState() == ResourceState::Failed;
+        }
+
+        /// @brief The loaded resource once it's ready, otherwise an invalid handle.
+        X_NODISCARD ResourceHandle<T> Get() const {
+            if (!IsReady() || ResourceKey::GetType(mState->mResource.GetKey()) != ResourceTypeIndex::Get<T>()) {
+                return {};
+            }
+            return ResourceHandle<T>(mState->mId, mState->mResource);
+        }
+
+        X_NODISCARD const shared_ptr<ResourceLoadState>& GetLoadState() const {
+            return mState;
+        }
+
+        auto operator co_await() const {
+            struct Awaiter : ResourceAwaiter {
+                const AsyncResource& mResource;
+
+                explicit Awaiter(const AsyncResource& resource) : mResource(resource) {}
+
+                bool await_ready() const {
+                    return !mResource.IsPending();
+                }
+
+                void await_suspend(std::coroutine_handle<> handle) const {
+                    mResource.mState->mWaiters.emplace_back([handle, alive = mAlive]() {
+                        if (*alive) { handle.resume(); }
+                    });
+                }
+
+                ResourceHandle<T> await_resume() const {
+                    return mResource.Get();
+                }
+            };
+            return Awaiter {*this};
         }
     };
 }  // namespace x
\ No newline at end of file
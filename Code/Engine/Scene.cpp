@@ -3,23 +3,49 @@
 #include "StaticResources.hpp"
 #include "SceneParser.hpp"
 #include <optional>
+#include <unordered_set>
 
 #include "WaterMaterial.hpp"
 
 namespace x {
-    Scene::Scene(RenderContext& context, ScriptEngine& scriptEngine)
-        : mResources(context, X_MEGABYTES(128)), mState(), mInitialState(), mContext(context),
-          mScriptEngine(scriptEngine) {}
+    Scene::Scene(RenderContext& context, ScriptEngine& scriptEngine, ResourceManager& resources)
+        : mResources(resources), mState(), mInitialState(), mContext(context), mScriptEngine(scriptEngine) {}
 
     Scene::~Scene() {
         Unload();
     }
 
     void Scene::Load(const SceneDescriptor& descriptor) {
+        BeginLoad(descriptor);
+
+        // Resources are still prepared on the worker threads in parallel, this only waits for them all to be done
+        while (IsLoading()) {
+            mResources.Update(true);
+        }
+    }
+
+    void Scene::BeginLoad(const SceneDescriptor& descriptor) {
+        mLoadTask = {};
+        mLoaded   = false;
+        mLoadTask = LoadAsync(descriptor);
+    }
+
+    bool Scene::IsLoading() const {
+        return !mLoadTask.IsDone();
+    }
+
+    const SceneLoadStats& Scene::GetLoadStats() const {
+        return mLoadStats;
+    }
+
+    LoadTask Scene::LoadAsync(SceneDescriptor descriptor) {
         mState.Reset();
         mInitialState.Reset();
         mOpaqueObjects.clear();
         mTransparentObjects.clear();
+        mLoadStats = {};
+
+        AssetManager::MarkAccessTrace("Scene: " + descriptor.mName);
 
         auto& sun = mState.mLights.mSun;
 
@@ -30,6 +56,70 @@ namespace x {
         sun.mDirection    = {sunDescriptor.mDirection.x, sunDescriptor.mDirection.y, sunDescriptor.mDirection.z, 0.0f};
         sun.mCastsShadows = sunDescriptor.mCastsShadows;
 
+        // Request everything the scene needs up front, so reading and decoding the later assets overlaps with parsing
+        // and uploading the earlier ones. The loads below pick the results up from the prefetch cache. Paks list each
+        // scene's full closure (textures included), otherwise fall back to what the entities reference directly.
+        vector<AssetId> assetIds = descriptor.mAssetIds;
+        if (assetIds.empty()) {
+            for (const auto& entity : descriptor.mEntities) {
+                if (entity.mModel.has_value()) {
+                    assetIds.push_back(entity.mModel->mMeshId);
+                    assetIds.push_back(entity.mModel->mMaterialId);
+                }
+                if (entity.mBehavior.has_value()) { assetIds.push_back(entity.mBehavior->mScriptId); }
+            }
+        }
+        AssetManager::PrefetchAssets(assetIds);
+
+        // Start loading every mesh and texture before creating anything, so they're prepared on the worker threads in
+        // parallel. The frame loop keeps running while this waits, the entities are only created once they're all in.
+        AsyncResourceGroup resources;
+        unordered_map<AssetId, MaterialDescriptor> materials;
+
+        // Anything still in the cache (held by the previous scene, or not evicted since) is reused as it is
+        std::unordered_set<u64> requested;
+        vector<u64> missing;
+        const auto track = [&](const u64 id) {
+            if (!requested.insert(id).second) { return; }
+            if (mResources.Contains(id)) {
+                mLoadStats.mReused++;
+                mLoadStats.mReusedBytes += mResources.GetResourceSize(id);
+            } else {
+                missing.push_back(id);
+            }
+        };
+
+        for (const auto& entity : descriptor.mEntities) {
+            if (!entity.mModel.has_value()) { continue; }
+
+            const auto& model = entity.mModel.value();
+            track(model.mMeshId);
+            resources.Add(mResources.LoadResourceAsync<Model>(model.mMeshId));
+            if (materials.contains(model.mMaterialId)) { continue; }
+
+            const auto materialBytes = AssetManager::GetAssetData(model.mMaterialId);
+            if (!materialBytes.has_value()) { X_LOG_FATAL("Failed to load material resource"); }
+            MaterialDescriptor matDesc {};
+            if (!MaterialParser::Parse(*materialBytes, matDesc)) { continue; }
+            for (const auto& texture : matDesc.mTextures) {
+                track(texture.mAssetId);
+                resources.Add(mResources.LoadResourceAsync<Texture2D>(texture.mAssetId));
+            }
+            materials[model.mMaterialId] = std::move(matDesc);
+        }
+
+        co_await resources;
+
+        for (const u64 id : missing) {
+            if (mResources.Contains(id)) {
+                mLoadStats.mLoaded++;
+                mLoadStats.mLoadedBytes += mResources.GetResourceSize(id);
+            } else {
+                mLoadStats.mFailed++;
+            }
+        }
+
+        // Everything is loaded now (failures are reported below), so the Load/Fetch calls just pick the resources up
         for (auto& entity : descriptor.mEntities) {
             const EntityId newEntity = mState.CreateEntity(entity.mName);
 
@@ -57,10 +147,9 @@ namespace x {
                   .SetMaterialId(model.mMaterialId);
 
                 // Load material
-                const auto materialBytes = AssetManager::GetAssetData(model.mMaterialId);
-                if (!materialBytes.has_value()) { X_LOG_FATAL("Failed to load material resource"); }
-                MaterialDescriptor matDesc {};
-                if (MaterialParser::Parse(*materialBytes, matDesc)) { LoadMaterial(matDesc, modelComponent); }
+                if (const auto it = materials.find(model.mMaterialId); it != materials.end()) {
+                    LoadMaterial(it->second, modelComponent);
+                }
             }
 
             if (entity.mBehavior.has_value()) {
@@ -89,19 +178,27 @@ namespace x {
         mLoaded       = true;
 
         Awake();
-        X_LOG_INFO("Loaded scene: '%s'", descriptor.mName.c_str())
+        X_LOG_INFO("Loaded scene: '%s' (%u resources reused, %.2f MB; %u loaded, %.2f MB; %u failed)",
+                   descriptor.mName.c_str(),
+                   mLoadStats.mReused,
+                   CAST<f64>(mLoadStats.mReusedBytes) / X_MEGABYTES(1),
+                   mLoadStats.mLoaded,
+                   CAST<f64>(mLoadStats.mLoadedBytes) / X_MEGABYTES(1),
+                   mLoadStats.mFailed)
     }
 
     void Scene::Unload() {
+        mLoadTask = {};  // Abandons a load still in progress
         Destroyed();
+        // The initial state holds handles too. Once both have let go, whatever only this scene used can be evicted
+        // from the shared cache, the rest stays loaded for the next scene.
         mState.Reset();
-        mResources.Clear();
+        mInitialState.Reset();
         mLoaded = false;
     }
 
     void Scene::Reset() {
         mState.Reset();
-        mResources.Clear();
     }
 
     void Scene::ResetState() {
@@ -121,6 +218,10 @@ namespace x {
     }
 
     void Scene::Update(f32 deltaTime) {
+        // Finishes resources loaded in the background, which resumes the load itself as they come in
+        mResources.Update();
+        if (IsLoading()) { return; }
+
         static f32 sceneTime {0.f};
         sceneTime += deltaTime;
 
@@ -9,12 +9,29 @@
 #include "SceneParser.hpp"
 
 namespace x {
+    /// @brief What the last load found in the resource cache. Reused resources were already loaded (by the previous
+    /// scene, usually), so only the ones counted as loaded had to be read and created.
+    struct SceneLoadStats {
+        u32 mReused {0};
+        u32 mLoaded {0};
+        u32 mFailed {0};
+        size_t mReusedBytes {0};
+        size_t mLoadedBytes {0};
+    };
+
     class Scene {
     public:
-        explicit Scene(RenderContext& context, ScriptEngine& scriptEngine);
+        /// @brief `resources` is shared between scenes and outlives them, so resources the next scene also uses stay
+        /// loaded across a transition. The scene only holds handles to what it uses.
+        explicit Scene(RenderContext& context, ScriptEngine& scriptEngine, ResourceManager& resources);
         ~Scene();
 
+        /// @brief Loads the scene, blocking until it's done.
         void Load(const SceneDescriptor& descriptor);
+        /// @brief Starts loading the scene without blocking. Resources are loaded in the background and the scene is
+        /// built as Update is called each frame, IsLoading is true until it's ready. Update and the draw calls don't do
+        /// anything until then.
+        void BeginLoad(const SceneDescriptor& descriptor);
         void Unload();
 
         void Reset();
@@ -32,11 +49,14 @@ namespace x {
         X_NODISCARD ResourceManager& GetResourceManager();
         X_NODISCARD const str& GetName() const;
         X_NODISCARD bool Loaded() const;
+        X_NODISCARD bool IsLoading() const;
+        X_NODISCARD const SceneLoadStats& GetLoadStats() const;
 
         shared_ptr<IMaterial> LoadMaterial(const MaterialDescriptor& material);
 
     private:
-        ResourceManager mResources;
+        ResourceManager& mResources;
+        LoadTask mLoadTask;
         SceneState mState;
         SceneState mInitialState;
         RenderContext& mContext;
@@ -44,11 +64,13 @@ namespace x {
         str mName;
         str mDescription;
         bool mLoaded {false};
+        SceneLoadStats mLoadStats;
 
         using ModelTransformPair = std::pair<const ModelComponent*, const TransformComponent*>;
         vector<ModelTransformPair> mOpaqueObjects;
         vector<ModelTransformPair> mTransparentObjects;
 
+        LoadTask LoadAsync(SceneDescriptor descriptor);
         void LoadMaterial(const MaterialDescriptor& material, ModelComponent& modelComponent);
     };
 }  // namespace x
\ No newline at end of file
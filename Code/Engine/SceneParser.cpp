@@ -1,6 +1,9 @@
 #include "SceneParser.hpp"
 #include "EngineCommon.hpp"
 #include "Common/XML.hpp"
+#include "Tools/XPak/DescriptorCompiler.hpp"
+
+#include <cstring>
 
 namespace x {
     static bool ParseWorld(SceneDescriptor& descriptor, const rapidxml::xml_node<>* worldNode) {
@@ -149,6 +152,82 @@ namespace x {
         return (worldResult && entitiesResult);
     }
 
+    // Reads a scene compiled by xpakc. Every record is fixed-size, so this is just copying fields across.
+    static bool ParseBinary(std::span<const u8> data, SceneDescriptor& descriptor) {
+        BinarySceneHeader header;
+        std::memcpy(&header, data.data(), sizeof(BinarySceneHeader));
+        if (header.mVersion != kBinaryDescriptorVersion) {
+            X_LOG_ERROR("Unsupported compiled scene version %u", header.mVersion);
+            return false;
+        }
+
+        const u64 entitiesSize = CAST<u64>(header.mEntityCount) * sizeof(BinaryEntity);
+        if (sizeof(BinarySceneHeader) + entitiesSize + header.mStringTableSize != data.size()) {
+            X_LOG_ERROR("Compiled scene is truncated");
+            return false;
+        }
+
+        const auto records = data.subspan(sizeof(BinarySceneHeader), entitiesSize);
+        const auto strings = data.subspan(sizeof(BinarySceneHeader) + entitiesSize);
+
+        descriptor.mName        = str(DescriptorCompiler::GetString(strings, header.mName));
+        descriptor.mDescription = str(DescriptorCompiler::GetString(strings, header.mDescription));
+
+        auto& sunDesc         = descriptor.mWorld.mLights.mSun;
+        sunDesc.mEnabled      = header.mSunEnabled != 0;
+        sunDesc.mIntensity    = header.mSunIntensity;
+        sunDesc.mColor        = Color(header.mSunColor[0], header.mSunColor[1], header.mSunColor[2]);
+        sunDesc.mDirection    = Float3(header.mSunDirection);
+        sunDesc.mCastsShadows = header.mSunCastsShadows != 0;
+
+        descriptor.mWorld.mSky.mSkyColor = Color(header.mSkyColor[0], header.mSkyColor[1], header.mSkyColor[2]);
+
+        descriptor.mEntities.reserve(header.mEntityCount);
+        for (u32 i = 0; i < header.mEntityCount; ++i) {
+            BinaryEntity entity;
+            std::memcpy(&entity, records.data() + CAST<size_t>(i) * sizeof(BinaryEntity), sizeof(BinaryEntity));
+
+            EntityDescriptor entityDesc {};
+            entityDesc.mId        = entity.mId;
+            entityDesc.mName      = str(DescriptorCompiler::GetString(strings, entity.mName));
+            entityDesc.mTransform = TransformDescriptor {
+              .mPosition = Float3(entity.mPosition),
+              .mRotation = Float3(entity.mRotation),
+              .mScale    = Float3(entity.mScale),
+            };
+
+            if (CHECK_FLAG(entity.mComponents, kBinaryEntity_Model)) {
+                entityDesc.mModel = ModelDescriptor {
+                  .mMeshId         = entity.mMeshId,
+                  .mMaterialId     = entity.mMaterialId,
+                  .mCastsShadows   = CHECK_FLAG(entity.mModelFlags, kBinaryModel_CastsShadows),
+                  .mReceiveShadows = CHECK_FLAG(entity.mModelFlags, kBinaryModel_ReceiveShadows),
+                };
+            }
+
+            if (CHECK_FLAG(entity.mComponents, kBinaryEntity_Camera)) {
+                entityDesc.mCamera = CameraDescriptor {
+                  .mFOV          = entity.mCameraFOV,
+                  .mNearZ        = entity.mCameraNearZ,
+                  .mFarZ         = entity.mCameraFarZ,
+                  .mOrthographic = entity.mCameraOrthographic != 0,
+                  .mWidth        = entity.mCameraWidth,
+                  .mHeight       = entity.mCameraHeight,
+                };
+            }
+
+            if (CHECK_FLAG(entity.mComponents, kBinaryEntity_Behavior)) {
+                entityDesc.mBehavior = BehaviorDescriptor {
+                  .mScriptId = entity.mScriptId,
+                };
+            }
+
+            descriptor.mEntities.push_back(std::move(entityDesc));
+        }
+
+        return true;
+    }
+
     bool SceneParser::Parse(const Path& filename, SceneDescriptor& descriptor) {
         rapidxml::xml_document<> doc;
         if (!XML::ReadFile(filename, doc)) return false;
@@ -156,6 +235,11 @@ namespace x {
     }
 
     bool SceneParser::Parse(std::span<const u8> data, SceneDescriptor& descriptor) {
+        // Paks store scenes compiled to binary, loose content and the editor use the XML
+        if (DescriptorCompiler::IsCompiled(data, kBinarySceneMagic, sizeof(BinarySceneHeader))) {
+            return ParseBinary(data, descriptor);
+        }
+
         rapidxml::xml_document<> doc;
 
         const auto buffer = new char[data.size() + 1];
@@ -78,7 +78,7 @@ namespace x {
         } mWorld;
 
         vector<EntityDescriptor> mEntities;
-        vector<u64> mAssetIds;
+        vector<u64> mAssetIds;  // Everything the scene needs, see AssetManager::GetDependencies
 
         bool IsValid() const {
             return (!mName.empty()) && (mEntities.size() > 0);
@@ -195,6 +195,11 @@ namespace x {
             } catch (const sol::error&) { return false; }
         }
 
+        /// @brief Bytes currently allocated by the Lua heap.
+        X_NODISCARD size_t GetMemoryUsage() const {
+            return mLua.memory_used();
+        }
+
         template<typename T>
         void RegisterType() {
             LuaRegistry<T> {}.RegisterWithLua(mLua);
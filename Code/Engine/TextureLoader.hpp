@@ -8,29 +8,54 @@
 #include "AssetManager.hpp"
 
 namespace x {
-    class TextureLoader2D final : public ResourceLoader<Texture2D> {
-        Texture2D LoadImpl(RenderContext& context, const u64 id) override {
-            Texture2D texture(context);
+    /// @brief A DDS texture parsed into system memory on a worker thread, ready to upload.
+    struct TextureStaging final : ResourceStaging {
+        TexMetadata mMetadata;
+        ScratchImage mImage;
 
-            TexMetadata metadata;
-            ScratchImage scratchImage;
+        size_t GetSize() const override {
+            return mImage.GetPixelsSize();
+        }
+    };
 
-            const auto textureBytes = AssetManager::GetAssetData(id);
-            if (!textureBytes.has_value()) {
-                X_LOG_ERROR("Failed to load texture with id %llu", id);
-                return texture;
+    class TextureLoader2D final : public ResourceLoader<Texture2D, TextureStaging> {
+        unique_ptr<TextureStaging> PrepareImpl(const u64 id) override {
+            auto staging = make_unique<TextureStaging>();
+
+            // Textures are stored uncompressed, so when reading from a pak file we can hand DirectXTex the mapped
+            // bytes directly and skip the copy
+            std::span<const u8> textureData = AssetManager::GetAssetView(id);
+            optional<vector<u8>> textureBytes;
+            if (textureData.empty()) {
+                textureBytes = AssetManager::GetAssetData(id);
+                if (!textureBytes.has_value()) {
+                    X_LOG_ERROR("Failed to load texture with id %llu", id);
+                    return nullptr;
+                }
+                textureData = *textureBytes;
             }
 
-            auto hr =
-              LoadFromDDSMemory(textureBytes->data(), textureBytes->size(), DDS_FLAGS_NONE, &metadata, scratchImage);
-            X_PANIC_ASSERT(SUCCEEDED(hr), "Failed to load DDS texture file: %llu", id)
+            const auto hr = LoadFromDDSMemory(
+              textureData.data(), textureData.size(), DDS_FLAGS_NONE, &staging->mMetadata, staging->mImage);
+            if (FAILED(hr)) {
+                X_LOG_ERROR("Failed to load DDS texture file: %llu", id);
+                return nullptr;
+            }
+
+            return staging;
+        }
+
+        Texture2D FinalizeImpl(RenderContext& context, const u64 id, TextureStaging& staging, size_t& size) override {
+            Texture2D texture(context);
+            const auto& scratchImage = staging.mImage;
 
-            hr = CreateShaderResourceView(context.GetDevice(),
-                                          scratchImage.GetImages(),
-                                          scratchImage.GetImageCount(),
-                                          metadata,
-                                          &texture.mTextureView);
+            auto hr = CreateShaderResourceView(context.GetDevice(),
+                                               scratchImage.GetImages(),
+                                               scratchImage.GetImageCount(),
+                                               staging.mMetadata,
+                                               &texture.mTextureView);
             X_PANIC_ASSERT(SUCCEEDED(hr), "Failed to create shader resource view from texture.")
+            size = scratchImage.GetPixelsSize();
 
             D3D11_SAMPLER_DESC samplerDesc {};
             samplerDesc.Filter         = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
@@ -21,7 +21,7 @@ public:
     void OnInitialize() override {
         // Simply render to the window viewport
         mGame.Initialize(this, mWindowViewport.get());
-        mGame.TransitionScene(mInitialScene);
+        mGame.TransitionScene(mInitialScene, true);
     }
 
     void OnUpdate() override {
@@ -0,0 +1,103 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "ResourceBlob.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace x {
+    ResourceBlob::ResourceBlob(std::span<const u8> data) {
+        if (data.size() < sizeof(ResourceBlobHeader)) { return; }
+
+        ResourceBlobHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.mMagic != kResourceBlobMagic || header.mVersion != kResourceBlobVersion) { return; }
+
+        const size_t indexSize = CAST<size_t>(header.mEntryCount) * sizeof(ResourceBlobEntry);
+        if (data.size() - sizeof(header) < indexSize + header.mStringTableSize) { return; }
+
+        const auto entries = std::span(RCAST<const ResourceBlobEntry*>(data.data() + sizeof(header)),
+                                       header.mEntryCount);
+        const auto strings = std::string_view(RCAST<const char*>(data.data() + sizeof(header) + indexSize),
+                                              header.mStringTableSize);
+        for (const auto& entry : entries) {
+            if (CAST<u64>(entry.mNameOffset) + entry.mNameSize > strings.size()) { return; }
+            if (entry.mDataOffset > data.size() || entry.mDataSize > data.size() - entry.mDataOffset) { return; }
+        }
+
+        mData    = data;
+        mEntries = entries;
+        mStrings = strings;
+    }
+
+    vector<u8> ResourceBlob::Build(vector<ResourceBlobImage> images) {
+        std::ranges::sort(images, {}, &ResourceBlobImage::mName);
+
+        ResourceBlobHeader header;
+        header.mEntryCount = CAST<u32>(images.size());
+        for (const auto& image : images) {
+            header.mStringTableSize += CAST<u32>(image.mName.size());
+        }
+
+        const size_t dataStart =
+          sizeof(header) + images.size() * sizeof(ResourceBlobEntry) + header.mStringTableSize;
+        vector<ResourceBlobEntry> entries;
+        str strings;
+        u64 dataOffset = dataStart;
+
+        for (const auto& image : images) {
+            ResourceBlobEntry entry;
+            entry.mNameOffset = CAST<u32>(strings.size());
+            entry.mNameSize   = CAST<u32>(image.mName.size());
+            entry.mWidth      = image.mWidth;
+            entry.mHeight     = image.mHeight;
+            entry.mDataOffset = dataOffset;
+            entry.mDataSize   = image.mCompressed.size();
+            entries.push_back(entry);
+
+            strings += image.mName;
+            dataOffset += image.mCompressed.size();
+        }
+
+        vector<u8> blob(dataOffset);
+        u8* out = blob.data();
+        std::memcpy(out, &header, sizeof(header));
+        out += sizeof(header);
+        std::memcpy(out, entries.data(), entries.size() * sizeof(ResourceBlobEntry));
+        out += entries.size() * sizeof(ResourceBlobEntry);
+        std::memcpy(out, strings.data(), strings.size());
+        out += strings.size();
+        for (const auto& image : images) {
+            std::memcpy(out, image.mCompressed.data(), image.mCompressed.size());
+            out += image.mCompressed.size();
+        }
+
+        return blob;
+    }
+
+    bool ResourceBlob::IsValid() const {
+        return !mData.empty();
+    }
+
+    u32 ResourceBlob::GetCount() const {
+        return CAST<u32>(mEntries.size());
+    }
+
+    const ResourceBlobEntry* ResourceBlob::Find(std::string_view name) const {
+        // Entries are sorted by name
+        const auto it = std::ranges::lower_bound(
+          mEntries, name, {}, [this](const ResourceBlobEntry& entry) { return GetName(entry); });
+        if (it == mEntries.end() || GetName(*it) != name) { return nullptr; }
+        return &*it;
+    }
+
+    std::string_view ResourceBlob::GetName(const ResourceBlobEntry& entry) const {
+        return mStrings.substr(entry.mNameOffset, entry.mNameSize);
+    }
+
+    std::span<const u8> ResourceBlob::GetData(const ResourceBlobEntry& entry) const {
+        return mData.subspan(entry.mDataOffset, entry.mDataSize);
+    }
+}  // namespace x
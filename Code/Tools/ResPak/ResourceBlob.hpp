@@ -0,0 +1,72 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Common/Macros.hpp"
+#include "Common/Typedefs.hpp"
+
+#include <span>
+#include <string_view>
+
+namespace x {
+    static constexpr u32 kResourceBlobMagic   = 0x53455258;  // 'XRES'
+    static constexpr u32 kResourceBlobVersion = 1;
+
+#pragma pack(push, 1)
+    struct ResourceBlobHeader {
+        u32 mMagic {kResourceBlobMagic};
+        u32 mVersion {kResourceBlobVersion};
+        u32 mEntryCount {0};
+        u32 mStringTableSize {0};
+    };
+
+    /// @brief One Brotli compressed RGBA8 image. Offsets are from the start of the blob.
+    struct ResourceBlobEntry {
+        u32 mNameOffset {0};  // Into the string table
+        u32 mNameSize {0};
+        u32 mWidth {0};
+        u32 mHeight {0};
+        u64 mDataOffset {0};
+        u64 mDataSize {0};
+    };
+#pragma pack(pop)
+
+    struct ResourceBlobImage {
+        str mName;
+        u32 mWidth {0};
+        u32 mHeight {0};
+        vector<u8> mCompressed;
+    };
+
+    /// @brief A single file holding every image a tool embeds (editor icons, logos), so it can be linked into the
+    /// executable as one resource rather than compiled from huge generated byte arrays.
+    ///
+    /// Layout:
+    ///   ResourceBlobHeader
+    ///   ResourceBlobEntry x entry count, sorted by name
+    ///   String table (names, not null-terminated)
+    ///   [Compressed image data]
+    ///
+    /// The reader never copies: names and payloads are views into the embedded bytes, which must outlive it.
+    class ResourceBlob {
+    public:
+        ResourceBlob() = default;
+        /// @brief Validates the header and index. An invalid blob behaves as an empty one.
+        explicit ResourceBlob(std::span<const u8> data);
+
+        static vector<u8> Build(vector<ResourceBlobImage> images);
+
+        X_NODISCARD bool IsValid() const;
+        X_NODISCARD u32 GetCount() const;
+        X_NODISCARD const ResourceBlobEntry* Find(std::string_view name) const;
+        X_NODISCARD std::string_view GetName(const ResourceBlobEntry& entry) const;
+        X_NODISCARD std::span<const u8> GetData(const ResourceBlobEntry& entry) const;
+
+    private:
+        std::span<const u8> mData;
+        std::span<const ResourceBlobEntry> mEntries;
+        std::string_view mStrings;
+    };
+}  // namespace x
@@ -5,12 +5,13 @@
 // Things this needs to do:
 // 1. Read in image data
 // 2. Compress image data bytes with Brotli
-// 3. Write the compressed bytes to a header file with the original size and compressed size
+// 3. Pack every image into a single resource blob with a name index, to be linked into the tool as one resource
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #include <CLI/CLI.hpp>
 
+#include "ResourceBlob.hpp"
 #include "Common/Typedefs.hpp"
 #include "Common/Filesystem.hpp"
 #include "Tools/XPak/Compression.hpp"  // For Brotli helpers
@@ -21,103 +22,69 @@ int main(int argc, char* argv[]) {
     CLI::App app {"ResPak"};
 
     str outputFile;
-    app.add_option("-o,--output", outputFile, "Output header file")->required();
+    app.add_option("-o,--output", outputFile, "Output resource blob (.xres)")->required();
 
     vector<str> inputFiles;
-    app.add_option("-i,--input", inputFiles, "Input files")
+    app.add_option("-i,--input", inputFiles, "Input files, optionally named as Name=File (defaults to the file name)")
       ->required()
-      ->check(CLI::ExistingFile)  // Ensure files exist
       ->expected(1, -1);
 
     try {
         app.parse(argc, argv);
     } catch (const CLI::ParseError& e) { return app.exit(e); }
 
-    std::ofstream output(outputFile, std::ios::out);
-    if (!output.is_open()) {
-        std::cerr << "Failed to open output file " << outputFile << std::endl;
-        return EXIT_FAILURE;
-    }
+    vector<ResourceBlobImage> images;
+    for (const auto& input : inputFiles) {
+        ResourceBlobImage image;
+        str file         = input;
+        const auto equal = input.find('=');
+        if (equal != str::npos) {
+            image.mName = input.substr(0, equal);
+            file        = input.substr(equal + 1);
+        }
 
-    output << "#pragma once\n\n";
-    output << "// File generated with ResPak\n\n";
+        const auto imageFile = Path(file);
+        if (!imageFile.Exists()) {
+            std::cerr << "Input file '" << file << "' does not exist" << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (image.mName.empty()) {
+            image.mName = imageFile.Filename();
+            image.mName = image.mName.substr(0, image.mName.find_last_of("."));  // Remove extension
+        }
 
-    for (const auto& input : inputFiles) {
-        const auto imageFile = Path(input);
-        str identifier       = imageFile.Filename();
-        identifier           = identifier.substr(0, identifier.find_last_of("."));  // Remove extension
-        std::ranges::transform(identifier, identifier.begin(), ::toupper);          // Force uppercase
-        const str bytesIdentifier          = identifier + "_" + "BYTES";
-        const str originalSizeIdentifier   = identifier + "_" + "ORIGINAL_SIZE";
-        const str compressedSizeIdentifier = identifier + "_" + "COMPRESSED_SIZE";
-
-        // Read image data
+        // Read image data. Always RGBA8, which is what the editor uploads
         i32 width, height, channels;
-        stbi_uc* data = stbi_load(imageFile.CStr(), &width, &height, &channels, 0);
+        stbi_uc* data = stbi_load(imageFile.CStr(), &width, &height, &channels, 4);
         if (!data) {
             std::cerr << "Failed to load image data for '" << imageFile.Str() << "'" << std::endl;
             continue;
         }
-        const size_t originalSize = width * height * channels;
-        std::cout << imageFile.Str() << std::endl;
+        const size_t originalSize = CAST<size_t>(width) * height * 4;
+        std::cout << image.mName << " (" << imageFile.Str() << ")" << std::endl;
         std::cout << " - Original size: " << originalSize << std::endl;
 
-        vector<u8> originalBytes(originalSize);
-        std::copy_n(data, originalSize, originalBytes.begin());
-        stbi_image_free(data);
-        X_ASSERT(originalSize == originalBytes.size());
-
         // Compress image data
-        vector<u8> compressedBytes = BrotliCompression::Compress(originalBytes, 11);
-        X_ASSERT(!compressedBytes.empty());
+        image.mWidth      = width;
+        image.mHeight     = height;
+        image.mCompressed = BrotliCompression::Compress(std::span<const u8>(data, originalSize), 11);
+        stbi_image_free(data);
+        X_ASSERT(!image.mCompressed.empty());
 
-        std::cout << " - Compressed size: " << compressedBytes.size() << std::endl;
+        std::cout << " - Compressed size: " << image.mCompressed.size() << std::endl;
         std::cout << '\n';
 
-        // Write to header file
-        constexpr size_t bytesPerLine = 12;
-        std::stringstream bytesStream;
-        bytesStream
-          << "//=========================================================================================//\n";
-        bytesStream << "// " + identifier + "\n";
-        bytesStream << "// Width: " + X_TOSTR(width) + ", Height: " + X_TOSTR(height) + "\n";
-        bytesStream
-          << "//=========================================================================================//\n";
-        bytesStream << "static const unsigned char " + bytesIdentifier + "[] = {\n    ";
-
-        size_t bytesRemaining = compressedBytes.size();
-        size_t offset         = 0;
-
-        while (bytesRemaining > 0) {
-            size_t bytesToRead = (bytesRemaining < bytesPerLine) ? bytesRemaining : bytesPerLine;
-
-            for (size_t i = 0; i < bytesToRead; i++) {
-                bytesStream << "0x" << std::setfill('0') << std::setw(2) << std::hex
-                            << CAST<int>(compressedBytes[offset + i]);
-
-                if (offset + i + 1 < compressedBytes.size()) {
-                    bytesStream << ", ";
-                    if ((offset + i + 1) % bytesPerLine == 0) { bytesStream << "\n    "; }
-                }
-            }
-
-            offset += bytesToRead;
-            bytesRemaining -= bytesToRead;
-        }
-
-        bytesStream << "\n};\n\n";
-        bytesStream << "static constexpr size_t " + originalSizeIdentifier + " = " + X_TOSTR(originalSize) +
-                         ";\n\n";
-        bytesStream << "static constexpr size_t " + compressedSizeIdentifier + " = " +
-                         X_TOSTR(compressedBytes.size()) + ";\n\n";
-        bytesStream << "static constexpr int " + identifier + "_WIDTH = " + X_TOSTR(width) + ";\n\n";
-        bytesStream << "static constexpr int " + identifier + "_HEIGHT = " + X_TOSTR(height) + ";\n\n";
-
-        bytesStream
-          << "//=========================================================================================//\n";
-        bytesStream
-          << "//=========================================================================================//\n\n\n";
+        images.push_back(std::move(image));
+    }
 
-        output << bytesStream.str();
+    const vector<u8> blob = ResourceBlob::Build(std::move(images));
+    std::ofstream output(outputFile, std::ios::out | std::ios::binary);
+    if (!output.is_open()) {
+        std::cerr << "Failed to open output file " << outputFile << std::endl;
+        return EXIT_FAILURE;
     }
-}
\ No newline at end of file
+    output.write(RCAST<const char*>(blob.data()), CAST<std::streamsize>(blob.size()));
+    std::cout << "Wrote " << blob.size() << " bytes to " << outputFile << std::endl;
+
+    return EXIT_SUCCESS;
+}
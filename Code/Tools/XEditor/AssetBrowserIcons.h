@@ -1,921 +0,0 @@
-#pragma once
-
-// File generated with ResPak
-
-//=========================================================================================//
-// AUDIOICON
-// Width: 128, Height: 128
-//=========================================================================================//
-static const unsigned char AUDIOICON_BYTES[] = {
-  0x1b, 0xff, 0xff, 0x30, 0x9e, 0x07, 0x76, 0x2c, 0x37, 0x94, 0xc2, 0x72, 0x58, 0xed, 0x38, 0x42, 0x92, 0xce, 0xfe,
-  0x7f, 0x98, 0x7a, 0x1a, 0xff, 0x75, 0xeb, 0x3d, 0xa8, 0xe7, 0x71, 0x16, 0xe6, 0x84, 0x60, 0x00, 0xa0, 0xd4, 0x45,
-  0x14, 0xa0, 0x06, 0x00, 0x1c, 0x23, 0x49, 0x64, 0x4f, 0x51, 0x6a, 0x77, 0x32, 0x01, 0xfc, 0x08, 0x43, 0x2b, 0x8d,
-  0xa5, 0x23, 0xec, 0xe9, 0x77, 0x00, 0xc4, 0x80, 0x40, 0x78, 0xff, 0xbd, 0xe8, 0xcf, 0x4d, 0x00, 0x1f, 0x2c, 0xe1,
-  0x87, 0x85, 0x60, 0xa0, 0x50, 0x18, 0x58, 0x18, 0x28, 0x14, 0xfe, 0xff, 0x82, 0x3a, 0x00, 0x95, 0xe1, 0xd8, 0x02,
-  0xcc, 0x64, 0x26, 0x1a, 0xf1, 0x3e, 0x44, 0x0c, 0x9b, 0xb9, 0xe9, 0x9b, 0xde, 0x5b, 0xff, 0xcc, 0xe0, 0xc5, 0x3c,
-  0xcd, 0x63, 0x99, 0xbd, 0x3b, 0x19, 0xc8, 0xd9, 0x7e, 0x99, 0x1d, 0xb3, 0x35, 0x59, 0x5f, 0x99, 0xa7, 0xc7, 0xdc,
-  0x2d, 0x40, 0xee, 0x44, 0x60, 0x27, 0x12, 0x2c, 0xb1, 0x99, 0xd1, 0xfa, 0x0a, 0x1e, 0xf2, 0x70, 0x67, 0xcc, 0xf7,
-  0x1d, 0x0d, 0x44, 0x82, 0x29, 0x86, 0xf5, 0x16, 0xdc, 0x3d, 0xc3, 0x8d, 0xc9, 0xde, 0xb7, 0x27, 0xc8, 0x80, 0xdf,
-  0x53, 0xa4, 0x02, 0x12, 0x54, 0x7f, 0x17, 0x32, 0x93, 0x35, 0x01, 0xeb, 0x4f, 0xf5, 0x96, 0x3c, 0x80, 0xeb, 0x92,
-  0xa6, 0x86, 0x7a, 0x4d, 0x93, 0x80, 0x6b, 0x57, 0x48, 0x0d, 0xf4, 0x18, 0xe5, 0x0e, 0x98, 0x43, 0xd9, 0xfb, 0xce,
-  0x76, 0x58, 0xbd, 0xbd, 0xb8, 0x5e, 0x41, 0xb9, 0x02, 0xbd, 0x85, 0x4c, 0x30, 0xe6, 0x9e, 0x5c, 0x7d, 0x03, 0x69,
-  0xd6, 0x5a, 0x69, 0xf6, 0x61, 0x04, 0xb7, 0xfb, 0x7d, 0x91, 0x96, 0x61, 0x25, 0x26, 0x0b, 0x67, 0x16, 0x9b, 0x6f,
-  0x6a, 0x3f, 0xc0, 0x8a, 0xf9, 0x9a, 0x8f, 0x79, 0x99, 0xb9, 0x11, 0x35, 0xdc, 0x98, 0xfb, 0xfd, 0x0a, 0xd8, 0x78,
-  0x26, 0xc4, 0x72, 0x19, 0x7a, 0x0c, 0x1b, 0xb4, 0x86, 0x9a, 0xf1, 0x7d, 0x60, 0x56, 0xcc, 0xc7, 0xbc, 0xcd, 0x6b,
-  0x99, 0x8d, 0x7d, 0x4f, 0x71, 0xd9, 0xe4, 0x8a, 0xcb, 0x07, 0x40, 0xe0, 0x11, 0x22, 0x01, 0xb0, 0x35, 0xf4, 0xf5,
-  0x44, 0x84, 0x94, 0x81, 0x78, 0x89, 0xb2, 0x80, 0xab, 0x11, 0x64, 0x82, 0xb3, 0x0a, 0x00, 0x19, 0x68, 0xec, 0x3e,
-  0xc0, 0x9d, 0x23, 0x30, 0xbe, 0x24, 0x65, 0xf8, 0x1d, 0x58, 0x5e, 0x92, 0x1b, 0x98, 0xcc, 0x21, 0xaf, 0x0f, 0x54,
-  0x2e, 0x01, 0xcf, 0x19, 0x74, 0x56, 0x01, 0x67, 0xbf, 0x4d, 0x44, 0x88, 0x8f, 0x09, 0x6d, 0xfd, 0x40, 0xca, 0x00,
-  0x5e, 0x2d, 0xae, 0xdc, 0x17, 0x97, 0x80, 0x64, 0xba, 0x01, 0x16, 0xb2, 0xe9, 0xd2, 0x15, 0xd0, 0x68, 0x05, 0xe7,
-  0x06, 0x78, 0xac, 0xae, 0x60, 0xe8, 0x67, 0xc8, 0x38, 0xe7, 0x11, 0x98, 0xd7, 0x07, 0x62, 0x69, 0x7a, 0x2a, 0x98,
-  0xb3, 0x4f, 0x24, 0x98, 0x50, 0xf4, 0x80, 0xc0, 0x82, 0x35, 0x18, 0xce, 0xcc, 0xca, 0x51, 0x05, 0x75, 0x82, 0xe1,
-  0xde, 0x90, 0xa2, 0x7e, 0x00, 0x5c, 0x59, 0xf3, 0xfb, 0x39, 0xb4, 0x86, 0x3d, 0x83, 0x8d, 0xbe, 0x1b, 0x21, 0x27,
-  0xa8, 0xa1, 0xf7, 0x44, 0x4f, 0x54, 0x90, 0x02, 0xec, 0x2e, 0x41, 0xb2, 0x5b, 0x93, 0x4f, 0x7e, 0x63, 0x72, 0x06,
-  0xb7, 0x6c, 0xa0, 0x67, 0x2a, 0x70, 0xb6, 0x5d, 0x6f, 0x80, 0x80, 0xb2, 0x0c, 0x7b, 0x35, 0x8c, 0x5c, 0x21, 0x17,
-  0x00, 0x58, 0x2f, 0x68, 0xab, 0x02, 0xe0, 0xb4, 0xce, 0x15, 0x09, 0x1c, 0xb6, 0x19, 0x5e, 0x13, 0x06, 0x6f, 0x4f,
-  0x1e, 0xe0, 0x3b, 0x83, 0x7d, 0xeb, 0x5a, 0xc7, 0xfc, 0xfd, 0x08, 0xae, 0x74, 0xf6, 0x38, 0xe7, 0xaf, 0xa7, 0xcd,
-  0x65, 0x03, 0xfa, 0xe4, 0x4b, 0x92, 0x16, 0xd8, 0x7e, 0x05, 0x43, 0x1a, 0xfc, 0xaf, 0xc1, 0x61, 0xdc, 0xf7, 0x33,
-  0x1d, 0xf6, 0x5f, 0xe6, 0xc7, 0x5c, 0xf4, 0x8b, 0x87, 0x85, 0xfa, 0x09, 0xe4, 0x4e, 0x54, 0xa0, 0x1a, 0xe0, 0xb8,
-  0x2c, 0x74, 0x3a, 0xc2, 0x90, 0x40, 0x50, 0x43, 0xa7, 0x1a, 0x66, 0x6a, 0x18, 0x7b, 0x86, 0x11, 0xf3, 0xbe, 0x9d,
-  0xe9, 0xca, 0xcc, 0xe1, 0x31, 0x23, 0x09, 0xe5, 0x06, 0x34, 0x29, 0xc1, 0x7e, 0x05, 0xce, 0x3e, 0xc4, 0xa9, 0x06,
-  0x74, 0x84, 0xbc, 0x04, 0xcc, 0x6e, 0xd3, 0x33, 0x31, 0x64, 0xc1, 0xf7, 0x23, 0x12, 0xc4, 0xbb, 0x97, 0xfe, 0xb5,
-  0x79, 0x7a, 0x0f, 0x4e, 0xce, 0x60, 0x6b, 0xaf, 0x02, 0x57, 0x4e, 0x00, 0xba, 0x74, 0x6e, 0x60, 0x42, 0xfd, 0x1a,
-  0x46, 0x9e, 0x61, 0xc8, 0x06, 0x46, 0x7f, 0x33, 0xd3, 0x91, 0xe1, 0xc3, 0x7c, 0xcd, 0xad, 0xa4, 0x4c, 0x70, 0xce,
-  0x84, 0x63, 0x5a, 0x6c, 0x45, 0x04, 0x21, 0x47, 0x35, 0xa0, 0xe5, 0x24, 0xf6, 0x23, 0x44, 0x82, 0x09, 0x56, 0xdf,
-  0x8d, 0x28, 0x20, 0x3e, 0xa6, 0x78, 0xa7, 0xf1, 0x8b, 0xd7, 0x3e, 0x9e, 0x20, 0x43, 0xde, 0x03, 0x3a, 0x79, 0xf1,
-  0x72, 0xbd, 0x5c, 0x01, 0xed, 0x35, 0x54, 0xf6, 0x60, 0x60, 0x41, 0x9f, 0xb9, 0x9f, 0x8d, 0x7a, 0x05, 0xc6, 0xd4,
-  0x11, 0xc0, 0x55, 0xd6, 0x2a, 0x13, 0x6c, 0x21, 0x2f, 0x5e, 0x1a, 0x77, 0x06, 0x58, 0x49, 0xb2, 0xac, 0x40, 0x6b,
-  0xf0, 0x9d, 0xe1, 0xd1, 0x52, 0x88, 0xdb, 0x0c, 0xd8, 0x5b, 0x02, 0x4f, 0x20, 0xed, 0x88, 0x93, 0xb7, 0x90, 0x68,
-  0x60, 0x7b, 0x09, 0x3c, 0xc1, 0x3e, 0x0c, 0xcb, 0xe0, 0xfa, 0x7e, 0x8c, 0x89, 0x04, 0x32, 0x82, 0x3c, 0xf9, 0xeb,
-  0x0a, 0xdc, 0xca, 0x59, 0xe7, 0x4c, 0x87, 0x42, 0x63, 0xa4, 0xb2, 0x98, 0x54, 0xa2, 0x13, 0xd0, 0x9f, 0x39, 0xdf,
-  0x4c, 0x54, 0x12, 0xc7, 0x4b, 0xf0, 0x0e, 0x1c, 0x6f, 0x0e, 0x12, 0x79, 0xf1, 0xa9, 0x21, 0x7e, 0xdd, 0xc0, 0xd0,
-  0xfe, 0x12, 0x84, 0x86, 0xea, 0x2d, 0x40, 0xaf, 0x32, 0xc1, 0xb7, 0x33, 0xec, 0x6a, 0xf9, 0x8f, 0x4f, 0x69, 0x71,
-  0xf1, 0x53, 0x44, 0x01, 0x81, 0x67, 0xa8, 0x19, 0x96, 0x27, 0x7f, 0xad, 0x31, 0x29, 0xc1, 0xae, 0xf2, 0x12, 0xd4,
-  0x10, 0x56, 0x57, 0x40, 0xcf, 0x77, 0x03, 0x82, 0x19, 0x46, 0x82, 0xed, 0x25, 0xd0, 0x17, 0x3f, 0xc0, 0xa5, 0xde,
-  0x8b, 0x10, 0x66, 0xf5, 0xed, 0x0a, 0xf6, 0xcd, 0x6c, 0x69, 0x05, 0xb4, 0x61, 0x67, 0xbd, 0xd4, 0xc0, 0xf7, 0x8b,
-  0x10, 0x7f, 0xd3, 0x13, 0xec, 0x2b, 0x1f, 0xfd, 0x04, 0xd2, 0x1a, 0xe7, 0x8c, 0x41, 0x10, 0x68, 0x9c, 0x7d, 0x22,
-  0x03, 0x4d, 0x19, 0xf7, 0xb7, 0x03, 0xf1, 0x56, 0x58, 0x33, 0x27, 0x1b, 0x34, 0x7d, 0xf3, 0x62, 0xae, 0x36, 0x47,
-  0xe6, 0xf4, 0xc0, 0x9e, 0x24, 0x6d, 0x80, 0xf7, 0x00, 0x5c, 0x13, 0x9e, 0x30, 0xfe, 0xfe, 0xf9, 0x0c, 0x95, 0x39,
-  0x6b, 0x90, 0xb8, 0x3f, 0xaa, 0x22, 0xc2, 0x9f, 0xdf, 0x7e, 0x4e, 0x2f, 0x13, 0xd4, 0x42, 0x98, 0x6c, 0x60, 0x5b,
-  0xfb, 0x5b, 0x80, 0xe6, 0x6e, 0x5d, 0xc1, 0xe7, 0x1f, 0x27, 0x5b, 0xe3, 0x09, 0x92, 0x92, 0xf2, 0x53, 0x16, 0xb8,
-  0x6b, 0x88, 0x92, 0x09, 0xf6, 0x23, 0x44, 0x03, 0x5e, 0x41, 0x1f, 0xc8, 0x2f, 0x7e, 0xe9, 0xdd, 0x7f, 0x47, 0xe3,
-  0xcb, 0xe3, 0x01, 0x98, 0x9e, 0x9e, 0xd4, 0x15, 0x78, 0x82, 0x6c, 0x40, 0xfb, 0x8c, 0xe9, 0x09, 0x06, 0x91, 0x40,
-  0xcb, 0xc9, 0xb0, 0xcb, 0x64, 0x41, 0xce, 0x00, 0xd8, 0x52, 0x08, 0x75, 0xb9, 0x82, 0xe1, 0x72, 0x07, 0xd4, 0x50,
-  0xd7, 0x1b, 0x15, 0x00, 0x4d, 0x62, 0xce, 0x22, 0x70, 0x78, 0x72, 0x92, 0x0e, 0x81, 0xfb, 0x35, 0xf0, 0x64, 0x05,
-  0xc7, 0x11, 0x72, 0x03, 0x8c, 0xde, 0x0f, 0x1e, 0x8a, 0x91, 0x52, 0x09, 0x34, 0xe7, 0x76, 0xe4, 0xcd, 0x43, 0x2e,
-  0x41, 0x4a, 0xd0, 0x0f, 0x76, 0x62, 0xce, 0x74, 0x3f, 0x82, 0x3b, 0x18, 0x68, 0x06, 0x41, 0x3f, 0x54, 0x30, 0x90,
-  0x27, 0x7f, 0x49, 0x0d, 0xdb, 0xae, 0x2b, 0x9d, 0xfd, 0xf4, 0x12, 0x30, 0xfe, 0x82, 0x91, 0x05, 0x85, 0x1e, 0x80,
-  0xa1, 0x48, 0x30, 0xf5, 0x5a, 0x84, 0xbb, 0x00, 0x4a, 0x09, 0x6a, 0x91, 0xce, 0x26, 0x19, 0x86, 0xfa, 0x20, 0x02,
-  0x21, 0x7d, 0xf2, 0x66, 0x26, 0xdb, 0x13, 0xe4, 0x61, 0x7b, 0x93, 0xbe, 0x6f, 0x6f, 0x60, 0x1f, 0xcc, 0x4f, 0xa5,
-  0x1d, 0xd0, 0x0b, 0x15, 0xc4, 0x19, 0x6c, 0x70, 0x16, 0xc1, 0x89, 0x06, 0xee, 0x6a, 0x10, 0x3b, 0x20, 0xa4, 0x5f,
-  0x19, 0x4e, 0x3f, 0x54, 0x10, 0x3f, 0xb8, 0x8c, 0xb3, 0xf3, 0xb9, 0x22, 0xc1, 0x84, 0xec, 0xd7, 0x22, 0x48, 0x65,
-  0x60, 0x6f, 0x79, 0x24, 0x68, 0x07, 0xe5, 0x7a, 0x49, 0x6f, 0xa5, 0x05, 0xfb, 0xba, 0x5f, 0x81, 0xe3, 0x44, 0x3e,
-  0x3d, 0xc8, 0x99, 0x6d, 0xae, 0x19, 0x53, 0x7d, 0x22, 0x99, 0x60, 0x42, 0xd2, 0xeb, 0xfb, 0x43, 0x7b, 0xd0, 0x27,
-  0xdf, 0xfb, 0x1a, 0x1e, 0xa0, 0x3e, 0xfa, 0x91, 0x76, 0x37, 0x82, 0x4f, 0x5f, 0x21, 0x77, 0xc0, 0xd0, 0x15, 0xe9,
-  0x04, 0x4c, 0xeb, 0x2f, 0x8d, 0xf9, 0xad, 0x0a, 0x98, 0xbe, 0xb7, 0x9c, 0x12, 0xfc, 0x02, 0x3d, 0x56, 0xc1, 0xce,
-  0xc5, 0xe3, 0xfd, 0x2d, 0x48, 0x50, 0x04, 0xe8, 0xb1, 0x0a, 0x58, 0xcd, 0x6c, 0xcb, 0x0c, 0xef, 0x47, 0xc0, 0x5b,
-  0x59, 0x40, 0x6f, 0x89, 0xf1, 0x7e, 0xa3, 0x02, 0x14, 0x41, 0x79, 0xf4, 0xee, 0x29, 0x76, 0x4e, 0xfe, 0x6f, 0xa3,
-  0x4f, 0xde, 0xbd, 0x15, 0xc1, 0x5f, 0x73, 0xbf, 0x01, 0x5c, 0x36, 0xb0, 0x59, 0x8f, 0x11, 0xe7, 0x2e, 0xba, 0xb3,
-  0x89, 0x01, 0x13, 0x4c, 0xee, 0x64, 0xc0, 0x99, 0xd5, 0x71, 0xdf, 0xe9, 0xa9, 0x25, 0xf8, 0xe7, 0x0e, 0x03, 0x30,
-  0xff, 0xdd, 0xee, 0x3a};
-
-static constexpr size_t AUDIOICON_ORIGINAL_SIZE = 65536;
-
-static constexpr size_t AUDIOICON_COMPRESSED_SIZE = 1334;
-
-static constexpr int AUDIOICON_WIDTH = 128;
-
-static constexpr int AUDIOICON_HEIGHT = 128;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// FOLDERICON
-// Width: 128, Height: 128
-//=========================================================================================//
-static const unsigned char FOLDERICON_BYTES[] = {
-  0x1b, 0xff, 0xff, 0x51, 0x04, 0x1b, 0x07, 0x10, 0xa8, 0xcd, 0x45, 0x51, 0x9b, 0x07, 0xab, 0x66, 0xc6, 0xdf, 0x0a,
-  0x38, 0x19, 0xe3, 0x3b, 0x5c, 0xb5, 0xaa, 0x61, 0x0e, 0xc4, 0x38, 0x29, 0x6b, 0x97, 0x99, 0x1a, 0xe5, 0xb0, 0x07,
-  0x6d, 0x5d, 0x7e, 0xf8, 0x85, 0xed, 0xd6, 0xf7, 0x77, 0x46, 0x97, 0xac, 0x83, 0xb1, 0x42, 0x19, 0x6c, 0x74, 0xd9,
-  0xd1, 0x52, 0xb3, 0x3a, 0xe6, 0x8e, 0xfb, 0x75, 0x48, 0x6a, 0x25, 0x40, 0x80, 0x39, 0xdd, 0x42, 0x8e, 0x46, 0xa3,
-  0xb5, 0x70, 0xce, 0x41, 0x27, 0x85, 0x78, 0x06, 0xac, 0xf7, 0x29, 0x48, 0xd9, 0x26, 0x64, 0x63, 0x3a, 0x58, 0xaa,
-  0xc1, 0x33, 0xfb, 0xdd, 0x1d, 0x5e, 0x3e, 0xff, 0x50, 0x17, 0x03, 0x6d, 0x02, 0x0a, 0x31, 0xb2, 0x5d, 0xb0, 0x0b,
-  0x2c, 0xb0, 0x02, 0x3c, 0xc0, 0x05, 0x0c, 0xf0, 0xc0, 0x5a, 0xb0, 0xf7, 0x61, 0x1b, 0xcc, 0x71, 0x02, 0x1a, 0xb6,
-  0xed, 0x9c, 0x45, 0x54, 0xeb, 0xe2, 0xb8, 0xd2, 0xea, 0x70, 0x00, 0xb0, 0x0d, 0xb6, 0xe6, 0x4d, 0x20, 0x98, 0xb2,
-  0xa5, 0x98, 0x74, 0xc0, 0xfd, 0xff, 0x5f, 0x5a, 0x49, 0x5f, 0x05, 0x55, 0xf7, 0x64, 0x8d, 0x73, 0x26, 0xb0, 0xc7,
-  0xd0, 0x99, 0x41, 0xd5, 0xbf, 0xaf, 0xee, 0x55, 0x97, 0xbe, 0x24, 0xcf, 0x68, 0xba, 0x1d, 0x42, 0x64, 0x66, 0x3e,
-  0xf5, 0xaa, 0x36, 0x48, 0x9b, 0xe1, 0x1e, 0xa3, 0x31, 0x81, 0x06, 0x9c, 0xee, 0x59, 0x54, 0x0e, 0x91, 0x79, 0xe1,
-  0x42, 0x43, 0xdb, 0xd3, 0xbd, 0xa9, 0x9b, 0xd6, 0x3c, 0x86, 0x51, 0xdd, 0xdd, 0xff, 0xdf, 0xa4, 0x74, 0xe0, 0x44,
-  0xfc, 0x66, 0xe7, 0xbd, 0x2b, 0xcd, 0x24, 0x02, 0x58, 0xaa, 0x9d, 0x9e, 0x60, 0x00, 0x30, 0xaa, 0x3f, 0xc1, 0x5e,
-  0x76, 0xf8, 0x54, 0x29, 0xc0, 0x20, 0xc0, 0xe0, 0x81, 0x82, 0x89, 0x07, 0x18, 0x14, 0x54, 0xfa, 0x03, 0x07, 0x26,
-  0x7e, 0xe0, 0xc0, 0x07, 0x03, 0xfb, 0x7b, 0x06, 0x0b, 0xc0, 0x5c, 0xdf, 0xff, 0x6e, 0xc1, 0x94, 0xc2, 0x80, 0x7c,
-  0xf7, 0xb1, 0x6c, 0x67, 0x23, 0xb0, 0x6c, 0x9d, 0x1d, 0x35, 0x2a, 0xef, 0x1b, 0x7e, 0xff, 0x97, 0x74, 0xde, 0xfb,
-  0x6f, 0x2e, 0x65, 0xc5, 0xc8, 0x28, 0x31, 0x7b, 0xba, 0xb7, 0x39, 0xd5, 0x41, 0x45, 0x26, 0xee, 0xd8, 0xf5, 0x85,
-  0xbf, 0x0c, 0x79, 0x88, 0xdf, 0xfe, 0x5c, 0x8d, 0xbe, 0x6f, 0x5a, 0x6d, 0x99, 0x67, 0x7e, 0x83, 0x2a, 0xcb, 0x87,
-  0x0b, 0xb1, 0x54, 0x9b, 0xfb, 0x74, 0xaa, 0x83, 0xd0, 0xf4, 0xb0, 0x52, 0x10, 0xf6, 0x06, 0x1a, 0x2f, 0xdb, 0x4d,
-  0xf0, 0x0d, 0x9f, 0xff, 0x5e, 0xff, 0x15, 0x1e, 0xf5, 0x53, 0xae, 0xc1, 0xd0, 0x32, 0xf9, 0xa1, 0xa8, 0xd1, 0x5f,
-  0x1c, 0x20, 0xe2, 0x0d, 0x80, 0xdb, 0x1f, 0xe0, 0x5b, 0xce, 0xaa, 0x3a, 0x10, 0xfa, 0x6d, 0xff, 0xa3, 0xe3, 0xfb,
-  0x19, 0xbe, 0xd7, 0xa4, 0xfa, 0xba, 0x86, 0x00, 0x07, 0x8f, 0xda, 0x3c, 0x1c, 0x81, 0x2a, 0x7b, 0x31, 0xea, 0x3d,
-  0x3c, 0x7f, 0x83, 0xa9, 0x7d, 0x6b, 0xa5, 0x6d, 0xab, 0x37, 0x6c, 0xd2, 0x9e, 0xcf, 0xf0, 0xdd, 0x32, 0xf1, 0x7b,
-  0x2a, 0x01, 0xf5, 0x43, 0x2b, 0xce, 0x55, 0x59, 0xad, 0x26, 0x7c, 0xc8, 0x7f, 0xfa, 0x68, 0x25, 0x75, 0x45, 0x94,
-  0xbd, 0x25, 0xd0, 0x46, 0x29, 0x4c, 0x34, 0xcd, 0xaf, 0x58, 0x69, 0xee, 0x71, 0xe3, 0xcc, 0xff, 0x64, 0xb6, 0x73,
-  0xb7, 0x67, 0xf8, 0x71, 0xc6, 0xea, 0x86, 0xeb, 0xcb, 0x1b, 0x14, 0x1a, 0xfa, 0x8a, 0x19, 0xb9, 0xb9, 0x62, 0x01,
-  0x62, 0x7a, 0x5f, 0x0e, 0x5b, 0x28, 0x53, 0xa9, 0xc6, 0x99, 0xa7, 0xbf, 0x61, 0x37, 0xf1, 0x7d, 0x06, 0xa4, 0x97,
-  0xad, 0xbe, 0x39, 0x43, 0xdd, 0x78, 0x84, 0x9f, 0x51, 0x59, 0xb8, 0x92, 0x52, 0x49, 0x8b, 0x73, 0x0a, 0xcc, 0xc3,
-  0x3c, 0x18, 0x50, 0xa0, 0xf0, 0x40, 0xd6, 0x77, 0x23, 0x5b, 0x96, 0x08, 0xa3, 0x1b, 0x2d, 0xc9, 0x65, 0x5c, 0x4b,
-  0xa2, 0x64, 0x2e, 0xfa, 0x8b, 0xcc, 0xf9, 0x08, 0x9f, 0x82, 0x93, 0x0e, 0xa8, 0x6d, 0x01, 0xea, 0xda, 0x2a, 0x9d,
-  0x2b, 0xcc, 0xa2, 0x36, 0x26, 0xd4, 0x58, 0xe3, 0x0f, 0xa3, 0x9e, 0x5e, 0x2d, 0xcc, 0xfc, 0x10, 0x4d, 0x0d, 0xb3,
-  0xaa, 0x73, 0x45, 0xa1, 0x96, 0x5a, 0x18, 0x7f, 0x99, 0xb9, 0x1e, 0xe1, 0x77, 0x45, 0xe0, 0xd6, 0x64, 0xc9, 0xe8,
-  0x0e, 0x41, 0x5b, 0xa6, 0xb3, 0xa7, 0xbc, 0x0e, 0x85, 0x4c, 0x6b, 0x7d, 0xa8, 0xa1, 0x72, 0x26, 0x10, 0x58, 0x82,
-  0xa4, 0x7a, 0x7d, 0xe6, 0x11, 0x0a, 0xf4, 0x6a, 0xb1, 0x7f, 0xe1, 0x9c, 0xd5, 0xb4, 0x63, 0x6a, 0x3e, 0xc0, 0xa0,
-  0xfb, 0x92, 0xc8, 0x77, 0x29, 0xda, 0x83, 0xa5, 0xd0, 0xce, 0x38, 0x3e, 0x25, 0x75, 0xc9, 0xe2, 0xcd, 0x19, 0xc9,
-  0x23, 0x7c, 0xc8, 0x95, 0xfd, 0x90, 0xa3, 0x17, 0x75, 0xfd, 0x33, 0x0f, 0xe5, 0xa5, 0x3a, 0x33, 0x92, 0x83, 0x24,
-  0x6f, 0x91, 0x5a, 0x8b, 0xae, 0x20, 0x79, 0x33, 0xa1, 0x4f, 0x1d, 0xaf, 0xcf, 0x7c, 0x09, 0x3e, 0xd5, 0x13, 0xb7,
-  0xaf, 0xdf, 0x05, 0x74, 0x5e, 0x63, 0x9b, 0x9a, 0x0d, 0x96, 0xeb, 0xbe, 0x6a, 0xe1, 0xee, 0x39, 0x27, 0x37, 0xb1,
-  0x4f, 0x6c, 0xac, 0x48, 0x04, 0x58, 0xcb, 0x2b, 0xb7, 0xf5, 0x97, 0x99, 0xbe, 0x04, 0x4b, 0xbd, 0x16, 0x17, 0xec,
-  0x69, 0x4f, 0xb8, 0xfd, 0x96, 0xb5, 0x4b, 0x0b, 0x18, 0x03, 0x58, 0xc3, 0xa5, 0x01, 0x85, 0x79, 0x18, 0xe5, 0x3b,
-  0xa9, 0x15, 0x36, 0xb5, 0xc7, 0xdb, 0xcc, 0x97, 0xc0, 0xfe, 0xe6, 0xd9, 0x17, 0x2b, 0x82, 0xc4, 0x9c, 0xcc, 0x54,
-  0xc3, 0x50, 0x3e, 0x61, 0x9f, 0x39, 0x5f, 0xa9, 0xd3, 0x0c, 0x8a, 0xaa, 0x41, 0x1c, 0x95, 0x47, 0x0d, 0xa5, 0x13,
-  0xd4, 0x26, 0xfc, 0xdd, 0x09, 0xa4, 0xfd, 0x5f, 0xc5, 0x62, 0x43, 0x7b, 0xcc, 0x15, 0xfa, 0x0b, 0x30, 0xad, 0x0e,
-  0xa2, 0x50, 0x57, 0x64, 0xa1, 0x2b, 0x1b, 0x4e, 0x13, 0x83, 0x6e, 0x71, 0x58, 0xe8, 0xaf, 0xca, 0xb3, 0x6e, 0x70,
-  0x19, 0x9e, 0xa4, 0x7d, 0x77, 0x2d, 0x89, 0xcf, 0x43, 0x84, 0x5f, 0x1b, 0xe5, 0x3d, 0x58, 0x79, 0x11, 0x4f, 0xd8,
-  0xd5, 0x09, 0x3e, 0x13, 0xfa, 0x04, 0x7d, 0x65, 0x68, 0x34, 0xef, 0x12, 0x78, 0x6a, 0x70, 0xff, 0x49, 0xec, 0xfb,
-  0x6f, 0xce, 0x15, 0x7e, 0xd3, 0xe8, 0x3e, 0xbd, 0x9d, 0x1a, 0x90, 0xb7, 0x69, 0xc8, 0xbc, 0xac, 0x8e, 0x3b, 0x77,
-  0x68, 0x0f, 0xe0, 0x8c, 0x64, 0xe8, 0x9e, 0xc3, 0xf3, 0xf3, 0x9a, 0xf5, 0x41, 0xfc, 0x85, 0xed, 0xdf, 0x24, 0xfe,
-  0x04, 0x50, 0x74, 0xa4, 0x0c, 0x6b, 0x6f, 0x4a, 0xd0, 0x35, 0x1f, 0x0a, 0x94, 0xa9, 0x88, 0xea, 0x5a, 0x98, 0xe1,
-  0x3d, 0xc3, 0x66, 0xe2, 0xc4, 0x5a, 0xbe, 0x11, 0x5e, 0x05, 0xc5, 0x0b, 0x00, 0x11, 0x2f, 0x5f, 0x12, 0x3a, 0xa4,
-  0x3f, 0x05, 0x4c, 0x71, 0x17, 0x77, 0x5c, 0x69, 0x78, 0xb0, 0x16, 0xc6, 0x38, 0x30, 0xfe, 0xad, 0x28, 0x79, 0xeb,
-  0xae, 0xde, 0x02, 0xfd, 0x15, 0xfc, 0xbf, 0x0d, 0x54, 0x98, 0x7e, 0xa1, 0x40, 0xbe, 0xb6, 0x1c, 0x2c, 0x53, 0xc2,
-  0x7f, 0xf0, 0xd3, 0x1c, 0x95, 0xc4, 0xbf, 0x53, 0xf4, 0x97, 0x03, 0x5f, 0x77, 0xf9, 0x2c, 0x63, 0xdc, 0x6d, 0x04,
-  0xbc, 0x30, 0x56, 0xfd, 0x9a, 0xab, 0xf9, 0x1d, 0x26, 0xbf, 0x03, 0xd4, 0xd4, 0xef, 0xa9, 0xbb, 0xbf, 0xaf, 0x93,
-  0x62, 0x5f, 0x14, 0x71, 0xa3, 0xcc, 0x9b, 0x0d, 0x4a, 0xea, 0x01, 0x71, 0xb9, 0x90, 0xa7, 0xbb, 0xbb, 0x65, 0x75,
-  0xc2, 0xdb, 0x01, 0xc7, 0xcd, 0xea, 0xae, 0x55, 0xad, 0x6b, 0xc8, 0xba, 0xe2, 0xfd, 0x7f, 0x30, 0xd0, 0xfa, 0x61,
-  0x7e, 0x1f, 0xf3, 0x6b, 0x58, 0xbb, 0xf7, 0x4b, 0x24, 0xd3, 0x8d, 0x5d, 0x57, 0xd6, 0xa8, 0x6a, 0xb2, 0x80, 0xaa,
-  0x93, 0x31, 0xfa, 0x8c, 0x89, 0xcb, 0x92, 0x6c, 0xc9, 0x2c, 0x18, 0xc0, 0xb5, 0x66, 0xc7, 0xe8, 0xf1, 0x08, 0x9e,
-  0x92, 0x64, 0xb3, 0x55, 0x7e, 0xcc, 0x47, 0xe3, 0x15, 0xac, 0xa8, 0x8a, 0xcf, 0xae, 0x0c, 0xdb, 0xb2, 0x9d, 0xd5,
-  0xb0, 0x0e, 0xef, 0x89, 0x94, 0x15, 0xe0, 0xb5, 0xd3, 0x6f, 0x7b, 0x50, 0x97, 0xb4, 0x83, 0x6d, 0x43, 0x69, 0x82,
-  0xaf, 0x0f, 0xcd, 0x7f, 0xa3, 0x02, 0xca, 0x8c, 0x06, 0x43, 0x61, 0x2d, 0x98, 0xc8, 0x7f, 0xac, 0xaa, 0x61, 0xfd,
-  0xd0, 0x56, 0xcb, 0x24, 0x3a, 0xb9, 0x83, 0xb9, 0x56, 0x9d, 0x99, 0x77, 0x7f, 0x06, 0xc3, 0x84, 0xf8, 0x2e, 0x21,
-  0x02, 0x19, 0x4a, 0xcb, 0xd6, 0x2a, 0x45, 0x21, 0x60, 0x62, 0x83, 0x87, 0x42, 0x8c, 0xa0, 0x84, 0x1c, 0xe6, 0x29,
-  0xca, 0x89, 0x56, 0xc6, 0xb1, 0xa0, 0xee, 0x30, 0x8c, 0x43, 0xd7, 0x02, 0xb7, 0xcc, 0x6a, 0x25, 0x55, 0x95, 0xdf,
-  0x93, 0x59, 0x55, 0xc5, 0x1d, 0x7c, 0x23, 0x11, 0x2d, 0x6d, 0xeb, 0xd1, 0xfe, 0x71, 0xae, 0x5c, 0xe6, 0xbd, 0x7f,
-  0x30, 0x70, 0x3f, 0x1a, 0x18, 0xf9, 0x47, 0x37, 0x5f, 0x06, 0x60, 0xf3, 0x9d, 0x26, 0x5e, 0x84, 0xeb, 0xb9, 0x59,
-  0x40, 0x17, 0xe4, 0x4c, 0x84, 0x77, 0x75, 0xee, 0x5a, 0x0c, 0x6a, 0x1c, 0x38, 0xaf, 0x3e, 0xa9, 0x98, 0x4d, 0x35,
-  0xb8, 0x77, 0x13, 0xcc, 0x41, 0x98, 0x0b, 0x69, 0x15, 0x80, 0xbe, 0x80, 0x0b, 0x76, 0x06, 0x78, 0x5d, 0x83, 0xdc,
-  0x9c, 0xcf, 0xe5, 0x19, 0x77, 0x8b, 0x21, 0x6a, 0xee, 0xe4, 0xd2, 0x96, 0x1e, 0xe0, 0x25, 0x81, 0xc1, 0xde, 0x26,
-  0x9d, 0x5e, 0x81, 0x78, 0x82, 0x33, 0x72, 0xfc, 0x13, 0x06, 0xe0, 0x04, 0xca, 0x2e, 0x1a, 0xcb, 0x3a, 0x79, 0xfb,
-  0x4f, 0xfb, 0x0d, 0xfa, 0xdf, 0xe8, 0x24, 0x27, 0xe2, 0x40, 0x45, 0x61, 0x96, 0x1b, 0x54, 0x7e, 0x03, 0x56, 0x45,
-  0x63, 0x50, 0xda, 0x9e, 0xf3, 0x5d, 0x9e, 0xdb, 0xed, 0x8e, 0x89, 0x7a, 0x83, 0xb1, 0x04, 0x77, 0xe1, 0x1d, 0x22,
-  0xbc, 0x0b, 0xd2, 0x08, 0x85, 0xbc, 0x65, 0xa5, 0x79, 0x06, 0xb2, 0xc2, 0x72, 0x50, 0x5d, 0x8b, 0x76, 0x4f, 0xc2,
-  0xff, 0x2c, 0x40, 0x17, 0x38, 0x30, 0xd1, 0x4e, 0x8b, 0xa6, 0x37, 0xaa, 0x77, 0x9b, 0x14, 0xa4, 0xd1, 0x71, 0x45,
-  0xf6, 0x9c, 0xef, 0x0a, 0x9b, 0x99, 0xe5, 0x19, 0x03, 0xf8, 0xb8, 0xc6, 0x62, 0x40, 0xbb, 0x47, 0x82, 0x40, 0x51,
-  0x2f, 0x83, 0xcd, 0x34, 0x4a, 0x51, 0x48, 0x33, 0x75, 0xe2, 0xe8, 0xd0, 0x44, 0x90, 0xb1, 0x3b, 0x16, 0xc0, 0x48,
-  0x80, 0x84, 0xe6, 0xff, 0xa0, 0xd0, 0xb1, 0xc6, 0x6c, 0x9c, 0xc7, 0xbb, 0xc5, 0x57, 0x80, 0xef, 0xc2, 0xef, 0x39,
-  0xdf, 0xc5, 0x30, 0x7f, 0xf4, 0x18, 0xa0, 0xe5, 0x80, 0xd4, 0x36, 0xe1, 0xf5, 0x36, 0xa3, 0x29, 0xb2, 0x43, 0x3c,
-  0xbd, 0x84, 0x15, 0x0c, 0x01, 0x25, 0x28, 0x3a, 0x87, 0x94, 0x90, 0x34, 0xa8, 0xb6, 0xdf, 0xba, 0x96, 0x0e, 0x30,
-  0x56, 0x09, 0x07, 0xa9, 0x29, 0xbb, 0x9f, 0x05, 0xed, 0x93, 0x8e, 0x73, 0xbe, 0x6b, 0xf0, 0x16, 0xab, 0x8a, 0x21,
-  0xb6, 0x69, 0xc2, 0x2b, 0x98, 0x18, 0x31, 0xc5, 0xf7, 0x92, 0x72, 0xea, 0x07, 0xb7, 0x57, 0xb3, 0xc3, 0xfa, 0x89,
-  0x89, 0x12, 0x09, 0xcf, 0x48, 0x52, 0x60, 0x90, 0x51, 0x96, 0xb7, 0xe2, 0xa8, 0x10, 0x1c, 0x30, 0x86, 0xe6, 0x7a,
-  0x0c, 0x99, 0xca, 0x13, 0x09, 0x68, 0xe2, 0x5f, 0x7c, 0xe3, 0x11, 0x98, 0x82, 0xbd, 0x7c, 0x0f, 0x4d, 0x50, 0xae,
-  0x7e, 0x09, 0x63, 0x30, 0x5a, 0x2e, 0x62, 0x04, 0xbc, 0x54, 0x6b, 0x89, 0xc6, 0xd0, 0x49, 0x7c, 0x3b, 0xaa, 0xcc,
-  0x8e, 0x82, 0xfa, 0x37, 0x68, 0x9d, 0x33, 0x2d, 0xd5, 0xe1, 0x5e, 0xdd, 0xed, 0xae, 0x77, 0xfa, 0xcc, 0x4e, 0x46,
-  0x51, 0x81, 0xc7, 0xd3, 0x92, 0x54, 0x1d, 0x2a, 0xe7, 0x7c, 0xd7, 0xe9, 0xe7, 0xc4, 0x57, 0xc8, 0x89, 0xb4, 0xe5,
-  0x45, 0x76, 0x0c, 0x36, 0xb0, 0xf9, 0xe5, 0xf4, 0x0a, 0xc5, 0xd6, 0x2e, 0x30, 0xa0, 0x4b, 0x4a, 0x20, 0xa2, 0x6f,
-  0xda, 0x3c, 0xaa, 0xb9, 0xb6, 0xac, 0x1b, 0x64, 0x9c, 0x9f, 0x45, 0x0e, 0xd5, 0xe8, 0x2c, 0xaa, 0xea, 0x72, 0xed,
-  0x76, 0xfd, 0x20, 0x30, 0x92, 0xb0, 0xe6, 0x7c, 0x17, 0x93, 0x42, 0x40, 0x28, 0xb9, 0x09, 0x78, 0x4e, 0xdd, 0x2e,
-  0x26, 0x8c, 0x8c, 0x1e, 0x43, 0x50, 0x74, 0x31, 0x64, 0x6a, 0x7b, 0x54, 0x83, 0xcd, 0x11, 0x3c, 0x59, 0x97, 0xef,
-  0x7c, 0x55, 0xd7, 0x9a, 0x8a, 0x0e, 0x07, 0xcd, 0x56, 0x50, 0xa1, 0x55, 0x5d, 0xad, 0x33, 0x7a, 0xb5, 0xce, 0x45,
-  0x73, 0xbe, 0x6b, 0xb8, 0xb5, 0x49, 0x21, 0x32, 0xd1, 0x89, 0x61, 0x29, 0xde, 0x25, 0x64, 0x08, 0xda, 0xaf, 0x63,
-  0xd8, 0xfc, 0x74, 0x3a, 0x1e, 0xbe, 0xe4, 0x8b, 0xbb, 0x0c, 0x06, 0x95, 0xa7, 0xa8, 0xa7, 0xc9, 0x91, 0x83, 0xa6,
-  0xa5, 0x15, 0x0b, 0x2f, 0xb2, 0xd5, 0x89, 0x1a, 0x73, 0xbe, 0x6b, 0x5f, 0x92, 0x5a, 0x30, 0x6b, 0xa6, 0x46, 0xb7,
-  0x9b, 0x29, 0x04, 0xad, 0x30, 0xd5, 0xe3, 0x49, 0xbe, 0x38, 0xc6, 0xd4, 0xe9, 0xc8, 0x11, 0xf7, 0x33, 0x60, 0xf7,
-  0x59, 0x75, 0x34, 0x99, 0x48, 0x25, 0xf8, 0xff, 0xcc, 0x20, 0x1c, 0x27, 0x50, 0xa9, 0xb2, 0x00, 0x1c, 0x87, 0x96,
-  0x59, 0x58, 0xe8, 0x35, 0xe7, 0xbb, 0xa6, 0x76, 0x2f, 0x52, 0x6d, 0x1c, 0x95, 0x8f, 0x3e, 0xaf, 0x5e, 0x9c, 0x2a,
-  0x74, 0x6d, 0x10, 0x84, 0xf2, 0xe5, 0x2c, 0x8d, 0x85, 0x8a, 0xba, 0xf8, 0x37, 0x31, 0xa2, 0x17, 0x70, 0xa4, 0x53,
-  0x0c, 0x0d, 0x15, 0xad, 0xe1, 0xdc, 0x0b, 0xc9, 0x51, 0xd0, 0xff, 0xa9, 0x47, 0xae, 0x7a, 0x8f, 0xd5, 0x40, 0xcd,
-  0xbc, 0x8f, 0x30, 0xf6, 0x1a, 0xca, 0x8c, 0xef, 0x10, 0x03, 0x99, 0x40, 0x61, 0x2b, 0xa3, 0x6e, 0xd4, 0x9e, 0xd3,
-  0x55, 0x7b, 0xb7, 0x08, 0x26, 0x10, 0x36, 0x8b, 0x41, 0x43, 0x50, 0xec, 0x82, 0x3e, 0x93, 0xd9, 0x2d, 0x87, 0x5d,
-  0x3f, 0x1c, 0x68, 0xc5, 0x44, 0xe3, 0x14, 0x06, 0xea, 0xcc, 0x8f, 0x8e, 0xe7, 0xae, 0xb2, 0xde, 0x81, 0xe9, 0xed,
-  0x35, 0xe7, 0xfb, 0xe8, 0x22, 0x94, 0x48, 0x64, 0x8d, 0x46, 0x6c, 0x6d, 0xde, 0x43, 0x6a, 0xc0, 0xd6, 0x14, 0x45,
-  0x34, 0xbe, 0xd0, 0x77, 0xba, 0x56, 0xc9, 0x31, 0x81, 0x49, 0x8e, 0x16, 0xb9, 0x18, 0xb4, 0x9b, 0x5e, 0xa4, 0x1a,
-  0x4c, 0xa7, 0x43, 0x47, 0xfc, 0xe8, 0x60, 0xb3, 0xed, 0xb1, 0xe1, 0x82, 0x69, 0xad, 0xba, 0x57, 0x01, 0x7e, 0x18,
-  0x18, 0x73, 0xe0, 0xe7, 0x5e, 0x7f, 0x09, 0xb2, 0x7b, 0x2d, 0xe6, 0xf8, 0x5b, 0x70, 0xf3, 0xe6, 0xda, 0x67, 0x29,
-  0x4d, 0x50, 0x12, 0x51, 0x1a, 0x47, 0x3b, 0xc4, 0x72, 0xb7, 0xdb, 0x27, 0xed, 0x04, 0x42, 0x18, 0x53, 0x4e, 0x8c,
-  0x08, 0x38, 0x5e, 0x49, 0x09, 0x61, 0x50, 0x43, 0x5e, 0xd6, 0xcd, 0x3b, 0x40, 0x77, 0xe3, 0xa6, 0xf3, 0x51, 0x50,
-  0xc8, 0x93, 0xb0, 0x51, 0xc7, 0x9e, 0xe8, 0x47, 0x18, 0x69, 0xfa, 0x80, 0x99, 0xf3, 0x5d, 0x7c, 0x89, 0xc2, 0xa0,
-  0xd3, 0x18, 0x9f, 0x57, 0x31, 0x9f, 0x8e, 0xf6, 0x17, 0x35, 0x75, 0xbb, 0x15, 0x32, 0x1c, 0x65, 0x0a, 0x08, 0x11,
-  0x6f, 0x81, 0xde, 0xca, 0x58, 0xc4, 0x18, 0x86, 0xf9, 0xf0, 0x24, 0xb4, 0xc9, 0x13, 0xb5, 0x43, 0xd9, 0x6d, 0x95,
-  0x7e, 0x56, 0xe2, 0x52, 0x36, 0xce, 0xd6, 0x5a, 0x5f, 0xc7, 0x96, 0x8e, 0xc2, 0x39, 0xdf, 0x47, 0xca, 0x48, 0x49,
-  0x0e, 0xad, 0x87, 0x80, 0x09, 0xaa, 0xf8, 0x03, 0x98, 0x16, 0x65, 0x0e, 0xb5, 0x5b, 0x9d, 0x85, 0x1b, 0x30, 0x9d,
-  0xdb, 0x4b, 0xd3, 0x4d, 0x97, 0xb0, 0x5f, 0x31, 0x04, 0x03, 0x94, 0x52, 0x8a, 0x91, 0x7a, 0x0d, 0x4a, 0xc9, 0x05,
-  0xe2, 0x74, 0x4f, 0xe4, 0x54, 0xac, 0x4b, 0x37, 0x57, 0xb0, 0xfa, 0x36, 0x16, 0xd5, 0x1a, 0xb3, 0x4d, 0xd5, 0x9c,
-  0xef, 0x23, 0xbc, 0x0c, 0x8b, 0x01, 0x64, 0xc8, 0x58, 0xb8, 0x86, 0x35, 0x05, 0x79, 0x63, 0xab, 0xb2, 0x34, 0x46,
-  0x85, 0x8e, 0xab, 0x59, 0x95, 0x3c, 0x2d, 0x63, 0x8b, 0x90, 0xf4, 0x4a, 0xc4, 0x04, 0xb8, 0x4f, 0x27, 0xb5, 0x0f,
-  0xc9, 0xb6, 0x6a, 0x49, 0x35, 0x09, 0xc3, 0x42, 0x03, 0x04, 0xe1, 0xa7, 0xf0, 0xc3, 0x9c, 0x7f, 0xf1, 0xe1, 0x23,
-  0x78, 0x18, 0xdf, 0x63, 0xb9, 0xc8, 0xa0, 0x14, 0xb5, 0xaf, 0x4e, 0xae, 0xdb, 0xa8, 0x88, 0x5a, 0xef, 0x86, 0xa5,
-  0xa5, 0x61, 0xf3, 0x35, 0xd5, 0xdd, 0xa7, 0x78, 0x4a, 0xab, 0x33, 0x39, 0x80, 0x5b, 0xcb, 0x87, 0xd2, 0x64, 0x0e,
-  0x65, 0x1d, 0x82, 0x98, 0x54, 0xd8, 0x37, 0xb6, 0xf9, 0x60, 0x99, 0xb6, 0xf1, 0x8a, 0x6e, 0xbe, 0x57, 0x14, 0xc8,
-  0x21, 0x40, 0xbc, 0xa7, 0xee, 0x1c, 0x6b, 0xce, 0x77, 0x29, 0x4a, 0x9b, 0x6d, 0x3e, 0x00, 0xcd, 0x41, 0x8a, 0x96,
-  0x2a, 0x43, 0x6b, 0xad, 0x38, 0x8f, 0xa6, 0xb9, 0xd2, 0x3c, 0x48, 0xd4, 0x30, 0x86, 0x7b, 0x2c, 0xfe, 0xd1, 0x0a,
-  0xe6, 0x49, 0xce, 0xd8, 0x2c, 0x81, 0x2e, 0x57, 0x02, 0x46, 0x93, 0xde, 0x2a, 0xbd, 0xd7, 0x70, 0x6b, 0x96, 0x8c,
-  0x13, 0x48, 0xa3, 0x2c, 0x67, 0x09, 0x9e, 0xbc, 0x32, 0xce, 0x22, 0x76, 0x98, 0xf3, 0x5d, 0x7c, 0x76, 0x0a, 0xd2,
-  0xf8, 0x36, 0x60, 0x18, 0xde, 0x39, 0x2a, 0xca, 0x59, 0x6f, 0x9b, 0xac, 0x12, 0x7c, 0x56, 0xe2, 0xa8, 0xfd, 0x0c,
-  0x48, 0x24, 0x77, 0xa5, 0x29, 0x8a, 0x5c, 0x8c, 0xc3, 0x35, 0xd5, 0x99, 0xb4, 0xb5, 0x2e, 0xf1, 0x48, 0x94, 0xb1,
-  0xfb, 0x80, 0x9b, 0x4a, 0x58, 0x33, 0x4b, 0x84, 0xec, 0xc2, 0xb7, 0x70, 0x9d, 0x77, 0xff, 0x0a, 0xd0, 0xc6, 0xd3,
-  0xfc, 0xf4, 0xd3, 0xbd, 0x88, 0x9b, 0x5b, 0x05, 0x1e, 0x48, 0x6e, 0x7f, 0x03, 0x6b, 0xa3, 0x66, 0x3b, 0x04, 0x88,
-  0x29, 0xa9, 0x38, 0xe7, 0xd3, 0xeb, 0x17, 0xe0, 0x67, 0x91, 0xd1, 0xe5, 0xbd, 0x4d, 0x09, 0x06, 0x04, 0xdd, 0x3b,
-  0x98, 0x6d, 0xd1, 0xf4, 0x0d, 0x59, 0xfa, 0x16, 0x90, 0x9b, 0xf4, 0x2f, 0x1f, 0xff, 0x08, 0xe7, 0x4a, 0x01, 0xa7,
-  0xdb, 0xaf, 0x3c, 0xe1, 0xd4, 0x6a, 0x9d, 0x6f, 0x8b, 0xb5, 0x3f, 0x95, 0xc0, 0x14, 0x85, 0xf2, 0xf5, 0x97, 0xd4,
-  0x04, 0x7c, 0x71, 0x82, 0xe5, 0x8a, 0xa1, 0x1b, 0xc2, 0x96, 0xa0, 0xa8, 0x72, 0x77, 0x15, 0xcc, 0x95, 0x16, 0xa5,
-  0x4d, 0xb3, 0xd6, 0x5b, 0xf6, 0x0a, 0xa3, 0x10, 0x96, 0x4e, 0x1a, 0x73, 0xbe, 0xeb, 0xc8, 0x9c, 0x18, 0x31, 0x21,
-  0xdc, 0xaa, 0x2a, 0x9a, 0x6a, 0x46, 0xb2, 0x74, 0x83, 0x22, 0xdd, 0x92, 0xf1, 0x9c, 0xe4, 0x68, 0x5c, 0x0a, 0x47,
-  0x52, 0xef, 0x10, 0xf2, 0x0d, 0x45, 0x9e, 0xde, 0x45, 0x1a, 0x0b, 0xb2, 0xa1, 0x0f, 0xba, 0xa7, 0x91, 0x4e, 0xef,
-  0x09, 0x3a, 0x1d, 0x6a, 0x83, 0x4d, 0xc6, 0xb4, 0x46, 0xa3, 0xe5, 0x84, 0x39, 0xdf, 0xb5, 0x2b, 0xc6, 0x13, 0x2e,
-  0xa6, 0x94, 0xb0, 0x9e, 0x21, 0x21, 0x80, 0xab, 0xe9, 0x5a, 0xc5, 0x64, 0x13, 0x0e, 0xea, 0x5e, 0x78, 0x4a, 0x8f,
-  0x88, 0xbe, 0x7b, 0x18, 0xd1, 0xd6, 0x50, 0x69, 0xc1, 0x05, 0xee, 0xee, 0x87, 0xb6, 0xf7, 0x60, 0x0a, 0xf0, 0x01,
-  0xf2, 0x67, 0x94, 0x7e, 0x23, 0xfe, 0x94, 0x72, 0xa0, 0x4e, 0x8d, 0xc6, 0x6f, 0x4a, 0xb2, 0xf3, 0xde, 0x23, 0x68,
-  0x7d, 0xb6, 0xab, 0x93, 0xfa, 0xc3, 0x9f, 0xf4, 0xf4, 0xa3, 0x39, 0x70, 0x3a, 0xfa, 0x54, 0xd4, 0x58, 0x6b, 0x2f,
-  0x03, 0xc6, 0x76, 0xcb, 0x29, 0x06, 0x33, 0x07, 0x37, 0x5a, 0x9f, 0x7a, 0x30, 0xc6, 0xc2, 0xb2, 0x64, 0x69, 0x7b,
-  0x00, 0x31, 0xfc, 0x84, 0x5e, 0xd1, 0x88, 0xd2, 0x4e, 0xde, 0x06, 0xa1, 0x1b, 0x59, 0x74, 0xe1, 0x19, 0x3c, 0xcd,
-  0x3b, 0x7f, 0x04, 0xcc, 0x51, 0x0c, 0x52, 0xc2, 0xee, 0x7b, 0x14, 0x1b, 0xb0, 0xdc, 0xeb, 0x3d, 0x04, 0x95, 0x12,
-  0x06, 0x29, 0x16, 0x55, 0x94, 0x8d, 0xbb, 0x87, 0x39, 0x31, 0xe3, 0x58, 0x14, 0xea, 0xc6, 0x8e, 0xdf, 0xf9, 0x4a,
-  0xbc, 0x7e, 0x76, 0x9a, 0xea, 0x28, 0x64, 0x51, 0x0e, 0xd4, 0x81, 0xca, 0x63, 0xaa, 0x55, 0x61, 0xd2, 0x54, 0xac,
-  0x31, 0xe7, 0xbb, 0x52, 0x60, 0x78, 0xa1, 0x09, 0x55, 0xc4, 0xe4, 0x4b, 0x44, 0x2a, 0xc0, 0x81, 0x1b, 0xa4, 0x06,
-  0x9d, 0x1b, 0xa5, 0x1c, 0xab, 0x21, 0x0d, 0x50, 0x2f, 0xa3, 0x82, 0x30, 0x78, 0xe2, 0x0c, 0x4d, 0x1f, 0xe4, 0x29,
-  0xd1, 0xe8, 0xca, 0x16, 0xc5, 0x9f, 0xda, 0xca, 0x75, 0xea, 0x50, 0xbf, 0xc6, 0xff, 0x11, 0x28, 0x29, 0x06, 0xf8,
-  0x8c, 0x0c, 0x1d, 0xa9, 0x9c, 0x44, 0xa8, 0xf3, 0x33, 0xa6, 0xd6, 0x37, 0x8b, 0x1a, 0x82, 0xa9, 0x88, 0xae, 0xc5,
-  0xf1, 0x90, 0x4c, 0xa8, 0x21, 0xe3, 0x51, 0x6b, 0x4b, 0x69, 0x3c, 0x49, 0x43, 0xed, 0xb0, 0xa9, 0xda, 0x2a, 0x0d,
-  0xe2, 0x21, 0xa7, 0x0e, 0x73, 0xbe, 0x6b, 0x24, 0x84, 0xef, 0x30, 0xf2, 0xb3, 0x67, 0x93, 0x10, 0x60, 0x0a, 0xaa,
-  0xb0, 0x84, 0x7d, 0x80, 0xf3, 0xe5, 0x62, 0x56, 0xd8, 0xf2, 0xc2, 0x58, 0x54, 0x7f, 0xdb, 0x87, 0x01, 0xc8, 0x09,
-  0x41, 0x3d, 0xee, 0xc2, 0x2a, 0x25, 0x69, 0x4a, 0x7b, 0x63, 0x7b, 0x22, 0x0e, 0xfa, 0xbd, 0x81, 0xe4, 0x6c, 0xf4,
-  0x63, 0xaf, 0xbc, 0xee, 0x97, 0x0b, 0xe6, 0x7c, 0x17, 0xd7, 0x93, 0x7a, 0x81, 0xa7, 0x04, 0xe4, 0x0c, 0x37, 0x7b,
-  0x96, 0x22, 0x9e, 0x4b, 0x41, 0xab, 0xc4, 0x08, 0x45, 0x44, 0xb2, 0xb3, 0x94, 0x96, 0x2f, 0x77, 0xe7, 0x50, 0x2b,
-  0xb5, 0x82, 0xff, 0xe4, 0x7a, 0xe1, 0xa9, 0xbd, 0x3d, 0x3a, 0x16, 0x49, 0xf7, 0xa6, 0x01, 0x70, 0xf8, 0x73, 0xec,
-  0x8b, 0xce, 0xf9, 0x3e, 0xf8, 0x1a, 0x35, 0x21, 0xa7, 0x64, 0x72, 0x2d, 0xc1, 0x0c, 0x3a, 0x46, 0xe8, 0x3c, 0x40,
-  0x61, 0x2f, 0xbd, 0x0e, 0xe0, 0x39, 0xcd, 0x24, 0x66, 0x2a, 0xc6, 0xd7, 0x6f, 0x01, 0x11, 0xfd, 0xd1, 0xbd, 0x7b,
-  0x34, 0x76, 0x10, 0xb6, 0x4e, 0xa3, 0xee, 0x61, 0x1d, 0x8b, 0x25, 0x3e, 0x42, 0xec, 0x06, 0x63, 0x45, 0xcc, 0x35,
-  0xee, 0x80, 0x47, 0xdd, 0x51, 0xcd, 0xbb, 0x6f, 0x01, 0x7f, 0x89, 0x98, 0xa4, 0x18, 0xad, 0x56, 0x44, 0x57, 0xd5,
-  0x31, 0xce, 0xa7, 0xdd, 0xe6, 0xd8, 0xee, 0x32, 0x41, 0xa3, 0x3f, 0xd5, 0x54, 0xc6, 0x68, 0x5b, 0x22, 0xd0, 0xca,
-  0xec, 0x95, 0xe4, 0x36, 0x84, 0x1a, 0xc7, 0x15, 0x90, 0xbb, 0x31, 0x72, 0xca, 0x44, 0x2d, 0xb9, 0x9c, 0x37, 0x75,
-  0x80, 0x7d, 0xcc, 0x6a, 0x73, 0x3e, 0xd7, 0xf4, 0x0f, 0xfd, 0xe3, 0x0b, 0x4c, 0x85, 0x4c, 0xc7, 0xf4, 0x27, 0xc8,
-  0x19, 0x0f, 0x90, 0x4e, 0x55, 0xcc, 0xb8, 0x87, 0x85, 0x1d, 0x49, 0xaa, 0x8d, 0x82, 0xa2, 0x09, 0x63, 0x99, 0x78,
-  0x25, 0x40, 0xf2, 0xe7, 0x88, 0xa0, 0x01, 0x37, 0x38, 0x8f, 0xea, 0xa5, 0xf4, 0x1c, 0xfd, 0x9c, 0xcf, 0x95, 0x12,
-  0xd0, 0x56, 0xdc, 0xcd, 0x18, 0xe5, 0x70, 0x79, 0xcb, 0x20, 0x3c, 0x31, 0x84, 0xbb, 0xa9, 0x75, 0x82, 0xe9, 0x52,
-  0x0a, 0xd5, 0xd8, 0x7b, 0x0c, 0xd8, 0x72, 0xd7, 0xa8, 0x4c, 0x18, 0xd9, 0x1b, 0x7c, 0x5e, 0x9f, 0x48, 0x13, 0xf6,
-  0x7e, 0x7d, 0xe0, 0x02, 0xb7, 0x33, 0x1b, 0x7e, 0x85, 0x50, 0x2d, 0xab, 0xae, 0xe1, 0xb3, 0xf9, 0x5a, 0xff, 0x08,
-  0xdd, 0xf3, 0x17, 0xae, 0x2f, 0x82, 0xa7, 0x72, 0x62, 0xc4, 0x64, 0x88, 0xe4, 0x2b, 0x4e, 0xd3, 0x56, 0xdc, 0x4c,
-  0x6b, 0x43, 0x4e, 0x49, 0xeb, 0xbb, 0x10, 0xf7, 0x47, 0xc0, 0xe5, 0x54, 0x76, 0x97, 0x01, 0xb4, 0x48, 0x83, 0xa2,
-  0x34, 0xb1, 0xf5, 0xa6, 0xea, 0x6f, 0x58, 0x72, 0xb3, 0xba, 0x12, 0xca, 0x70, 0xc2, 0x38, 0x24, 0x97, 0xe2, 0x74,
-  0xb3, 0xbb, 0x35, 0xf3, 0xf2, 0x08, 0x7f, 0x94, 0xef, 0x0a, 0x6a, 0x84, 0x94, 0x6c, 0xc8, 0xd6, 0x47, 0xd5, 0x72,
-  0x92, 0x51, 0x63, 0xef, 0x83, 0x59, 0xa9, 0x9c, 0xf6, 0x2b, 0x45, 0x0a, 0x46, 0xbb, 0x42, 0x83, 0x31, 0xf4, 0x93,
-  0x69, 0x57, 0x89, 0x1b, 0x48, 0xcf, 0x38, 0x3a, 0xfc, 0x4a, 0x62, 0x9f, 0x6c, 0xb7, 0x8a, 0x76, 0xb8, 0xa9, 0x0c,
-  0x7e, 0x65, 0x52, 0xf5, 0xf6, 0x34, 0xe7, 0x73, 0x7d, 0x9f, 0xb5, 0x62, 0x26, 0x7e, 0xeb, 0x32, 0x91, 0x42, 0x07,
-  0x44, 0xd3, 0xa9, 0x16, 0x13, 0xcd, 0xa6, 0x5b, 0x09, 0x71, 0xc4, 0x10, 0x95, 0xc9, 0xd8, 0x05, 0x1e, 0x09, 0xf6,
-  0x44, 0x1a, 0x58, 0x92, 0xc9, 0x6f, 0x15, 0x8c, 0xe9, 0x57, 0x74, 0x09, 0x59, 0x45, 0x78, 0xe5, 0xa7, 0x8f, 0x1b,
-  0x73, 0x3e, 0x1f, 0x4f, 0x26, 0x8e, 0x08, 0xe4, 0xb9, 0x0c, 0x9f, 0x9f, 0x3a, 0xbd, 0x5b, 0x4e, 0x54, 0x5a, 0xd7,
-  0xdc, 0xcd, 0xfd, 0xe4, 0xae, 0x11, 0xdd, 0x54, 0x8d, 0xcb, 0xe3, 0x34, 0xf3, 0xac, 0xce, 0x59, 0xa8, 0x50, 0x08,
-  0xd5, 0x78, 0x18, 0x98, 0x6d, 0x33, 0xea, 0x49, 0xd0, 0x6f, 0x72, 0xbc, 0x01, 0xd6, 0x63, 0x6b, 0xcc, 0xf9, 0x5c,
-  0x4f, 0xbc, 0x87, 0x14, 0x0b, 0xaa, 0x3c, 0xc0, 0x87, 0x87, 0x39, 0xf6, 0xa5, 0x08, 0x23, 0xeb, 0xcb, 0xca, 0xa2,
-  0xe1, 0x72, 0x50, 0x76, 0x22, 0x81, 0x44, 0x2b, 0x8f, 0x03, 0x87, 0xed, 0x2a, 0xc1, 0xab, 0x48, 0x18, 0xfe, 0xc6,
-  0x08, 0xca, 0x42, 0xed, 0xa3, 0x44, 0xad, 0xdf, 0x1d, 0xd5, 0xbc, 0x12, 0xd6, 0x89, 0x98, 0x7a, 0xee, 0xe7, 0x7a,
-  0xc2, 0xbb, 0xb5, 0xdd, 0x45, 0x50, 0xc4, 0x22, 0xcf, 0xa2, 0x49, 0xb0, 0x7d, 0x4e, 0x29, 0xd8, 0x1f, 0x9c, 0x5a,
-  0x23, 0x40, 0xdb, 0x63, 0x4c, 0x39, 0xb1, 0x5f, 0xca, 0x80, 0x1c, 0x94, 0xf4, 0xaa, 0x66, 0xe3, 0x78, 0x9c, 0x35,
-  0x1f, 0x47, 0x58, 0x83, 0x4e, 0x77, 0x02, 0x2b, 0x3f, 0x4c, 0x43, 0xbc, 0xbc, 0x02, 0x92, 0x9d, 0xfb, 0xf9, 0xf8,
-  0x13, 0xef, 0xf6, 0x4c, 0x3b, 0x83, 0xbb, 0x39, 0x35, 0xd4, 0x80, 0x5e, 0x23, 0x91, 0xfb, 0xa9, 0x72, 0x53, 0x11,
-  0x6a, 0xed, 0xaf, 0xc4, 0xcc, 0x50, 0xf9, 0x92, 0x89, 0x5f, 0x8a, 0xb5, 0x18, 0x42, 0x1a, 0xdd, 0x32, 0x01, 0x96,
-  0xe6, 0xbb, 0x96, 0x33, 0x76, 0x6f, 0xc7, 0x32, 0x3c, 0xa6, 0x43, 0x66, 0xc7, 0x33, 0xc7, 0x9f, 0x03, 0x73, 0x3d,
-  0xd1, 0x68, 0x26, 0x8d, 0xbe, 0x47, 0x5f, 0x8a, 0xc6, 0x83, 0x09, 0xdd, 0x7e, 0xa6, 0x61, 0xf7, 0x2b, 0x2b, 0x44,
-  0x09, 0xea, 0x32, 0x2f, 0xc7, 0x1a, 0x94, 0x19, 0x23, 0xe4, 0x4b, 0x16, 0xd2, 0x28, 0x3b, 0x5a, 0xa3, 0xb8, 0x9c,
-  0x6b, 0x25, 0xbf, 0x5f, 0xf4, 0xab, 0xfe, 0x50, 0x9b, 0x1e, 0xea, 0xb2, 0x7a, 0x2f, 0xa5, 0x92, 0x98, 0x0c, 0xf5,
-  0xcf, 0x85, 0xb9, 0x7e, 0xb8, 0xfc, 0xc7, 0x1b, 0xe8, 0x45, 0xba, 0xfd, 0x14, 0xaa, 0xd6, 0x57, 0xd4, 0x4d, 0x7b,
-  0xa5, 0x80, 0x82, 0x8c, 0xc5, 0xc5, 0x54, 0x4d, 0xa5, 0x01, 0x53, 0x01, 0x60, 0x49, 0x18, 0xd0, 0xbb, 0x4b, 0x1d,
-  0x7b, 0x42, 0xe7, 0x2e, 0x22, 0x81, 0x58, 0x60, 0x41, 0x32, 0x94, 0xc3, 0x2b, 0xd1, 0xe7, 0x71, 0xee, 0xcf, 0x89,
-  0xb9, 0x7e, 0xef, 0xe1, 0x26, 0xb6, 0x73, 0x46, 0x43, 0x84, 0x68, 0x3c, 0xa2, 0x6a, 0xa4, 0xbd, 0x26, 0xa1, 0x90,
-  0xf1, 0x34, 0xd4, 0x0d, 0x18, 0x90, 0x26, 0x80, 0x19, 0xa1, 0xbf, 0x13, 0xbd, 0x12, 0x3c, 0x4e, 0x39, 0xfd, 0xa6,
-  0x30, 0xdc, 0x71, 0xf8, 0x59, 0x4a, 0xfc, 0xd7, 0xd2, 0xf4, 0x0b, 0x43, 0x7d, 0x1b, 0xfc, 0x01, 0xf2, 0x7d, 0x95,
-  0x4e, 0x4f, 0x00, 0x25, 0x85, 0xbc, 0xcb, 0x9d, 0x13, 0xef, 0xd4, 0xe6, 0x2d, 0x4c, 0x3e, 0x40, 0x1b, 0xfa, 0x80,
-  0x58, 0x3e, 0x8a, 0xa1, 0x9f, 0x0c, 0xe6, 0x55, 0xf3, 0x08, 0x78, 0x88, 0xb4, 0x4e, 0x1f, 0x34, 0x5e, 0xfc, 0x0b,
-  0xec, 0xdd, 0x68, 0x7e, 0x95, 0x28, 0x38, 0x0b, 0x0a, 0x91, 0x41, 0xb7, 0xed, 0x53, 0x95, 0xd5, 0x61, 0x44, 0x1e,
-  0xc7, 0xce, 0x77, 0x99, 0xa1, 0x3d, 0x2b, 0xe7, 0x0f, 0x7e, 0x31, 0xde, 0x68, 0x7e, 0x61, 0xfb, 0x29, 0x2a, 0x03,
-  0x70, 0x01};
-
-static constexpr size_t FOLDERICON_ORIGINAL_SIZE = 65536;
-
-static constexpr size_t FOLDERICON_COMPRESSED_SIZE = 3859;
-
-static constexpr int FOLDERICON_WIDTH = 128;
-
-static constexpr int FOLDERICON_HEIGHT = 128;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// FOLDERICONEMPTY
-// Width: 128, Height: 128
-//=========================================================================================//
-static const unsigned char FOLDERICONEMPTY_BYTES[] = {
-  0x1b, 0xff, 0xff, 0x22, 0x2a, 0x57, 0x4d, 0xc6, 0xe3, 0x74, 0x45, 0x9f, 0xd0, 0xac, 0x2e, 0x89, 0x43, 0x92, 0xf2,
-  0x61, 0xdb, 0xd8, 0xaf, 0x5a, 0x49, 0x6d, 0x92, 0x7f, 0xa0, 0x93, 0x05, 0x38, 0xc0, 0x11, 0x06, 0x58, 0x40, 0x01,
-  0x6e, 0x60, 0x0b, 0x2c, 0xb0, 0x02, 0x0c, 0xf0, 0x00, 0x03, 0x1c, 0x58, 0x07, 0xf6, 0xbe, 0x1b, 0x8c, 0x31, 0xb7,
-  0x85, 0x0d, 0xff, 0x7d, 0xfb, 0xa9, 0xcd, 0x84, 0xfa, 0xac, 0x0c, 0x58, 0xb5, 0x77, 0xcf, 0x4c, 0xfe, 0x16, 0x9f,
-  0x94, 0x25, 0x32, 0x56, 0x56, 0x02, 0x5a, 0xfe, 0x7c, 0xeb, 0x9f, 0xde, 0x8e, 0xd4, 0xd6, 0x12, 0x7a, 0x11, 0xf3,
-  0x64, 0xf4, 0x28, 0x70, 0x8f, 0xba, 0x32, 0x5e, 0xe9, 0x44, 0x0b, 0x61, 0xaa, 0xeb, 0x78, 0xe4, 0xb1, 0xbd, 0x84,
-  0x92, 0x64, 0x51, 0x72, 0xd9, 0xfb, 0xa1, 0x4e, 0x96, 0x1d, 0x83, 0x2c, 0x8f, 0xd4, 0xc9, 0x37, 0x2f, 0x01, 0x0c,
-  0xac, 0x41, 0x61, 0xa1, 0x50, 0xfc, 0x70, 0x80, 0x07, 0xff, 0xd6, 0x05, 0xdf, 0xbf, 0x73, 0x23, 0x8b, 0x5b, 0xd5,
-  0x30, 0x06, 0x1f, 0x2e, 0xbc, 0xaa, 0x1f, 0x08, 0x04, 0x1a, 0x02, 0x0d, 0x0d, 0x03, 0x03, 0xfb, 0x95, 0xc1, 0x02,
-  0x00, 0xfe, 0xcc, 0xa6, 0x1a, 0xaa, 0x4b, 0x85, 0xfb, 0x53, 0xaf, 0x3c, 0xea, 0x1e, 0xb8, 0x33, 0x75, 0x48, 0x51,
-  0x59, 0x92, 0x8a, 0x2a, 0x28, 0x2f, 0xbb, 0x72, 0x03, 0x67, 0x82, 0xe9, 0x94, 0x52, 0x52, 0x3f, 0x31, 0xbe, 0xfe,
-  0x93, 0x1e, 0x17, 0xd2, 0x81, 0x6b, 0x71, 0x81, 0x57, 0x53, 0x1b, 0xb6, 0x02, 0xa6, 0x4d, 0x67, 0xb2, 0x61, 0xb3,
-  0xc8, 0xf1, 0x84, 0x29, 0xa2, 0x13, 0xbd, 0x0d, 0x99, 0xb8, 0x49, 0x7d, 0xa5, 0x85, 0xd2, 0x2a, 0x14, 0xe6, 0x21,
-  0xec, 0xca, 0x64, 0x7d, 0xb5, 0x84, 0xc8, 0xd1, 0x29, 0x3c, 0xc4, 0xa1, 0xde, 0x7d, 0x9e, 0xff, 0x17, 0x6e, 0x4a,
-  0x00, 0xb5, 0xeb, 0x86, 0x90, 0x1b, 0x1d, 0x94, 0xae, 0xc2, 0x05, 0x52, 0x2b, 0x83, 0x33, 0xc1, 0x17, 0x38, 0x0b,
-  0x07, 0xa9, 0x7f, 0xd7, 0x79, 0x79, 0xa8, 0x98, 0xbe, 0x55, 0x02, 0xe6, 0xd2, 0x82, 0x2b, 0xbb, 0xb1, 0xfe, 0x94,
-  0x46, 0x78, 0x8d, 0xfc, 0x17, 0x46, 0x08, 0x7a, 0xcc, 0x81, 0xbb, 0xd8, 0xbb, 0xcd, 0xcd, 0x43, 0x6b, 0x14, 0x02,
-  0x41, 0x74, 0xae, 0xfd, 0xd2, 0xc0, 0x19, 0xb6, 0x64, 0x84, 0x7d, 0x5e, 0x92, 0x80, 0xe0, 0xd6, 0x30, 0x37, 0x69,
-  0xa2, 0x77, 0x99, 0xc5, 0x03, 0x1f, 0x80, 0x36, 0xab, 0x0e, 0xf9, 0x6f, 0x78, 0xff, 0x0e, 0x4b, 0xae, 0x38, 0x20,
-  0xb8, 0x92, 0x81, 0x62, 0xb3, 0xa1, 0x57, 0x12, 0x50, 0x72, 0x4d, 0xf8, 0x6e, 0xb3, 0x59, 0x48, 0x85, 0x6a, 0xfe,
-  0xc0, 0x9e, 0x6b, 0xf3, 0x91, 0x1b, 0xdb, 0x6f, 0x55, 0x14, 0xf5, 0xfc, 0x27, 0x08, 0x2b, 0x5c, 0x20, 0x30, 0x57,
-  0xaf, 0xf8, 0x2e, 0xf3, 0xb5, 0x70, 0xb9, 0xfc, 0x11, 0xce, 0x02, 0x38, 0xe7, 0xa0, 0xa0, 0xd7, 0x6d, 0x3e, 0x72,
-  0x6c, 0xc8, 0x20, 0x24, 0x1c, 0x32, 0x50, 0x09, 0x48, 0x07, 0x96, 0x14, 0xdf, 0x65, 0x4e, 0x0b, 0x4d, 0xcb, 0xa0,
-  0x20, 0x66, 0x0d, 0x4d, 0x10, 0x68, 0xfe, 0x46, 0xd6, 0x4f, 0xca, 0x88, 0x84, 0x89, 0x89, 0x01, 0xf3, 0xab, 0xf0,
-  0x8f, 0x4c, 0x16, 0xa6, 0x80, 0xc0, 0xf5, 0x8f, 0x5f, 0x1f, 0xb8, 0x4d, 0xc0, 0x49, 0x4c, 0x76, 0x3f, 0x1c, 0x24,
-  0xf1, 0xfe, 0x01, 0xe1, 0x7d, 0xac, 0xf8, 0x02, 0x91, 0x4f, 0xf7, 0x4f, 0x0d, 0x0b, 0x5b, 0x6d, 0x3e, 0x24, 0x00,
-  0x84, 0xb1, 0x19, 0xe3, 0xc6, 0x2c, 0x6a, 0x7e, 0xae, 0x7f, 0x16, 0x20, 0x2e, 0x00, 0xe2, 0x06, 0xb1, 0x3f, 0x33,
-  0x29, 0xc8, 0xcd, 0x77, 0x2d, 0x32, 0x01, 0xd4, 0x7e, 0x1c, 0x5c, 0x7f, 0x0e, 0xd6, 0xc7, 0x82, 0x83, 0xd4, 0xba,
-  0xf6, 0x8b, 0x98, 0x5f, 0x99, 0x1f, 0xe9, 0x9f, 0x99, 0x14, 0x44, 0x62, 0xa0, 0x6c, 0x3f, 0x10, 0x90, 0x80, 0x90,
-  0xb8, 0x3d, 0x93, 0x6f, 0x06, 0x51, 0x96, 0x7f, 0x96, 0xc6, 0x41, 0xec, 0xcf, 0x4c, 0x0a, 0x3e, 0x97, 0x1f, 0xcd,
-  0x1f, 0x46, 0x4b, 0xdf, 0x9c, 0x43, 0xe0, 0xb3, 0xde, 0x07, 0x39, 0x8e, 0x18, 0x9c, 0x07, 0xf1, 0xab, 0xc4, 0x50,
-  0x88, 0xde, 0x76, 0x46, 0x93, 0x9c, 0x08, 0x35, 0x27, 0x6d, 0x4e, 0x58, 0x8c, 0xc2, 0x24, 0x4f, 0xe7, 0x14, 0xf6,
-  0x08, 0x0a, 0x05, 0xaf, 0x28, 0xd5, 0x65, 0xd1, 0xa0, 0x40, 0xb7, 0xa0, 0x5e, 0x53, 0x91, 0xb2, 0x80, 0x9a, 0x21,
-  0x6b, 0xf3, 0xcc, 0xdf, 0x03, 0xa1, 0xeb, 0xf6, 0x6f, 0xca, 0x0a, 0xfe, 0xe0, 0x08, 0xde, 0xe2, 0xe0, 0x28, 0x0b,
-  0xb3, 0x5d, 0x88, 0x3f, 0x49, 0x3a, 0x8e, 0xa0, 0x74, 0x30, 0xe6, 0x95, 0x58, 0xc0, 0x79, 0x57, 0xe3, 0x31, 0xd3,
-  0x14, 0x07, 0xc2, 0x32, 0xde, 0xbb, 0x42, 0xe6, 0x0b, 0xe2, 0x45, 0x06, 0x72, 0xc3, 0x36, 0x69, 0xa3, 0xb2, 0xbd,
-  0x22, 0x6f, 0x13, 0xb0, 0xe0, 0x79, 0x56, 0x3c, 0x7e, 0x93, 0x01, 0x2c, 0x4a, 0x00, 0xce, 0xa3, 0xc4, 0x78, 0x1f,
-  0x8f, 0x09, 0x6d, 0x4d, 0x5e, 0x55, 0x06, 0x1a, 0xe0, 0xc0, 0xbb, 0x28, 0x92, 0x58, 0x20, 0x98, 0x38, 0x00, 0x5d,
-  0x11, 0x66, 0xa1, 0x04, 0x18, 0x38, 0x68, 0x04, 0x0b, 0x10, 0x80, 0x07, 0x9b, 0xaf, 0xc6, 0x4e, 0x03, 0x0c, 0xc4,
-  0xeb, 0x37, 0xcb, 0x2a, 0x2d, 0x44, 0x0d, 0x3c, 0x40, 0x9e, 0xcc, 0x7f, 0xc3, 0x40, 0x66, 0x20, 0x1f, 0x1b, 0x09,
-  0x0e, 0x98, 0x2d, 0x43, 0x6a, 0x83, 0x81, 0xce, 0x02, 0x50, 0x0e, 0xaa, 0xfc, 0x5b, 0x64, 0x81, 0x4e, 0xeb, 0x66,
-  0x3d, 0x12, 0x07, 0x36, 0xa7, 0xc0, 0xc5, 0xf3, 0x29, 0x20, 0xab, 0x51, 0x23, 0x48, 0x76, 0x00, 0x3c, 0xe8, 0x0c,
-  0x44, 0x00, 0x91, 0xf0, 0xd5, 0x00, 0xff, 0xfd, 0x4a, 0xe7, 0x7c, 0xac, 0xca, 0xc2, 0x2c, 0xeb, 0x44, 0xc8, 0xe0,
-  0x4d, 0x03, 0x62, 0x09, 0x36, 0xce, 0x4b, 0xb0, 0x51, 0x15, 0x80, 0x7e, 0x7f, 0x94, 0x00, 0x06, 0xae, 0x1e, 0xd4,
-  0x01, 0xd3, 0x2c, 0xd9, 0x00, 0x2d, 0x51, 0xfd, 0xcb, 0x63, 0xf9, 0xa7, 0xdc, 0xca, 0x80, 0x75, 0x0d, 0x80, 0x05,
-  0xde, 0x94, 0x0f, 0x20, 0x2d, 0x18, 0x82, 0xd8, 0xe2, 0x00, 0x10, 0x5b, 0x0d, 0xed, 0x97, 0xe0, 0xdf, 0x06, 0x30,
-  0x50, 0xf5, 0x7f, 0x00, 0xe5, 0x06, 0x58, 0x03, 0x21, 0xb1, 0x2c, 0xcb, 0x18, 0x44, 0x8b, 0x4d, 0xfd, 0x47, 0x80,
-  0xa2, 0x00, 0xdc, 0x80, 0xe0, 0xa8, 0xfe, 0xff, 0x49, 0x85, 0xa1, 0x9b, 0x4a, 0x30, 0x7b, 0x55, 0x00, 0x0b, 0x0e,
-  0xb0, 0x73, 0x9f, 0xf4, 0x40, 0x5f, 0x01, 0x67, 0x5c, 0x1c, 0x84, 0x31, 0xe7, 0x02, 0x64, 0xe1, 0x5c, 0xee, 0x14,
-  0xa4, 0x1a, 0xb0, 0x64, 0x00, 0x00, 0x1a, 0xa0, 0x82, 0x50, 0x1d, 0xc0, 0x02, 0x40, 0xf7, 0x1f, 0x04, 0xe5, 0x82,
-  0x85, 0xa7, 0xdf, 0x85, 0xa1, 0xa7, 0x02, 0xc6, 0xf3, 0xe0, 0x80, 0x02, 0x5c, 0x15, 0x20, 0x41, 0x40, 0xc6, 0x93,
-  0xe2, 0x5b, 0x71, 0x06, 0x19, 0x30, 0x58, 0x16, 0xc9, 0x8b, 0xcc, 0x00, 0x13, 0x2e, 0x24, 0xba, 0x03, 0x24, 0xd1,
-  0xdb, 0xfa, 0x37, 0x8b, 0x26, 0xd7, 0x53, 0x3e, 0x02, 0xd0, 0xf6, 0x8f, 0x51, 0x07, 0xd0, 0xee, 0xa3, 0x0d, 0x10,
-  0xa5, 0x40, 0x02, 0x20, 0x41, 0x5f, 0x03, 0x86, 0x2d, 0xdb, 0xff, 0x4d, 0xca, 0xc2, 0x39, 0xe5, 0x0d, 0x11, 0x2b,
-  0xf2, 0x0e, 0xed, 0xc0, 0x5d, 0x7e, 0xff, 0x54, 0x30, 0x54, 0x01, 0xab, 0xa5, 0x27, 0x3f, 0x7e, 0xf4, 0xf6, 0xef,
-  0xda, 0x7f, 0x0d, 0x9e, 0x91, 0x15, 0x30, 0x3c, 0x7c, 0xa8, 0x01, 0x21, 0xd9, 0x01, 0xd1, 0x58, 0xc6, 0x2c, 0x75,
-  0x03, 0x44, 0x55, 0xff, 0x35, 0xb1, 0x29, 0x03, 0x72, 0xfa, 0x65, 0xec, 0x11, 0x77, 0xff, 0x94, 0x2d, 0x73, 0x7b,
-  0xed, 0xd4, 0xbe, 0xef, 0x17, 0x06, 0xd5, 0x80, 0xb8, 0x86, 0x5b, 0x57, 0xc0, 0x82, 0xe8, 0x7f, 0x86, 0xfb, 0xaf,
-  0xb7, 0x02, 0x83, 0x68, 0x15, 0xb3, 0x72, 0x40, 0x8a, 0x7a, 0xfe, 0x29, 0xcd, 0x52, 0x36, 0xc0, 0x0c, 0x42, 0x4a,
-  0x3a, 0x40, 0x0d, 0xae, 0xc5, 0xb4, 0xa7, 0x1e, 0x6a, 0xff, 0x79, 0xd4, 0xff, 0x7d, 0x19, 0xc8, 0xfa, 0x13, 0x43,
-  0x89, 0xeb, 0xb3, 0x00, 0x25, 0xe7, 0x6a, 0xc1, 0x54, 0xed, 0xef, 0x82, 0x85, 0x07, 0xd1, 0x8a, 0x00, 0xcc, 0x20,
-  0x01, 0x74, 0x63, 0xa2, 0x02, 0xac, 0xc5, 0x53, 0xf7, 0xa3, 0x1c, 0x00, 0xa3, 0x0f, 0x9f, 0x54, 0x70, 0x1c, 0x55,
-  0xfb, 0x5f, 0x34, 0x19, 0x24, 0x01, 0xac, 0x55, 0xe0, 0x4d, 0xe4, 0x20, 0x03, 0x6b, 0xb3, 0x02, 0x90, 0x07, 0xb5,
-  0xfb, 0x29, 0xc4, 0xf4, 0xeb, 0xdc, 0x7f, 0x86, 0x1d, 0x3c, 0x04, 0x16, 0x54, 0xff, 0xcd, 0x84, 0x2d, 0x0e, 0x4e,
-  0x88, 0x04, 0x1c, 0x31, 0x7e, 0xa0, 0xae, 0xc3, 0xcf, 0x3a, 0x51, 0x16, 0x28, 0xcc, 0x96, 0xfe, 0xf3, 0x9c, 0x47,
-  0x0e, 0x08, 0x77, 0x15, 0x00, 0x0f, 0xa8, 0x54, 0x65, 0xe1, 0x61, 0x28, 0x81, 0xc7, 0x2a, 0x1d, 0x84, 0x68, 0x32,
-  0x16, 0x47, 0xa8, 0x33, 0x00, 0x62, 0x4b, 0xa6, 0xef, 0xb7, 0x02, 0xa8, 0xe9, 0x93, 0x88, 0xfa, 0xc7, 0x71, 0x2b,
-  0x3a, 0x7c, 0x90, 0xff, 0xee, 0x06, 0x30, 0x5b, 0x12, 0x30, 0x23, 0x1d, 0x3c, 0x0e, 0x2d, 0x30, 0x71, 0x7b, 0xc2,
-  0x0b, 0x25, 0x96, 0x23, 0x90, 0x81, 0x31, 0x5a, 0xa4, 0x93, 0xd4, 0x15, 0xd5, 0xd1, 0xbf, 0x69, 0xf6, 0xf7, 0xe2,
-  0xba, 0x2a, 0xa0, 0x37, 0x00, 0x7e, 0xff, 0x29, 0x64, 0xa0, 0x01, 0x0e, 0xe8, 0xd6, 0xd4, 0x3c, 0x9e, 0x72, 0x02,
-  0x68, 0x7f, 0xd5, 0x80, 0xdd, 0xe3, 0x07, 0x32, 0x8d, 0x18, 0x15, 0x27, 0x24, 0x20, 0xb7, 0x7f, 0xa4, 0x6a, 0x3f,
-  0x39, 0x7d, 0x51, 0x81, 0x31, 0xa3, 0xdb, 0x3f, 0x01, 0x7b, 0xce, 0x3e, 0x92, 0x93, 0x0d, 0x80, 0x77, 0x86, 0xa7,
-  0x0c, 0xa0, 0x8e, 0xde, 0xdf, 0xe2, 0x60, 0xb2, 0xa7, 0xfd, 0xf1, 0x20, 0xed, 0x72, 0xa0, 0x1a, 0xd0, 0x05, 0x69,
-  0xe1, 0x83, 0x44, 0x1e, 0x3e, 0xde, 0xb8, 0x83, 0x1a, 0x60, 0xf9, 0xf0, 0x97, 0xfb, 0x8f, 0x2e, 0xcd, 0x0f, 0x41,
-  0x0a, 0x1a, 0xc9, 0xfe, 0xe3, 0xd9, 0xdf, 0x73, 0xf3, 0xba, 0x44, 0x7c, 0x81, 0xd4, 0x91, 0xa6, 0x0f, 0x56, 0x4b,
-  0x2c, 0x75, 0xf6, 0xad, 0x61, 0x88, 0x0f, 0x7a, 0xae, 0x1e, 0xe3, 0xbc, 0x88, 0x24, 0x8a, 0xb5, 0x0e, 0xef, 0xf2,
-  0x40, 0x02, 0xe0, 0xe0, 0xee, 0xa7, 0x60, 0xb2, 0x96, 0x01, 0x8b, 0xb4, 0x85, 0x93, 0xe9, 0x00, 0x8b, 0xa7, 0xbf,
-  0xbc, 0x79, 0x58, 0xa6, 0x05, 0xc5, 0xbb, 0x61, 0xa9, 0x06, 0x28, 0x6f, 0x1e, 0x47, 0xe1, 0xc9, 0xed, 0xef, 0xc9,
-  0xe9, 0x0b, 0xbe, 0xe5, 0x60, 0xda, 0x53, 0x0e, 0xd0, 0x73, 0xf1, 0x1a, 0x50, 0x0a, 0x32, 0x22, 0x06, 0x04, 0x82,
-  0xe0, 0x0d, 0x40, 0xd3, 0x0f, 0xdc, 0x86, 0xbb, 0xbc, 0x9c, 0xe8, 0xe1, 0xab, 0x0b, 0xc0, 0x16, 0x74, 0x07, 0x64,
-  0x18, 0x63, 0x08, 0x8b, 0xb0, 0x68, 0x45, 0x90, 0x82, 0x71, 0x4f, 0xbe, 0x1f, 0xdd, 0x7f, 0xfd, 0x37, 0x9f, 0x20,
-  0x33, 0x10, 0x43, 0x03, 0x40, 0x13, 0x09, 0x25, 0x40, 0x1f, 0x7e, 0x10, 0xe6, 0x4f, 0x69, 0x21, 0x21, 0x0f, 0xfa,
-  0xe8, 0xd5, 0xa1, 0x53, 0xc0, 0x6f, 0x6b, 0x34, 0x7e, 0xa8, 0x01, 0x5e, 0x0a, 0x16, 0x22, 0xb7, 0xda, 0x92, 0x02,
-  0x09, 0xa0, 0xb3, 0xaf, 0x4b, 0x6b, 0x98, 0x31, 0xcf, 0x6a, 0x30, 0x28, 0x01, 0x08, 0x84, 0x76, 0x90, 0x18, 0x2c,
-  0xe8, 0x64, 0x72, 0x09, 0x95, 0x01, 0x2f, 0x42, 0x06, 0x68, 0x03, 0x02, 0xf3, 0x11, 0xd3, 0x7f, 0x2d, 0x77, 0xdf,
-  0x02, 0xb6, 0x80, 0xbc, 0x79, 0xc0, 0x00, 0x47, 0x2c, 0x75, 0x8d, 0x80, 0x87, 0x3c, 0x7a, 0x6f, 0x91, 0x57, 0x8f,
-  0x88, 0xba, 0x77, 0xea, 0xfe, 0xe7, 0xc8, 0x68, 0x28, 0xbf, 0x50, 0x50, 0x06, 0x74, 0x03, 0x60, 0xfa, 0xe0, 0xec,
-  0x57, 0xb2, 0xce, 0x8a, 0x3d, 0x02, 0x16, 0xea, 0x04, 0x2c, 0x19, 0xbe, 0x97, 0xa0, 0xa0, 0xa8, 0xc2, 0x19, 0x6f,
-  0x00, 0xe4, 0xbd, 0x1f, 0x88, 0xfe, 0x5b, 0x3e, 0x7e, 0xc6, 0x2c, 0x79, 0xf4, 0x43, 0xa6, 0xcf, 0x01, 0x75, 0xc0,
-  0x2d, 0xaf, 0x02, 0x0b, 0x24, 0x68, 0x91, 0x87, 0x45, 0x67, 0xef, 0x5e, 0xd3, 0xcf, 0x0d, 0x25, 0x47, 0x3a, 0x7a,
-  0x41, 0x9f, 0x05, 0x18, 0x50, 0x41, 0x44, 0x23, 0xc0, 0xeb, 0x3e, 0x7b, 0x00, 0x1c, 0x98, 0x38, 0xc2, 0x63, 0x90,
-  0x82, 0x89, 0x91, 0x17, 0x9f, 0x86, 0x06, 0x00, 0xc0, 0x50, 0x72, 0x22, 0x2d, 0x24, 0x32, 0x03, 0xc6, 0xc8, 0xdd,
-  0xc7, 0x91, 0xc3, 0xdf, 0xd5, 0xd7, 0xce, 0x54, 0xa8, 0xe9, 0x19, 0x7f, 0xbb, 0x8e, 0xfe, 0x40, 0xc3, 0x77, 0x52,
-  0xa6, 0xe0, 0x15, 0xe8, 0x47, 0x8a, 0xce, 0x5e, 0x19, 0x91, 0xc8, 0x09, 0x2d, 0x79, 0xef, 0xd4, 0x87, 0x4f, 0x41,
-  0xf0, 0xbc, 0x0f, 0xd4, 0xd9, 0xe3, 0xea, 0xb3, 0x57, 0x59, 0x70, 0x0d, 0xa7, 0x28, 0x02, 0x01, 0xa8, 0xfd, 0xd0,
-  0x00, 0x99, 0x81, 0xe6, 0x8b, 0xc1, 0x5d, 0x2f, 0x41, 0x7f, 0x0a, 0x6e, 0x1d, 0x8c, 0xdb, 0x62, 0x01, 0x09, 0xa8,
-  0x83, 0xa4, 0x86, 0xef, 0x16, 0xa2, 0xa0, 0x7b, 0xf8, 0x7b, 0x96, 0x05, 0x4a, 0x07, 0xc6, 0x1b, 0xe7, 0x6d, 0xaa,
-  0x00, 0x40, 0xff, 0xf7, 0x36, 0x00, 0x79, 0xb8, 0xfb, 0x16, 0x10, 0xc0, 0x23, 0x03, 0xe0, 0x4b, 0x1b, 0x10, 0x38,
-  0xbc, 0x73, 0x42, 0x44, 0x30, 0xc4, 0x09, 0xd6, 0xe2, 0xe9, 0x0b, 0x03, 0xf2, 0xec, 0x4d, 0xdc, 0x5a, 0xfc, 0xab,
-  0xb8, 0x01, 0x1f, 0x15, 0x0b, 0x5b, 0x32, 0x70, 0xd8, 0xcd, 0x2b, 0xb5, 0xf0, 0xe8, 0x17, 0x0e, 0x1c, 0x65, 0x60,
-  0x28, 0x74, 0x11, 0x7a, 0xaf, 0x3e, 0xc4, 0x51, 0xd3, 0x17, 0x1c, 0x69, 0xfa, 0x9c, 0x6b, 0x66, 0x28, 0x3f, 0x99,
-  0x3c, 0x6b, 0xc0, 0x82, 0xbe, 0x76, 0x63, 0x2d, 0x0d, 0x9d, 0x81, 0xe9, 0x20, 0xed, 0xb9, 0xf8, 0xee, 0x3a, 0x7b,
-  0x40, 0x6f, 0xff, 0x2f, 0xbb, 0x79, 0xd1, 0x37, 0x2a, 0xa0, 0x86, 0x6f, 0x83, 0x67, 0x39, 0x4b, 0xf6, 0xdf, 0x4b,
-  0xc1, 0xc2, 0xc4, 0x18, 0x0a, 0x06, 0xb1, 0xe4, 0x95, 0x1f, 0x8f, 0xee, 0xe9, 0x3b, 0xb6, 0x2e, 0x64, 0x0a, 0x2c,
-  0x64, 0xe0, 0x0d, 0x75, 0xf6, 0x68, 0xba, 0xef, 0xdd, 0xc9, 0x49, 0x0c, 0xf4, 0x16, 0x00, 0x5f, 0x8c, 0x38, 0xa0,
-  0xbb, 0x0c, 0x39, 0x48, 0x00, 0x1d, 0x3e, 0x67, 0xf5, 0xbe, 0x75, 0x7d, 0x50, 0x46, 0xef, 0x4b, 0xe7, 0x00, 0x2c,
-  0x9d, 0xbe, 0xf4, 0xde, 0xa1, 0xa6, 0x8f, 0x6e, 0x00, 0x04, 0x49, 0x8f, 0x9f, 0x8a, 0x5d, 0x0d, 0x78, 0xff, 0x53,
-  0xc0, 0x25, 0xd0, 0x19, 0xe0, 0x57, 0xee, 0x25, 0xc3, 0x1f, 0x2a, 0xfb, 0x2f, 0x0e, 0xc4, 0xd1, 0xc6, 0x0f, 0xa2,
-  0x2c, 0x80, 0x9b, 0x29, 0x07, 0x80, 0x55, 0x0a, 0xf9, 0xc7, 0xa3, 0x6f, 0xfa, 0x54, 0x19, 0xf8, 0x86, 0x25, 0x05,
-  0xc0, 0x7a, 0xca, 0x00, 0x40, 0xdd, 0xfb, 0x8f, 0xe0, 0x14, 0x1e, 0x3d, 0x5f, 0x3c, 0x78, 0x4d, 0xac, 0xa3, 0x86,
-  0xaf, 0xd9, 0xf4, 0xd6, 0x47, 0x4a, 0xcc, 0x5a, 0x90, 0x16, 0xbf, 0x72, 0x1f, 0x71, 0xf1, 0xa3, 0x4f, 0x95, 0xd2,
-  0xc2, 0xb7, 0x12, 0x80, 0x6f, 0x56, 0xd3, 0x9e, 0x7d, 0xd1, 0x44, 0xb0, 0xdc, 0xb9, 0x3c, 0xde, 0xff, 0xb7, 0x58,
-  0x7d, 0x1b, 0xa0, 0x9a, 0xbe, 0xef, 0x31, 0x5e, 0xf9, 0xce, 0x87, 0x80, 0xc6, 0xf5, 0x51, 0x76, 0x00, 0x16, 0x02,
-  0x8f, 0xea, 0xe2, 0x89, 0xe9, 0xc3, 0x0e, 0x26, 0xf4, 0xc1, 0x70, 0x36, 0xeb, 0xbe, 0xa3, 0x66, 0x3f, 0xc4, 0x04,
-  0x62, 0xc9, 0xf0, 0xe7, 0xfe, 0x4f, 0x35, 0x92, 0x0a, 0xd6, 0x18, 0xa6, 0xaf, 0xfc, 0xe0, 0xc5, 0x0a, 0xbd, 0xe3,
-  0x87, 0xb7, 0x7f, 0x6f, 0x03, 0x78, 0xbb, 0x0e, 0xbf, 0xd2, 0x00, 0x72, 0x00, 0xee, 0x32, 0x55, 0x06, 0xc4, 0xf0,
-  0xd7, 0xb0, 0x83, 0x2b, 0x85, 0xdb, 0x28, 0x05, 0xac, 0x77, 0x89, 0x06, 0xd4, 0x47, 0xaf, 0x34, 0x50, 0x86, 0x3c,
-  0xfc, 0xba, 0x0a, 0x20, 0x1d, 0xf0, 0x2a, 0xfb, 0x2f, 0xf5, 0x0a, 0x54, 0x82, 0x8d, 0x90, 0x67, 0x1f, 0xe3, 0x60,
-  0xa0, 0xef, 0xad, 0xaf, 0xf7, 0x7b, 0x97, 0x7e, 0xed, 0x4a, 0xb5, 0xa0, 0xe9, 0xdf, 0xfd, 0xca, 0x0f, 0x42, 0x3c,
-  0x5e, 0x22, 0xb7, 0x9f, 0xc1, 0x5a, 0x47, 0x53, 0x02, 0x59, 0x00, 0x8e, 0x47, 0xc1, 0x82, 0x31, 0xfa, 0xe2, 0xd7,
-  0xc3, 0x50, 0x4f, 0x05, 0xc0, 0x1e, 0x07, 0xdd, 0x47, 0x3f, 0xaf, 0x84, 0xc2, 0xf5, 0x6f, 0x7f, 0x79, 0xef, 0xaf,
-  0x02, 0x60, 0x89, 0xe9, 0x27, 0x12, 0x40, 0x29, 0x78, 0x15, 0xfc, 0x84, 0x06, 0x02, 0xa7, 0x0f, 0x49, 0xbf, 0xf3,
-  0x47, 0x49, 0x09, 0xb3, 0xe4, 0x6b, 0xe7, 0x58, 0xf9, 0xca, 0xbb, 0xe5, 0xec, 0xeb, 0x2e, 0x41, 0xf7, 0xe1, 0x63,
-  0x75, 0xed, 0x3f, 0xcb, 0x0c, 0x28, 0x03, 0x51, 0x4a, 0xc0, 0x43, 0xf0, 0xc1, 0x1c, 0xf7, 0x5e, 0xb5, 0xfd, 0x8d,
-  0xe7, 0xbc, 0x23, 0x9d, 0x7d, 0x16, 0x56, 0x59, 0x00, 0x77, 0x54, 0x06, 0x74, 0x02, 0xa4, 0xb0, 0x22, 0xca, 0x01,
-  0xb8, 0x50, 0x75, 0x00, 0x15, 0xa0, 0x1c, 0x3f, 0xde, 0x21, 0x0d, 0x08, 0x07, 0x77, 0xff, 0x83, 0x79, 0xc0, 0x02,
-  0xa5, 0x05, 0xfc, 0xfa, 0x15, 0x96, 0x87, 0xc0, 0x43, 0xca, 0x7b, 0xaf, 0xdf, 0x76, 0xf6, 0x2e, 0xfd, 0xe0, 0x04,
-  0xf4, 0xcd, 0x2b, 0x91, 0xfd, 0x2f, 0x10, 0x19, 0x88, 0x23, 0x98, 0xf0, 0xf4, 0xb3, 0x40, 0x1f, 0x7b, 0x29, 0x32,
-  0x80, 0x29, 0x77, 0x40, 0xd7, 0xc5, 0x6b, 0xcf, 0xfe, 0x03, 0xcd, 0xea, 0x43, 0x5a, 0xa8, 0x4a, 0xb0, 0xfc, 0x83,
-  0x13, 0x42, 0xed, 0x3f, 0x30, 0x80, 0x83, 0xa5, 0xe3, 0xaf, 0x85, 0x79, 0x04, 0x2c, 0xe8, 0xb3, 0x5f, 0x4f, 0x1f,
-  0xce, 0x40, 0x2f, 0x40, 0x9d, 0xfd, 0xe0, 0x04, 0x4b, 0x41, 0x1d, 0x60, 0xd1, 0xad, 0x3b, 0x20, 0x4c, 0x44, 0xa0,
-  0xa6, 0x6f, 0xd7, 0xd1, 0x9f, 0xed, 0x4f, 0x7c, 0x33, 0x7d, 0x32, 0x01, 0xbc, 0xf2, 0x5f, 0x0c, 0xee, 0xbe, 0x05,
-  0x3f, 0x23, 0x4b, 0xb6, 0xbf, 0x7e, 0xe9, 0xac, 0x63, 0xf1, 0xf0, 0x07, 0x02, 0x7d, 0xed, 0x86, 0x2c, 0x5a, 0x34,
-  0xfd, 0x68, 0xfb, 0x13, 0xf5, 0xbd, 0x5f, 0x49, 0x2a, 0x0e, 0x9e, 0x3e, 0xd4, 0x01, 0x8f, 0x42, 0x0a, 0x76, 0xc6,
-  0xbd, 0x9f, 0xc3, 0x10, 0xde, 0xda, 0xcd, 0xcf, 0x45, 0x96, 0x71, 0x0b, 0xaf, 0xb0, 0xe8, 0xda, 0x4d, 0x19, 0xb8,
-  0x58, 0x10, 0x50, 0x01, 0xdc, 0xe2, 0xf1, 0x53, 0xd6, 0x7f, 0x8b, 0xbc, 0xbb, 0x9f, 0x02, 0xb4, 0xe0, 0xf5, 0x40,
-  0x3a, 0x08, 0xc9, 0x51, 0x05, 0x58, 0x63, 0xcb, 0x37, 0x07, 0xd2, 0x35, 0xd4, 0xf0, 0x8b, 0x98, 0xdf, 0xf6, 0xc9,
-  0x41, 0x7d, 0xf1, 0x91, 0xed, 0x2f, 0x65, 0xb0, 0x22, 0xb4, 0xff, 0xc6, 0xcd, 0xec, 0x02, 0x0e, 0xee, 0xb9, 0x05,
-  0x7c, 0x82, 0x9b, 0x97, 0x34, 0x9a, 0x39, 0xe2, 0xe2, 0x37, 0x83, 0x1c, 0x80, 0xc5, 0x1f, 0xbc, 0x40, 0x30, 0xfd,
-  0x1d, 0x38, 0xe5, 0x2c, 0x34, 0x80, 0x2a, 0x80, 0x45, 0xe8, 0xed, 0x27, 0x6f, 0x5e, 0x38, 0x7c, 0x52, 0x2c, 0x4a,
-  0x41, 0xa9, 0x74, 0x60, 0xee, 0xbe, 0xf0, 0x6f, 0x40, 0xbf, 0x3b, 0x1a, 0x80, 0x87, 0x1f, 0x1e, 0x34, 0x7c, 0xab,
-  0x98, 0x45, 0xde, 0xbb, 0xa4, 0x83, 0xf2, 0xde, 0xff, 0xa5, 0x5f, 0x5b, 0x4d, 0x77, 0x0a, 0x2c, 0x79, 0xf1, 0xc2,
-  0xea, 0x76, 0xd0, 0xc0, 0x05, 0x00, 0xf7, 0x3c, 0x50, 0x83, 0x79, 0x75, 0x68, 0x7e, 0x6d, 0x94, 0xdb, 0x5f, 0x0d,
-  0x7f, 0xd4, 0x00, 0xd7, 0x6e, 0x88, 0xf8, 0xd2, 0xf1, 0xc3, 0x1b, 0x40, 0xdd, 0x7b, 0x11, 0x9e, 0xbb, 0x2c, 0x52,
-  0xef, 0xf4, 0xbb, 0xa8, 0x67, 0xf8, 0xaf, 0xf5, 0xff, 0xe3, 0xf1, 0x0f, 0x56, 0x9f, 0xc5, 0xbc, 0x6f, 0x1c, 0xc2,
-  0x23, 0x07, 0xa4, 0xae, 0x77, 0xee, 0xee, 0xab, 0x0f, 0x24, 0x2d, 0xb8, 0x0b, 0xb7, 0xfb, 0x6f, 0x48, 0xbe, 0x73,
-  0xf6, 0x10, 0x07, 0xb5, 0x9f, 0xbe, 0xfa, 0x84, 0x5c, 0xd0, 0x55, 0xff, 0x47, 0x61, 0x21, 0x1d, 0xbc, 0x12, 0x80,
-  0x87, 0xbd, 0xa3, 0x01, 0x3c, 0x96, 0x7a, 0xeb, 0x92, 0x47, 0xef, 0x40, 0xb0, 0xf0, 0x63, 0xbb, 0x9a, 0x3e, 0xe7,
-  0x8c, 0xbd, 0xe7, 0x6b, 0x6e, 0x5e, 0xca, 0xc2, 0x91, 0x0a, 0x70, 0xe5, 0xe1, 0x81, 0x10, 0x27, 0x61, 0x3d, 0x39,
-  0x07, 0x71, 0xd4, 0xf7, 0x3e, 0xaf, 0xfb, 0xe6, 0x67, 0x88, 0x8b, 0x01, 0xe5, 0xc0, 0xed, 0x12, 0xad, 0x0a, 0x39,
-  0xfe, 0xc6, 0xc9, 0xe1, 0x4b, 0xb3, 0xd7, 0xc4, 0x86, 0xe2, 0xf9, 0x8f, 0x44, 0x09, 0x74, 0x1b, 0x7c, 0x66, 0x47,
-  0x3e, 0x47, 0x6f, 0xf7, 0xcd, 0xab, 0x66, 0xe9, 0xb5, 0x7f, 0xd9, 0xbd, 0x3f, 0x65, 0xb1, 0xa0, 0x0a, 0x00, 0xbc,
-  0xb2, 0xfe, 0xf9, 0xb8, 0x30, 0x03, 0xde, 0x98, 0x50, 0x06, 0x8c, 0xf5, 0x2b, 0xf1, 0x0a, 0x84, 0xe6, 0xaf, 0x10,
-  0x97, 0xf8, 0xb5, 0xdd, 0x9b, 0x87, 0x6f, 0x73, 0xf8, 0x84, 0xaf, 0x7a, 0xe9, 0xd4, 0x16, 0x92, 0x6f, 0x32, 0x00,
-  0x88, 0x89, 0xd7, 0xfd, 0xd2, 0x57, 0x8b, 0xde, 0xfa, 0xf0, 0xfb, 0x27, 0x6b, 0xd1, 0x55, 0x01, 0x8f, 0xb6, 0x1f,
-  0x52, 0x00, 0x0b, 0xff, 0xcf, 0xa0, 0x01, 0x80, 0xbf};
-
-static constexpr size_t FOLDERICONEMPTY_ORIGINAL_SIZE = 65536;
-
-static constexpr size_t FOLDERICONEMPTY_COMPRESSED_SIZE = 2954;
-
-static constexpr int FOLDERICONEMPTY_WIDTH = 128;
-
-static constexpr int FOLDERICONEMPTY_HEIGHT = 128;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// MATERIALICON
-// Width: 128, Height: 128
-//=========================================================================================//
-static const unsigned char MATERIALICON_BYTES[] = {
-  0x1b, 0xff, 0xff, 0x30, 0x9e, 0x07, 0x76, 0x2c, 0x37, 0x94, 0xc2, 0x72, 0x58, 0xed, 0x78, 0x48, 0x52, 0x9e, 0xff,
-  0x45, 0x0f, 0xf1, 0x5f, 0xb7, 0xde, 0x03, 0xee, 0x3c, 0xce, 0x1a, 0xc8, 0x24, 0xe9, 0xfc, 0x3d, 0x54, 0xc2, 0x22,
-  0xa4, 0x85, 0x49, 0x3a, 0xb5, 0xb6, 0x14, 0xfe, 0x1a, 0xb1, 0xc6, 0x99, 0x4b, 0x1e, 0xc9, 0x19, 0x77, 0xf6, 0x1a,
-  0x22, 0x60, 0x40, 0x20, 0xa4, 0x79, 0xf7, 0x09, 0x60, 0x20, 0x58, 0x18, 0x4c, 0xa0, 0x50, 0xf8, 0xf7, 0xbd, 0xe7,
-  0xfb, 0x75, 0x52, 0xc0, 0xc0, 0xc0, 0x87, 0x0f, 0x85, 0x07, 0x03, 0x58, 0xd8, 0xf0, 0x20, 0x50, 0x08, 0x14, 0x02,
-  0x85, 0xc0, 0x85, 0x0b, 0xf3, 0xbf, 0x33, 0x0b, 0x40, 0xc5, 0xb9, 0x75, 0xb3, 0x0f, 0x52, 0xfc, 0x17, 0x71, 0xf8,
-  0xdd, 0xaa, 0x40, 0xc0, 0x70, 0x21, 0x0a, 0xdf, 0x5b, 0x55, 0xa5, 0x60, 0xf8, 0x10, 0xdc, 0x27, 0x03, 0xa1, 0x22,
-  0x09, 0xd1, 0x2f, 0x02, 0x83, 0x7e, 0x07, 0x3f, 0xdd, 0xa4, 0xf8, 0x2f, 0x12, 0x20, 0xc0, 0x7f, 0x09, 0xe8, 0xbf,
-  0x74, 0x8f, 0x0c, 0x84, 0x16, 0x69, 0x48, 0xec, 0x0e, 0x28, 0x02, 0xbd, 0xdd, 0x21, 0x83, 0x10, 0x7c, 0x32, 0xe8,
-  0xfe, 0xfe, 0x06, 0x06, 0x46, 0x51, 0x66, 0xa8, 0x24, 0x08, 0x2a, 0x3a, 0xff, 0x71, 0xbe, 0xbb, 0xb9, 0x41, 0xb8,
-  0xc8, 0xda, 0x08, 0x68, 0x02, 0x64, 0x24, 0x00, 0x3d, 0x02, 0x6d, 0xe1, 0x75, 0x6b, 0x02, 0x81, 0x55, 0x46, 0xa4,
-  0x3b, 0x50, 0x17, 0x14, 0x10, 0x9c, 0x7f, 0x77, 0x66, 0xcc, 0x9b, 0x2b, 0x63, 0x13, 0x40, 0x11, 0x60, 0x2c, 0x85,
-  0x3a, 0x40, 0xb7, 0x65, 0x42, 0x20, 0x82, 0x23, 0x00, 0x90, 0x19, 0x86, 0x80, 0x8d, 0x1f, 0x63, 0xd5, 0x5d, 0x05,
-  0x01, 0x04, 0xe9, 0x55, 0x08, 0x60, 0x56, 0x2a, 0xb6, 0x42, 0x53, 0xfc, 0xfc, 0xc3, 0x7c, 0xf7, 0x74, 0x1d, 0x94,
-  0x59, 0xac, 0x57, 0x46, 0xb4, 0x8b, 0x00, 0x10, 0xe8, 0x0b, 0x5d, 0x05, 0xe3, 0x67, 0xb0, 0x78, 0xc8, 0xee, 0x88,
-  0x81, 0x48, 0x58, 0xc9, 0xef, 0x00, 0xe3, 0xad, 0x0f, 0x80, 0x22, 0x30, 0xd8, 0x8f, 0xd8, 0x84, 0x10, 0xe0, 0x57,
-  0xf8, 0xc5, 0xfd, 0x5c, 0x07, 0x20, 0x10, 0x04, 0x48, 0x24, 0x72, 0xe7, 0xdf, 0x67, 0x00, 0x76, 0xa0, 0x48, 0x5a,
-  0x84, 0xdb, 0xb9, 0x10, 0x41, 0x00, 0x83, 0xe0, 0x63, 0x83, 0xc1, 0xa0, 0x2a, 0xda, 0x82, 0x15, 0xa2, 0x1e, 0x81,
-  0x59, 0x6d, 0x56, 0xde, 0x4b, 0x2d, 0x22, 0xb2, 0xa8, 0xfa, 0x08, 0x64, 0x3e, 0xa9, 0x3f, 0x90, 0xaa, 0x2e, 0x00,
-  0x42, 0x39, 0x7f, 0xb0, 0x03, 0xfa, 0x1b, 0xc6, 0x04, 0xea, 0x4e, 0x6a, 0x11, 0x08, 0x2a, 0x50, 0x22, 0x1a, 0x21,
-  0xac, 0x33, 0x50, 0x45, 0x53, 0x08, 0x45, 0xfa, 0x39, 0x44, 0xf7, 0xe1, 0x79, 0x1b, 0x22, 0x9a, 0xa6, 0x79, 0x0a,
-  0x01, 0xf8, 0x44, 0x6d, 0x02, 0xe8, 0x06, 0xc0, 0x41, 0x40, 0xc3, 0x8f, 0x31, 0x48, 0x32, 0x00, 0x21, 0x50, 0xa4,
-  0xfc, 0xb8, 0x0b, 0x86, 0xba, 0x80, 0x0d, 0x8b, 0x00, 0x13, 0xed, 0x23, 0xa0, 0xe5, 0xcf, 0x09, 0x83, 0xba, 0xe0,
-  0x43, 0x4a, 0x95, 0xe8, 0x27, 0x7c, 0xb8, 0x05, 0xe3, 0xbf, 0x48, 0x43, 0x05, 0xd9, 0x1d, 0x80, 0xb6, 0xd5, 0x5f,
-  0x4d, 0xad, 0x0e, 0x80, 0x83, 0xa0, 0xa0, 0x26, 0xb8, 0x21, 0x96, 0xa4, 0x50, 0x04, 0xcc, 0x79, 0xff, 0x0d, 0x18,
-  0x1a, 0x1e, 0xb8, 0xe4, 0xbf, 0x23, 0x18, 0x15, 0x00, 0xd1, 0x2a, 0x04, 0x33, 0x04, 0xaa, 0x82, 0x83, 0x8f, 0xc5,
-  0xf0, 0x01, 0x66, 0xef, 0xcf, 0x40, 0x08, 0xd2, 0x5b, 0x9d, 0xc5, 0x66, 0x07, 0x20, 0x65, 0x35, 0xbe, 0x7e, 0xe6,
-  0x3b, 0x80, 0x65, 0x81, 0x40, 0x45, 0xb0, 0x0a, 0xcd, 0x80, 0x56, 0x54, 0x1e, 0x6e, 0x6f, 0x2e, 0x42, 0x49, 0xce,
-  0xf5, 0xeb, 0x32, 0xdf, 0x74, 0x07, 0x30, 0xf1, 0x08, 0x23, 0xc3, 0xa2, 0x00, 0x80, 0x29, 0x01, 0xbc, 0x1e, 0xf4,
-  0xe1, 0x23, 0x20, 0xe8, 0x94, 0xf2, 0xc3, 0xf5, 0xad, 0x8d, 0x50, 0xeb, 0x43, 0x6f, 0x09, 0x74, 0x64, 0x8d, 0x33,
-  0xc0, 0x26, 0xa0, 0x2a, 0xe3, 0x11, 0x6a, 0x71, 0x0e, 0x40, 0xd2, 0x78, 0x94, 0x30, 0xa3, 0x24, 0x88, 0xe1, 0x12,
-  0xc0, 0xf3, 0xba, 0x36, 0x3c, 0xc9, 0x5c, 0x0c, 0xec, 0xce, 0xdf, 0xbe, 0xf9, 0x30, 0xf2, 0x3b, 0x00, 0x82, 0x4a,
-  0x8e, 0x9a, 0x01, 0x29, 0x48, 0x67, 0x14, 0x05, 0x21, 0x9c, 0xdf, 0xd6, 0x08, 0x35, 0xff, 0xda, 0x0c, 0xeb, 0x95,
-  0x65, 0x13, 0x70, 0x5f, 0x7e, 0x52, 0x6d, 0xfd, 0x1b, 0x0d, 0x5d, 0x97, 0x2a, 0x61, 0x92, 0x0f, 0x14, 0x01, 0x04,
-  0xe4, 0x05, 0xee, 0x5d, 0x19, 0x08, 0x37, 0x4a, 0xba, 0xd9, 0x8d, 0x0f, 0x55, 0xe5, 0x6b, 0x84, 0x23, 0x82, 0x8f,
-  0x32, 0x50, 0x22, 0x00, 0xf5, 0x04, 0xf4, 0x8d, 0x0d, 0x33, 0x45, 0x20, 0xfb, 0x60, 0xe2, 0xf4, 0x9e, 0xe2, 0x27,
-  0x27, 0xbf, 0xaa, 0xff, 0xda, 0x59, 0xf6, 0xf6, 0x1d, 0xe7, 0xff, 0x77, 0x07, 0x00, 0x0c, 0x68, 0x05, 0x52, 0x82,
-  0xe0, 0x33, 0x20, 0x2f, 0xe8, 0x8d, 0xb4, 0xd8, 0xbc, 0xe7, 0xa0, 0xdb, 0xfe, 0xc6, 0x67, 0x50, 0x2f, 0x38, 0xc3,
-  0xcd, 0x70, 0xe8, 0x26, 0xf5, 0xd7, 0x9c, 0xff, 0xed, 0x0e, 0xd0, 0x7d, 0xf0, 0xe5, 0x23, 0xb1, 0x3e, 0x04, 0x50,
-  0x5d, 0x50, 0x22, 0x25, 0xd0, 0xe8, 0xbf, 0xa3, 0x08, 0x14, 0x76, 0xab, 0x1b, 0xd7, 0x77, 0x1c, 0x89, 0xb8, 0x4d,
-  0x06, 0xc8, 0x64, 0xc0, 0x97, 0x08, 0xe9, 0xb1, 0x30, 0xd1, 0x10, 0x94, 0x0a, 0xd2, 0x82, 0x0c, 0x22, 0x0e, 0x6f,
-  0x29, 0x02, 0x05, 0xf9, 0xf3, 0x9a, 0xa3, 0xab, 0x66, 0x61, 0xe6, 0xa6, 0xfe, 0x00, 0xc0, 0x85, 0xc0, 0x1f, 0xc0,
-  0xaa, 0xa4, 0x47, 0x28, 0xa0, 0x0c, 0xa4, 0x21, 0x80, 0x88, 0x8b, 0xef, 0x7b, 0x8a, 0xbb, 0x7c, 0xbf, 0xc9, 0xa0,
-  0x4f, 0xae, 0x1c, 0xb8, 0x45, 0x00, 0x83, 0xc8, 0x06, 0x60, 0xa6, 0x5c, 0x8c, 0x24, 0xb0, 0x19, 0x20, 0x13, 0x2b,
-  0x20, 0xbc, 0x6b, 0x57, 0x4c, 0xca, 0xfa, 0x71, 0x67, 0xfd, 0xb5, 0x6d, 0x04, 0x5a, 0x9c, 0x5e, 0x58, 0x15, 0x0e,
-  0xc3, 0xbe, 0x97, 0x6a, 0x75, 0xfe, 0x8c, 0x32, 0x50, 0x33, 0x20, 0x81, 0xde, 0x17, 0x81, 0x13, 0xcb, 0x43, 0xaf,
-  0xe6, 0x93, 0x1e, 0x3e, 0xa6, 0xb1, 0x07, 0x70, 0x1c, 0x01, 0xdd, 0xf8, 0xdc, 0xdd, 0x22, 0xd8, 0xd1, 0x67, 0x40,
-  0xea, 0x6d, 0xaf, 0x22, 0xb2, 0x56, 0x25, 0x77, 0x9c, 0x74, 0x6d, 0xdc, 0xdb, 0xdd, 0x40, 0x32, 0x7c, 0x52, 0x7f,
-  0x30, 0x10, 0x02, 0x2c, 0xdd, 0xce, 0xe7, 0x3b, 0x00, 0x04, 0x62, 0x62, 0xfd, 0xae, 0xe2, 0x36, 0x49, 0xc0, 0x55,
-  0xc9, 0x47, 0x92, 0x75, 0xcb, 0xea, 0xae, 0xcb, 0xd4, 0xee, 0x00, 0x84, 0x1f, 0x92, 0x7f, 0x82, 0xa0, 0x07, 0x9f,
-  0x2a, 0xd9, 0x0e, 0xf9, 0xbf, 0x22, 0x90, 0x3a, 0xf4, 0xbe, 0xed, 0x20, 0x07, 0xb3, 0x86, 0xa8, 0xdb, 0xaf, 0xad,
-  0x04, 0x59, 0xd6, 0xa6, 0xcd, 0xd7, 0x7e, 0x07, 0x74, 0xe5, 0x6c, 0x31, 0x5f, 0x00, 0x21, 0x20, 0x10, 0x16, 0xc3,
-  0xb7, 0x15, 0x81, 0x82, 0x35, 0x17, 0x9d, 0xbe, 0x2d, 0xf9, 0x54, 0xfb, 0xe4, 0xf2, 0x97, 0x53, 0x67, 0x33, 0x00,
-  0x11, 0x11, 0x29, 0x0b, 0x39, 0x82, 0xf0, 0xc6, 0x04, 0x10, 0xc5, 0x43, 0xb2, 0xff, 0xeb, 0x86, 0xc7, 0x97, 0x5c,
-  0x09, 0x7b, 0xce, 0x7e, 0x9a, 0x82, 0x24, 0x01, 0x34, 0x04, 0x09, 0x3e, 0xb1, 0x19, 0xa0, 0x27, 0x00, 0x22, 0xe2,
-  0x9d, 0x09, 0x08, 0x14, 0x04, 0x0c, 0xcb, 0x20, 0xb2, 0x5f, 0x1b, 0xe6, 0x93, 0x2e, 0x0b, 0x56, 0x7c, 0x97, 0x80,
-  0xc9, 0x37, 0xf7, 0x4f, 0x89, 0xa8, 0xb7, 0x26, 0x20, 0x50, 0x50, 0x42, 0xb8, 0xbf, 0x72, 0xb6, 0x35, 0xcf, 0x7f,
-  0x6d, 0xcc, 0xd2, 0x90, 0x44, 0xa0, 0x8d, 0x3b, 0x5c, 0xce, 0x23, 0x10, 0x34, 0x02, 0x10, 0x31, 0x4f, 0x4d, 0x00,
-  0xc3, 0x53, 0xa6, 0x48, 0xae, 0x1c, 0x21, 0xd8, 0xdf, 0x78, 0x76, 0xd7, 0x73, 0x1d, 0xf2, 0xbf, 0x9d, 0x59, 0x04,
-  0xac, 0xdc, 0x56, 0x23, 0x44, 0x40, 0x07, 0x71, 0x6f, 0x4e, 0xc0, 0x65, 0xe3, 0xdb, 0xaf, 0x8d, 0x40, 0xbb, 0x05,
-  0xa3, 0x5d, 0x97, 0x58, 0x8b, 0xaf, 0xa2, 0x21, 0x33, 0x2c, 0x3d, 0xcb, 0x00, 0x10, 0x70, 0xe4, 0xad, 0x85, 0xc1,
-  0xe7, 0x3e, 0x2d, 0xbf, 0xb6, 0xe1, 0xdc, 0x1f, 0x3a, 0xf8, 0x5f, 0x95, 0x1f, 0x98, 0xe9, 0xb5, 0x93, 0x46, 0x09,
-  0xe8, 0x0b, 0x10, 0x49, 0x6f, 0x4e, 0x80, 0x41, 0x73, 0xdb, 0xfa, 0x33, 0xcf, 0x80, 0x51, 0xd2, 0xb7, 0xcb, 0xca,
-  0xba, 0x96, 0xc6, 0x23, 0xa0, 0xf0, 0x66, 0xeb, 0x20, 0xe5, 0xed, 0x09, 0x78, 0x4b, 0xf3, 0x5f, 0x3b, 0x8e, 0x8f,
-  0x1b, 0x9e, 0x79, 0xd6, 0xe5, 0x4a, 0x5d, 0x37, 0xab, 0x66, 0xc9, 0x06, 0x4b, 0x03, 0x04, 0x34, 0x1e, 0x37, 0x40,
-  0xc0, 0xa9, 0x30, 0xdb, 0x04, 0x18, 0xb5, 0xfb, 0x56, 0xeb, 0x43, 0xd7, 0x6e, 0x01, 0x08, 0xb0, 0x2c, 0x66, 0x7b,
-  0x04, 0xd2, 0x02, 0x7e, 0xf7, 0x00, 0xc0, 0xc8, 0xcc, 0xd6, 0x7f, 0x4b, 0x30, 0xea, 0x77, 0x60, 0x93, 0xa4, 0xd7,
-  0x01, 0xef, 0x97, 0xcd, 0xb2, 0x34, 0x9e, 0x80, 0x90, 0xe8, 0xbd, 0xbd, 0x48, 0x36, 0x6e, 0x7e, 0x56, 0x3b, 0xa0,
-  0x23, 0x69, 0x37, 0x1d, 0xf2, 0xdf, 0x1a, 0x9e, 0xa0, 0xdc, 0x96, 0xec, 0x54, 0x83, 0x41, 0xd8, 0x1d, 0x10, 0x08,
-  0x82, 0xe8, 0x8b, 0x87, 0x5d, 0xc8, 0x1e, 0x80, 0x71, 0xd6, 0xcb, 0xd7, 0xd6, 0xeb, 0x26, 0xab, 0x46, 0xcd, 0x06,
-  0xcc, 0xea, 0x02, 0xf6, 0xbd, 0xbf, 0x18, 0x07, 0xe1, 0xc7, 0x38, 0x02, 0x7b, 0x84, 0x64, 0x4e, 0x90, 0xb2, 0x52,
-  0x91, 0x50, 0xa5, 0x30, 0xe9, 0x1b, 0x08, 0x00, 0x29, 0xb3, 0x76, 0x3f, 0x0d, 0xd9, 0xe6, 0x47, 0x4c, 0x6c, 0x5c,
-  0xfe, 0xe6, 0x96, 0x01, 0x81, 0x1a, 0x71, 0xe5, 0xdf, 0x41, 0x64, 0x27, 0xa0, 0x55, 0xef, 0x0b, 0x80, 0x4f, 0xca,
-  0xff, 0xf7, 0x09, 0x98, 0xb2, 0x19, 0x80, 0x6e, 0x4f, 0xfc, 0x0e, 0x02, 0x20, 0x6f, 0x75, 0x1c, 0xc1, 0xbe, 0xf9,
-  0x80, 0x92, 0x71, 0x02, 0x8c, 0x23, 0xe0, 0x43, 0x90, 0xf4, 0x08, 0xfc, 0xb8, 0x83, 0x00, 0x98, 0xb1, 0x6b, 0x3d,
-  0xd7, 0xf5, 0x07, 0xb6, 0x4a, 0x40, 0xb8, 0x12, 0x14, 0x10, 0x09, 0xf7, 0xa0, 0xcd, 0x6b, 0xf6, 0x2f, 0x9b, 0x1f,
-  0x1f, 0x01, 0x5b, 0xf3, 0x57, 0x09, 0x00, 0x13, 0x84, 0x5b, 0x08, 0x80, 0x7d, 0xf0, 0x4e, 0x64, 0x08, 0xc1, 0x77,
-  0x09, 0x80, 0xc6, 0x9a, 0x4b, 0x31, 0xfe, 0x15, 0xfb, 0xc5, 0x22, 0x4e, 0x81, 0xed, 0x13, 0x10, 0x08, 0xfc, 0xee,
-  0xfd, 0xe3, 0x4f, 0x3a, 0x4b, 0x30, 0xea, 0x3d, 0xed, 0xb3, 0xed, 0xac, 0xfe, 0xd5, 0x32, 0xae, 0x04, 0xb0, 0x17,
-  0x17, 0x05, 0x24, 0x08, 0x7d, 0xfe, 0x27, 0x37, 0x40, 0x60, 0xff, 0xc8, 0x94, 0xf2, 0x96, 0x7c, 0xd3, 0xfb, 0x51,
-  0x11, 0x2e, 0x7f, 0xae, 0x37, 0x27, 0x9e, 0x8f, 0x00, 0x7f, 0xbd, 0x7f, 0x00, 0x78, 0xcf, 0xbf, 0x6a, 0xa1, 0x57,
-  0xa0, 0xe2, 0x1b, 0x68, 0x7b, 0xff, 0xec, 0x5e, 0x75, 0x50, 0x59, 0x98, 0xfd, 0x33, 0x9e, 0x0e, 0x88, 0x14, 0xd4,
-  0x1d, 0x10, 0x8c, 0x9e, 0xfb, 0x19, 0x2d, 0x9c, 0x62, 0xf1, 0xeb, 0xdc, 0x15, 0xc6, 0xfe, 0xfc, 0x53, 0x4c, 0xb6,
-  0xfe, 0xcf, 0x3b, 0x87, 0x8b, 0x53, 0xfc, 0x9f, 0x3f, 0x00, 0xfa, 0xd8, 0x0f, 0x84, 0xa2, 0x20, 0x0b, 0x00, 0xea,
-  0x7c, 0x6c, 0xd3, 0xfa, 0x2a, 0xc1, 0x6d, 0x0d, 0x7e, 0xee, 0x13, 0x80, 0xdf, 0x3c, 0x02, 0xf7, 0xb5, 0x07, 0xe0,
-  0xe6, 0x08, 0xe4, 0xb5, 0x57, 0xa2, 0x08, 0xc4, 0x78, 0xf1, 0xda, 0x4c, 0x94, 0xba, 0xb1, 0x00, 0xac, 0xfe, 0xc2,
-  0x4b, 0x6f, 0x61, 0xdf, 0x23, 0x90, 0xcb, 0xf7, 0x7e, 0x94, 0xbb, 0x35, 0x02, 0x39, 0x01, 0xf6, 0xfc, 0xd1, 0x7a,
-  0xf8, 0xc4, 0x3e, 0xae, 0x21, 0xd9, 0xf2, 0x77, 0x6f, 0x01, 0x90, 0xbc, 0x9e, 0xbe, 0xe6, 0x86, 0x5b, 0xdd, 0x5d,
-  0x00, 0x26, 0xb7, 0x8f, 0xdc, 0x7e, 0xab, 0xb7, 0x3e, 0x37, 0x17, 0x7f, 0x1b, 0x03, 0xda, 0xca, 0x93, 0xdb, 0x57,
-  0x75, 0x87, 0x04, 0xf2, 0xd4, 0x45, 0x8b, 0x8c, 0xd9, 0x5f, 0x79, 0xa8, 0xec, 0xde, 0xb2, 0x6f, 0xfd, 0xde, 0x89,
-  0xcc, 0xe6, 0xef, 0x3c, 0xc9, 0x76, 0x8f, 0x04, 0x6d, 0x75, 0x27, 0x3c, 0x5c, 0xf2, 0xbf, 0x2d, 0x3d, 0x37, 0xbb,
-  0xad, 0xb2, 0xf7, 0xaf, 0x5c, 0x09, 0x80, 0xff, 0x77, 0xfb, 0x51, 0x07};
-
-static constexpr size_t MATERIALICON_ORIGINAL_SIZE = 65536;
-
-static constexpr size_t MATERIALICON_COMPRESSED_SIZE = 1741;
-
-static constexpr int MATERIALICON_WIDTH = 128;
-
-static constexpr int MATERIALICON_HEIGHT = 128;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// MESHICON
-// Width: 128, Height: 128
-//=========================================================================================//
-static const unsigned char MESHICON_BYTES[] = {
-  0x1b, 0xff, 0xff, 0xa2, 0x28, 0x59, 0x9c, 0x01, 0xa4, 0xc7, 0x81, 0x1b, 0x6b, 0xb1, 0x12, 0xb4, 0x61, 0xda, 0xf1,
-  0x90, 0xa4, 0xbc, 0x1f, 0x6e, 0xbd, 0xff, 0xc7, 0xff, 0xc0, 0x3c, 0x43, 0x9c, 0xc4, 0xc3, 0x80, 0x52, 0x17, 0x15,
-  0xa0, 0x05, 0x20, 0x1d, 0x47, 0xce, 0x36, 0xa5, 0x1d, 0x3b, 0x7b, 0x84, 0xd2, 0x93, 0xc6, 0xd2, 0x11, 0xf6, 0xf4,
-  0x75, 0xb6, 0x28, 0x61, 0x57, 0x48, 0x0b, 0x49, 0xf9, 0x5a, 0x5b, 0x0a, 0x73, 0xc6, 0xda, 0x4f, 0x68, 0x88, 0x80,
-  0x01, 0x81, 0x50, 0xe5, 0x45, 0xd5, 0xb3, 0xb4, 0xdc, 0xb0, 0xe5, 0x07, 0x07, 0x81, 0x87, 0x40, 0xca, 0x1f, 0x02,
-  0x67, 0xd6, 0x45, 0xff, 0xd5, 0x1d, 0x5a, 0x1e, 0x78, 0x80, 0x1f, 0x3e, 0x1c, 0x2c, 0x6c, 0xf9, 0x41, 0xc3, 0x40,
-  0x20, 0x30, 0x10, 0x08, 0x04, 0x06, 0x06, 0x0e, 0x0e, 0xee, 0xbf, 0x2b, 0x0d, 0x00, 0x3e, 0x24, 0x62, 0xbe, 0x20,
-  0xa3, 0x19, 0xfd, 0x00, 0x2d, 0x31, 0x06, 0xec, 0x97, 0x69, 0x17, 0x5b, 0xa6, 0xe8, 0x33, 0x69, 0x5b, 0x5d, 0x87,
-  0x45, 0x6f, 0xf9, 0x8f, 0x7e, 0x44, 0x1b, 0x74, 0xe1, 0x67, 0x90, 0x12, 0x63, 0xc8, 0xd1, 0xe5, 0x9d, 0x89, 0x40,
-  0x6b, 0xeb, 0x52, 0x1a, 0xf8, 0xcc, 0x99, 0xc8, 0xa8, 0x39, 0xd5, 0xf2, 0xe9, 0xfc, 0xd9, 0xb4, 0xfa, 0xe7, 0xd2,
-  0x32, 0x92, 0x39, 0x9b, 0x81, 0x90, 0xc8, 0xb7, 0x7a, 0x68, 0x30, 0x7d, 0x47, 0xba, 0xef, 0xf2, 0x5a, 0x58, 0x97,
-  0xe6, 0x11, 0xcf, 0xd5, 0x0c, 0x84, 0x44, 0xcc, 0x9e, 0x33, 0xa7, 0xa8, 0x56, 0xf4, 0xcf, 0xfa, 0x09, 0x47, 0xb8,
-  0x0b, 0x41, 0x33, 0x91, 0x59, 0x9a, 0x81, 0xa9, 0xeb, 0xf2, 0xc0, 0x47, 0xa0, 0xe3, 0xfb, 0xf2, 0x5a, 0x65, 0x30,
-  0xef, 0xcf, 0xfa, 0x9a, 0x9e, 0x1e, 0xd6, 0xdc, 0xc4, 0x40, 0x48, 0x24, 0x1c, 0xb9, 0x98, 0xf3, 0xb5, 0xf7, 0x39,
-  0x9a, 0x48, 0x4b, 0x9c, 0x27, 0x10, 0xb7, 0x87, 0x9a, 0x58, 0xd0, 0x38, 0x3a, 0x28, 0xb3, 0x92, 0x88, 0xb2, 0x63,
-  0xcb, 0x85, 0x2b, 0x97, 0xab, 0xe0, 0xd7, 0xee, 0x27, 0xfa, 0x78, 0x08, 0x6a, 0x7d, 0x8d, 0xac, 0x4b, 0x6d, 0xc8,
-  0xb3, 0x61, 0x92, 0x62, 0xcb, 0x75, 0xab, 0xf7, 0xdd, 0x4f, 0xf4, 0x4b, 0x6f, 0x23, 0xad, 0xd4, 0x77, 0x26, 0x9d,
-  0x1a, 0x62, 0x40, 0x83, 0x34, 0x0b, 0x90, 0x1c, 0x53, 0x6e, 0xd1, 0x67, 0xf9, 0x60, 0xab, 0x27, 0xea, 0xdc, 0x4b,
-  0x98, 0xbc, 0x23, 0xd0, 0x52, 0xcb, 0xfd, 0x3e, 0x43, 0xf5, 0xbf, 0xa0, 0xba, 0xf7, 0x3f, 0x03, 0xc9, 0x31, 0xe3,
-  0x7e, 0x25, 0x6f, 0xfa, 0x65, 0xf8, 0xcb, 0xd2, 0xab, 0xbd, 0x4f, 0xde, 0x47, 0x3f, 0x79, 0xd6, 0x57, 0x0f, 0x5d,
-  0x62, 0xe8, 0x77, 0x8d, 0xad, 0xae, 0xc7, 0xa2, 0x23, 0x67, 0xfd, 0x87, 0xdb, 0xe8, 0xbb, 0x7c, 0xe9, 0xbe, 0xa1,
-  0xd4, 0x6f, 0x23, 0x51, 0x60, 0x43, 0x1d, 0xeb, 0x92, 0x1b, 0xd8, 0xbb, 0x35, 0x51, 0xd1, 0xe5, 0xf1, 0x31, 0xdd,
-  0xdb, 0xea, 0xfb, 0x6f, 0x4f, 0x20, 0xf9, 0xdd, 0xe4, 0x3b, 0x37, 0xbe, 0x14, 0x8f, 0x09, 0x2a, 0xf7, 0x5d, 0xde,
-  0xf1, 0x94, 0x8d, 0xb3, 0xa9, 0xb5, 0xa8, 0x26, 0x9c, 0xf7, 0x39, 0x03, 0xa1, 0x51, 0xf3, 0x8c, 0x3a, 0xcb, 0x27,
-  0xae, 0xa3, 0xef, 0xcc, 0xbe, 0x5b, 0x96, 0x5e, 0x3f, 0xfc, 0x89, 0x3a, 0xfb, 0x34, 0x64, 0x56, 0xcb, 0xbb, 0x7e,
-  0x22, 0x50, 0x8d, 0x0a, 0x1b, 0xf4, 0x1d, 0x42, 0x87, 0x78, 0x9f, 0xe5, 0x93, 0xee, 0x7c, 0x32, 0xe9, 0x30, 0x58,
-  0xea, 0x77, 0xe1, 0xd6, 0x5f, 0xfc, 0x87, 0x3a, 0xfa, 0x35, 0x52, 0x7d, 0x8f, 0xcd, 0xad, 0x1f, 0xa3, 0xd2, 0x3b,
-  0xa4, 0x6e, 0xf1, 0xe7, 0xc3, 0xd3, 0xdd, 0x7f, 0x26, 0xaa, 0xcd, 0x5a, 0xde, 0xa3, 0x7f, 0x09, 0x2f, 0xbd, 0x67,
-  0x6e, 0x59, 0xbb, 0x5f, 0x7b, 0xbf, 0x11, 0x13, 0x0b, 0xf5, 0x51, 0xbd, 0x3c, 0x4b, 0xea, 0x3a, 0xfe, 0xfc, 0xf8,
-  0xf0, 0xe2, 0xf1, 0xb7, 0x57, 0xb9, 0x3f, 0x5f, 0x7c, 0x0f, 0xe8, 0xef, 0x4b, 0x0f, 0xc8, 0xcb, 0xdf, 0x47, 0xbf,
-  0xd4, 0xeb, 0x15, 0x7b, 0xee, 0xe8, 0x7f, 0xe9, 0xf3, 0xbb, 0x44, 0x96, 0xc0, 0x26, 0x7f, 0xeb, 0x7d, 0x0b, 0x0b,
-  0xc1, 0x08, 0x32, 0x80, 0xb1, 0xfb, 0x9a, 0xfa, 0xb3, 0xf0, 0xe7, 0xaa, 0x92, 0x01, 0xaf, 0x32, 0xb7, 0xd4, 0xe7,
-  0xcf, 0x1f, 0xf8, 0xaa, 0x5d, 0x01, 0xeb, 0xbf, 0xa8, 0xfb, 0xe4, 0x0b, 0xb2, 0xf6, 0xbb, 0x1e, 0x82, 0x6f, 0x3b,
-  0x8f, 0x60, 0x1f, 0xfd, 0x9c, 0x5c, 0xe1, 0x4e, 0xdd, 0xb8, 0xad, 0x7e, 0xb9, 0x9f, 0x60, 0x02, 0x92, 0x80, 0xce,
-  0x7c, 0xf4, 0xb5, 0xf4, 0xb1, 0xed, 0x79, 0xc0, 0x14, 0xa1, 0x07, 0x30, 0x94, 0x07, 0x62, 0xa1, 0x73, 0xca, 0xe0,
-  0xc6, 0x59, 0xe3, 0x2f, 0xe1, 0x17, 0xff, 0xdb, 0xf2, 0x6b, 0xf9, 0xb2, 0xef, 0xfb, 0xd2, 0x57, 0x8a, 0xd8, 0xb3,
-  0xe4, 0x8b, 0xa5, 0xee, 0xc5, 0xb8, 0x55, 0x77, 0xf4, 0x75, 0xfe, 0x60, 0xe1, 0x03, 0xce, 0x77, 0xa9, 0xff, 0x81,
-  0xb8, 0xaf, 0xfa, 0xb0, 0x96, 0x56, 0xdd, 0xee, 0xba, 0x53, 0xef, 0x15, 0xef, 0xe4, 0xe3, 0x9d, 0x7b, 0x79, 0xd2,
-  0xde, 0x56, 0xe2, 0x75, 0xe9, 0x9f, 0xd7, 0x7f, 0x1f, 0x7e, 0xb0, 0x4f, 0xbd, 0x60, 0xed, 0xfe, 0xaa, 0xf1, 0x81,
-  0x06, 0x80, 0xaa, 0xc7, 0xa6, 0x3c, 0x52, 0x03, 0x75, 0x46, 0x78, 0x7d, 0x4b, 0xff, 0x79, 0x31, 0x4e, 0x3f, 0xcd,
-  0x7f, 0x84, 0x5f, 0xbc, 0x97, 0xd4, 0x9b, 0x6f, 0x7b, 0xb0, 0x91, 0xfc, 0x5e, 0x3f, 0xdf, 0xb9, 0x8f, 0xc7, 0x12,
-  0x98, 0x56, 0x7f, 0x96, 0x7e, 0x09, 0x73, 0xf7, 0x04, 0x9f, 0xc9, 0xf2, 0x2b, 0x05, 0x40, 0x5b, 0xf6, 0x7d, 0xdb,
-  0xc7, 0xf8, 0x6d, 0xf4, 0x39, 0xf4, 0x6d, 0xea, 0x71, 0x5f, 0x97, 0x81, 0xf4, 0xe3, 0xb9, 0x3e, 0x3b, 0xbe, 0xec,
-  0x9e, 0xe0, 0x2b, 0x05, 0xaf, 0x99, 0xf4, 0x77, 0x02, 0x30, 0x8d, 0x3b, 0x9c, 0x97, 0xe8, 0xfb, 0x23, 0x17, 0xe8,
-  0xfb, 0x3e, 0x47, 0xbe, 0x4d, 0x3d, 0xb6, 0x7b, 0x72, 0x5b, 0x94, 0x12, 0x14, 0x09, 0xbf, 0xe8, 0x9f, 0xd2, 0x7f,
-  0x5d, 0x7e, 0x58, 0xaa, 0x80, 0x80, 0x85, 0x40, 0xdd, 0x8e, 0xc9, 0xc7, 0xdb, 0xbe, 0x9f, 0xc9, 0x5d, 0x34, 0x07,
-  0x9b, 0x1d, 0x7e, 0xf9, 0xc3, 0xb6, 0x20, 0x85, 0xf7, 0xf4, 0x9f, 0x67, 0x26, 0xfd, 0x9c, 0x3e, 0x8f, 0x03, 0x60,
-  0x0a, 0x0d, 0x7c, 0xef, 0x60, 0x4d, 0x01, 0xe6, 0xe5, 0x13, 0xf8, 0xde, 0x47, 0x07, 0x74, 0xd3, 0x53, 0xf4, 0xb7,
-  0x11, 0x91, 0xf3, 0x52, 0xc3, 0x0f, 0x79, 0xe1, 0x4c, 0x20, 0x4a, 0x20, 0xe5, 0xa5, 0x40, 0xcc, 0xfb, 0xca, 0xc7,
-  0xff, 0x72, 0xb3, 0xdd, 0x1d, 0x6d, 0x71, 0x4a, 0xfa, 0xb9, 0xe9, 0x29, 0x6e, 0xad, 0x1f, 0x5a, 0x81, 0x99, 0x45,
-  0xde, 0xe6, 0x37, 0x7b, 0xbe, 0xc1, 0xdf, 0xbf, 0xdc, 0x25, 0xd9, 0xb9, 0x7b, 0xcc, 0xed, 0x2c, 0xda, 0xe8, 0x78,
-  0x7d, 0x34, 0xe2, 0x3b, 0x82, 0x27, 0xa3, 0xf0, 0xf7, 0xf1, 0x87, 0xbc, 0x4d, 0x7f, 0x81, 0xd7, 0x67, 0x4f, 0xbf,
-  0xd1, 0xf0, 0xd5, 0xa8, 0x39, 0xd8, 0xe6, 0x38, 0x7a, 0xbc, 0xd7, 0x2f, 0xb0, 0x71, 0x62, 0x8e, 0xba, 0x5f, 0x0f,
-  0xbc, 0x7f, 0x2f, 0x00, 0x78, 0x8b, 0x1b, 0xda, 0xec, 0x94, 0xea, 0x7c, 0xbe, 0x3a, 0xa3, 0xf4, 0xbb, 0xb5, 0x3e,
-  0x6f, 0x7a, 0xc0, 0x9e, 0xb7, 0x17, 0x11, 0x90, 0x43, 0x8e, 0xe8, 0xef, 0x9b, 0x53, 0x68, 0x68, 0xd2, 0x6f, 0x14,
-  0xfe, 0x93, 0x12, 0xf0, 0xeb, 0x6b, 0x05, 0x66, 0x08, 0x95, 0x01, 0xe4, 0x95, 0xaa, 0x1f, 0x59, 0x2f, 0xff, 0x6a,
-  0x7a, 0x2b, 0x28, 0x98, 0x3a, 0x1f, 0xd5, 0x7f, 0xbf, 0xf9, 0x6b, 0x7d, 0x79, 0x07, 0xdb, 0x3d, 0x5f, 0xc2, 0xaf,
-  0x0c, 0x5a, 0xff, 0x01, 0x53, 0x1d, 0xc0, 0xba, 0xfa, 0x41, 0x83, 0xee, 0xf0, 0x71, 0x53, 0x7d, 0x1e, 0x89, 0xcd,
-  0xbb, 0x1f, 0x77, 0xb3, 0xf0, 0x86, 0xf7, 0x6f, 0xf3, 0x4b, 0xf5, 0xe3, 0x74, 0x8d, 0x3e, 0x3b, 0x8b, 0x40, 0xd9,
-  0xae, 0xfa, 0xc3, 0xbb, 0xb2, 0x04, 0x90, 0xde, 0x2b, 0x2a, 0xf7, 0xed, 0x0d, 0xef, 0x0f, 0x33, 0xe9, 0xb7, 0xcc,
-  0x0e, 0xe1, 0x7a, 0x7a, 0x0a, 0xd8, 0x8d, 0x81, 0xf7, 0x4f, 0xda, 0xea, 0x9f, 0xb7, 0x97, 0xc8, 0x2c, 0xfd, 0x52,
-  0x1c, 0xb1, 0x33, 0x76, 0xf9, 0xdd, 0x63, 0x85, 0xb7, 0x22, 0x90, 0x2a, 0xf0, 0xf4, 0x96, 0xfa, 0x3c, 0x18, 0xa5,
-  0xff, 0xb3, 0xfc, 0xb2, 0x87, 0x2b, 0x91, 0x57, 0x42, 0xdf, 0x86, 0x7f, 0xd5, 0x9c, 0x40, 0xc5, 0xb3, 0xd5, 0x39,
-  0x27, 0xc7, 0xe9, 0xd7, 0x36, 0x7f, 0x70, 0x2f, 0xe0, 0x8f, 0x5a, 0x1b, 0x76, 0x8f, 0xf7, 0x7b, 0xe3, 0x7a, 0xf3,
-  0xd5, 0xe8, 0x30, 0x71, 0x35, 0xce, 0xf5, 0xf7, 0x02, 0xe1, 0x6f, 0xd3, 0x8f, 0xa5, 0x37, 0xcd, 0x29, 0x83, 0xe9,
-  0xad, 0xce, 0x3e, 0x2d, 0xfa, 0xec, 0x60, 0xe5, 0x9e, 0xfe, 0xc3, 0xfd, 0x75, 0x7d, 0x3d, 0x67, 0xef, 0x60, 0xf0,
-  0xf2, 0x68, 0x34, 0xdf, 0x7c, 0x64, 0x75, 0x76, 0xfa, 0x8c, 0xdd, 0x10, 0xdc, 0x37, 0xca, 0x2f, 0x70, 0xbf, 0xfc,
-  0x1e, 0x30, 0x4f, 0x4f, 0xa0, 0x90, 0x7a, 0xec, 0xc3, 0xaf, 0xb3, 0xcb, 0xdc, 0x34, 0xfe, 0x28, 0xaf, 0xdf, 0x33,
-  0x50, 0x04, 0x1e, 0x2c, 0x8d, 0xf7, 0xe6, 0x79, 0x76, 0x72, 0xb1, 0x19, 0x38, 0x68, 0x3e, 0x3d, 0x96, 0x9d, 0x50,
-  0xdf, 0xfb, 0x5f, 0xe5, 0xc7, 0xe3, 0xd7, 0xf9, 0x35, 0x76, 0x7f, 0xbe, 0xfc, 0x2c, 0x9e, 0x49, 0x47, 0x36, 0x4f,
-  0xff, 0x40, 0x01, 0xf7, 0x67, 0x7b, 0x23, 0xec, 0x9c, 0xfa, 0xed, 0xe6, 0xab, 0xf4, 0xd8, 0x9b, 0xfa, 0x27, 0x02,
-  0x42, 0x9b, 0x7e, 0xeb, 0xb3, 0xcf, 0xfa, 0xb1, 0x2d, 0xff, 0x73, 0xea, 0x8f, 0xab, 0xff, 0xf9, 0xd9, 0xab, 0xa5,
-  0x0a, 0x00, 0x15, 0xff, 0x9f, 0x6e, 0x7e, 0xbb, 0xe6, 0x04, 0xe8, 0xf4, 0x18, 0xb9, 0x18, 0xf7, 0xfa, 0x8a, 0xd0,
-  0x77, 0xbf, 0x60, 0x9f, 0xdf, 0xe8, 0xee, 0x6a, 0x2c, 0x64, 0x3f, 0x3b, 0x99, 0xdb, 0xf4, 0x5b, 0x1d, 0x8d, 0x0c,
-  0xa0, 0xcf, 0xd8, 0x39, 0xf1, 0xbc, 0xbd, 0xcc, 0xc1, 0xde, 0x67, 0x02, 0xcc, 0x93, 0xe5, 0xff, 0x57, 0x9b, 0xef,
-  0x0c, 0x2c, 0x7e, 0x7b, 0x7d, 0x98, 0x31, 0xc3, 0x8e, 0xde, 0xff, 0x0e, 0xef, 0xcf, 0x5e, 0x6d, 0xf3, 0xf7, 0xfa,
-  0xf5, 0x98, 0x81, 0x1b, 0x92, 0x64, 0x5f, 0x3b, 0xda, 0xdd, 0x76, 0x0c, 0x6d, 0xf5, 0x59, 0x53, 0x01, 0xe6, 0x6c,
-  0x76, 0x6c, 0xa6, 0xb7, 0x4f, 0x3f, 0xbf, 0xf9, 0x96, 0x51, 0xf7, 0x41, 0x97, 0xb3, 0xfd, 0x8f, 0x0d, 0x76, 0x77,
-  0xf5, 0x0e, 0xc6, 0xff, 0xbf, 0x4b, 0xbf, 0x0c, 0x33, 0x23, 0x8e, 0xf7, 0xe6, 0x7d, 0x73, 0xd0, 0xd5, 0x01, 0x69,
-  0xf9, 0xd0, 0x0f, 0xb8, 0xeb, 0x45, 0xa2, 0xaf, 0x52, 0xff, 0x22, 0xc9, 0x38, 0xfe, 0xdb, 0xf0, 0xab, 0x3e, 0xfc,
-  0xf7, 0xcb, 0x6f, 0x3f, 0x96, 0xf7, 0x88, 0xda, 0xaf, 0x0e, 0x43, 0xf7, 0xfe, 0x06, 0x94, 0x62, 0x5f, 0xef, 0xdb,
-  0xae, 0xcf, 0x9e, 0xd3, 0xf6, 0xb2, 0xd7, 0x7f, 0xbf, 0xf9, 0x86, 0x96, 0x27, 0xff, 0xfe, 0xd5, 0x93, 0x26, 0x03,
-  0xd3, 0x1d, 0x5f, 0x17, 0xc8, 0xf7, 0xff, 0x5e, 0x7d, 0x6d, 0x79, 0x65, 0xfc, 0xe8, 0x9d, 0x0c, 0xbf, 0xdf, 0x7d,
-  0xb6, 0x29, 0xb1, 0xd5, 0xe7, 0x60, 0x48, 0x1f, 0x23, 0x96, 0xd7, 0x67, 0xfb, 0xfe, 0xf2, 0xa7, 0xfe, 0x75, 0xf7,
-  0xf1, 0xea, 0xaf, 0x1f, 0x27, 0xe3, 0xc3, 0xc4, 0x98, 0x03, 0xf1, 0x92, 0xd2, 0xc6, 0xe0, 0x6a, 0xf9, 0xfb, 0xf5,
-  0xad, 0x6c, 0xd1, 0x57, 0xdf, 0x8b, 0xdc, 0x7f, 0xf2, 0x7b, 0x0e, 0xe6, 0xe3, 0xf7, 0x87, 0x23, 0xa4, 0xa2, 0xd7,
-  0x0a, 0x7f, 0x9d, 0x7e, 0x89, 0x05, 0xa5, 0xca, 0xe2, 0xbc, 0xdf, 0xfc, 0x35, 0x1d, 0x43, 0x2c, 0xe0, 0xd9, 0x70,
-  0xbe, 0x65, 0xc2, 0x87, 0x4d, 0xdb, 0xf2, 0xbf, 0xb5, 0xfc, 0x7d, 0xfd, 0x44, 0x9d, 0x9d, 0xf1, 0x6d, 0x72, 0x80,
-  0xcc, 0x8c, 0xfa, 0x91, 0xc2, 0x86, 0x4f, 0xbf, 0xd7, 0x5e, 0x33, 0xfe, 0x47, 0xfd, 0xc4, 0x65, 0x73, 0xd2, 0xd4,
-  0x2c, 0xa9, 0x97, 0x33, 0x90, 0xb7, 0xfb, 0xf4, 0x53, 0xda, 0x77, 0x9a, 0xbf, 0xc2, 0xe6, 0xc8, 0xf7, 0xeb, 0x19,
-  0xc8, 0x59, 0x4f, 0x5f, 0x69, 0x86, 0xde, 0xe6, 0xaf, 0x7c, 0x73, 0xf3, 0xcb, 0xdf, 0x8f, 0x0e, 0xa1, 0xc3, 0x6e,
-  0xe9, 0x17, 0x1f, 0xfc, 0x13, 0xea, 0x7d, 0x0e, 0x7f, 0x01, 0x17, 0x1d, 0x9e, 0x87, 0x5f, 0x49, 0xe7, 0xb3, 0x8f,
-  0xfa, 0x21, 0xcc, 0x50, 0xd6, 0xfd, 0xaa, 0x21, 0x7e, 0x84, 0x64, 0x24, 0x1f, 0xf7, 0x35, 0x6c, 0x2e, 0xd5, 0x8f,
-  0x43, 0xdc, 0xf0, 0x59, 0x23, 0x46, 0xfe, 0x5e, 0x59, 0x00, 0xf8, 0xef, 0x76, 0xb5, 0x0d};
-
-static constexpr size_t MESHICON_ORIGINAL_SIZE = 65536;
-
-static constexpr size_t MESHICON_COMPRESSED_SIZE = 1782;
-
-static constexpr int MESHICON_WIDTH = 128;
-
-static constexpr int MESHICON_HEIGHT = 128;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// SCENEICON
-// Width: 128, Height: 128
-//=========================================================================================//
-static const unsigned char SCENEICON_BYTES[] = {
-  0x1b, 0xff, 0xff, 0x22, 0x2a, 0x38, 0xc1, 0x8c, 0xc7, 0x81, 0x1b, 0x6b, 0xb1, 0x12, 0xb4, 0x61, 0xda, 0xf1, 0x90,
-  0xa4, 0xbc, 0x1f, 0x6e, 0xbd, 0xff, 0xc7, 0xff, 0xa0, 0x9e, 0xc7, 0xd9, 0xce, 0x19, 0xe4, 0x0a, 0x82, 0x30, 0x2f,
-  0x02, 0x5d, 0x40, 0x6d, 0x6e, 0xda, 0xae, 0x6a, 0x9a, 0xde, 0xbd, 0xb0, 0x84, 0xfc, 0xd5, 0xff, 0x7b, 0x9e, 0x02,
-  0x2d, 0xa0, 0xde, 0xfe, 0x93, 0x4e, 0x54, 0xd3, 0xb4, 0x6f, 0x44, 0x7d, 0x0a, 0x2b, 0xb6, 0x1d, 0x00, 0x31, 0x20,
-  0x10, 0x2a, 0xbd, 0x32, 0xbb, 0x80, 0x03, 0x87, 0xc5, 0x42, 0xe1, 0xe3, 0x0f, 0x67, 0x7e, 0x27, 0xff, 0x7f, 0x66,
-  0x02, 0x18, 0x81, 0x0f, 0x85, 0xc2, 0x83, 0x0f, 0x85, 0x81, 0xc2, 0x40, 0x20, 0x10, 0x58, 0x58, 0x58, 0x28, 0xdc,
-  0xbf, 0xa2, 0x0e, 0x00, 0x9e, 0x0e, 0x62, 0xdf, 0xb3, 0x3f, 0x5c, 0x88, 0xc0, 0x60, 0xd0, 0xab, 0x70, 0x00, 0x07,
-  0x1b, 0xba, 0x57, 0xa1, 0x02, 0x67, 0x6b, 0x70, 0xad, 0x47, 0xe1, 0xc5, 0x16, 0x10, 0x6a, 0x0d, 0x91, 0x4e, 0x6f,
-  0x6a, 0x10, 0xc0, 0xc0, 0xd9, 0x0a, 0x42, 0xcd, 0xf1, 0xec, 0x4d, 0x09, 0x22, 0xb2, 0x02, 0x4d, 0x0f, 0x34, 0x3c,
-  0xe9, 0x48, 0x4f, 0x86, 0x07, 0x41, 0xaa, 0xc0, 0x59, 0x82, 0xc4, 0x7b, 0x12, 0xaa, 0x16, 0x6a, 0x0b, 0xd4, 0x87,
-  0xc6, 0xe1, 0x77, 0xf0, 0xae, 0x97, 0xe0, 0x13, 0xce, 0x86, 0x96, 0x2b, 0x09, 0xbf, 0xeb, 0x42, 0x3f, 0x23, 0x61,
-  0xd9, 0x43, 0x10, 0x58, 0x02, 0xee, 0x3b, 0x40, 0x6d, 0x3b, 0x7d, 0xfb, 0xfe, 0xa2, 0x29, 0x12, 0xcc, 0x1e, 0x1a,
-  0x0b, 0x59, 0xb8, 0x75, 0xff, 0x2f, 0x05, 0xea, 0xdb, 0x16, 0xa8, 0x42, 0x61, 0xfa, 0x0d, 0xec, 0xc2, 0x21, 0x21,
-  0x26, 0xea, 0x9f, 0x85, 0xc9, 0x03, 0xdc, 0x6b, 0x07, 0x6a, 0x05, 0xa1, 0xcc, 0xbf, 0x09, 0x29, 0x64, 0xa4, 0xc4,
-  0x84, 0x4f, 0x78, 0xd5, 0x33, 0x21, 0x80, 0x5a, 0xa2, 0x2c, 0x40, 0x46, 0xa8, 0x1c, 0xe7, 0x77, 0xf4, 0x8c, 0x2c,
-  0xc3, 0x10, 0x01, 0x36, 0xa0, 0x5f, 0x20, 0xea, 0x8c, 0x61, 0x5d, 0x81, 0xc9, 0xb3, 0x04, 0xb9, 0xe8, 0xdf, 0xc1,
-  0x21, 0x5c, 0xd2, 0x1a, 0x7a, 0x10, 0x7b, 0x05, 0x02, 0xb8, 0x19, 0x5a, 0x56, 0x9e, 0x2b, 0xa0, 0xba, 0xc5, 0xad,
-  0x40, 0x69, 0x0f, 0xfd, 0x4b, 0x91, 0xa9, 0x39, 0xb2, 0x2c, 0x61, 0x34, 0x43, 0xf7, 0x7c, 0xfa, 0x04, 0x6a, 0x8e,
-  0x0e, 0x4c, 0xbe, 0x84, 0xf2, 0x37, 0x15, 0x3d, 0xe9, 0xc2, 0x39, 0xfc, 0x21, 0xdb, 0x15, 0x88, 0x04, 0x61, 0xa0,
-  0x1f, 0xde, 0xbe, 0xc9, 0xb9, 0xfe, 0x08, 0x2f, 0xd6, 0x03, 0xc2, 0x63, 0xff, 0xbd, 0xee, 0x80, 0x2c, 0x41, 0x21,
-  0x48, 0xda, 0xb9, 0x00, 0x16, 0xc8, 0xeb, 0x0a, 0xe8, 0x3b, 0x4b, 0x50, 0xd2, 0x1b, 0x73, 0x28, 0x80, 0x85, 0x7b,
-  0xac, 0xff, 0xfd, 0x00, 0x04, 0x4b, 0x42, 0x76, 0x60, 0x42, 0x3e, 0x2e, 0x7b, 0xfa, 0xf4, 0x91, 0x93, 0xdd, 0x85,
-  0x9e, 0x73, 0x87, 0x8a, 0xea, 0x8b, 0x10, 0x85, 0xf7, 0x6e, 0xfe, 0x26, 0x4b, 0x03, 0xee, 0x10, 0x46, 0x64, 0xca,
-  0x0e, 0x8c, 0x26, 0x94, 0x15, 0xc8, 0xf7, 0x78, 0xac, 0x1f, 0xe8, 0x11, 0xde, 0x44, 0xb6, 0xa0, 0x36, 0x60, 0xb2,
-  0x6e, 0x80, 0x60, 0x34, 0x2b, 0x90, 0x0b, 0x61, 0xe2, 0xde, 0x81, 0x5a, 0xc2, 0xba, 0x45, 0x39, 0xfa, 0xbd, 0xc0,
-  0xd9, 0x7f, 0xdf, 0xcf, 0xdf, 0x30, 0x47, 0x34, 0x58, 0xb1, 0x20, 0x1b, 0x4e, 0x86, 0xb1, 0x34, 0x00, 0xf7, 0x0e,
-  0xcc, 0x3b, 0x7a, 0x61, 0x25, 0xf4, 0x59, 0xf5, 0x80, 0xba, 0x01, 0x8e, 0x0e, 0x5c, 0x37, 0x60, 0x56, 0x10, 0xca,
-  0x04, 0x17, 0x49, 0x16, 0xbc, 0xaa, 0x40, 0x79, 0x47, 0x0f, 0x6c, 0x86, 0x82, 0xf0, 0x87, 0x8e, 0x1a, 0xa0, 0x7f,
-  0x43, 0xe4, 0xaa, 0xff, 0x67, 0x12, 0x32, 0x54, 0x9b, 0xaf, 0x3f, 0x2f, 0x76, 0x42, 0xf4, 0x06, 0xca, 0xd5, 0xde,
-  0x70, 0xf7, 0x24, 0x37, 0xfd, 0xff, 0x5f, 0xc6, 0x05, 0xf8, 0xa6, 0x01, 0xd1, 0x00, 0x5a, 0x81, 0x92, 0x40, 0xba,
-  0xf0, 0x15, 0x0c, 0x94, 0x05, 0xd6, 0xa3, 0xfe, 0x0e, 0xca, 0x0f, 0xfa, 0xee, 0x73, 0xc8, 0x23, 0xeb, 0x80, 0x18,
-  0x6c, 0xd1, 0x17, 0x00, 0xfd, 0x27, 0x16, 0xf4, 0x0a, 0x2a, 0x4b, 0x02, 0xb9, 0xc2, 0xb7, 0xeb, 0x8f, 0xd0, 0x3b,
-  0x00, 0xe4, 0xf3, 0xcd, 0x57, 0x42, 0x82, 0x42, 0xaf, 0xd7, 0x9b, 0xcd, 0x3f, 0x8d, 0x55, 0xce, 0x1b, 0x80, 0xe2,
-  0x46, 0xe8, 0x15, 0x90, 0xda, 0x2f, 0xa9, 0xd1, 0x06, 0x78, 0x01, 0x54, 0xa3, 0xdc, 0xe2, 0xbb, 0x93, 0xbb, 0x02,
-  0xba, 0x73, 0x12, 0xa3, 0x05, 0x00, 0x67, 0x0d, 0x48, 0xed, 0xd2, 0x62, 0x6d, 0x01, 0x24, 0x00, 0x45, 0x5f, 0x02,
-  0x92, 0x05, 0x1d, 0x9e, 0xa5, 0x1f, 0x80, 0x87, 0xea, 0xc3, 0xe5, 0xbc, 0xbf, 0xf3, 0x1c, 0x12, 0x14, 0xde, 0x27,
-  0x0d, 0xe8, 0x76, 0x1f, 0x8f, 0x5e, 0x02, 0xd9, 0x92, 0xde, 0x81, 0xdc, 0xa0, 0x92, 0x5c, 0x11, 0xb4, 0x26, 0xc9,
-  0x3d, 0x72, 0x87, 0x5c, 0xd7, 0xcb, 0x44, 0x0a, 0xe8, 0xbe, 0x49, 0x83, 0x75, 0xe0, 0xd3, 0xb3, 0x87, 0x9d, 0x7f,
-  0x35, 0x00, 0x10, 0x07, 0x54, 0x02, 0x89, 0x7e, 0x49, 0x93, 0x6d, 0x51, 0xb9, 0x45, 0xee, 0x90, 0xb5, 0x49, 0xaf,
-  0xe3, 0x78, 0x70, 0xd7, 0xe4, 0xb5, 0xf0, 0xff, 0x58, 0x40, 0xc7, 0xf8, 0xe4, 0xb9, 0x55, 0xe0, 0x1d, 0xb0, 0xd0,
-  0x0e, 0x48, 0x2a, 0x49, 0x05, 0xfa, 0x0a, 0xf8, 0xfa, 0x00, 0xa9, 0x7a, 0xc3, 0x71, 0x37, 0x0d, 0x9c, 0x3a, 0xc7,
-  0xfd, 0x6f, 0x0b, 0xec, 0x1b, 0x50, 0x15, 0x20, 0x13, 0x68, 0x50, 0x01, 0x60, 0xda, 0x3b, 0x40, 0xbc, 0xc0, 0x42,
-  0x68, 0x25, 0xb4, 0x0e, 0xd9, 0x0a, 0xf4, 0x2b, 0x03, 0xd1, 0xa2, 0x7d, 0x4f, 0x12, 0x13, 0x7e, 0x8b, 0xb5, 0x03,
-  0x06, 0x06, 0x76, 0xf9, 0x11, 0xf8, 0xc8, 0xef, 0xd2, 0xfc, 0x21, 0x95, 0xea, 0xa6, 0x4f, 0x2a, 0x60, 0x5b, 0xe3,
-  0x9e, 0x2b, 0x21, 0x8f, 0x69, 0x73, 0x3f, 0x5b, 0x05, 0xf3, 0x0f, 0x8f, 0x97, 0x96, 0xad, 0x84, 0xfd, 0xfc, 0x59,
-  0x07, 0xc0, 0x3c, 0x2a, 0x41, 0x11, 0x38, 0x1a, 0x0e, 0xe5, 0x7b, 0xb9, 0xe5, 0x77, 0x32, 0x8d, 0x64, 0xb6, 0x45,
-  0xc1, 0x77, 0xcb, 0xdf, 0x43, 0x60, 0x1d, 0xe8, 0x2b, 0x50, 0x51, 0x28, 0x24, 0x05, 0x22, 0xc5, 0x3f, 0x04, 0x61,
-  0x6b, 0x50, 0x0b, 0x3f, 0x98, 0x29, 0x91, 0xa2, 0x77, 0xbf, 0xe0, 0x4b, 0xbf, 0xb1, 0xd2, 0xf3, 0xfd, 0xd1, 0xeb,
-  0xb9, 0x6e, 0xc0, 0x79, 0x05, 0x72, 0x81, 0x8a, 0x22, 0x34, 0xe4, 0xb0, 0x14, 0x7d, 0x2a, 0x2f, 0x93, 0x00, 0x2a,
-  0x8d, 0xaf, 0x6e, 0x47, 0x02, 0x55, 0x80, 0x39, 0x91, 0x7f, 0xaf, 0x01, 0x12, 0xa0, 0x9e, 0x63, 0xfb, 0xdf, 0x28,
-  0x40, 0xf2, 0xdf, 0x0f, 0xa4, 0xb5, 0x05, 0x1a, 0x0f, 0xa7, 0x38, 0xd0, 0x5e, 0xba, 0xdd, 0x6f, 0x45, 0xe4, 0x13,
-  0x09, 0x76, 0x00, 0xa4, 0xfe, 0x23, 0x6c, 0x97, 0xbf, 0x79, 0x05, 0xf0, 0xa6, 0x0a, 0x35, 0xa0, 0x4a, 0xc0, 0x5f,
-  0xf1, 0x0d, 0x49, 0x43, 0x1d, 0x00, 0x0a, 0x89, 0xbf, 0x84, 0x2b, 0x1c, 0x76, 0xaf, 0xe0, 0x89, 0x55, 0xf0, 0xfd,
-  0x67, 0xd7, 0xab, 0x27, 0x04, 0x28, 0xe1, 0xc0, 0xba, 0x01, 0xbd, 0x84, 0x94, 0xff, 0x84, 0x72, 0x43, 0xeb, 0x4e,
-  0xcb, 0xbe, 0x2e, 0x7c, 0x15, 0xad, 0x3b, 0x91, 0x40, 0x18, 0xae, 0xff, 0x95, 0x1d, 0x7c, 0x05, 0xfe, 0xea, 0xf2,
-  0x63, 0xe7, 0xdf, 0x2a, 0x50, 0x09, 0xfc, 0x14, 0xb4, 0x0d, 0xb9, 0xdc, 0x36, 0xa0, 0xef, 0x8b, 0x77, 0x7d, 0xab,
-  0x03, 0x21, 0xf1, 0x22, 0x58, 0xcd, 0xdf, 0xb7, 0x0d, 0x48, 0x71, 0x33, 0xe2, 0x35, 0xd7, 0x98, 0x55, 0xa0, 0x4a,
-  0x90, 0x2b, 0xa4, 0xb9, 0x80, 0xa3, 0x2a, 0x00, 0xfa, 0x4b, 0xd0, 0x55, 0xff, 0x7e, 0xa3, 0x6f, 0x02, 0x82, 0x7a,
-  0x05, 0xa3, 0xf9, 0xf3, 0x0d, 0xe0, 0xe9, 0x2d, 0xb0, 0x0e, 0xd8, 0x06, 0xf4, 0xa8, 0x67, 0x11, 0xa9, 0x57, 0x90,
-  0x83, 0xef, 0x05, 0x22, 0xd7, 0x7b, 0x07, 0x6c, 0x07, 0x00, 0xaa, 0x20, 0xe5, 0xb3, 0xe8, 0x28, 0x09, 0xfb, 0x67,
-  0xc3, 0xff, 0x0d, 0xb5, 0xd5, 0xe1, 0xb6, 0x52, 0xcf, 0x77, 0x38, 0x61, 0x65, 0xf4, 0x88, 0x09, 0xb4, 0x7e, 0x7c,
-  0xee, 0xc8, 0x78, 0x20, 0xdb, 0x9e, 0x98, 0x17, 0xe5, 0x0d, 0xf5, 0xe0, 0x39, 0x5a, 0x9e, 0xf6, 0x8b, 0x33, 0x2f,
-  0x9d, 0x41, 0x82, 0x27, 0x8d, 0x45, 0xf3, 0x4b, 0xd6, 0xa2, 0xfa, 0x81, 0xa5, 0x3f, 0x60, 0x21, 0xb1, 0x4a, 0xbc,
-  0x94, 0x3a, 0xeb, 0x21, 0x66, 0x73, 0x09, 0x8c, 0xd5, 0xac, 0x8f, 0xe5, 0x2b, 0x83, 0x6c, 0x8b, 0xb4, 0x46, 0xd8,
-  0x2a, 0x9d, 0x62, 0x1d, 0xf0, 0x9a, 0x69, 0x24, 0x0a, 0xda, 0xe7, 0x0b, 0xda, 0x53, 0xbe, 0x02, 0x02, 0xe4, 0xa8,
-  0xd9, 0xf2, 0xab, 0xce, 0xf4, 0x31, 0x2e, 0xcf, 0x38, 0x94, 0x6f, 0xd8, 0x0e, 0xb5, 0x33, 0x72, 0x9f, 0x1f, 0xeb,
-  0xa8, 0x17, 0x55, 0xa5, 0x7b, 0xbe, 0x2f, 0xc3, 0xba, 0x0e, 0xe3, 0xb1, 0xe8, 0x3b, 0xc3, 0x97, 0xc2, 0x0b, 0x80,
-  0x82, 0x29, 0x80, 0xf5, 0xd9, 0x60, 0x3e, 0xa1, 0x7c, 0x74, 0x8a, 0xf0, 0x2d, 0x00, 0x03, 0x56, 0xf4, 0xaf, 0x0f,
-  0x0a, 0xed, 0xa2, 0xd0, 0x06, 0xa8, 0x27, 0xc2, 0xb1, 0xf9, 0xb3, 0x56, 0xd0, 0xe1, 0xd8, 0x4f, 0xa7, 0x17, 0x50,
-  0x0a, 0xce, 0x25, 0x41, 0xb0, 0x8e, 0xfe, 0xf9, 0xe0, 0xca, 0xfc, 0xf5, 0xc7, 0xe8, 0x8a, 0xc2, 0xdd, 0xbe, 0xfc,
-  0x68, 0x8b, 0x6f, 0xe1, 0x37, 0x67, 0xe2, 0x5d, 0x67, 0x27, 0xf6, 0x23, 0xb0, 0x13, 0x80, 0xec, 0x6a, 0xaf, 0xcf,
-  0xef, 0x81, 0xb0, 0x02, 0x80, 0x7d, 0xeb, 0xf9, 0xf7, 0x7f, 0x5d, 0xc3, 0xbe, 0xfe, 0x78, 0x75, 0xbc, 0x8f, 0x04,
-  0xaa, 0x49, 0xa8, 0x02, 0x40, 0xd3, 0x9b, 0x0f, 0xf8, 0x11, 0x54, 0xee, 0x6b, 0x9f, 0x19, 0xc1, 0x17, 0xff, 0x21,
-  0x58, 0x6d, 0x8c, 0x02, 0xdd, 0x82, 0x6a, 0x19, 0x28, 0x09, 0xbc, 0x76, 0x86, 0x11, 0xf4, 0x7f, 0x43, 0x65, 0x9f,
-  0x8f, 0xdd, 0xfe, 0xf9, 0x4f, 0xcb, 0xf1, 0xeb, 0xcf, 0xde, 0x1f, 0x91, 0x2d, 0x78, 0x00, 0xe3, 0x7d, 0xc9, 0x2a,
-  0xb0, 0x7b, 0x43, 0x2b, 0x01, 0x3c, 0x04, 0x28, 0xd7, 0x52, 0x1a, 0xcf, 0x76, 0x9e, 0x15, 0x20, 0x21, 0x5c, 0x53,
-  0x09, 0x2e, 0x97, 0x20, 0xef, 0xfe, 0x9e, 0xf3, 0x73, 0x81, 0xac, 0xcd, 0x3c, 0x95, 0xbd, 0x4b, 0x52, 0x5e, 0x4d,
-  0xbd, 0xc4, 0x48, 0x81, 0x7f, 0x7d, 0x60, 0x3e, 0xf5, 0xf5, 0xfc, 0x02, 0x60, 0x21, 0xd8, 0xed, 0x09, 0xe0, 0x7e,
-  0x53, 0x7e, 0x63, 0x2f, 0xa0, 0xf6, 0x45, 0xce, 0xba, 0x09, 0x8b, 0x94, 0x16, 0xc9, 0x8a, 0xf3, 0xc6, 0x47, 0x0a,
-  0x95, 0x2f, 0x73, 0x50, 0x2e, 0x94, 0x4f, 0x5f, 0xdf, 0xd2, 0xe3, 0x61, 0xcd, 0x9f, 0xef, 0x8b, 0x7c, 0x14, 0xdd,
-  0x7f, 0x26, 0xbf, 0x2f, 0x01, 0xc5, 0xcd, 0xdc, 0xf7, 0x63, 0xa7, 0xcf, 0x9f, 0xe3, 0xb3, 0xaf, 0x60, 0x8b, 0xf1,
-  0x7a, 0xeb, 0x14, 0x68, 0xeb, 0x19, 0xf3, 0xb7, 0x02, 0x72, 0xf0, 0xdb, 0x9d, 0xb6, 0x40, 0x8a, 0x64, 0xbd, 0x5d,
-  0x2d, 0x39, 0xfb, 0xc6, 0x47, 0xae, 0xd6, 0x1c, 0x13, 0x1f, 0xbf, 0xbf, 0x75, 0xdf, 0x42, 0x9e, 0x3f, 0xde, 0x94,
-  0x8f, 0xa4, 0x00, 0xa0, 0xd0, 0xa7, 0xeb, 0xad, 0x7d, 0xfd, 0xaf, 0x7e, 0x00, 0xd9, 0x4f, 0x9d, 0x52, 0xa1, 0xf0,
-  0x02, 0xe6, 0xef, 0x0f, 0xf6, 0x0a, 0xf8, 0x28, 0xd6, 0xd1, 0x49, 0xfe, 0x9b, 0xe1, 0x01, 0xc8, 0xff, 0x6f, 0xdf,
-  0xb4, 0x04};
-
-static constexpr size_t SCENEICON_ORIGINAL_SIZE = 65536;
-
-static constexpr size_t SCENEICON_COMPRESSED_SIZE = 1617;
-
-static constexpr int SCENEICON_WIDTH = 128;
-
-static constexpr int SCENEICON_HEIGHT = 128;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// SCRIPTICON
-// Width: 128, Height: 128
-//=========================================================================================//
-static const unsigned char SCRIPTICON_BYTES[] = {
-  0x1b, 0xff, 0xff, 0x30, 0x9e, 0x07, 0x76, 0x2c, 0x37, 0x94, 0xc2, 0x72, 0x58, 0xed, 0x38, 0x42, 0x92, 0xce, 0xfc,
-  0x4f, 0x7a, 0x88, 0xff, 0xba, 0xf5, 0x1e, 0x98, 0x67, 0x88, 0xf4, 0x64, 0x1f, 0x82, 0xcf, 0xba, 0x78, 0x02, 0x0d,
-  0xd8, 0x01, 0xf1, 0xcc, 0xaf, 0x64, 0x9f, 0x6a, 0xa7, 0x33, 0x2b, 0xca, 0x57, 0x35, 0x2b, 0x7c, 0x7a, 0x1d, 0x00,
-  0x31, 0x20, 0x10, 0xfe, 0xad, 0x8b, 0xef, 0xeb, 0xdc, 0x00, 0x06, 0x16, 0x3e, 0x2c, 0x2c, 0x3c, 0x58, 0xc0, 0x81,
-  0x8b, 0x81, 0x40, 0xa0, 0xa1, 0x61, 0xa0, 0x61, 0x60, 0x60, 0xe1, 0xff, 0x17, 0xb3, 0x01, 0xa8, 0x24, 0xcf, 0x05,
-  0x1d, 0xea, 0x0f, 0x14, 0x3f, 0x90, 0x3d, 0x20, 0xf9, 0x81, 0x48, 0x41, 0xa0, 0xc0, 0xfb, 0x01, 0xe7, 0x01, 0xd6,
-  0x03, 0xb8, 0x6f, 0xe8, 0x41, 0x9e, 0x0f, 0x11, 0x84, 0x4b, 0x38, 0xff, 0x82, 0x93, 0x70, 0x0c, 0x87, 0xb0, 0xff,
-  0xc1, 0xce, 0x0f, 0x56, 0x61, 0x0b, 0x6b, 0x58, 0xc2, 0x1c, 0xa6, 0x1f, 0x8c, 0x7e, 0xd0, 0x7b, 0xa0, 0x13, 0xda,
-  0xd0, 0xfc, 0xa0, 0x16, 0xd6, 0xa0, 0x7d, 0x3b, 0x1e, 0xf8, 0x15, 0xc7, 0x70, 0x51, 0x0b, 0x1c, 0xcd, 0x61, 0xa1,
-  0xac, 0x54, 0x18, 0xfe, 0x40, 0xab, 0x87, 0x45, 0xb8, 0x04, 0xf5, 0x9b, 0x81, 0x0f, 0x71, 0x0c, 0x57, 0x5f, 0x81,
-  0x94, 0x52, 0x05, 0x48, 0x32, 0x8c, 0x03, 0x5b, 0x82, 0x9d, 0x4b, 0x6a, 0x81, 0x53, 0x41, 0xf9, 0x5e, 0x60, 0x55,
-  0x0e, 0x4a, 0x1b, 0xdf, 0x81, 0xa4, 0x72, 0xce, 0xfa, 0xe2, 0xa9, 0x0a, 0x50, 0x15, 0x96, 0xa7, 0x38, 0xec, 0x05,
-  0xf9, 0x3b, 0x09, 0x58, 0x71, 0xdb, 0xd9, 0x96, 0xa0, 0x0f, 0x4f, 0x46, 0x69, 0x51, 0x9c, 0x75, 0x60, 0xa9, 0xb7,
-  0xc0, 0x56, 0x90, 0xbe, 0x11, 0xa8, 0xa9, 0x03, 0x55, 0x92, 0xd4, 0xa5, 0x5a, 0x74, 0x02, 0x18, 0x53, 0xaa, 0x02,
-  0x2b, 0xd5, 0x41, 0x95, 0x60, 0xff, 0xcc, 0xa9, 0x70, 0xd0, 0xb9, 0x40, 0xf0, 0x7d, 0x78, 0xe0, 0x28, 0xdc, 0xca,
-  0xc1, 0xd6, 0x6c, 0x02, 0x16, 0xf3, 0x48, 0x79, 0xb2, 0x04, 0x67, 0x16, 0xb6, 0xea, 0x43, 0xf8, 0xbe, 0x8d, 0x70,
-  0x0d, 0x68, 0x69, 0x1d, 0x24, 0x86, 0x45, 0xa1, 0x2d, 0x50, 0x25, 0x3b, 0x96, 0xf6, 0xcf, 0x5b, 0x55, 0x19, 0x8d,
-  0xfd, 0x09, 0x6c, 0xdf, 0x86, 0xd4, 0x83, 0x3a, 0x98, 0x6b, 0xcb, 0xa2, 0x25, 0x48, 0x7c, 0x05, 0x28, 0xdb, 0x2a,
-  0xe9, 0x50, 0x30, 0xfc, 0xe9, 0x07, 0x8c, 0x6f, 0xc2, 0x43, 0x5a, 0x38, 0x5e, 0x80, 0x9e, 0xc4, 0x57, 0x20, 0x91,
-  0x02, 0xa8, 0x07, 0xca, 0xc2, 0x18, 0xf6, 0x6a, 0x81, 0x51, 0x7d, 0x50, 0x6e, 0xbe, 0x09, 0x0f, 0xe9, 0xc0, 0x2d,
-  0x40, 0x3f, 0x81, 0xe3, 0x16, 0x8c, 0xd7, 0xbf, 0x57, 0x59, 0x60, 0x97, 0x76, 0x80, 0x81, 0x06, 0xa5, 0x90, 0x07,
-  0xea, 0x5b, 0x80, 0x2b, 0xbb, 0x01, 0x9d, 0x55, 0x80, 0x65, 0x4a, 0x86, 0x60, 0x3b, 0x60, 0x2d, 0xcc, 0xd9, 0x51,
-  0x22, 0x2d, 0x10, 0xdf, 0x05, 0x2b, 0xfa, 0x16, 0xa4, 0x12, 0x3f, 0x01, 0xf3, 0x05, 0x58, 0x94, 0x81, 0x62, 0x27,
-  0x43, 0xb3, 0x0e, 0xec, 0xd8, 0x50, 0x3c, 0x64, 0x21, 0x09, 0xd1, 0x77, 0xe0, 0x61, 0x5a, 0x81, 0xf7, 0xf6, 0xdf,
-  0xa5, 0x94, 0x71, 0x30, 0x2e, 0xc1, 0xfa, 0xc9, 0x2f, 0x80, 0xfc, 0x51, 0x2b, 0x50, 0x16, 0x08, 0x0a, 0xd8, 0x87,
-  0xc0, 0xf9, 0x04, 0xcc, 0xf7, 0x1f, 0x55, 0xca, 0x53, 0x15, 0xa0, 0x28, 0xd4, 0xc2, 0xbc, 0x03, 0xc4, 0x0b, 0x61,
-  0xf0, 0x83, 0x17, 0xe8, 0xbd, 0xc3, 0x9d, 0x7e, 0x03, 0xe2, 0xe8, 0xac, 0x04, 0x2c, 0x24, 0xc6, 0xb7, 0x9f, 0xd9,
-  0x02, 0xd8, 0x59, 0x57, 0x66, 0x2c, 0x4c, 0x7d, 0x07, 0x28, 0xf5, 0x10, 0x08, 0x7e, 0x70, 0xc3, 0x0e, 0xe4, 0xce,
-  0xe1, 0xce, 0x19, 0x2b, 0xdf, 0x21, 0x99, 0xdf, 0x7e, 0x16, 0x5a, 0x82, 0x65, 0xa1, 0x86, 0xf0, 0x9d, 0x0e, 0xe0,
-  0x15, 0xce, 0x2f, 0x30, 0x05, 0x74, 0xfb, 0xcc, 0x37, 0x00, 0xdf, 0x01, 0x87, 0x27, 0xe9, 0x1d, 0x94, 0x05, 0xb2,
-  0x42, 0x31, 0x1f, 0x40, 0xed, 0x40, 0x06, 0xd6, 0xc3, 0x08, 0xfd, 0xce, 0x3d, 0x94, 0x81, 0xc5, 0x7c, 0x02, 0x4a,
-  0x95, 0xa9, 0xf7, 0x4e, 0x3f, 0x55, 0x82, 0x3f, 0xc5, 0x97, 0x85, 0xca, 0xf5, 0x8f, 0x0c, 0xc0, 0xbc, 0x03, 0xdb,
-  0x02, 0x7a, 0xa1, 0x86, 0x1c, 0xc0, 0x35, 0x33, 0x6f, 0x81, 0xdf, 0x7e, 0x8b, 0xf9, 0x06, 0xa0, 0xd2, 0x0a, 0xb4,
-  0xb1, 0xa9, 0x6b, 0xef, 0xda, 0x57, 0xd6, 0xe5, 0x09, 0x2b, 0x95, 0x83, 0xa7, 0x04, 0xb8, 0x0f, 0xa7, 0x9a, 0x50,
-  0x36, 0xae, 0x3b, 0xce, 0x27, 0x60, 0xe5, 0x18, 0xa9, 0x80, 0x14, 0x5d, 0x4e, 0x3f, 0x12, 0x3a, 0x79, 0x3b, 0xcb,
-  0x40, 0x55, 0x7f, 0x8b, 0xa8, 0x4d, 0x6f, 0x01, 0x77, 0x25, 0x75, 0x80, 0xb9, 0x3b, 0x26, 0xc3, 0xee, 0x3f, 0xef,
-  0x2d, 0x80, 0xa4, 0x67, 0xa5, 0x5d, 0xff, 0xda, 0x80, 0xa5, 0xd6, 0x82, 0x18, 0x50, 0x07, 0xa5, 0xac, 0x80, 0x96,
-  0x20, 0xb9, 0x6f, 0x12, 0x41, 0x49, 0xa4, 0x01, 0xa3, 0x09, 0x1c, 0xaf, 0xff, 0x9e, 0x15, 0x95, 0x82, 0x78, 0xf0,
-  0x1d, 0x58, 0x08, 0x77, 0x5f, 0x82, 0x74, 0xd0, 0xb6, 0x40, 0x39, 0x9f, 0x80, 0xcc, 0xc5, 0x68, 0x02, 0x75, 0x01,
-  0xa4, 0x74, 0xf6, 0x32, 0xa5, 0x02, 0x47, 0x1d, 0xf8, 0x06, 0x2c, 0x1c, 0x9e, 0x7e, 0xd4, 0xc1, 0xe8, 0xfe, 0x37,
-  0xe2, 0xbc, 0x03, 0x59, 0x01, 0x83, 0x9f, 0x40, 0xd5, 0xbd, 0x97, 0xa0, 0x1c, 0x24, 0x4a, 0xf2, 0xea, 0xed, 0xb7,
-  0x1d, 0x40, 0x55, 0x22, 0x2b, 0xa0, 0x65, 0xb6, 0x00, 0x12, 0xdf, 0x01, 0x8c, 0xee, 0x99, 0x3f, 0x77, 0x25, 0x21,
-  0x25, 0x28, 0xa5, 0xc6, 0xfb, 0x7f, 0xaf, 0x94, 0x5f, 0x80, 0xa9, 0xe4, 0xd8, 0x82, 0x47, 0x59, 0x79, 0xed, 0xf8,
-  0x09, 0x58, 0x92, 0x0d, 0xc8, 0x1c, 0xbe, 0xde, 0xde, 0x7f, 0xf7, 0xe5, 0xf1, 0xab, 0x6b, 0x6e, 0xa9, 0x05, 0xc2,
-  0x9f, 0x4d, 0x20, 0xb6, 0x6f, 0xa0, 0x04, 0xe5, 0x20, 0x63, 0x3c, 0x01, 0xc2, 0x7c, 0xff, 0x4b, 0xfa, 0x40, 0x2b,
-  0xa0, 0x00, 0x9e, 0x24, 0x72, 0x1c, 0xa3, 0x05, 0x78, 0xf5, 0x2d, 0x78, 0xfd, 0xf6, 0x67, 0x75, 0x36, 0x81, 0xfb,
-  0xaa, 0x00, 0x69, 0x42, 0x99, 0xed, 0x3f, 0xf8, 0xa4, 0x03, 0xda, 0x82, 0x8a, 0xd4, 0x95, 0x5b, 0x78, 0xb7, 0x02,
-  0xc9, 0xfb, 0x1b, 0x00, 0x7c, 0xbd, 0x50, 0xf8, 0x20, 0x70, 0x3e, 0x81, 0x98, 0xee, 0xdd, 0xc2, 0x52, 0x19, 0x78,
-  0xe7, 0xf6, 0xbb, 0xd8, 0x17, 0x1f, 0xcb, 0xef, 0x7f, 0xa0, 0xf5, 0x16, 0xf0, 0xf4, 0x25, 0xc0, 0xb7, 0x63, 0x5e,
-  0x01, 0x8d, 0x04, 0xbd, 0x7b, 0x57, 0x29, 0x99, 0x3d, 0xf9, 0xef, 0x0b, 0x83, 0x15, 0x46, 0xdf, 0x01, 0x6a, 0xfe,
-  0xf6, 0x4b, 0xa8, 0x0f, 0x50, 0x7d, 0x05, 0x10, 0x04, 0xb2, 0x43, 0x6f, 0x7f, 0x63, 0x30, 0x7e, 0xe5, 0x16, 0xde,
-  0x7d, 0xf4, 0xdd, 0x17, 0x87, 0xfc, 0x73, 0x4d, 0x5c, 0x65, 0xa1, 0x1f, 0x80, 0xfd, 0xa5, 0x84, 0x59, 0x0f, 0x1c,
-  0xad, 0x00, 0xaa, 0xe7, 0x3b, 0x30, 0xe1, 0x1e, 0x75, 0xe0, 0x3b, 0xb0, 0xc0, 0x6e, 0xf5, 0x65, 0x26, 0xf8, 0xf5,
-  0xd7, 0xa4, 0x35, 0xdf, 0x00, 0x28, 0x04, 0xaa, 0xb7, 0x80, 0x4e, 0x2a, 0xd0, 0x7f, 0x0f, 0xb1, 0xd9, 0xfe, 0x5f,
-  0xb1, 0xb8, 0xf7, 0x16, 0x1c, 0x2f, 0x80, 0x02, 0xb9, 0xfe, 0x9a, 0x48, 0xec, 0x04, 0xf4, 0xeb, 0x1f, 0x68, 0xbd,
-  0x08, 0xe8, 0x00, 0xc0, 0xe8, 0xbf, 0x87, 0xe6, 0x17, 0xa0, 0xeb, 0xc0, 0x7d, 0xbf, 0x94, 0x61, 0xff, 0x36, 0xec,
-  0x06, 0x68, 0x4a, 0x9e, 0xb9, 0x2e, 0x3d, 0xbf, 0xfd, 0x6c, 0xe1, 0xd5, 0x7f, 0x00, 0xae, 0x9f, 0x00, 0x6c, 0xfe,
-  0x77, 0xf0, 0xea, 0xf6, 0x63, 0x4b, 0x70, 0xff, 0x16, 0xd8, 0x7d, 0x26, 0x2c, 0xfe, 0x42, 0xb8, 0xce, 0x4f, 0x5f,
-  0x88, 0xfa, 0x4f, 0x10, 0xe8, 0xed, 0xaf, 0x12, 0x65, 0xfe, 0xb7, 0x70, 0x66, 0xfb, 0x3f, 0xa6, 0x2b, 0xb7, 0x30,
-  0x7e, 0xf4, 0x9b, 0x3b, 0xc0, 0xfe, 0xb9, 0x76, 0x82, 0xcf, 0x7e, 0x24, 0x0e, 0x74, 0x03, 0x40, 0xfa, 0xc8, 0x83,
-  0x2e, 0x80, 0x34, 0x70, 0xed, 0x25, 0x18, 0xdf, 0xfe, 0xcc, 0x7a, 0x4b, 0x61, 0x64, 0x5f, 0xbc, 0xf8, 0x16, 0x10,
-  0xaf, 0xff, 0x08, 0xc8, 0xd9, 0xe1, 0x2b, 0x87, 0xd3, 0x16, 0x64, 0xd4, 0x81, 0xfb, 0xb6, 0xb0, 0x1c, 0x58, 0xfc,
-  0x05, 0x53, 0x6e, 0xff, 0xf1, 0x1d, 0x98, 0x2d, 0x40, 0xe8, 0xce, 0x4f, 0x3f, 0x70, 0x02, 0xb0, 0xf3, 0x29, 0x25,
-  0xc8, 0xbc, 0x6f, 0xfc, 0x02, 0xd8, 0x17, 0x05, 0x2e, 0x00, 0x0d, 0x34, 0xf6, 0xf6, 0x3f, 0xdf, 0xff, 0x60, 0xe7,
-  0x17, 0x20, 0xb1, 0x8a, 0xd9, 0xdd, 0x6f, 0x03, 0x7b, 0x5f, 0x12, 0x54, 0x15, 0x95, 0xd7, 0xfd, 0x4e, 0xd0, 0x5b,
-  0x00, 0x2b, 0x00, 0x05, 0x4c, 0x0c, 0xef, 0x9e, 0x7e, 0x40, 0xd9, 0x05, 0xd8, 0x57, 0x80, 0x68, 0xfd, 0xe1, 0x33,
-  0x37, 0x00, 0xef, 0x12, 0xf8, 0x6a, 0x01, 0xcd, 0x7d, 0xc3, 0x41, 0xbf, 0xfe, 0xa8, 0x05, 0x78, 0xdc, 0x81, 0xf9,
-  0x04, 0x96, 0x03, 0xbc, 0xfb, 0xfd, 0x97, 0xd8, 0x46, 0x1e, 0x7c, 0x46, 0x87, 0x5f, 0xdf, 0x03, 0xc0, 0x42, 0x09,
-  0xfd, 0xea, 0x2d, 0xcc, 0x16, 0x00, 0xc1, 0x3c, 0xe8, 0x0e, 0x2b, 0x90, 0x42, 0xdf, 0xd1, 0xfe, 0x9b, 0xf2, 0x16,
-  0xbc, 0x83, 0xdc, 0x06, 0xda, 0x0d, 0xe8, 0xde, 0x63, 0xa5, 0xbd, 0xfd, 0xbe, 0xe5, 0xc1, 0x3f, 0xf9, 0xfa, 0xfd,
-  0x17, 0xb3, 0xf3, 0xd3, 0x07, 0xbc, 0x91, 0x03, 0x99, 0xc0, 0xbb, 0xb7, 0x90, 0x58, 0xe6, 0x1b, 0x20, 0x4e, 0xf3,
-  0x12, 0x90, 0xf1, 0x1f, 0x10, 0x91, 0x09, 0xf4, 0x16, 0x10, 0x37, 0xdb, 0x02, 0xd2, 0x81, 0x9d, 0x80, 0x3b, 0xb7,
-  0x50, 0xaa, 0x2f, 0x0b, 0xb9, 0xff, 0x8c, 0x3d, 0x8c, 0x2c, 0xf8, 0x5d, 0x17, 0xb2, 0xd9, 0xe1, 0xaf, 0x0a, 0x80,
-  0xbc, 0x91, 0x03, 0x8d, 0x95, 0xad, 0xae, 0xfb, 0x95, 0xf4, 0x3b, 0x81, 0x9a, 0x9f, 0x71, 0x12, 0x3b, 0xde, 0x39,
-  0xfd, 0x10, 0x6f, 0x36, 0x01, 0xf9, 0xd4, 0x3f, 0x76, 0xe0, 0x2d, 0x24, 0xdf, 0x02, 0x8c, 0xe9, 0x9b, 0x07, 0x24,
-  0x23, 0x0f, 0xad, 0xfc, 0x02, 0xc4, 0xfd, 0x6c, 0x02, 0xb0, 0x79, 0x07, 0xd0, 0xfc, 0xe1, 0x2f, 0x75, 0xff, 0x16,
-  0x56, 0xbe, 0xf3, 0xe8, 0x05, 0x9d, 0xdd, 0x88, 0xf4, 0xf6, 0x43, 0xb8, 0xf9, 0x02, 0xac, 0x0e, 0xec, 0x28, 0x21,
-  0xe4, 0xdb, 0x91, 0x2f, 0x1f, 0xec, 0xe9, 0xab, 0x2d, 0xc1, 0x75, 0x8f, 0xc0, 0x71, 0x07, 0xf4, 0xf0, 0x4d, 0x5d,
-  0x10, 0x9f, 0x0a, 0x60, 0x3a, 0xdb, 0x7f, 0xe7, 0x0b, 0x30, 0xb3, 0xe6, 0x1f, 0xa8, 0xad, 0x2a, 0xc0, 0xfc, 0xf4,
-  0x95, 0x0e, 0xee, 0xbd, 0x04, 0xa9, 0xb3, 0xc3, 0xef, 0x8a, 0x09, 0xca, 0x3b, 0xa7, 0x9f, 0xd4, 0xf1, 0xe1, 0xd3,
-  0x87, 0xb5, 0x80, 0xdc, 0x95, 0x63, 0x5f, 0x3c, 0xcc, 0x58, 0x64, 0x5a, 0x9d, 0x9f, 0x7e, 0xcc, 0xb3, 0x4f, 0x6a,
-  0x22, 0x91, 0x75, 0x70, 0xe5, 0xe1, 0x55, 0x5a, 0xbc, 0xfa, 0xe8, 0xe7, 0xf7, 0x5f, 0xe4, 0xda, 0xd3, 0xc7, 0x79,
-  0xe4, 0x04, 0x28, 0x9e, 0x74, 0x70, 0xdb, 0x16, 0xbc, 0x92, 0xd9, 0x1f, 0x5d, 0x32, 0xbd, 0xd0, 0x0b, 0xea, 0x27,
-  0x18, 0xa1, 0xcb, 0xa3, 0xa7, 0xb5, 0xd0, 0x1e, 0xbe, 0x45, 0xad, 0x64, 0x01, 0x7c, 0x07, 0xec, 0xf4, 0x9c, 0x4f,
-  0x80, 0x7f, 0xf3, 0xa1, 0xef, 0x9d, 0xe6, 0x4a, 0x2d, 0x09, 0x3e, 0xb2, 0x04, 0xdf, 0x82, 0x85, 0xf1, 0x02, 0x4c,
-  0xd9, 0x47, 0x1f, 0x51, 0xfb, 0xda, 0xad, 0x75, 0xf0, 0xaa, 0x05, 0x5b, 0x01, 0xaf, 0x12, 0x42, 0x97, 0x4d, 0x46,
-  0x66, 0x91, 0xfc, 0x1d, 0x6f, 0x3e, 0xce, 0x06, 0x70, 0xe9, 0x18, 0x1d, 0x80, 0xd2, 0x66, 0x03, 0xd9, 0xf5, 0xca,
-  0x5b, 0x48, 0x14, 0x4f, 0x52, 0x8f, 0x3e, 0xa9, 0x77, 0x4a, 0x90, 0xb4, 0xbc, 0x62, 0x41, 0x55, 0x2a, 0xf1, 0xdd,
-  0xb5, 0x2b, 0xa5, 0x4f, 0xfe, 0x29, 0x5f, 0x81, 0xc3, 0x48, 0x16, 0xe3, 0xbb, 0xaf, 0x95, 0x95, 0x5f, 0x00, 0xc9,
-  0x95, 0xff, 0x31, 0xea, 0x95, 0xd7, 0x9e, 0x56, 0x3d, 0xc9, 0xb8, 0x02, 0xe6, 0xc9, 0x3f, 0x73, 0xfc, 0xde, 0xab,
-  0xb4, 0xe4, 0x37, 0x00, 0xc4, 0xe2, 0x29, 0xb9, 0xe7, 0x38, 0xfa, 0x93, 0xdf, 0x6b, 0x15, 0x30, 0x16, 0xde, 0x2e,
-  0xc1, 0xa2, 0x9b, 0x40, 0x75, 0xd0, 0x07, 0x52, 0xf1, 0x7a, 0xdf, 0x4a, 0x0b, 0x12, 0x16, 0xb3, 0x02, 0x2c, 0xc9,
-  0x62, 0xf4, 0xd6, 0x75, 0x7c, 0xf8, 0xb3, 0x2d, 0x90, 0x50, 0x15, 0x60, 0xdd, 0x79, 0x01, 0x52, 0xfa, 0x1f, 0x0e,
-  0xe0, 0x5f, 0x69, 0x94, 0x14, 0x30, 0xfd, 0x04, 0xed, 0x01, 0xca, 0x03, 0xa4, 0x07, 0x08, 0x0f, 0xe0, 0x1e, 0xc0,
-  0x28, 0xa0, 0x02, 0x51, 0x80, 0xfd, 0x00, 0xf2, 0xc0, 0x8f, 0x78, 0xf8, 0x3f, 0xe6, 0x02, 0x70, 0x57, 0xfc, 0xbb,
-  0x1d, 0x36, 0x01};
-
-static constexpr size_t SCRIPTICON_ORIGINAL_SIZE = 65536;
-
-static constexpr size_t SCRIPTICON_COMPRESSED_SIZE = 1808;
-
-static constexpr int SCRIPTICON_WIDTH = 128;
-
-static constexpr int SCRIPTICON_HEIGHT = 128;
-
-//=========================================================================================//
-//=========================================================================================//
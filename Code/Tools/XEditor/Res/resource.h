@@ -1,2 +1,3 @@
 #pragma once
 #define APPICON 101
+#define EDITOR_RESOURCES 102
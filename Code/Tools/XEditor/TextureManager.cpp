@@ -6,6 +6,7 @@
 
 #include "TextureManager.hpp"
 #include "Common/Str.hpp"
+#include "Engine/EngineCommon.hpp"
 #include "Tools/XPak/Compression.hpp"
 
 namespace x {
@@ -48,14 +49,10 @@ namespace x {
     }
 
     bool TextureManager::LoadFromMemoryCompressed(
-      const u8* data, const size_t compressedSize, u32 width, u32 height, u32 channels, const str& name) {
-        vector<u8> compressedData(compressedSize);
-        std::copy_n(data, compressedSize, compressedData.begin());
-        X_ASSERT(compressedData[0] == data[0]);
-
-        const size_t originalSize         = width * height * channels;
-        const vector<u8> uncompressedData = BrotliCompression::Decompress(compressedData, originalSize);
-        X_ASSERT(uncompressedData.size() == originalSize);
+      std::span<const u8> data, u32 width, u32 height, u32 channels, const str& name) {
+        // Decoded straight from the caller's bytes, no copy of the compressed data
+        vector<u8> uncompressedData(CAST<size_t>(width) * height * channels);
+        if (!BrotliCompression::Decompress(data, uncompressedData, {})) { return false; }
 
         return LoadFromMemory(uncompressedData.data(), width, height, channels, name);
     }
@@ -82,9 +79,21 @@ namespace x {
         return true;
     }
 
+    void TextureManager::SetResources(const ResourceBlob& resources) {
+        mResources = resources;
+    }
+
     std::optional<TextureData> TextureManager::GetTexture(const str& name) {
         if (name.empty()) { return std::nullopt; }
-        if (!mTextures.contains(name)) { return std::nullopt; }
+        if (!mTextures.contains(name)) {
+            const auto* resource = mResources.Find(name);
+            if (!resource) { return std::nullopt; }
+            const auto data = mResources.GetData(*resource);
+            if (!LoadFromMemoryCompressed(data, resource->mWidth, resource->mHeight, 4, name)) {
+                X_LOG_ERROR("Failed to load editor resource '%s'", name.c_str());
+                return std::nullopt;
+            }
+        }
         return mTextures[name];
     }
 
@@ -7,6 +7,7 @@
 #include "Common/Typedefs.hpp"
 #include "Engine/D3D.hpp"
 #include "Engine/RenderContext.hpp"
+#include "Tools/ResPak/ResourceBlob.hpp"
 #include <imgui.h>
 
 namespace x {
@@ -22,15 +23,19 @@ namespace x {
         explicit TextureManager(RenderContext& context) : mContext(context) {}
 
         bool LoadFromMemory(const u8* data, u32 width, u32 height, u32 channels, const str& name);
-        bool LoadFromMemoryCompressed(
-          const u8* data, const size_t compressedSize, u32 width, u32 height, u32 channels, const str& name);
+        bool LoadFromMemoryCompressed(std::span<const u8> data, u32 width, u32 height, u32 channels, const str& name);
         bool LoadFromDDSFile(const Path& ddsFile, const str& name);
 
+        /// @brief Textures missing from the manager are looked up in `resources` by name and decoded on first use.
+        /// The blob's bytes must outlive the manager.
+        void SetResources(const ResourceBlob& resources);
+
         std::optional<TextureData> GetTexture(const str& name);
         ImTextureID GetTextureID(const str& name);
 
     private:
         RenderContext& mContext;
+        ResourceBlob mResources;
         unordered_map<str, TextureData> mTextures;
     };
 }  // namespace x
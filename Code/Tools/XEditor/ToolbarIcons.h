@@ -1,472 +0,0 @@
-#pragma once
-
-// File generated with ResPak
-
-//=========================================================================================//
-// CLEANCODE
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char CLEANCODE_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x90, 0x8f, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0xd7, 0xe1, 
-    0x81, 0x06, 0x16, 0xe8, 0x01, 0x07, 0x76, 0xc2, 0x00, 0x7f, 0xb0, 0x03, 
-    0x06, 0x18, 0xe0, 0x00, 0x03, 0x3c, 0xe0, 0x00, 0x33, 0xdb, 0xe9, 0x06, 
-    0x4b, 0xf9, 0xef, 0xba, 0x5e, 0x24, 0xb3, 0xc4, 0x86, 0xd0, 0x66, 0x89, 
-    0x25, 0x62, 0x61, 0xd4, 0x85, 0x6c, 0xb2, 0x1d, 0x0a, 0xc9, 0x5c, 0xbd, 
-    0x65, 0x26, 0x07, 0xf5, 0xe1, 0xb4, 0xfd, 0xfe, 0x2c, 0x06, 0xeb, 0x82, 
-    0x2c, 0x36, 0x9f, 0xfb, 0xb2, 0x0e, 0xcd, 0x99, 0xdf, 0xd7, 0x94, 0xf8, 
-    0x63, 0x18, 0x8c, 0xf6, 0x2e, 0xc2, 0x44, 0x6f, 0xac, 0x60, 0x47, 0xcb, 
-    0xc3, 0x66, 0x27, 0xb2, 0x26, 0x0c, 0x36, 0x51, 0x5a, 0x28, 0x15, 0xda, 
-    0x8f, 0x15
-};
-
-static constexpr size_t CLEANCODE_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t CLEANCODE_COMPRESSED_SIZE = 110;
-
-static constexpr int CLEANCODE_WIDTH = 24;
-
-static constexpr int CLEANCODE_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// COMPILECODE
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char COMPILECODE_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x40, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0x07, 0x91, 
-    0x1d, 0xe8, 0xc1, 0x3a, 0x60, 0x80, 0x91, 0x15, 0xd8, 0x01, 0x1f, 0x58, 
-    0x80, 0x0f, 0x2c, 0xc2, 0x03, 0x1e, 0x30, 0xc0, 0xc1, 0xff, 0xff, 0x4e, 
-    0xed, 0x9e, 0x13, 0x04, 0xfa, 0x31, 0xb2, 0x5a, 0x04, 0x13, 0x0c, 0x28, 
-    0xe1, 0xc9, 0x44, 0x92, 0xbd, 0x33, 0x1a, 0x0c, 0x6c, 0x13, 0x92, 0x60, 
-    0x10, 0x0c, 0xec, 0x60, 0x64, 0x14, 0x51, 0x7e, 0xef, 0xcf, 0x92, 0x6e, 
-    0x18, 0xdb, 0x87, 0x24, 0xaa, 0x9f, 0x00, 0x1b, 0xa5, 0x52, 0xaa, 0xdf, 
-    0x00, 0x1b, 0x99, 0x39, 0xa7, 0xa0, 0x33, 0x7f, 0xe3, 0x2d, 0xe1, 0x9b, 
-    0xfe, 0x82, 0x9b, 0x3b, 0x2e, 0x3d, 0xaa, 0xef, 0xb3, 0x72, 0x32, 0x25, 
-    0xe4, 0xfe, 0x34, 0xfd, 0xf3, 0x58, 0xf3, 0xcd, 0xfb, 0x52, 0x77, 0x87, 
-    0x18, 0x90, 0xd9, 0xda, 0x80, 0x93, 0xbd, 0xe2, 0x0a, 0x8a, 0xfa, 0x3a, 
-    0xb2, 0xc9, 0xd1, 0x94, 0x4b, 0x5d, 0xc3, 0x62, 0x90, 0x5e, 0x0a, 0x1d, 
-    0x87, 0x6d, 0x92, 0xaf, 0x1a
-};
-
-static constexpr size_t COMPILECODE_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t COMPILECODE_COMPRESSED_SIZE = 149;
-
-static constexpr int COMPILECODE_WIDTH = 24;
-
-static constexpr int COMPILECODE_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// FOCUSSELECTED
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char FOCUSSELECTED_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x30, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0x57, 0xf1, 
-    0x04, 0x1d, 0xd8, 0x03, 0x78, 0xb0, 0x0d, 0x6c, 0x07, 0x5b, 0xc1, 0x7e, 
-    0xb0, 0x1e, 0xac, 0x07, 0x2b, 0xe0, 0x00, 0x0b, 0x78, 0xc0, 0x02, 0x16, 
-    0x30, 0x04, 0xd5, 0x89, 0x9a, 0x85, 0x9f, 0x39, 0xd1, 0x90, 0xc7, 0x8b, 
-    0x94, 0xda, 0x11, 0x54, 0xf4, 0xa0, 0xfd, 0xb4, 0x99, 0x7f, 0x51, 0x0d, 
-    0x14, 0x0a, 0x85, 0xb0, 0xdd, 0xfd, 0x53, 0x98, 0x85, 0xc3, 0x60, 0x18, 
-    0x0c, 0x82, 0x41, 0xd0, 0x17, 0xcb, 0x08, 0xa3, 0x8d, 0x77, 0xe4, 0xf0, 
-    0xb7, 0x86, 0x65, 0x8c, 0x11, 0x93, 0x8b, 0xc9, 0xd1, 0x9e, 0x31, 0x12, 
-    0x4d, 0x14, 0x7b, 0x87, 0x10, 0xb8, 0x94, 0x23, 0x57, 0x0a, 0x91, 0x9d, 
-    0x45, 0x3d, 0x86, 0xa3, 0x09, 0x3d, 0x44, 0xfd, 0xea, 0x16, 0x25, 0x66, 
-    0x2c, 0xd7, 0x03, 0xf4, 0x3e, 0xcc, 0x72, 0xed, 0x30, 0x05, 0x56, 0x9a, 
-    0x98, 0xd3, 0x2b, 0xf1, 0x0c, 0x02, 0xed, 0x72, 0xca, 0xde, 0x32, 0x1d, 
-    0x7d, 0xb1, 0xf5, 0xe9, 0xd1, 0x47, 0xb3, 0x23, 0x9a, 0x07, 0xe9, 0xbc, 
-    0xe4, 0x1e, 0x56, 0x7d, 0x8d, 0xfe, 0x8b, 0xd1, 0xcc, 0x9d, 0x5e, 0x52, 
-    0xe2, 0xa3, 0xbe, 0xf3, 0x09, 0xd4, 0x85, 0x58, 0x12, 0x27, 0x6b, 0xd1, 
-    0xf0, 0xb6, 0x67, 0x48, 0x52, 0x00, 0xc5, 0x1f, 0xd7, 0xfc, 0x40, 0xf7, 
-    0xab, 0x67, 0xfd, 0x47, 0xfd, 0x3e, 0xfb, 0x6b, 0x8b, 0x3b, 0xe4, 0x9f, 
-    0xe4, 0x00
-};
-
-static constexpr size_t FOCUSSELECTED_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t FOCUSSELECTED_COMPRESSED_SIZE = 206;
-
-static constexpr int FOCUSSELECTED_WIDTH = 24;
-
-static constexpr int FOCUSSELECTED_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// GRIDTOGGLE
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char GRIDTOGGLE_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x08, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0x57, 0xf1, 
-    0x3c, 0xe0, 0x00, 0x0b, 0x58, 0xb0, 0x0f, 0xf0, 0x60, 0x1b, 0xd8, 0x0b, 
-    0xd6, 0x83, 0xed, 0x60, 0x01, 0x1c, 0x60, 0x08, 0x07, 0x58, 0xc0, 0x40, 
-    0xa4, 0xa7, 0xee, 0xe0, 0x05, 0xde, 0xf4, 0xa5, 0x4a, 0x4d, 0x93, 0x25, 
-    0x2d, 0xc1, 0x04, 0x97, 0x41, 0xd3, 0xf4, 0xf7, 0x80, 0x13, 0x83, 0x49, 
-    0x61, 0x36, 0xa8, 0xcd, 0x71, 0xfb, 0xb2, 0x24, 0x18, 0x97, 0x3e, 0x89, 
-    0xc8, 0xf0, 0x2b, 0x70, 0xb7, 0x3b, 0x70, 0xe0, 0x7d, 0x79, 0x74, 0x45, 
-    0x3d, 0x67, 0x99, 0x81, 0xae, 0x0f, 0x55, 0x82, 0x9e, 0x0f, 0x1c, 0xd2, 
-    0x8e, 0x04, 0x74, 0x2d, 0x2a, 0xba, 0x49, 0xba, 0x18, 0x30, 0x84, 0x27, 
-    0x37, 0xba, 0x22, 0x13, 0x79, 0x3b, 0x78, 0x1a, 0x6a, 0x3a, 0xcb, 0x08, 
-    0x44, 0x75, 0x01, 0x8f, 0x88, 0x4c, 0x66, 0xf9, 0xb6, 0x08, 0x29, 0x9d, 
-    0xac, 0xea, 0x70, 0xa4, 0x52, 0xb3, 0x36, 0xb4, 0x76, 0x04, 0x7e, 0x8b, 
-    0x7f, 0x24, 0x98, 0xc6, 0x28, 0x73, 0xba, 0xcb, 0x66, 0x5f, 0x8f, 0x7c, 
-    0xd5, 0x73, 0xae, 0xae, 0xec, 0x93, 0xdf, 0x2c, 0x21, 0xde, 0xe0, 0xba, 
-    0x92, 0x29, 0xb2, 0x37, 0xcd, 0x42, 0xe4, 0xe8, 0xdd, 0x37, 0x0f, 0xd5, 
-    0x4f, 0x11, 0x7f, 0x79, 0x09
-};
-
-static constexpr size_t GRIDTOGGLE_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t GRIDTOGGLE_COMPRESSED_SIZE = 185;
-
-static constexpr int GRIDTOGGLE_WIDTH = 24;
-
-static constexpr int GRIDTOGGLE_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// MOVEICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char MOVEICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x28, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0x87, 0x26, 
-    0x1d, 0xe8, 0xd0, 0x16, 0xd8, 0x1e, 0xad, 0xd8, 0x1e, 0x30, 0xc4, 0x83, 
-    0x80, 0x6e, 0xea, 0x7f, 0x4b, 0x53, 0xd8, 0xa2, 0x11, 0x8d, 0x25, 0x16, 
-    0xc9, 0xba, 0xda, 0x1a, 0x48, 0x5c, 0x22, 0x3a, 0x31, 0x50, 0xe7, 0x88, 
-    0xbb, 0x1c, 0x4c, 0x5d, 0x86, 0x89, 0xd2, 0xaf, 0xcc, 0x13, 0x93, 0x70, 
-    0x35, 0x88, 0x66, 0x02, 0x12, 0x2e, 0x00, 0x70, 0xc8, 0xc9, 0x77, 0xe9, 
-    0x55, 0x16, 0x80, 0x13, 0xe5, 0x1f, 0xfd, 0x27, 0xba, 0x0a, 0xb3, 0x74, 
-    0x95, 0x13, 0x34, 0x89, 0x5e, 0x8d, 0x94, 0xd5, 0x1d, 0x0d, 0x90, 0xa2, 
-    0x45, 0x8f, 0x07, 0xe7, 0x84, 0xdf, 0xd5, 0x5a, 0x7e, 0xc7, 0x58, 0xf1, 
-    0x23, 0x3b, 0xa7, 0x18, 0x92, 0xaa, 0x23, 0xc9, 0x67, 0x47, 0x86, 0x11, 
-    0xa8, 0xca, 0x86, 0x49, 0x96, 0x8c, 0xd2, 0xfd, 0x94, 0xa3, 0xa5, 0x57, 
-    0xd7, 0xb6, 0x83, 0xca, 0xf2, 0x4c, 0x51, 0x5e, 0x22, 0xc1, 0xf9, 0xcb, 
-    0x6c, 0x00
-};
-
-static constexpr size_t MOVEICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t MOVEICON_COMPRESSED_SIZE = 146;
-
-static constexpr int MOVEICON_WIDTH = 24;
-
-static constexpr int MOVEICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// OPENFOLDER
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char OPENFOLDER_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x50, 0x86, 0xc1, 0xe0, 0x16, 0x5c, 0x70, 0xb0, 0x37, 
-    0x5b, 0x70, 0x00, 0x1c, 0x31, 0x9d, 0x1c, 0xc7, 0x1a, 0xcb, 0x99, 0x3a, 
-    0x51, 0x05, 0x96, 0x80, 0xd5, 0x76, 0x88, 0x98, 0x71, 0xf7, 0xd1, 0x30, 
-    0xb2, 0x70, 0x1f, 0x14, 0x57, 0xc1, 0x11, 0xed, 0x05, 0x54, 0x8b, 0xed, 
-    0x68, 0xe2, 0xd5, 0x8b, 0x34, 0x26, 0xb4, 0xa1, 0x1b, 0x3e, 0x80, 0x2f, 
-    0xda, 0xb3, 0xbd, 0xac, 0x0c
-};
-
-static constexpr size_t OPENFOLDER_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t OPENFOLDER_COMPRESSED_SIZE = 65;
-
-static constexpr int OPENFOLDER_WIDTH = 24;
-
-static constexpr int OPENFOLDER_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// PAUSEICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char PAUSEICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0xf8, 0x27, 0xff, 0x3f, 0x01, 0xc0, 0x21, 0xa7, 0x07, 
-    0x49, 0x25, 0xca, 0x14, 0x5a, 0x56, 0x06, 0x80, 0xc0, 0x1b, 0xaf, 0x50, 
-    0x86, 0x0e, 0xb9, 0x49, 0x70, 0xbd, 0x01
-};
-
-static constexpr size_t PAUSEICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t PAUSEICON_COMPRESSED_SIZE = 31;
-
-static constexpr int PAUSEICON_WIDTH = 24;
-
-static constexpr int PAUSEICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// PLAYICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char PLAYICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x20, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0x77, 0x83, 
-    0x03, 0x0d, 0x70, 0xb2, 0x27, 0x0b, 0x70, 0xc0, 0x07, 0x1b, 0x70, 0xc2, 
-    0x01, 0x07, 0x1c, 0x70, 0xcb, 0x9d, 0x24, 0x07, 0x6d, 0xaf, 0x98, 0x3d, 
-    0x86, 0xf8, 0x0c, 0xed, 0xf7, 0x5b, 0xfb, 0xbd, 0x20, 0x87, 0x07, 0x41, 
-    0x10, 0xe2, 0x74, 0x14, 0x85, 0x44, 0x93, 0x7c, 0xbf, 0xb0, 0x46, 0x94, 
-    0xfe, 0xa2, 0xa8, 0x21, 0x5d, 0x9d, 0xda, 0x24, 0x77, 0x3e, 0xb5, 0x7e, 
-    0x45, 0xdd, 0xb2, 0x85, 0xc7, 0x53, 0x90, 0x64, 0x56, 0x9c, 0xb0, 0x3e, 
-    0x15, 0x86, 0x4d, 0x0b, 0xcf, 0xc6, 0x08, 0xf0, 0x08, 0x36, 0x44, 0x9c, 
-    0x98, 0xaf, 0x13, 0xab, 0x6e, 0x9f, 0xd9, 0xcf, 0x28, 0xb8, 0x0f, 0xea, 
-    0x67, 0xc3, 0x02
-};
-
-static constexpr size_t PLAYICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t PLAYICON_COMPRESSED_SIZE = 111;
-
-static constexpr int PLAYICON_WIDTH = 24;
-
-static constexpr int PLAYICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// PLAYWINDOWEDICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char PLAYWINDOWEDICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x20, 0x86, 0x87, 0xb7, 0xdb, 0x47, 0x3c, 0xc0, 0x3f, 
-    0xbf, 0xf9, 0x89, 0x1d, 0x48, 0xde, 0xbc, 0xf3, 0xa8, 0xa4, 0x79, 0x22, 
-    0x6d, 0x07, 0x18, 0x36, 0x6f, 0xfe, 0x40, 0x95, 0xd3, 0x0d, 0x1c, 0x46, 
-    0x2a, 0xa7, 0x26, 0x27, 0x29, 0xd1, 0xdc, 0xfe, 0x46, 0x21, 0x33, 0x92, 
-    0x45, 0xfd, 0x6e, 0x74, 0x4e, 0xdc, 0x6b, 0x21, 0x07, 0x8e, 0x85, 0x3c, 
-    0xb8, 0x6e, 0xc1, 0x86, 0xe4, 0x82, 0x23, 0xac, 0x3b, 0x5a, 0xf6, 0xa1, 
-    0x0e, 0x35, 0x2b, 0x75, 0x51, 0x65, 0xbd, 0xd1, 0x52, 0x46, 0x18, 0xe9, 
-    0x6f, 0xdb, 0x90, 0xe9, 0x65, 0xaa, 0xc8, 0xd8, 0x26, 0xfa, 0x15, 0xb2, 
-    0x4e, 0xac, 0x4f, 0x00, 0x5d, 0xbf, 0x88, 0xeb, 0x0a, 0x57, 0xc6, 0x77, 
-    0xa3, 0x01
-};
-
-static constexpr size_t PLAYWINDOWEDICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t PLAYWINDOWEDICON_COMPRESSED_SIZE = 110;
-
-static constexpr int PLAYWINDOWEDICON_WIDTH = 24;
-
-static constexpr int PLAYWINDOWEDICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// REDOICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char REDOICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0xa0, 0x06, 0x4a, 0x76, 0x03, 0x1c, 0xe0, 0x00, 0x07, 
-    0x18, 0x59, 0x81, 0x2d, 0xc0, 0xc8, 0x1e, 0x30, 0xc0, 0x00, 0x03, 0x0c, 
-    0x30, 0xc0, 0x83, 0x7f, 0xdb, 0xe9, 0x9e, 0x7d, 0xf5, 0x94, 0xff, 0x45, 
-    0x53, 0x4e, 0xba, 0x0d, 0x26, 0xc8, 0x61, 0x44, 0x27, 0x9b, 0x4b, 0xa2, 
-    0xcc, 0x3e, 0xf8, 0x3d, 0xad, 0x03, 0x39, 0x4a, 0x34, 0x50, 0x63, 0x70, 
-    0x5b, 0x77, 0xcc, 0x58, 0xd6, 0xf0, 0x21, 0x91, 0x71, 0xc2, 0xad, 0x54, 
-    0x34, 0xc1, 0x03, 0x0e, 0x45, 0xa7, 0xd8, 0xb6, 0x75, 0xc8, 0x4d, 0x2f, 
-    0x12, 0xaa, 0x89, 0x4f, 0x59, 0x97, 0x5f, 0x72, 0x52, 0x91, 0xb8, 0x5e, 
-    0xcb, 0x01
-};
-
-static constexpr size_t REDOICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t REDOICON_COMPRESSED_SIZE = 98;
-
-static constexpr int REDOICON_WIDTH = 24;
-
-static constexpr int REDOICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// ROTATEICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char ROTATEICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x30, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0x87, 0x12, 
-    0x4f, 0xd0, 0x02, 0x3e, 0x60, 0xc1, 0x1a, 0xc2, 0x82, 0x6d, 0x60, 0x1d, 
-    0x58, 0x06, 0x16, 0xc2, 0x02, 0x06, 0x30, 0x80, 0x01, 0x3c, 0xf8, 0xaf, 
-    0xbf, 0xf1, 0xfa, 0x0e, 0xdc, 0x99, 0x05, 0xcd, 0x2c, 0x4c, 0x9a, 0xc0, 
-    0x22, 0x0b, 0xf7, 0x21, 0x67, 0x49, 0x77, 0x03, 0x6f, 0x12, 0x83, 0x07, 
-    0x1f, 0x3f, 0x94, 0xdb, 0x38, 0x2c, 0x46, 0x9b, 0xd1, 0x60, 0xfc, 0x60, 
-    0x58, 0xf8, 0x38, 0x70, 0x61, 0xbf, 0x2c, 0xb3, 0x0d, 0x1b, 0x7e, 0x51, 
-    0x23, 0x47, 0xdc, 0x42, 0xda, 0x18, 0x57, 0xfe, 0x9f, 0x70, 0x45, 0x49, 
-    0x73, 0xfa, 0x3a, 0xb6, 0x4c, 0x05, 0x90, 0x55, 0x43, 0xe2, 0x00, 0x75, 
-    0x57, 0x17, 0x54, 0x5e, 0x41, 0xd3, 0xbc, 0xae, 0x40, 0xd9, 0x0c, 0x67, 
-    0xdf, 0xfa, 0x38, 0x27, 0xe6, 0x7a, 0x49, 0x46, 0x8d, 0x08, 0x18, 0x1b, 
-    0x7c, 0xae, 0x95, 0x96, 0x9e, 0xa6, 0x9b, 0xe8, 0x26, 0xbb, 0xe5, 0xf2, 
-    0xb9, 0x0a, 0x37, 0xa4, 0xf9, 0x63, 0x51, 0xc4, 0x34, 0x02, 0x70, 0x45, 
-    0xa5, 0x29, 0xaa, 0x2a, 0xef, 0x84, 0xba, 0x63, 0xf0, 0x36, 0xf3, 0x0d, 
-    0x9f, 0xba, 0x32, 0xb3, 0xc8, 0x3b, 0xec, 0x68, 0xdd, 0x9e, 0x33, 0xfa, 
-    0xe6, 0xf0, 0x20, 0xc8, 0x64, 0x65, 0x09, 0xff, 0xac, 0x05
-};
-
-static constexpr size_t ROTATEICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t ROTATEICON_COMPRESSED_SIZE = 190;
-
-static constexpr int ROTATEICON_WIDTH = 24;
-
-static constexpr int ROTATEICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// SCALEICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char SCALEICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x28, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0xf7, 0x80, 
-    0x13, 0x29, 0x53, 0xa4, 0x38, 0x29, 0x45, 0xd2, 0xda, 0xe9, 0x8f, 0xf0, 
-    0x81, 0xe8, 0xe9, 0x45, 0x22, 0x0b, 0x76, 0x93, 0x2e, 0x51, 0xa8, 0x60, 
-    0x10, 0x16, 0xec, 0xda, 0x51, 0x18, 0xe8, 0x63, 0xbf, 0xca, 0x8d, 0xdb, 
-    0xce, 0xc8, 0x04, 0x6e, 0x71, 0x0b, 0x2c, 0x09, 0x6e, 0x3a, 0x68, 0x93, 
-    0x00, 0x39, 0x40, 0x31, 0x0f, 0x9b, 0xe9, 0xbf, 0xcc, 0x53, 0xe1, 0x15, 
-    0xd5, 0xab, 0x54, 0x93, 0x95, 0x0d, 0xa0, 0x3b, 0x8d, 0xed, 0x5c, 0x5e, 
-    0x34
-};
-
-static constexpr size_t SCALEICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t SCALEICON_COMPRESSED_SIZE = 85;
-
-static constexpr int SCALEICON_WIDTH = 24;
-
-static constexpr int SCALEICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// SELECTASSETICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char SELECTASSETICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x68, 0x8f, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0x87, 0x1c, 
-    0x5d, 0x84, 0x91, 0xfd, 0xc8, 0x7a, 0xb2, 0x62, 0x3b, 0xc4, 0x01, 0x0e, 
-    0xfe, 0x6d, 0xa7, 0x1f, 0x07, 0x9a, 0xe9, 0x1a, 0x0d, 0x1e, 0x51, 0x42, 
-    0xdd, 0xc5, 0x3a, 0xc4, 0xc0, 0x29, 0xea, 0xe6, 0x31, 0x56, 0x96, 0x75, 
-    0x6d, 0x5b, 0x06, 0x5d, 0x8b, 0x6a, 0xba, 0x80, 0xe3, 0x46, 0x7a, 0x28, 
-    0x74, 0xa9, 0xa3, 0xf0, 0x4f, 0x88, 0xc2, 0x24, 0x30, 0x99, 0x35, 0x4d, 
-    0x3a, 0x61, 0xde, 0x48, 0x79, 0x5f, 0x81, 0xb1, 0xda, 0x41, 0x7f, 0x91, 
-    0x22, 0x8b, 0x05, 0x24, 0x33, 0x00, 0xda, 0x77, 0x2f, 0xc0, 0x18, 0x22, 
-    0x1c, 0x4b, 0xd7, 0xbe, 0xeb, 0x6d
-};
-
-static constexpr size_t SELECTASSETICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t SELECTASSETICON_COMPRESSED_SIZE = 102;
-
-static constexpr int SELECTASSETICON_WIDTH = 24;
-
-static constexpr int SELECTASSETICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// SELECTICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char SELECTICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x70, 0x8e, 0x54, 0xb5, 0xbf, 0x02, 0xf8, 0xd7, 0xe1, 
-    0x81, 0x06, 0xd6, 0x00, 0x0f, 0xf6, 0x03, 0x1e, 0xec, 0xa0, 0x07, 0x7b, 
-    0x60, 0x03, 0x3c, 0x61, 0x80, 0x01, 0x06, 0x18, 0x60, 0xf0, 0xff, 0xee, 
-    0x9e, 0xcf, 0x56, 0xdb, 0x55, 0x6c, 0x6d, 0x15, 0x06, 0x92, 0x69, 0x2a, 
-    0x51, 0xf0, 0x45, 0xe1, 0xe3, 0x83, 0x0f, 0x17, 0x3e, 0x38, 0xe1, 0x56, 
-    0x97, 0x8b, 0x5d, 0x20, 0x0c, 0xff, 0x51, 0x59, 0xe9, 0x6a, 0x48, 0x1d, 
-    0x89, 0xa2, 0xa2, 0x93, 0xa0, 0x52, 0xd9, 0x05, 0xe0, 0x6b, 0x93, 0x95, 
-    0xbb, 0x87, 0x8f, 0x87, 0xa5, 0x3a, 0x73, 0x6b, 0x3c, 0xeb, 0xea, 0x30, 
-    0x92, 0x05, 0x90, 0x89, 0x46, 0xd0, 0x02, 0x99, 0xe9, 0xe0, 0x9c, 0x2a, 
-    0x0a, 0x25, 0x55, 0xe9, 0x08, 0xcb, 0xf8, 0x2d, 0x67, 0x3f, 0xb9, 0x7d, 
-    0x73, 0x6a, 0x98, 0x81, 0x6e, 0x2f, 0x22, 0xd2, 0x00, 0xff, 0xbb, 0x0e, 
-    0x03
-};
-
-static constexpr size_t SELECTICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t SELECTICON_COMPRESSED_SIZE = 133;
-
-static constexpr int SELECTICON_WIDTH = 24;
-
-static constexpr int SELECTICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// STOPICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char STOPICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0xf8, 0xa7, 0x00, 0xfe, 0xdb, 0x09, 0xc2, 0x0c, 0x6b, 
-    0x4c, 0x06, 0x80, 0xc0, 0x1b, 0x47, 0x10, 0x39, 0x05, 0x56, 0x1c
-};
-
-static constexpr size_t STOPICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t STOPICON_COMPRESSED_SIZE = 23;
-
-static constexpr int STOPICON_WIDTH = 24;
-
-static constexpr int STOPICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
-//=========================================================================================//
-// UNDOICON
-// Width: 24, Height: 24
-//=========================================================================================//
-static const unsigned char UNDOICON_BYTES[] = {
-    0x1b, 0xff, 0x08, 0x80, 0x86, 0x20, 0x76, 0x3e, 0x60, 0x80, 0x01, 0x06, 
-    0x18, 0x60, 0x60, 0x1f, 0x61, 0x60, 0x01, 0x16, 0xd9, 0x00, 0x07, 0x38, 
-    0xc0, 0x01, 0x9e, 0xaa, 0xa7, 0x2b, 0x2c, 0x19, 0xf3, 0x49, 0x2e, 0xb6, 
-    0x52, 0x95, 0x8e, 0x7f, 0x52, 0x50, 0x38, 0xf3, 0xf1, 0x1e, 0x63, 0xb1, 
-    0x4c, 0x5b, 0x0c, 0xbf, 0x65, 0x28, 0x8c, 0x56, 0x84, 0xaa, 0x34, 0xe0, 
-    0x6c, 0xfd, 0xb2, 0x71, 0x21, 0x30, 0xf1, 0x72, 0x7d, 0x0c, 0xc9, 0x06, 
-    0x7b, 0xf1, 0x63, 0x23, 0x91, 0x3a, 0x9c, 0x04, 0x87, 0x1b, 0xbb, 0x92, 
-    0x41, 0xc9, 0xeb, 0xda, 0x84, 0xd3, 0x95, 0xcd, 0xc7, 0xd5, 0xc1, 0x8d, 
-    0xf5, 0xef, 0xfd, 0xc5, 0x6b, 0x69
-};
-
-static constexpr size_t UNDOICON_ORIGINAL_SIZE = 2304;
-
-static constexpr size_t UNDOICON_COMPRESSED_SIZE = 102;
-
-static constexpr int UNDOICON_WIDTH = 24;
-
-static constexpr int UNDOICON_HEIGHT = 24;
-
-//=========================================================================================//
-//=========================================================================================//
-
-
@@ -1,300 +0,0 @@
-#pragma once
-
-// File generated with ResPak
-
-//=========================================================================================//
-// COG
-// Width: 130, Height: 130
-//=========================================================================================//
-static const unsigned char COG_BYTES[] = {
-  0x5b, 0x0f, 0x08, 0x01, 0xe3, 0x71, 0x5a, 0xac, 0x79, 0x71, 0x9c, 0x77, 0x05, 0xf0, 0x1f, 0xff, 0xf0, 0xc4, 0x2e,
-  0xbe, 0x03, 0x1c, 0xb0, 0x1d, 0xc0, 0xc0, 0x0a, 0x6c, 0x03, 0xdb, 0xc0, 0x0a, 0xac, 0xc0, 0xfa, 0x60, 0x73, 0x60,
-  0x01, 0x06, 0x18, 0xe0, 0x00, 0x06, 0xf8, 0xfc, 0xde, 0x65, 0x8a, 0xc7, 0x29, 0x08, 0x1a, 0xc0, 0xf0, 0xbc, 0x93,
-  0x6f, 0x11, 0x89, 0x01, 0x49, 0x45, 0x17, 0xe6, 0x40, 0xde, 0x74, 0x3f, 0xf5, 0x16, 0x50, 0x77, 0x41, 0x03, 0xd2,
-  0x38, 0x4d, 0x25, 0x38, 0x84, 0xee, 0xcc, 0x0a, 0xcc, 0x68, 0x95, 0x02, 0xe0, 0x49, 0x68, 0x63, 0x9c, 0xd2, 0x38,
-  0x38, 0x18, 0x1a, 0x5f, 0xb6, 0xe4, 0xcd, 0x4b, 0x7c, 0x7b, 0xc6, 0xb5, 0xfb, 0xef, 0x22, 0x3a, 0x5e, 0x37, 0x02,
-  0x11, 0x71, 0x22, 0x02, 0x11, 0x81, 0x40, 0x20, 0x10, 0xd7, 0x31, 0x54, 0x1c, 0x77, 0x72, 0x5a, 0xee, 0x57, 0x6d,
-  0x4e, 0x26, 0x23, 0x4b, 0x29, 0x59, 0x4d, 0xbf, 0x14, 0x23, 0xcb, 0x46, 0x6e, 0xab, 0xcf, 0xb4, 0x1d, 0xc9, 0x66,
-  0x26, 0x23, 0x8c, 0x20, 0xa7, 0x1d, 0xb8, 0x24, 0x3a, 0x8b, 0xb0, 0xe7, 0xcf, 0x72, 0xe4, 0xb4, 0x2b, 0x2e, 0x79,
-  0x51, 0xef, 0x8b, 0xb9, 0xcc, 0x5c, 0xf6, 0xc0, 0xa5, 0x4f, 0x2b, 0xba, 0xd4, 0x5c, 0xf6, 0x89, 0xcb, 0x9a, 0x96,
-  0xb8, 0x84, 0x5c, 0x36, 0x65, 0xd2, 0xd1, 0x70, 0xbc, 0x33, 0x97, 0x2d, 0x4c, 0x62, 0xd1, 0xfb, 0x05, 0x27, 0x79,
-  0xf6, 0x72, 0x00, 0xaa, 0x1d, 0xd0, 0x34, 0xbd, 0x1a, 0x2b, 0x7b, 0x84, 0x92, 0x64, 0x2e, 0x79, 0xda, 0xd5, 0x65,
-  0x36, 0x1c, 0xfc, 0xcf, 0x60, 0xca, 0xc9, 0x57, 0xec, 0x9a, 0x11, 0xe7, 0x96, 0x15, 0x85, 0x4b, 0x9f, 0x76, 0x34,
-  0x55, 0xce, 0x87, 0xbd, 0x22, 0x95, 0x94, 0xec, 0x81, 0xfd, 0x66, 0x74, 0x79, 0x0d, 0x24, 0x70, 0xad, 0x8b, 0xa4,
-  0xfb, 0x48, 0xf2, 0x13, 0xfe, 0x2c, 0xf0, 0x1c, 0x40, 0x0f, 0x89, 0x3f, 0x1b, 0x14, 0x5f, 0xff, 0xc4, 0x9b, 0xb1,
-  0x5f, 0x71, 0xfc, 0x71, 0x1a, 0x00, 0x00, 0xbc, 0x31, 0x18, 0x7e, 0x84, 0x9d, 0x0e, 0xcd, 0xc7, 0x10, 0x65, 0x1b,
-  0x82, 0x85, 0xb0, 0xb8, 0x0b, 0xba, 0x0e, 0x8d, 0x71, 0xa5, 0x07, 0x8a, 0x35, 0x8e, 0xbf, 0x8b, 0x5c, 0xbe, 0x22,
-  0x1b, 0x9e, 0x03, 0xc0, 0x27, 0xb1, 0x67, 0x03, 0x3a, 0x34, 0xb7, 0x99, 0xbc, 0xf0, 0xaa, 0x9f, 0x80, 0x2c, 0xf0,
-  0x1c, 0xa8, 0x3b, 0x74, 0xa0, 0x4f, 0xce, 0x6a, 0x96, 0x86, 0xcb, 0xd1, 0x16, 0x99, 0x9d, 0xce, 0xc3, 0x17, 0xb5,
-  0xcd, 0x06, 0x9c, 0xa6, 0x96, 0xce, 0x82, 0x3f, 0x1e, 0x54, 0x70, 0xab, 0x4e, 0xff, 0x54, 0x44, 0xa8, 0x2d, 0xdb,
-  0xa6, 0x34, 0xf9, 0x46, 0x78, 0xe1, 0x7d, 0x56, 0x1e, 0x46, 0x5a, 0x5b, 0x5e, 0x8e, 0x12, 0xb0, 0xc0, 0x73, 0x78,
-  0x94, 0x92, 0x17, 0x6e, 0x3e, 0x39, 0x7b, 0x11, 0x9a, 0x0e, 0xb7, 0x63, 0x7e, 0x37, 0xaf, 0x37, 0x3d, 0x1b, 0x4e,
-  0x8b, 0x7a, 0xe1, 0x13, 0xdb, 0x64, 0x60, 0x81, 0xe7, 0x80, 0xff, 0xa1, 0x3c, 0xd6, 0x18, 0x31, 0xcb, 0xca, 0xe6,
-  0x7d, 0x03, 0x5b, 0x6e, 0xa4, 0x47, 0x94, 0x73, 0x33, 0x48, 0xfe, 0x2c, 0xf0, 0x1c, 0x7c, 0x40, 0xfa, 0x99, 0xf9,
-  0x31, 0x86, 0xcb, 0x74, 0xfc, 0x45, 0x8b, 0x2e, 0x02, 0x0a, 0xeb, 0x4e, 0x10, 0x09, 0x78, 0x0e, 0xf8, 0x87, 0xf5,
-  0x07, 0xf9, 0x11, 0x4c, 0x22, 0x05, 0x7f, 0x1a, 0x63, 0x78, 0x63, 0x8c, 0x69, 0x6a, 0x92, 0xc2, 0x14, 0x34, 0xc3,
-  0xe6, 0xa0, 0x6d, 0x76, 0x4f, 0x6f, 0xc3, 0x2b, 0xc0, 0x54, 0xd4, 0x50, 0x79, 0x2b, 0xa3, 0x85, 0x0c, 0x3f, 0x16,
-  0x63, 0xbf, 0x08, 0x28, 0xa8, 0x20, 0xdc, 0x20, 0x7d, 0x52, 0x49, 0x7f, 0x78, 0xfc, 0xcd, 0xb7, 0xe2, 0x5e, 0x08,
-  0xea, 0x45, 0x79, 0x76, 0xa3, 0x24, 0x0a, 0x6f, 0x80, 0xf7, 0xf7, 0xc9, 0x24, 0x79, 0x2e, 0xf8, 0x93, 0x8f, 0xd2,
-  0x07, 0x31, 0x8f, 0xca, 0x8f, 0x5c, 0x85, 0x00, 0xe5, 0xfc, 0x5a, 0xba, 0x92, 0x5e, 0x3a, 0x06, 0x6f, 0x15, 0xe0,
-  0xeb, 0x4d, 0x8d, 0x37, 0xd8, 0x12, 0x67, 0xb0, 0xc3, 0x77, 0xbd, 0xaa, 0xe8, 0x97, 0xd9, 0x32, 0x40, 0xd7, 0xa8,
-  0x9a, 0xc7, 0xaa, 0x91, 0x30, 0xbc, 0x3a, 0x58, 0xa4, 0xa6, 0x62, 0xc2, 0xe1, 0x5b, 0xbe, 0x39, 0x95, 0xbf, 0x44,
-  0x92, 0x42, 0xea, 0xed, 0xe1, 0xd2, 0x0c, 0xfc, 0x09, 0xe1, 0xb0, 0x59, 0x20, 0x59, 0x91, 0x29, 0x3f, 0x3e, 0x74,
-  0x6d, 0xd1, 0x1d, 0xf4, 0xa2, 0x25, 0x47, 0xdb, 0x18, 0xde, 0x14, 0x83, 0x7e, 0x4b, 0xe1, 0x59, 0x33, 0x1d, 0xf8,
-  0xd8, 0x35, 0x70, 0x9b, 0xe2, 0xcf, 0x75, 0xfe, 0xb6, 0xdf, 0x6c, 0x1d, 0xd4, 0x2a, 0xd5, 0x8d, 0xce, 0x32, 0xcc,
-  0x1e, 0x20, 0x0b, 0x5c, 0x2d, 0x35, 0xfe, 0x03, 0x13, 0xbd, 0xd2, 0xe4, 0xd7, 0x0a, 0x65, 0x9c, 0x8b, 0x78, 0x10,
-  0x43, 0x37, 0xc1, 0x35, 0x39, 0x98, 0x3c, 0x18, 0xec, 0x22, 0x82, 0xc4, 0xc3, 0xee, 0xf2, 0x1e, 0xaa, 0x02, 0xd7,
-  0x94, 0xda, 0x08, 0x27, 0x65, 0x8b, 0xf7, 0x86, 0x51, 0x4a, 0x6a, 0x26, 0x86, 0x31, 0xe9, 0xc9, 0x09, 0x82, 0x2f,
-  0x50, 0xfe, 0x38, 0x57, 0x83, 0x58, 0x47, 0x4a, 0x72, 0x3a, 0x53, 0x8c, 0x9b, 0x0f, 0x99, 0xb3, 0x69, 0xdd, 0xda,
-  0x67, 0x3b, 0x37, 0xff, 0x5a, 0x38, 0x55, 0x11, 0x06, 0x03, 0xff, 0x14, 0xb9, 0x9b, 0x0a, 0xa8, 0x07, 0x91, 0xd1,
-  0xd0, 0x87, 0x9f, 0xda, 0xc6, 0xd3, 0xe0, 0x60, 0x2e, 0x73, 0xd0, 0x56, 0x5b, 0xc2, 0xe8, 0xb4, 0x2e, 0xde, 0xe1,
-  0xf1, 0xe7, 0x57, 0x0d, 0x81, 0x63, 0x8d, 0x76, 0x36, 0x23, 0x62, 0xe4, 0x50, 0x42, 0x73, 0xb6, 0x14, 0xce, 0x18,
-  0xc3, 0x7f, 0x6e, 0xec, 0x30, 0x33, 0x3c, 0xf0, 0xca, 0x9a, 0xc0, 0xf3, 0x5f, 0x3a, 0x0f, 0x91, 0x1a, 0xc3, 0x07,
-  0xc8, 0xe5, 0x27, 0x45, 0x25, 0xfe, 0x0f, 0x80, 0xe7, 0xd0, 0xd6, 0x9e, 0x4a, 0xb2, 0xbc, 0x59, 0x24, 0x75, 0xbb,
-  0x63, 0xc8, 0x58, 0x5f, 0x8e, 0x1f, 0xa7, 0x7b, 0x25, 0xc3, 0x08, 0x1a, 0x1b, 0x71, 0x75, 0x1f, 0x02, 0xa4, 0xce,
-  0x46, 0x33, 0xd2, 0x63, 0x8d, 0x10, 0x4a, 0x53, 0xb4, 0xd5, 0xbf, 0xe7, 0xbc, 0x7e, 0x00, 0x43, 0xd0, 0x63, 0x47,
-  0x74, 0x1f, 0x88, 0x77, 0x47, 0x60, 0xfc, 0xc2, 0x7f, 0xf4, 0x34, 0xbf, 0xc8, 0x85, 0xaf, 0x99, 0x14, 0x17, 0xef,
-  0x38, 0x8b, 0x4a, 0xcf, 0x03, 0xe6, 0xd1, 0x52, 0x23, 0x38, 0xac, 0x38, 0x0a, 0xfa, 0xe8, 0xd9, 0x8c, 0xad, 0x8a,
-  0xcd, 0xe8, 0xb9, 0x03, 0xa7, 0xdf, 0x08, 0xbe, 0x25, 0xd4, 0x40, 0x25, 0x68, 0xca, 0x47, 0x0f, 0x88, 0x07, 0xc0,
-  0x7c, 0x93, 0xad, 0x53, 0x17, 0x91, 0xff, 0xf8, 0x37, 0xb2, 0xe8, 0xf1, 0xd8, 0x99, 0x74, 0xc1, 0xcf, 0x5c, 0x59,
-  0xe2, 0x47, 0xa2, 0x65, 0x24, 0xbc, 0xf8, 0x64, 0x9b, 0x43, 0x01, 0x9f, 0xe9, 0x3e, 0x34, 0xb6, 0x39, 0x0a, 0x95,
-  0x5e, 0xd5, 0x55, 0x88, 0xe7, 0x3a, 0x25, 0x25, 0xd5, 0x83, 0x46, 0x8b, 0x66, 0x6d, 0xdf, 0x8f, 0x7e, 0xb5, 0x5d,
-  0x4c, 0xbe, 0x84, 0x1f, 0x67, 0x55, 0x92, 0x33, 0x97, 0xa2, 0xb2, 0xe3, 0xdf, 0xf6, 0x48, 0xfc, 0xa2, 0xb9, 0xd9,
-  0xcd, 0x4d, 0x26, 0x1f, 0x3d, 0xff, 0x2e, 0x8b, 0xbf, 0xe1, 0xa9, 0x34, 0xe5, 0x06, 0x8e, 0xe1, 0x27, 0xcc, 0x94,
-  0x39, 0xf0, 0x37, 0xa8, 0xe8, 0x0a, 0x9e, 0x0a, 0xbd, 0xc9, 0x3e, 0xcb, 0x95, 0x55, 0x4a, 0xb8, 0xe9, 0x2a, 0xc6,
-  0x56, 0xde, 0x6a, 0x1e, 0x23, 0x61, 0x37, 0x77, 0xf3, 0x78, 0xed, 0xff, 0x6a, 0xaa, 0x67, 0x9c, 0x68, 0x1d, 0xee,
-  0x55, 0xf9, 0x2f, 0x6c, 0xe2, 0x83, 0x4f, 0x6e, 0x98, 0x3a, 0xd1, 0x52, 0xf0, 0x77, 0x38, 0xfc, 0x50, 0xd1, 0x10,
-  0x85, 0x1b, 0x62, 0x62, 0x2d, 0x1d, 0x08, 0x70, 0x49, 0xb9, 0xa1, 0x8b, 0xe6, 0xe2, 0xe7, 0x02, 0xe7, 0x43, 0xf2,
-  0x2b, 0x5e, 0xad, 0x1b, 0x5c, 0x2c, 0xe5, 0x41, 0xfe, 0x1d, 0x9d, 0x49, 0x4d, 0x8a, 0x88, 0xfc, 0x21, 0x97, 0xc9,
-  0x7e, 0x08, 0x7c, 0x62, 0x44, 0xae, 0x8c, 0xc4, 0x85, 0xbf, 0x99, 0x4c, 0x52, 0x85, 0x94, 0xca, 0x0a, 0x10, 0x4d,
-  0xca, 0xf0, 0x46, 0x5b, 0xfd, 0xaa, 0x91, 0x5a, 0x26, 0x75, 0xd0, 0x5a, 0x5f, 0x21, 0xbd, 0x94, 0xc9, 0x5a, 0x3d,
-  0xd6, 0xd5, 0x24, 0xa5, 0x81, 0x81, 0x99, 0xda, 0xb0, 0x96, 0x60, 0xa9, 0xa4, 0x79, 0x1a, 0x37, 0xc8, 0x1b, 0xc8,
-  0x3c, 0x13, 0xb5, 0x21, 0xd6, 0x45, 0xeb, 0x91, 0xc7, 0x33, 0x3b, 0xaa, 0x9a, 0xd6, 0x1b, 0x6b, 0xbb, 0x4a, 0x62,
-  0xfa, 0xb6, 0x73, 0x80, 0xd8, 0x18, 0x96, 0x77, 0xb2, 0xfa, 0xee, 0x5e, 0x0e, 0x46, 0x8d, 0xf6, 0x69, 0x67, 0xeb,
-  0x4d, 0xcf, 0xa6, 0xa2, 0xea, 0x41, 0xe8, 0xf4, 0xb1, 0x99, 0x8c, 0x09, 0x7d, 0xf8, 0x94, 0xa4, 0x0c, 0xf3, 0xb1,
-  0xe0, 0x13, 0x39, 0x8d, 0x15, 0x8a, 0x0e, 0x0b, 0x3c, 0x07, 0x75, 0x6e, 0x07, 0xc9, 0x02, 0x5d, 0xeb, 0x3b, 0x21,
-  0xdc, 0x0a, 0x3a, 0x64, 0xee, 0xc0, 0xcd, 0xe2, 0xbf, 0x4c, 0x82, 0x96, 0xd6, 0x57, 0x79, 0xf5, 0x42, 0xf8, 0xea,
-  0x04, 0xac, 0x3a, 0xc1, 0xb7, 0x3a, 0x8c, 0x12, 0x80, 0x59, 0x84, 0x12, 0x53, 0xe2, 0xb5, 0x9c, 0xdd, 0x4b, 0xa0,
-  0xf4, 0x25, 0x66, 0xff, 0x07, 0x9b, 0xb4, 0xd9, 0x3c, 0xa8, 0xfd, 0x1d, 0x2d, 0xf9, 0x47, 0x60, 0x3c, 0x0b, 0xe2,
-  0xe5, 0x1d, 0xa3, 0x26, 0x45, 0xf5, 0x74, 0x2a, 0x81, 0x3a, 0x1c, 0xd1, 0xda, 0x61, 0x5b, 0x45, 0xd8, 0x89, 0x1c,
-  0x6b, 0x59, 0x34, 0x7f, 0xe2, 0x62, 0xa9, 0x8b, 0x62, 0x52, 0x22, 0x70, 0x09, 0xd1, 0xb8, 0x4e, 0x47, 0xb3, 0x9a,
-  0x9b, 0x4a, 0x78, 0x14, 0x9b, 0x65, 0xcb, 0x9a, 0xbe, 0x22, 0xae, 0xa0, 0x9a, 0x68, 0x23, 0x2e, 0xbc, 0x99, 0x4e,
-  0xac, 0x83, 0x47, 0x69, 0xe0, 0xd7, 0x44, 0xe5, 0xaf, 0x05, 0xe1, 0x67, 0x62, 0x43, 0xe5, 0x9d, 0xd8, 0x5d, 0x8f,
-  0x48, 0x1f, 0x54, 0xfc, 0x38, 0xbc, 0xeb, 0xea, 0x1f, 0xce, 0x1f, 0x36, 0xb9, 0x7d, 0xaf, 0x86, 0x58, 0x71, 0x30,
-  0x83, 0xa8, 0x70, 0x69, 0x44, 0x3f, 0x3d, 0xae, 0x31, 0x21, 0xb5, 0x19, 0x76, 0xee, 0xd2, 0x94, 0xe0, 0x8a, 0x5f,
-  0x68, 0x92, 0x52, 0x2f, 0xd3, 0x4f, 0x55, 0xb6, 0x65, 0x4c, 0xbc, 0x52, 0xed, 0xbf, 0x5a, 0x4e, 0x9a, 0xca, 0xaf,
-  0xf2, 0xab, 0xfc, 0xcb, 0x67, 0x75, 0x8c, 0xaa, 0x90, 0x70, 0xd5, 0xf3, 0xc6, 0x11, 0x24, 0xd1, 0x9c, 0x57, 0x52,
-  0x35, 0x97, 0x17, 0xdf, 0xa3, 0xcd, 0x8a, 0x27, 0x62, 0x67, 0x81, 0xe6, 0x26, 0xf8, 0x1a, 0xeb, 0xb9, 0x86, 0x57,
-  0xdb, 0x0a, 0xaf, 0x1b, 0x8d, 0x01, 0xc7, 0xb2, 0x26, 0x58, 0xfc, 0x39, 0x17, 0xbb, 0x70, 0x56, 0x66, 0xbf, 0x09,
-  0x06, 0x10, 0x1c, 0x22, 0x37, 0xcd, 0xac, 0x30, 0x63, 0xc9, 0xf8, 0x9b, 0x43, 0xc4, 0x26, 0xc3, 0x74, 0x0d, 0x0e,
-  0xe0, 0x37, 0x45, 0x69, 0x49, 0xe2, 0x9a, 0x2c, 0x2c, 0xa8, 0x4f, 0x52, 0x8f, 0xfc, 0x36, 0x86, 0xe1, 0xd7, 0x64,
-  0xf1, 0xa4, 0xf9, 0x6f, 0xf6, 0x09, 0x9c, 0x32, 0x28, 0xc2, 0xaf, 0x72, 0x92, 0xd3, 0xa7, 0x4d, 0x14, 0x4f, 0x01,
-  0xd0, 0xa0, 0xec, 0x37, 0x43, 0xe0, 0x37, 0x08, 0x36, 0x35, 0xa8, 0x4d, 0xfb, 0x92, 0x35, 0x9b, 0xba, 0x34, 0x74,
-  0xe8, 0x6a, 0x61, 0x26, 0xc7, 0xa5, 0x47, 0xf8, 0x8d, 0x94, 0xf8, 0x5d, 0xcf, 0xfe, 0xd3, 0x3e, 0xea, 0x12, 0x56,
-  0x86, 0x08, 0x39, 0x33, 0x97, 0xa7, 0x6d, 0x56, 0xf7, 0x60, 0x32, 0x60, 0xc1, 0x7b, 0x80, 0xd0, 0xfa, 0xc4, 0x4f,
-  0x35, 0xc2, 0xda, 0x28, 0xaa, 0xf5, 0xe3, 0xc0, 0x5f, 0xd1, 0xbb, 0x9e, 0xc9, 0xdb, 0x8a, 0x9b, 0x65, 0x1b, 0xef,
-  0x90, 0xd4, 0xd9, 0x7b, 0x24, 0x79, 0xff, 0x40, 0x57, 0x40, 0x0e, 0x78, 0x16, 0xf3, 0x2a, 0xe9, 0xf2, 0x42, 0x2d,
-  0x16, 0xb5, 0xea, 0x38, 0xd4, 0x5c, 0x0a, 0xa8, 0xbd, 0x9d, 0x16, 0x03, 0x07, 0x3e, 0x2c, 0x82, 0xe7, 0x37, 0x1c,
-  0x59, 0x99, 0xa3, 0x94, 0x9c, 0x4d, 0xd3, 0xd3, 0x10, 0x0d, 0x71, 0x29, 0xf8, 0x1c, 0x02, 0x18, 0x1c, 0xf0, 0x2c,
-  0xc6, 0x38, 0x39, 0x1e, 0x45, 0x4a, 0xd5, 0xc5, 0xb5, 0x85, 0x70, 0x42, 0x67, 0xac, 0x35, 0x72, 0x22, 0xa7, 0xe4,
-  0xc7, 0x01, 0xcf, 0x02, 0xbf, 0x06, 0x8c, 0xbf, 0x64, 0x03, 0x3f, 0x9f, 0x6b, 0x20, 0x96, 0xc6, 0x9f, 0x03, 0xfe,
-  0x41, 0x01, 0x0d, 0x29, 0xc3, 0x05, 0x04, 0x2e, 0xab, 0xe9, 0x40, 0x9a, 0x2e, 0x37, 0x3c, 0x0b, 0xfc, 0xae, 0x67,
-  0xfc, 0x9c, 0x8c, 0x58, 0x93, 0x14, 0x95, 0xcb, 0xe4, 0x80, 0x67, 0x81, 0xdf, 0x69, 0x80, 0xdf, 0xa6, 0x21, 0xd4,
-  0x85, 0x24, 0xe7, 0x64, 0x8e, 0x73, 0xc0, 0xb3, 0xa0, 0xa5, 0x48, 0x20, 0xff, 0xc5, 0x34, 0xa4, 0xda, 0x0c, 0xfc,
-  0x0d, 0x3d, 0x25, 0x80, 0xbf, 0x7e, 0x49, 0xc4, 0xd5, 0xc0, 0x53, 0x90, 0x16, 0x2f, 0x4f, 0xc8, 0xa3, 0x84, 0xc8,
-  0xbc, 0x1f, 0xfe, 0x7c, 0xc0, 0xaf, 0x06, 0x8a, 0x50, 0x9e, 0xfc, 0x47, 0x44, 0xbc, 0xb0, 0x8c, 0x03, 0xfc, 0xcf,
-  0x07, 0xfc, 0x05, 0x7f, 0x31, 0x4c, 0xe1, 0xba, 0xaf, 0x88, 0xc6, 0xb0, 0x2f, 0x84, 0x87, 0xa2, 0xe7, 0x41, 0x63,
-  0x19, 0x09, 0x0f, 0x45, 0xae, 0xb1, 0xc5, 0x32, 0xf5, 0x50, 0x24, 0xab, 0x58, 0xa6, 0x1a, 0xc3, 0x05, 0xc7, 0x59,
-  0x0c, 0x89, 0xc6, 0x17, 0x5d, 0xcf, 0x58, 0x34, 0xe6, 0x51, 0xef, 0x5a, 0xdb, 0x79, 0xad, 0x99, 0x44, 0xd1, 0x8b,
-  0xef, 0xe3, 0xef, 0x7f, 0x40, 0x00, 0x98, 0xde, 0xee, 0x69, 0xff, 0x09, 0x03};
-
-static constexpr size_t COG_ORIGINAL_SIZE = 67600;
-
-static constexpr size_t COG_COMPRESSED_SIZE = 1894;
-
-static constexpr int COG_WIDTH = 130;
-
-static constexpr int COG_HEIGHT = 130;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// CONTROLLER
-// Width: 168, Height: 120
-//=========================================================================================//
-static const unsigned char CONTROLLER_BYTES[] = {
-  0x5b, 0xff, 0x3a, 0x01, 0xe5, 0x91, 0x5a, 0xf5, 0x89, 0xc3, 0x2b, 0x80, 0xff, 0xf8, 0x87, 0x47, 0x3c, 0xf9, 0xff,
-  0x07, 0x18, 0xb0, 0x05, 0xb0, 0x60, 0x2b, 0xd8, 0x06, 0xd6, 0x82, 0xf5, 0x82, 0x65, 0x60, 0xfd, 0x60, 0xfd, 0x60,
-  0x05, 0x0c, 0x60, 0x01, 0x03, 0x18, 0xc0, 0xe3, 0xf7, 0x2d, 0x55, 0x9a, 0x49, 0x43, 0xcc, 0x21, 0x58, 0x4f, 0x5e,
-  0x59, 0x88, 0x38, 0x26, 0x2c, 0xef, 0x50, 0x44, 0x58, 0x08, 0x75, 0xff, 0x1a, 0x59, 0xcf, 0xba, 0x25, 0x24, 0xad,
-  0xd0, 0xce, 0x49, 0x67, 0xa5, 0x33, 0x7a, 0xb3, 0xb7, 0xc9, 0x9b, 0x9b, 0xdd, 0x74, 0x85, 0x5f, 0x5a, 0x41, 0x41,
-  0x95, 0xb3, 0xc0, 0x10, 0x14, 0x33, 0x97, 0xff, 0x4a, 0xbb, 0x80, 0x68, 0xe6, 0x01, 0xf8, 0x61, 0x5a, 0xf9, 0xe5,
-  0xd2, 0x95, 0x2e, 0x60, 0x60, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70, 0xc0, 0x49, 0x6f, 0x2a, 0xbb, 0x3d, 0x52,
-  0x33, 0xb2, 0x72, 0x12, 0xe5, 0x1f, 0xfd, 0xcc, 0xc9, 0x4a, 0x23, 0xa7, 0x8d, 0xa4, 0x1f, 0xbe, 0x5b, 0x52, 0x90,
-  0xd3, 0xfe, 0x2a, 0x1a, 0xa9, 0x72, 0x7d, 0x8e, 0x64, 0xc4, 0x93, 0xf5, 0x79, 0x58, 0x64, 0x5f, 0x94, 0x33, 0x25,
-  0x95, 0x5e, 0xd7, 0xbe, 0xc3, 0x5c, 0x7b, 0x67, 0xa5, 0xb2, 0x55, 0x9b, 0x40, 0x17, 0x38, 0xfb, 0x3f, 0x12, 0x99,
-  0x9d, 0x16, 0x21, 0xd7, 0xc6, 0xd4, 0xcc, 0x64, 0xf1, 0x11, 0x5f, 0x8c, 0xff, 0xc8, 0x35, 0x35, 0x3d, 0x23, 0x96,
-  0x95, 0x15, 0xcf, 0x49, 0x24, 0xeb, 0x48, 0x86, 0xac, 0x88, 0xd9, 0xfd, 0xf9, 0x8a, 0x65, 0xe4, 0x4d, 0x4d, 0x71,
-  0xe6, 0x14, 0xe7, 0xe4, 0x77, 0xf9, 0x8a, 0x92, 0x1f, 0x51, 0x34, 0x5e, 0xc6, 0xc9, 0xa3, 0x8c, 0x16, 0xff, 0x36,
-  0xce, 0xca, 0x50, 0x8f, 0xb8, 0xb2, 0x98, 0xc7, 0x4d, 0x9f, 0x37, 0xea, 0x17, 0x96, 0x9b, 0xc1, 0xf7, 0xb5, 0x8d,
-  0xf9, 0x45, 0x89, 0xfc, 0x25, 0x3b, 0xc2, 0xc3, 0x09, 0x28, 0x1e, 0x7d, 0x6b, 0x7f, 0x3a, 0x25, 0x8d, 0x6c, 0x50,
-  0xe8, 0x23, 0x96, 0x3c, 0x5d, 0x9e, 0xea, 0x74, 0xac, 0x4d, 0x50, 0x1c, 0x2d, 0x72, 0xf2, 0xf9, 0xf4, 0x2b, 0x33,
-  0x76, 0x99, 0xeb, 0x46, 0xa3, 0xd3, 0x66, 0x66, 0x56, 0xa7, 0xef, 0x88, 0xe0, 0xda, 0x17, 0xc5, 0x33, 0xd3, 0xe9,
-  0x8b, 0x92, 0xb7, 0x16, 0xce, 0xad, 0xde, 0xd2, 0xcc, 0xb4, 0xdc, 0xa6, 0x5d, 0xad, 0xde, 0x45, 0xcb, 0x95, 0x3b,
-  0xb7, 0xef, 0xb4, 0xac, 0xf2, 0x6c, 0x94, 0xdf, 0xab, 0xbc, 0x6e, 0xd1, 0x23, 0x51, 0x8e, 0x3b, 0xad, 0xca, 0xa0,
-  0xb9, 0x67, 0x3b, 0xe3, 0x75, 0x7a, 0xf4, 0x69, 0xdd, 0x9a, 0xb8, 0x8b, 0xad, 0xf1, 0x19, 0x80, 0x4f, 0x30, 0xab,
-  0x15, 0x1d, 0xe7, 0x6a, 0x1e, 0x26, 0xbc, 0x68, 0xe1, 0x71, 0x11, 0xe2, 0xaa, 0x3a, 0xdc, 0xd8, 0xc9, 0x53, 0x1c,
-  0x6d, 0x83, 0x88, 0xe1, 0x4a, 0x17, 0x63, 0x0a, 0x56, 0x73, 0x98, 0xa6, 0x06, 0x6f, 0x4d, 0xbd, 0x28, 0x25, 0x05,
-  0x94, 0x32, 0xeb, 0xb8, 0x8f, 0x5c, 0xfe, 0x76, 0x8e, 0xb9, 0x4a, 0x8b, 0x1c, 0xa3, 0xc7, 0xc9, 0x69, 0xe2, 0xc5,
-  0xb6, 0x1c, 0x94, 0xe0, 0xa2, 0xb1, 0x55, 0x52, 0xc9, 0x1f, 0x50, 0x8a, 0x69, 0xa8, 0xb2, 0x03, 0x89, 0x84, 0xd5,
-  0x12, 0xc7, 0x34, 0x75, 0xc0, 0x6e, 0xc4, 0x9a, 0x50, 0x35, 0xb7, 0xd2, 0x3d, 0x21, 0xed, 0x21, 0xe4, 0x23, 0x8b,
-  0x35, 0x59, 0x3e, 0xa8, 0x27, 0xa3, 0xd7, 0xa7, 0xa0, 0x97, 0x9e, 0xc5, 0x15, 0xfb, 0x93, 0x7f, 0xf9, 0xd0, 0xb7,
-  0x86, 0x20, 0x7b, 0x4f, 0x14, 0x8e, 0xae, 0xd3, 0x34, 0xbe, 0xa4, 0xd4, 0x2a, 0xec, 0xd3, 0x0f, 0x9f, 0x62, 0x64,
-  0x0d, 0xcd, 0xff, 0x43, 0x94, 0xda, 0x51, 0xf2, 0x87, 0xb4, 0x0f, 0xc6, 0xfb, 0xe8, 0x3e, 0xda, 0xc1, 0x5c, 0x4e,
-  0x76, 0x58, 0x7d, 0xd2, 0x49, 0xc8, 0x6c, 0x1a, 0x6b, 0xd2, 0x2b, 0x4a, 0xe0, 0xf1, 0xd6, 0x18, 0x1d, 0x69, 0x56,
-  0x70, 0x0c, 0xab, 0xfb, 0xd3, 0xda, 0x5a, 0x51, 0x55, 0x55, 0x90, 0xb9, 0x9b, 0xd6, 0x75, 0xac, 0x6c, 0x50, 0x30,
-  0xac, 0xe3, 0x6b, 0x7d, 0x54, 0x89, 0x2b, 0x1e, 0x3c, 0x0f, 0xea, 0x3d, 0x6e, 0xd3, 0x82, 0x9b, 0xb4, 0x3e, 0x75,
-  0xdc, 0xf1, 0x5a, 0x44, 0xe2, 0x73, 0x40, 0x59, 0x01, 0x8d, 0x62, 0x11, 0xc5, 0x03, 0xf1, 0x69, 0x83, 0xf1, 0x68,
-  0x5a, 0x0c, 0xaa, 0x22, 0x72, 0x07, 0x9c, 0xa1, 0xb9, 0xe1, 0xcf, 0x80, 0x61, 0x39, 0xda, 0x54, 0xf2, 0x07, 0xbb,
-  0xdd, 0x24, 0x8f, 0xa4, 0x39, 0xca, 0xe6, 0x65, 0xfc, 0xb0, 0xe5, 0xeb, 0x3c, 0x93, 0x68, 0xfa, 0xd2, 0xbe, 0xb0,
-  0x9e, 0x99, 0xfb, 0x5e, 0xb5, 0x94, 0xd5, 0x12, 0xaf, 0x15, 0x6d, 0xcd, 0x4a, 0xbd, 0xac, 0x10, 0x63, 0x93, 0xf5,
-  0xac, 0x63, 0x90, 0xfb, 0xd2, 0x89, 0x59, 0xb7, 0xa0, 0xf0, 0x5d, 0x72, 0x49, 0xf3, 0xaa, 0xba, 0x65, 0xe8, 0x2a,
-  0x18, 0x19, 0x0d, 0xaa, 0x03, 0xd1, 0x0b, 0x9c, 0x92, 0xbc, 0x86, 0xd3, 0x46, 0xf3, 0xde, 0xeb, 0xcb, 0xe4, 0xcb,
-  0xe6, 0x99, 0xef, 0xc9, 0xce, 0xa8, 0xf3, 0xde, 0x88, 0x60, 0x5b, 0x23, 0x7d, 0x80, 0x6b, 0x77, 0xd9, 0xb8, 0x83,
-  0xfb, 0x1b, 0xa9, 0x44, 0xe3, 0xe6, 0xbd, 0x39, 0x45, 0x2d, 0x81, 0xe0, 0x56, 0xb9, 0xb8, 0xd7, 0x5e, 0x72, 0xe2,
-  0xf0, 0xac, 0x8d, 0xf1, 0x22, 0xf6, 0xb2, 0xef, 0xfd, 0x80, 0x13, 0x07, 0x5b, 0xcb, 0xd5, 0xb1, 0xe6, 0x7a, 0x5d,
-  0x1c, 0x4d, 0xb1, 0xf7, 0x43, 0x1e, 0xae, 0x40, 0xf1, 0x85, 0xd4, 0xb5, 0x6b, 0xf3, 0x82, 0xf7, 0x90, 0x5f, 0x68,
-  0xac, 0xc8, 0xcb, 0xbe, 0xe6, 0xcb, 0x29, 0xb8, 0xe9, 0xc3, 0xdb, 0x77, 0x56, 0xef, 0x7d, 0x5a, 0xaf, 0x44, 0xa9,
-  0x49, 0xa8, 0x65, 0xcd, 0x3b, 0x7d, 0x7e, 0xd3, 0xfa, 0x44, 0x72, 0xe5, 0x5f, 0x9f, 0xd5, 0x74, 0x7b, 0xda, 0xa0,
-  0x91, 0xdb, 0xf8, 0x75, 0x6b, 0x79, 0x30, 0x5b, 0xd0, 0x9b, 0xd2, 0xc8, 0x5c, 0x98, 0x26, 0xe9, 0x9b, 0x7c, 0x97,
-  0x7b, 0x2d, 0x7b, 0x63, 0xc2, 0x2c, 0x78, 0x7e, 0x9d, 0xcd, 0x52, 0x5b, 0x22, 0x4a, 0xd2, 0x4b, 0x6a, 0x9a, 0x8b,
-  0xcb, 0x83, 0x45, 0x01, 0x45, 0xcf, 0xe6, 0x3c, 0x7f, 0x0d, 0xed, 0x26, 0x09, 0x9c, 0x9e, 0xe2, 0x8d, 0x87, 0x26,
-  0xef, 0x9b, 0x3e, 0x95, 0x88, 0x16, 0x73, 0x63, 0x6a, 0x33, 0x8f, 0x46, 0x70, 0x33, 0xe7, 0x18, 0xe9, 0xfa, 0x65,
-  0x3c, 0xee, 0xd6, 0xca, 0xa5, 0x73, 0xf2, 0x89, 0xda, 0x40, 0x1c, 0xb9, 0xd7, 0x6e, 0x43, 0x9b, 0xa5, 0x8d, 0x86,
-  0xd9, 0xbb, 0xf7, 0xa0, 0xb8, 0x63, 0x93, 0xec, 0x16, 0xb4, 0xf3, 0x73, 0x7d, 0x13, 0xd5, 0x81, 0xbf, 0x4d, 0x9d,
-  0xae, 0x34, 0x57, 0xe5, 0xf1, 0x66, 0xa8, 0x8c, 0x60, 0xa9, 0x5a, 0xa8, 0xe8, 0x17, 0x90, 0xe6, 0xa9, 0x1a, 0xb9,
-  0x7b, 0xa4, 0xd1, 0xb2, 0x6e, 0x45, 0x33, 0xe9, 0x1e, 0xad, 0xe2, 0x2a, 0xa6, 0xe6, 0x70, 0xd5, 0xd5, 0x7d, 0x5e,
-  0x21, 0x56, 0x62, 0xc0, 0xab, 0xc0, 0x34, 0xc1, 0x18, 0x02, 0x3c, 0x46, 0x55, 0x6d, 0x1b, 0x7c, 0x8e, 0x2a, 0xdb,
-  0xf5, 0x8e, 0x52, 0x23, 0x26, 0xee, 0x7e, 0xc8, 0xa1, 0x54, 0xf7, 0xed, 0xf7, 0xb5, 0xc2, 0xe6, 0x21, 0x95, 0x6f,
-  0x04, 0x9a, 0x15, 0x52, 0x2a, 0x37, 0x43, 0x12, 0xd1, 0x60, 0xb6, 0x25, 0xa5, 0x49, 0xe5, 0xef, 0x29, 0xa2, 0xc2,
-  0x02, 0x5e, 0x08, 0x3c, 0x2d, 0x7d, 0xbf, 0xed, 0x87, 0x24, 0xbd, 0x22, 0xc4, 0xb2, 0x19, 0x52, 0x43, 0x47, 0xc9,
-  0xe3, 0xcf, 0x64, 0xb3, 0x8d, 0xa5, 0xaf, 0x0a, 0x1a, 0xcd, 0x66, 0x48, 0xc3, 0xe8, 0x9b, 0xfc, 0x6f, 0x30, 0x94,
-  0xf5, 0x66, 0x97, 0xf6, 0xe1, 0x30, 0x3d, 0x53, 0xec, 0x58, 0xb1, 0xc1, 0x5a, 0x98, 0xde, 0x32, 0xf1, 0x57, 0xd1,
-  0xb2, 0xa3, 0x41, 0x25, 0xaf, 0x0a, 0xf1, 0x06, 0x3e, 0x3b, 0xec, 0x15, 0x91, 0xf5, 0x9e, 0xf0, 0xa5, 0x54, 0x3e,
-  0x0f, 0x8f, 0xb7, 0xa1, 0x65, 0x4a, 0xfe, 0xab, 0x9d, 0x58, 0x14, 0xc9, 0x75, 0x89, 0x16, 0x7e, 0xae, 0xa9, 0x82,
-  0x52, 0x14, 0xcf, 0xe4, 0x32, 0x6b, 0x75, 0x7d, 0x95, 0xe0, 0x61, 0x43, 0x4d, 0xf2, 0x77, 0x22, 0xd9, 0x4b, 0x33,
-  0xb5, 0x0f, 0xf3, 0x8c, 0xf6, 0xb0, 0x12, 0x29, 0xc0, 0x7a, 0x94, 0xc8, 0x09, 0x68, 0xb1, 0x1a, 0x2c, 0x55, 0xc3,
-  0x7f, 0x0d, 0x22, 0x52, 0xa9, 0x76, 0x8c, 0x2c, 0x7f, 0x71, 0x53, 0xe3, 0x5b, 0x10, 0xde, 0x00, 0x29, 0x14, 0xce,
-  0x03, 0x48, 0x49, 0xa4, 0xc0, 0xda, 0x02, 0xe6, 0x6b, 0xc5, 0x47, 0x03, 0x7e, 0x22, 0x97, 0xa3, 0x85, 0xc9, 0xf0,
-  0x9e, 0x8c, 0x79, 0x03, 0xe5, 0xff, 0xd9, 0x48, 0xfe, 0x05, 0x6e, 0x3b, 0x59, 0x04, 0xe0, 0xee, 0x93, 0xde, 0x0a,
-  0x62, 0x2b, 0x87, 0xa7, 0x30, 0x5f, 0xf3, 0xf0, 0x53, 0xf9, 0xd7, 0x40, 0x33, 0x78, 0x80, 0x9b, 0xcd, 0x32, 0x2c,
-  0xe1, 0x4d, 0x14, 0xf9, 0x04, 0xa2, 0xe1, 0xa1, 0xa8, 0xfc, 0x6b, 0xb0, 0xa2, 0x2a, 0x7f, 0xca, 0xbf, 0xf1, 0xe3,
-  0xfa, 0x09, 0x64, 0x37, 0x5f, 0xae, 0xa2, 0xcf, 0x95, 0x1b, 0xe7, 0x8a, 0xa7, 0xfc, 0xc4, 0xe7, 0x4a, 0x31, 0x90,
-  0x1f, 0x21, 0xfe, 0xf2, 0x90, 0x7f, 0x0d, 0xf2, 0xc9, 0x3a, 0x3a, 0x7e, 0xc3, 0x44, 0x46, 0x1a, 0xf2, 0xb7, 0x66,
-  0x68, 0x6e, 0x08, 0xff, 0x35, 0x28, 0x56, 0x7c, 0x49, 0x20, 0x0d, 0xd3, 0x27, 0x14, 0x6b, 0xc6, 0x19, 0xc3, 0xff,
-  0xf6, 0xb9, 0xce, 0x49, 0xaf, 0x94, 0x12, 0x4a, 0x79, 0x35, 0x2e, 0xfc, 0x9e, 0x5a, 0xb9, 0xc4, 0x75, 0xd0, 0x93,
-  0x02, 0xbd, 0x2c, 0x52, 0x71, 0xaa, 0x89, 0x53, 0x20, 0x0f, 0x6b, 0x41, 0x03, 0xda, 0xa6, 0x0c, 0x34, 0xa5, 0x89,
-  0xa6, 0x2e, 0x56, 0x0e, 0x71, 0xad, 0x13, 0x59, 0xd7, 0x14, 0x4a, 0xd5, 0x54, 0xc5, 0xbe, 0xc2, 0xc0, 0xbf, 0x7d,
-  0xae, 0x4a, 0x33, 0x09, 0xd6, 0x84, 0xb2, 0x0d, 0x39, 0x6c, 0x54, 0xa0, 0x0d, 0x71, 0xdd, 0x1b, 0x0c, 0xbe, 0xd2,
-  0x72, 0x72, 0x03, 0xfe, 0x4c, 0x5c, 0x59, 0x2a, 0x6f, 0x90, 0x7f, 0x0d, 0xf2, 0xe9, 0xd8, 0x96, 0x0d, 0xe1, 0x31,
-  0xb2, 0xda, 0xd9, 0x11, 0xe1, 0x07, 0xb9, 0x59, 0xe7, 0x9a, 0x25, 0xed, 0x6e, 0xa3, 0x48, 0x68, 0x25, 0x3f, 0x5d,
-  0x82, 0xc2, 0xf8, 0x10, 0xfe, 0xb7, 0x9b, 0x8e, 0xc5, 0x8a, 0x9d, 0x51, 0x97, 0x60, 0x9c, 0x0b, 0x7f, 0xbb, 0x48,
-  0x49, 0x66, 0x8d, 0xa0, 0x0f, 0x11, 0x56, 0xb8, 0x1e, 0xc3, 0x11, 0x3c, 0x4a, 0xd4, 0xcf, 0x6e, 0xe7, 0x24, 0xf6,
-  0x07, 0x5a, 0x28, 0x74, 0xf6, 0x90, 0xd3, 0xc5, 0xdd, 0xf3, 0x61, 0x08, 0x5b, 0xaf, 0x3e, 0xb5, 0x2c, 0x00, 0x40,
-  0xfe, 0x1a, 0x8d, 0xe6, 0x4d, 0xbf, 0x50, 0xcd, 0x11, 0x45, 0xf1, 0xdf, 0x44, 0x53, 0x87, 0x41, 0x41, 0x2b, 0xe5,
-  0x2b, 0x70, 0xd4, 0x79, 0xd0, 0xb6, 0x52, 0xd1, 0x73, 0xc8, 0x47, 0x44, 0x30, 0x33, 0x7e, 0x08, 0xf2, 0x48, 0xe4,
-  0x1d, 0x42, 0xbe, 0x0f, 0xe7, 0x4a, 0x5a, 0xfd, 0xa1, 0xaf, 0x11, 0xb3, 0x1c, 0x15, 0x19, 0xd3, 0xf0, 0x7b, 0xfa,
-  0x8d, 0x24, 0xda, 0x2c, 0x2a, 0x6a, 0xd2, 0x59, 0x60, 0x3a, 0xd0, 0x84, 0xfe, 0x3d, 0x99, 0x99, 0xb1, 0xb4, 0x0b,
-  0x59, 0x19, 0xf3, 0x98, 0x4d, 0x76, 0xb8, 0xa4, 0xab, 0x37, 0x12, 0x39, 0xd0, 0x74, 0x3f, 0x5f, 0x86, 0x1b, 0x3b,
-  0xd0, 0x74, 0x5f, 0x9b, 0x5a, 0xe9, 0x8a, 0x35, 0x5b, 0x5c, 0x83, 0x22, 0x21, 0x95, 0xfc, 0xe3, 0x7c, 0x73, 0x1c,
-  0x41, 0x99, 0x19, 0xff, 0xe1, 0x90, 0x1e, 0x4e, 0xde, 0xa0, 0x4b, 0x01, 0xa6, 0x54, 0x84, 0xc6, 0x53, 0x53, 0x63,
-  0x5d, 0x28, 0xa4, 0x74, 0x75, 0x6b, 0x1c, 0x06, 0x58, 0xde, 0xe1, 0x01, 0x4d, 0x73, 0x45, 0x78, 0x42, 0x8a, 0xaf,
-  0xdc, 0xb8, 0x8e, 0x6c, 0x78, 0x33, 0x30, 0xc0, 0x3d, 0x75, 0xed, 0xd9, 0xb0, 0x21, 0x38, 0x80, 0x3c, 0x84, 0x4e,
-  0xcc, 0x44, 0x45, 0x86, 0x82, 0xf8, 0x0a, 0x28, 0x14, 0xd9, 0x28, 0xc8, 0x20, 0x11, 0x5a, 0xf9, 0x84, 0x32, 0x2a,
-  0x3a, 0x32, 0x18, 0x84, 0x5a, 0x24, 0xe8, 0x4c, 0x42, 0x74, 0xa4, 0x14, 0xc2, 0x70, 0x76, 0xe8, 0xcc, 0x4c, 0x7c,
-  0xa4, 0x7c, 0x16, 0x70, 0x72, 0x78, 0xe4, 0x14, 0x19, 0x29, 0x9f, 0xf8, 0x80, 0x09, 0x75, 0x39, 0x5b, 0x42, 0xf1,
-  0x44, 0x1e, 0x1d, 0xaf, 0xaa, 0x51, 0x92, 0x82, 0x09, 0xef, 0x0d, 0xc2, 0x53, 0x3f, 0x37, 0x36, 0xca, 0x27, 0xd2,
-  0xc0, 0x97, 0x61, 0x57, 0x67, 0xc7, 0x45, 0xc1, 0xc4, 0xcb, 0xdb, 0xc3, 0xb3, 0xf5, 0x3f, 0x32, 0x52, 0x1a, 0xe1,
-  0x1d, 0xc7, 0x65, 0x29, 0xb3, 0xa5, 0x51, 0x1c, 0x0f, 0x5a, 0xbe, 0x2f, 0xc4, 0x81, 0x64, 0x68, 0x76, 0x54, 0x0e,
-  0x53, 0xb5, 0x84, 0xba, 0x86, 0x87, 0xf6, 0x5b, 0x7a, 0x23, 0xa5, 0x0e, 0x8b, 0x7d, 0x6c, 0xf8, 0x39, 0x35, 0x1f,
-  0xca, 0x6c, 0xb8, 0x28, 0x8d, 0xf0, 0x86, 0x19, 0xaf, 0x6b, 0x83, 0xe3, 0xbb, 0xb2, 0x08, 0xe5, 0xf3, 0x40, 0x23,
-  0x8e, 0xee, 0x0d, 0xb0, 0x6e, 0x30, 0xa2, 0xc8, 0x5d, 0x4d, 0xe5, 0x87, 0xf4, 0x60, 0xa4, 0xce, 0xf1, 0x35, 0xb5,
-  0x1d, 0x49, 0x74, 0xa8, 0xe5, 0x37, 0x25, 0x3f, 0xf1, 0xff, 0xac, 0xa8, 0x57, 0xca, 0x9c, 0x41, 0xee, 0x72, 0x70,
-  0x67, 0x69, 0xff, 0x29, 0x62, 0x79, 0x53, 0xa6, 0x99, 0x1c, 0xca, 0x1f, 0xd2, 0x07, 0x8a, 0x48, 0x4a, 0x7a, 0x66,
-  0xf6, 0x09, 0x3f, 0x65, 0xf2, 0x3b, 0xe1, 0x70, 0xcb, 0x1a, 0x31, 0xcd, 0x64, 0x50, 0xe6, 0x90, 0x56, 0xc5, 0x13,
-  0x5f, 0xba, 0xa1, 0x90, 0x9c, 0x91, 0xb1, 0x62, 0xd6, 0x5e, 0x69, 0xad, 0xb2, 0x07, 0xbb, 0x3c, 0x22, 0x6e, 0x27,
-  0x47, 0x94, 0x0b, 0xe8, 0xb0, 0x42, 0x2a, 0x7f, 0x2b, 0xc9, 0x1f, 0xa6, 0xd1, 0x1c, 0x54, 0x11, 0x6a, 0x7d, 0x5d,
-  0xe1, 0xa0, 0xe4, 0x7e, 0xd6, 0x51, 0x61, 0xe9, 0x4b, 0x2a, 0x49, 0x2d, 0x0a, 0x3f, 0xf1, 0xf3, 0xc0, 0x51, 0xd2,
-  0x51, 0x2e, 0x57, 0x6d, 0x88, 0x73, 0xcb, 0x6b, 0xff, 0x16, 0x9e, 0x95, 0xfe, 0x6e, 0xcc, 0xdf, 0xb7, 0x14, 0xeb,
-  0xec, 0x27, 0x91, 0x1e, 0xff, 0x9f, 0x6a, 0x00};
-
-static constexpr size_t CONTROLLER_ORIGINAL_SIZE = 80640;
-
-static constexpr size_t CONTROLLER_COMPRESSED_SIZE = 1965;
-
-static constexpr int CONTROLLER_WIDTH = 168;
-
-static constexpr int CONTROLLER_HEIGHT = 120;
-
-//=========================================================================================//
-//=========================================================================================//
-
-//=========================================================================================//
-// FOLDER_OUTLINE
-// Width: 139, Height: 120
-//=========================================================================================//
-static const unsigned char FOLDER_OUTLINE_BYTES[] = {
-  0x5b, 0x9f, 0x04, 0x01, 0xf1, 0x91, 0x5a, 0xf5, 0x89, 0xc3, 0x2b, 0x80, 0xff, 0xf8, 0x87, 0x90, 0x5d, 0xa0, 0x03,
-  0x0c, 0x30, 0xb0, 0x02, 0xfb, 0xc0, 0x7a, 0xb0, 0x7f, 0xb0, 0x02, 0x1b, 0x60, 0x80, 0x03, 0x1c, 0x60, 0x80, 0x03,
-  0x1c, 0xe0, 0xc1, 0xff, 0xd7, 0x5e, 0xa7, 0xbf, 0x91, 0x38, 0xbd, 0x6f, 0xe6, 0xcb, 0x78, 0x6c, 0x15, 0x06, 0x15,
-  0x26, 0x55, 0xfa, 0x28, 0xf6, 0x5f, 0xfa, 0xae, 0x31, 0x91, 0x11, 0x12, 0xe1, 0x45, 0xca, 0xa1, 0x3f, 0xe8, 0x42,
-  0x06, 0xba, 0x50, 0x4c, 0xbc, 0xa0, 0xa8, 0x46, 0xfc, 0xeb, 0x44, 0x7d, 0xef, 0x93, 0x4a, 0x95, 0xda, 0x48, 0xc6,
-  0x70, 0x2c, 0x86, 0x05, 0x01, 0x05, 0x03, 0x86, 0x01, 0x06, 0x01, 0x03, 0x01, 0x9b, 0x17, 0x7e, 0xcc, 0xe9, 0xd9,
-  0x39, 0xf1, 0x56, 0xe8, 0x5d, 0x52, 0xf1, 0x78, 0x0f, 0xa5, 0xc4, 0x37, 0x17, 0xda, 0xfb, 0xd1, 0x9b, 0x9a, 0x0c,
-  0xe9, 0x67, 0x6f, 0x4a, 0x32, 0xac, 0xbd, 0xa0, 0x89, 0xdc, 0xa5, 0x1b, 0x30, 0xa3, 0xe7, 0x9a, 0x89, 0x6e, 0xa1,
-  0x08, 0x57, 0x91, 0xcc, 0xe5, 0x84, 0x38, 0xd1, 0xfa, 0xf3, 0xfb, 0x4d, 0x77, 0x97, 0xa2, 0xb6, 0x05, 0x72, 0xd7,
-  0x3e, 0x6c, 0x3c, 0x17, 0xfa, 0x0f, 0x4f, 0xcc, 0xc7, 0x7e, 0x53, 0x98, 0x5a, 0x44, 0xfc, 0x5d, 0xc9, 0xd5, 0x62,
-  0x86, 0x71, 0x9a, 0x9c, 0x16, 0xac, 0x0d, 0x3e, 0xbc, 0x34, 0x4c, 0x75, 0xb2, 0x0e, 0xcf, 0xb8, 0x4c, 0x21, 0x96,
-  0x78, 0xed, 0x66, 0x4e, 0x7f, 0xd5, 0xac, 0x0c, 0x8d, 0xba, 0x03, 0xe8, 0xb7, 0x57, 0x4b, 0x64, 0xa7, 0x11, 0x07,
-  0xf8, 0xdf, 0xdf, 0x48, 0x00, 0xb8, 0x91, 0x34, 0x9e, 0x6e, 0xa0, 0x6d, 0x8c, 0xd2, 0xf3, 0x82, 0xd5, 0x4e, 0xd1,
-  0x45, 0xaf, 0x68, 0xaf, 0x79, 0x4b, 0xb4, 0x22, 0xf3, 0x08, 0x1a, 0xb7, 0xd5, 0x48, 0x4d, 0x74, 0xe3, 0xa9, 0xca,
-  0xaf, 0xa3, 0x2b, 0xab, 0xe8, 0xc3, 0x71, 0x24, 0x98, 0x00, 0xe0, 0x7f, 0xb8, 0x48, 0xbe, 0x78, 0xe2, 0xf6, 0xb1,
-  0x8b, 0x78, 0x66, 0x8a, 0x19, 0xb8, 0x8c, 0xe4, 0x3e, 0xc4, 0xe5, 0xc9, 0x44, 0x66, 0xde, 0x30, 0xb3, 0xcb, 0xbe,
-  0x4d, 0x31, 0x33, 0xf6, 0x62, 0xcd, 0x8a, 0x02, 0xfc, 0xd4, 0x7d, 0x43, 0xa4, 0x56, 0x24, 0x23, 0xfd, 0xe6, 0xf5,
-  0xd6, 0xe6, 0x39, 0xbd, 0x70, 0x0b, 0xb9, 0x56, 0x2c, 0xe7, 0xae, 0x6e, 0x7a, 0xf5, 0x93, 0x57, 0x59, 0x1e, 0xba,
-  0x5e, 0x67, 0x7b, 0x51, 0x69, 0x01, 0x9c, 0x3c, 0x33, 0xd5, 0x89, 0xac, 0x43, 0x87, 0x59, 0xe8, 0x94, 0x81, 0xa5,
-  0x7b, 0xe0, 0xd3, 0x42, 0x5e, 0xc6, 0xb5, 0x7c, 0x1e, 0x58, 0x5b, 0x28, 0xcb, 0x38, 0x41, 0x25, 0x70, 0x14, 0xa1,
-  0x5a, 0x90, 0xe3, 0x13, 0x72, 0x0f, 0xf4, 0x66, 0x19, 0x65, 0x34, 0xf7, 0xc9, 0x0b, 0x5c, 0xc3, 0xc8, 0xb2, 0x4c,
-  0x22, 0xff, 0x90, 0x08, 0x14, 0xb2, 0xee, 0x25, 0x20, 0x40, 0xa0, 0xd0, 0x35, 0x9b, 0x16, 0x2d, 0x17, 0x43, 0x37,
-  0x86, 0x7e, 0x26, 0xd3, 0x0f, 0xc3, 0x75, 0xfc, 0xa2, 0xdf, 0xc6, 0xd2, 0x97, 0x9e, 0x57, 0xc6, 0x94, 0x1f, 0x97,
-  0xe8, 0x50, 0x9c, 0x81, 0x13, 0x50, 0x6c, 0x4f, 0x8e, 0x58, 0x21, 0x72, 0xa8, 0x90, 0xb9, 0x66, 0xda, 0x08, 0xee,
-  0x7a, 0xc9, 0x21, 0xf4, 0x77, 0x8d, 0x61, 0x14, 0xd4, 0x3a, 0xa9, 0xa9, 0x63, 0xea, 0x89, 0xa4, 0x60, 0x26, 0xd3,
-  0xc6, 0x5b, 0xc7, 0x89, 0xca, 0x9e, 0x0d, 0xa9, 0x4c, 0x52, 0x19, 0xc1, 0x53, 0x7e, 0x8e, 0xc6, 0x5b, 0x53, 0x52,
-  0x31, 0x6d, 0x4d, 0x39, 0x51, 0x69, 0x44, 0x1b, 0x6f, 0xed, 0x49, 0xe2, 0x10, 0x25, 0x98, 0xc9, 0x2a, 0x84, 0xd2,
-  0x29, 0x3f, 0xae, 0x24, 0xa1, 0x34, 0xbb, 0x7a, 0x23, 0x09, 0xa5, 0xe2, 0x4a, 0x12, 0x74, 0x23, 0x83, 0xee, 0xfa,
-  0x74, 0x23, 0xb8, 0xad, 0x56, 0x65, 0xe8, 0x96, 0x0c, 0xba, 0x64, 0xd0, 0x25, 0x83, 0x2e, 0x19, 0x74, 0xc9, 0xa0,
-  0x4b, 0x06, 0x5d, 0x32, 0x74, 0x32, 0xa9, 0x14, 0xb2, 0xe4, 0xa2, 0xe0, 0x74, 0x8b, 0xe4, 0xd0, 0x90, 0x17, 0xb1,
-  0x92, 0x4f, 0xe8, 0x92, 0x41, 0x97, 0x8a, 0xbb, 0xde, 0x8b, 0xe9, 0x1b, 0xc1, 0x75, 0xb3, 0x54, 0xdc, 0x15, 0x72,
-  0xf8, 0xdc, 0x8f, 0x38, 0x8a, 0xd1, 0x07, 0x5d, 0x12, 0xf8, 0x92, 0xc0, 0x97, 0x04, 0xb1, 0xf4, 0x68, 0x3d, 0xd3,
-  0xcf, 0xf2, 0xa0, 0x55, 0xd2, 0x0a, 0x9f, 0xfb, 0x79, 0x87, 0x59, 0x50, 0xeb, 0xe4, 0x68, 0x9d, 0xf2, 0xb3, 0x38,
-  0x5a, 0x25, 0x3b, 0x08, 0xfd, 0xc6, 0x26, 0x28, 0xa9, 0x10, 0x72, 0x93, 0xb4, 0xc1, 0xe8, 0x1f, 0x05, 0xb4, 0x36,
-  0x74, 0x7d, 0xaa, 0x42, 0xed, 0x94, 0xdf, 0x88, 0x28, 0xd4, 0x26, 0xa9, 0x41, 0x93, 0x60, 0xd9, 0x25, 0x08, 0xb5,
-  0x27, 0x2a, 0x49, 0x1f, 0xd4, 0x4a, 0x5a, 0x11, 0x3b, 0xe5, 0x37, 0x22, 0x0c, 0x9d, 0x2c, 0xae, 0x47, 0xe6, 0xfa,
-  0x34, 0x98, 0x72, 0xc4, 0x56, 0xf2, 0x89, 0x58, 0xc9, 0x1b, 0x32, 0xd7, 0xa7, 0xa6, 0x25, 0x47, 0x2c, 0x3d, 0x32,
-  0x59, 0x42, 0x0f, 0x67, 0x51, 0xa8, 0x64, 0x1a, 0x72, 0x64, 0x32, 0x2e, 0x3d, 0xaf, 0xcc, 0xf5, 0x4f, 0x82, 0x13,
-  0x41, 0x90, 0xbc, 0xd8, 0xb4, 0x8f, 0xf9, 0x43, 0xf4, 0xb1, 0xf4, 0xd9, 0x36, 0x80, 0x4c, 0xf4, 0x27, 0x97, 0xe1,
-  0x36, 0x8c, 0x37, 0xd0, 0xf8, 0x57, 0x2d, 0xc3, 0xb4, 0x31, 0xe5, 0x46, 0xf9, 0x75, 0x65, 0x1f, 0x35, 0xcd, 0x4c,
-  0x1d, 0xc7, 0x55, 0x99, 0x32, 0x93, 0x98, 0x12, 0x53, 0xf8, 0x55, 0x6c, 0xfc, 0xdb, 0x96, 0x92, 0x15, 0x8b, 0xf7,
-  0x27, 0x65, 0xd1, 0x41, 0x00};
-
-static constexpr size_t FOLDER_OUTLINE_ORIGINAL_SIZE = 66720;
-
-static constexpr size_t FOLDER_OUTLINE_COMPRESSED_SIZE = 784;
-
-static constexpr int FOLDER_OUTLINE_WIDTH = 139;
-
-static constexpr int FOLDER_OUTLINE_HEIGHT = 120;
-
-//=========================================================================================//
-//=========================================================================================//
@@ -28,11 +28,7 @@
 #include "Engine/SceneParser.hpp"
 #include "Engine/EngineCommon.hpp"
 #include "Tools/XPak/AssetGenerator.hpp"
-
-// Embedded resources
-#include "AssetBrowserIcons.h"
-#include "ToolbarIcons.h"
-#include "Logos.h"
+#include "Tools/XPak/TextureBaker.hpp"
 
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -2448,7 +2444,7 @@ namespace x {
     AssetType XEditor::GetAssetTypeFromFile(const Path& path) {
         const auto ext = path.Extension();
 
-        if (ext == "dds") {
+        if (ext == "dds" || TextureBaker::IsSourceImage(ext)) {
             return kAssetType_Texture;
         } else if (ext == "glb" || ext == "obj" || ext == "fbx") {
             return kAssetType_Mesh;
@@ -2468,7 +2464,10 @@ namespace x {
     void XEditor::ReloadAssetCache(bool fullReload) {
         if (mLoadedProject.mLoaded && mGame.IsInitialized()) {
             mAssetDescriptors.clear();
-            if (fullReload) AssetManager::ReloadAssets();  // Update asset cache internally
+            if (fullReload) {
+                mGame.ReloadAssets();  // Update asset cache internally
+                mEditorResources.Clear();
+            }
             mAssetDescriptors = AssetManager::GetAssetDescriptors();
         }
     }
@@ -2532,65 +2531,22 @@ namespace x {
     }
 
     void XEditor::LoadEditorIcons() {
-        auto Load = [&](const u8* data, size_t size, u32 width, u32 height, const char* name) {
-            const auto result = mTextureManager.LoadFromMemoryCompressed(data, size, width, height, 4, name);
-            if (!result) {
-                X_LOG_ERROR("Failed to load editor icon '%s'", name);
-                throw std::runtime_error("Failed to load editor icon '" + str(name) + "'");
-            }
-        };
+        // Icons and logos are packed by ResPak and linked in as a single RCDATA resource. The resource stays mapped
+        // with the executable, so each icon is decoded straight from it the first time it's drawn.
+        const HRSRC resource = FindResource(nullptr, MAKEINTRESOURCE(EDITOR_RESOURCES), RT_RCDATA);
+        const HGLOBAL handle = resource ? LoadResource(nullptr, resource) : nullptr;
+        const void* data     = handle ? LockResource(handle) : nullptr;
+        if (!data) {
+            X_LOG_ERROR("Failed to find embedded editor resources");
+            throw std::runtime_error("Failed to find embedded editor resources");
+        }
 
-        // Toolbar Icons
-        Load(MOVEICON_BYTES, MOVEICON_COMPRESSED_SIZE, MOVEICON_WIDTH, MOVEICON_HEIGHT, "MoveIcon");
-        Load(PAUSEICON_BYTES, PAUSEICON_COMPRESSED_SIZE, PAUSEICON_WIDTH, PAUSEICON_HEIGHT, "PauseIcon");
-        Load(PLAYICON_BYTES, PLAYICON_COMPRESSED_SIZE, PLAYICON_WIDTH, PLAYICON_HEIGHT, "PlayIcon");
-        Load(PLAYWINDOWEDICON_BYTES,
-             PLAYWINDOWEDICON_COMPRESSED_SIZE,
-             PLAYWINDOWEDICON_WIDTH,
-             PLAYWINDOWEDICON_HEIGHT,
-             "PlayWindowedIcon");
-        Load(REDOICON_BYTES, REDOICON_COMPRESSED_SIZE, REDOICON_WIDTH, REDOICON_HEIGHT, "RedoIcon");
-        Load(UNDOICON_BYTES, UNDOICON_COMPRESSED_SIZE, UNDOICON_WIDTH, UNDOICON_HEIGHT, "UndoIcon");
-        Load(GRIDTOGGLE_BYTES, GRIDTOGGLE_COMPRESSED_SIZE, GRIDTOGGLE_WIDTH, GRIDTOGGLE_HEIGHT, "GridToggleIcon");
-        Load(FOCUSSELECTED_BYTES,
-             FOCUSSELECTED_COMPRESSED_SIZE,
-             FOCUSSELECTED_WIDTH,
-             FOCUSSELECTED_HEIGHT,
-             "FocusSelectedIcon");
-        Load(ROTATEICON_BYTES, ROTATEICON_COMPRESSED_SIZE, ROTATEICON_WIDTH, ROTATEICON_HEIGHT, "RotateIcon");
-        Load(SCALEICON_BYTES, SCALEICON_COMPRESSED_SIZE, SCALEICON_WIDTH, SCALEICON_HEIGHT, "ScaleIcon");
-        Load(SELECTICON_BYTES, SELECTICON_COMPRESSED_SIZE, SELECTICON_WIDTH, SELECTICON_HEIGHT, "SelectIcon");
-        Load(STOPICON_BYTES, STOPICON_COMPRESSED_SIZE, STOPICON_WIDTH, STOPICON_HEIGHT, "StopIcon");
-        Load(SELECTASSETICON_BYTES,
-             SELECTASSETICON_COMPRESSED_SIZE,
-             SELECTASSETICON_WIDTH,
-             SELECTASSETICON_HEIGHT,
-             "SelectAssetIcon");
-        Load(OPENFOLDER_BYTES, OPENFOLDER_COMPRESSED_SIZE, OPENFOLDER_WIDTH, OPENFOLDER_HEIGHT, "OpenFolderIcon");
-        Load(COMPILECODE_BYTES, COMPILECODE_COMPRESSED_SIZE, COMPILECODE_WIDTH, COMPILECODE_HEIGHT, "CompileCodeIcon");
-        Load(CLEANCODE_BYTES, CLEANCODE_COMPRESSED_SIZE, CLEANCODE_WIDTH, CLEANCODE_HEIGHT, "CleanCodeIcon");
-
-        // Asset Browser Icons
-        Load(AUDIOICON_BYTES, AUDIOICON_COMPRESSED_SIZE, AUDIOICON_WIDTH, AUDIOICON_HEIGHT, "AudioIcon");
-        Load(MATERIALICON_BYTES, MATERIALICON_COMPRESSED_SIZE, MATERIALICON_WIDTH, MATERIALICON_HEIGHT, "MaterialIcon");
-        Load(MESHICON_BYTES, MESHICON_COMPRESSED_SIZE, MESHICON_WIDTH, MESHICON_HEIGHT, "MeshIcon");
-        Load(SCENEICON_BYTES, SCENEICON_COMPRESSED_SIZE, SCENEICON_WIDTH, SCENEICON_HEIGHT, "SceneIcon");
-        Load(SCRIPTICON_BYTES, SCRIPTICON_COMPRESSED_SIZE, SCRIPTICON_WIDTH, SCRIPTICON_HEIGHT, "ScriptIcon");
-        Load(FOLDERICON_BYTES, FOLDERICON_COMPRESSED_SIZE, FOLDERICON_WIDTH, FOLDERICON_HEIGHT, "FolderIcon");
-        Load(FOLDERICONEMPTY_BYTES,
-             FOLDERICONEMPTY_COMPRESSED_SIZE,
-             FOLDERICONEMPTY_WIDTH,
-             FOLDERICONEMPTY_HEIGHT,
-             "FolderEmptyIcon");
-
-        // Logos / Branding
-        Load(ABOUT_BANNER_BYTES, ABOUT_BANNER_COMPRESSED_SIZE, ABOUT_BANNER_WIDTH, ABOUT_BANNER_HEIGHT, "AboutBanner");
-        Load(XEDITOR_LOGO_BYTES, XEDITOR_LOGO_COMPRESSED_SIZE, XEDITOR_LOGO_WIDTH, XEDITOR_LOGO_HEIGHT, "XEditorLogo");
-        Load(BACKGROUND_LOGOS_BYTES,
-             BACKGROUND_LOGOS_COMPRESSED_SIZE,
-             BACKGROUND_LOGOS_WIDTH,
-             BACKGROUND_LOGOS_HEIGHT,
-             "BackgroundLogos");
+        const ResourceBlob resources(std::span(CAST<const u8*>(data), SizeofResource(nullptr, resource)));
+        if (!resources.IsValid()) {
+            X_LOG_ERROR("Embedded editor resources are corrupt or out of date");
+            throw std::runtime_error("Embedded editor resources are corrupt or out of date");
+        }
+        mTextureManager.SetResources(resources);
     }
 
     void XEditor::RegisterEditorShortcuts() {
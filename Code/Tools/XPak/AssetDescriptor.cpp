@@ -55,4 +55,14 @@ namespace x {
                 return "invalid";
         }
     }
-}  // namespace x
\ No newline at end of file
+
+    AssetType AssetDescriptor::GetTypeFromString(const str& type) {
+        if (type == "texture") return kAssetType_Texture;
+        if (type == "mesh") return kAssetType_Mesh;
+        if (type == "audio") return kAssetType_Audio;
+        if (type == "material") return kAssetType_Material;
+        if (type == "scene") return kAssetType_Scene;
+        if (type == "script") return kAssetType_Script;
+        return kAssetType_Invalid;
+    }
+}  // namespace x
@@ -34,5 +34,6 @@ namespace x {
         static AssetId GetBaseId(AssetId id);
         static AssetType GetTypeFromId(AssetId id);
         static str GetTypeString(AssetType type);
+        static AssetType GetTypeFromString(const str& type);
     };
 }  // namespace x
@@ -0,0 +1,62 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "BakeCache.hpp"
+#include "Common/Timer.hpp"
+
+namespace x {
+    bool BakeCache::Open(const Path& directory) {
+        if (mDisk.IsOpen() && mDisk.GetDirectory() == directory) { return true; }
+        return mDisk.Open(directory);
+    }
+
+    vector<u8> BakeCache::BakeMesh(std::span<const u8> source,
+                                   const str& formatHint,
+                                   const MeshBakeOptions& options) {
+        const u64 key = XPakCache::MakeKey(source,
+                                           kAssetType_Mesh,
+                                           kCodec_None,
+                                           0,
+                                           0,
+                                           MeshBaker::GetCacheSalt(formatHint, options));
+        if (auto baked = Find(key)) { return std::move(*baked); }
+
+        const Timer timer;
+        auto baked = MeshBaker::Bake(source, formatHint, options);
+        // Failures aren't cached, the mesh is likely to be fixed before it's loaded again
+        if (!baked.empty()) { Store(key, baked, timer.Elapsed()); }
+        return baked;
+    }
+
+    vector<u8> BakeCache::BakeTexture(std::span<const u8> source, const TextureBakeOptions& options) {
+        const u64 key = XPakCache::MakeKey(source,
+                                           kAssetType_Texture,
+                                           kCodec_None,
+                                           0,
+                                           0,
+                                           TextureBaker::GetCacheSalt(options));
+        if (auto baked = Find(key)) { return std::move(*baked); }
+
+        const Timer timer;
+        auto baked = TextureBaker::Bake(source, options);
+        if (!baked.empty()) { Store(key, baked, timer.Elapsed()); }
+        return baked;
+    }
+
+    std::optional<vector<u8>> BakeCache::Find(u64 key) const {
+        // Misses until the cache is opened
+        auto record = mDisk.Load(key);
+        if (!record.has_value() || record->mPayload.empty()) { return std::nullopt; }
+        return std::move(record->mPayload);
+    }
+
+    void BakeCache::Store(u64 key, const vector<u8>& baked, f64 seconds) const {
+        XPakCacheRecord record;
+        record.mCodec   = kCodec_None;
+        record.mSize    = baked.size();
+        record.mSeconds = seconds;
+        record.mPayload = baked;
+        mDisk.Store(key, record);
+    }
+}  // namespace x
@@ -0,0 +1,40 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "XPakCache.hpp"
+#include "MeshBaker.hpp"
+#include "TextureBaker.hpp"
+#include "Common/Filesystem.hpp"
+#include "Common/Typedefs.hpp"
+
+#include <span>
+
+namespace x {
+    /// @brief Assets baked from source at load time (loose content, i.e. dev builds and the editor), persisted in an
+    /// XPakCache directory so an unchanged asset is only baked once across loads and runs.
+    ///
+    /// Keys are built the same way xpakc builds them for uncompressed payloads, so the two can share a cache
+    /// directory. Nothing is kept in memory, the ResourceManager already holds on to whatever was loaded. Safe to use
+    /// from multiple threads.
+    class BakeCache {
+    public:
+        BakeCache() = default;
+
+        /// @brief Persists baked assets in `directory`. Until this is called every asset is baked on each load.
+        bool Open(const Path& directory);
+
+        /// @brief Returns the baked mesh, see MeshBaker::Bake. Empty if it fails to import.
+        vector<u8> BakeMesh(std::span<const u8> source, const str& formatHint, const MeshBakeOptions& options = {});
+        /// @brief Returns the baked DDS, see TextureBaker::Bake. Empty if the image couldn't be decoded.
+        vector<u8> BakeTexture(std::span<const u8> source, const TextureBakeOptions& options = {});
+
+    private:
+        XPakCache mDisk;
+
+        std::optional<vector<u8>> Find(u64 key) const;
+        void Store(u64 key, const vector<u8>& baked, f64 seconds) const;
+    };
+}  // namespace x
@@ -0,0 +1,453 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "BlockCompression.hpp"
+#include "Common/Macros.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace x {
+    static constexpr u32 kRefineIterations = 2;
+
+    // Where each BC1 index sits between the two endpoints, 0 = first endpoint, 1 = second
+    static constexpr f32 kBC1Weights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+    // BC7 interpolation weights for 4 bit indices, out of 64
+    static constexpr u32 kBC7Weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    // Writes a BC7 block LSB first
+    class BlockBitWriter {
+    public:
+        explicit BlockBitWriter(u8* block) : mBlock(block) {
+            std::memset(mBlock, 0, 16);
+        }
+
+        void Write(u32 value, u32 bits) {
+            for (u32 i = 0; i < bits; ++i) {
+                if ((value >> i) & 1) { mBlock[mOffset >> 3] |= CAST<u8>(1 << (mOffset & 7)); }
+                ++mOffset;
+            }
+        }
+
+    private:
+        u8* mBlock;
+        u32 mOffset {0};
+    };
+
+    static u32 Quantize(f32 value, u32 maxValue) {
+        const f32 scaled = std::round(value / 255.0f * CAST<f32>(maxValue));
+        return CAST<u32>(X_CLAMP(scaled, 0.0f, CAST<f32>(maxValue)));
+    }
+
+    // Principal axis of a set of points, found by power iteration on their covariance matrix. Starts from the row
+    // with the largest variance, which can't be orthogonal to the axis unless every point is the same.
+    template<size_t N>
+    static void FindPrincipalAxis(const f32 (*points)[N], u32 count, f32* mean, f32* axis) {
+        for (size_t c = 0; c < N; ++c) {
+            mean[c] = 0.0f;
+            for (u32 i = 0; i < count; ++i) {
+                mean[c] += points[i][c];
+            }
+            mean[c] /= CAST<f32>(count);
+        }
+
+        f32 covariance[N][N] {};
+        for (u32 i = 0; i < count; ++i) {
+            for (size_t a = 0; a < N; ++a) {
+                for (size_t b = 0; b < N; ++b) {
+                    covariance[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+                }
+            }
+        }
+
+        size_t largest = 0;
+        for (size_t c = 1; c < N; ++c) {
+            if (covariance[c][c] > covariance[largest][largest]) { largest = c; }
+        }
+
+        for (size_t c = 0; c < N; ++c) {
+            axis[c] = covariance[largest][largest] > 0.0f ? covariance[largest][c] : 1.0f;
+        }
+
+        for (u32 iteration = 0; iteration < 8; ++iteration) {
+            f32 next[N] {};
+            f32 length = 0.0f;
+            for (size_t a = 0; a < N; ++a) {
+                for (size_t b = 0; b < N; ++b) {
+                    next[a] += covariance[a][b] * axis[b];
+                }
+                length += next[a] * next[a];
+            }
+
+            if (length <= std::numeric_limits<f32>::min()) { break; }
+            length = std::sqrt(length);
+            for (size_t c = 0; c < N; ++c) {
+                axis[c] = next[c] / length;
+            }
+        }
+
+        f32 length = 0.0f;
+        for (size_t c = 0; c < N; ++c) {
+            length += axis[c] * axis[c];
+        }
+        length = std::sqrt(length);
+        for (size_t c = 0; c < N; ++c) {
+            axis[c] /= length;
+        }
+    }
+
+    // Endpoints spanning the points along their principal axis
+    template<size_t N>
+    static void FitPrincipalAxis(const f32 (*points)[N], u32 count, f32* start, f32* end) {
+        f32 mean[N];
+        f32 axis[N];
+        FindPrincipalAxis<N>(points, count, mean, axis);
+
+        f32 minT = std::numeric_limits<f32>::max();
+        f32 maxT = std::numeric_limits<f32>::lowest();
+        for (u32 i = 0; i < count; ++i) {
+            f32 t = 0.0f;
+            for (size_t c = 0; c < N; ++c) {
+                t += (points[i][c] - mean[c]) * axis[c];
+            }
+            minT = X_MIN(minT, t);
+            maxT = X_MAX(maxT, t);
+        }
+
+        for (size_t c = 0; c < N; ++c) {
+            start[c] = mean[c] + axis[c] * minT;
+            end[c]   = mean[c] + axis[c] * maxT;
+        }
+    }
+
+    // Least squares endpoints for a fixed set of indices. `weights[i]` is how far along from `start` to `end` pixel
+    // i's index sits. Returns false (leaving the endpoints alone) if every pixel uses the same weight.
+    template<size_t N>
+    static bool RefitEndpoints(const f32 (*points)[N], const f32* weights, u32 count, f32* start, f32* end) {
+        f32 aa {0};
+        f32 ab {0};
+        f32 bb {0};
+        f32 ax[N] {};
+        f32 bx[N] {};
+        for (u32 i = 0; i < count; ++i) {
+            const f32 b = weights[i];
+            const f32 a = 1.0f - b;
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (size_t c = 0; c < N; ++c) {
+                ax[c] += a * points[i][c];
+                bx[c] += b * points[i][c];
+            }
+        }
+
+        const f32 determinant = aa * bb - ab * ab;
+        if (std::abs(determinant) < 1e-6f) { return false; }
+
+        for (size_t c = 0; c < N; ++c) {
+            start[c] = X_CLAMP((bb * ax[c] - ab * bx[c]) / determinant, 0.0f, 255.0f);
+            end[c]   = X_CLAMP((aa * bx[c] - ab * ax[c]) / determinant, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    static u16 PackRgb565(const f32* color) {
+        return CAST<u16>((Quantize(color[0], 31) << 11) | (Quantize(color[1], 63) << 5) | Quantize(color[2], 31));
+    }
+
+    static void UnpackRgb565(u16 packed, f32* color) {
+        const u32 r = (packed >> 11) & 31;
+        const u32 g = (packed >> 5) & 63;
+        const u32 b = packed & 31;
+        color[0]    = CAST<f32>((r << 3) | (r >> 2));
+        color[1]    = CAST<f32>((g << 2) | (g >> 4));
+        color[2]    = CAST<f32>((b << 3) | (b >> 2));
+    }
+
+    // Picks the closest of the 4 colors a pair of 565 endpoints decodes to for every pixel. Returns the squared error.
+    static f32 SelectBC1Indices(const f32 (*colors)[3], u16 color0, u16 color1, u8* indices) {
+        f32 palette[4][3];
+        UnpackRgb565(color0, palette[0]);
+        UnpackRgb565(color1, palette[1]);
+        for (u32 c = 0; c < 3; ++c) {
+            palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+            palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+        }
+
+        f32 total {0};
+        for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+            f32 best = std::numeric_limits<f32>::max();
+            for (u8 index = 0; index < 4; ++index) {
+                f32 error {0};
+                for (u32 c = 0; c < 3; ++c) {
+                    const f32 delta = colors[i][c] - palette[index][c];
+                    error += delta * delta;
+                }
+                if (error < best) {
+                    best       = error;
+                    indices[i] = index;
+                }
+            }
+            total += best;
+        }
+        return total;
+    }
+
+    static void EncodeBC1Color(const u8* pixels, u8* block) {
+        f32 colors[BlockCompression::kBlockPixels][3];
+        for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+            for (u32 c = 0; c < 3; ++c) {
+                colors[i][c] = pixels[i * 4 + c];
+            }
+        }
+
+        f32 start[3];
+        f32 end[3];
+        FitPrincipalAxis<3>(colors, BlockCompression::kBlockPixels, start, end);
+
+        u16 bestColor0 {0};
+        u16 bestColor1 {0};
+        u8 bestIndices[BlockCompression::kBlockPixels] {};
+        f32 bestError = std::numeric_limits<f32>::max();
+
+        for (u32 iteration = 0; iteration <= kRefineIterations; ++iteration) {
+            const u16 color0 = PackRgb565(end);
+            const u16 color1 = PackRgb565(start);
+
+            u8 indices[BlockCompression::kBlockPixels];
+            const f32 error = SelectBC1Indices(colors, color0, color1, indices);
+            if (error < bestError) {
+                bestError  = error;
+                bestColor0 = color0;
+                bestColor1 = color1;
+                std::memcpy(bestIndices, indices, sizeof(indices));
+            }
+            if (bestError == 0.0f || iteration == kRefineIterations) { break; }
+
+            // Weights run from color0 (`end`) to color1 (`start`)
+            f32 weights[BlockCompression::kBlockPixels];
+            for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+                weights[i] = kBC1Weights[bestIndices[i]];
+            }
+            if (!RefitEndpoints<3>(colors, weights, BlockCompression::kBlockPixels, end, start)) { break; }
+        }
+
+        // color0 > color1 selects the 4 color mode, which BC3 assumes as well. Swapping the endpoints swaps indices
+        // 0/1 and 2/3. Equal endpoints decode index 0 the same in either mode.
+        if (bestColor0 < bestColor1) {
+            std::swap(bestColor0, bestColor1);
+            for (auto& index : bestIndices) {
+                index ^= 1;
+            }
+        } else if (bestColor0 == bestColor1) {
+            std::memset(bestIndices, 0, sizeof(bestIndices));
+        }
+
+        u32 indexBits {0};
+        for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+            indexBits |= CAST<u32>(bestIndices[i]) << (i * 2);
+        }
+
+        std::memcpy(block, &bestColor0, sizeof(u16));
+        std::memcpy(block + 2, &bestColor1, sizeof(u16));
+        std::memcpy(block + 4, &indexBits, sizeof(u32));
+    }
+
+    // Single channel block, `values` is read every `stride` bytes. Tries both endpoint orderings: 6 interpolated
+    // values between the extremes, or 4 between the extremes excluding 0 and 255 with those two stored exactly.
+    static void EncodeBC4(const u8* values, u32 stride, u8* block) {
+        u8 lo {255};
+        u8 hi {0};
+        u8 innerLo {255};
+        u8 innerHi {0};
+        for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+            const u8 value = values[i * stride];
+            lo             = X_MIN(lo, value);
+            hi             = X_MAX(hi, value);
+            if (value != 0 && value != 255) {
+                innerLo = X_MIN(innerLo, value);
+                innerHi = X_MAX(innerHi, value);
+            }
+        }
+        if (innerLo > innerHi) { innerLo = innerHi = 0; }
+
+        u8 bestEndpoints[2] {};
+        u8 bestIndices[BlockCompression::kBlockPixels] {};
+        f32 bestError = std::numeric_limits<f32>::max();
+
+        const auto evaluate = [&](u8 endpoint0, u8 endpoint1) {
+            f32 palette[8];
+            palette[0] = endpoint0;
+            palette[1] = endpoint1;
+            if (endpoint0 > endpoint1) {
+                for (u32 k = 1; k <= 6; ++k) {
+                    palette[k + 1] = (CAST<f32>(7 - k) * endpoint0 + CAST<f32>(k) * endpoint1) / 7.0f;
+                }
+            } else {
+                for (u32 k = 1; k <= 4; ++k) {
+                    palette[k + 1] = (CAST<f32>(5 - k) * endpoint0 + CAST<f32>(k) * endpoint1) / 5.0f;
+                }
+                palette[6] = 0.0f;
+                palette[7] = 255.0f;
+            }
+
+            u8 indices[BlockCompression::kBlockPixels];
+            f32 total {0};
+            for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+                f32 best = std::numeric_limits<f32>::max();
+                for (u8 index = 0; index < 8; ++index) {
+                    const f32 delta = CAST<f32>(values[i * stride]) - palette[index];
+                    if (delta * delta < best) {
+                        best       = delta * delta;
+                        indices[i] = index;
+                    }
+                }
+                total += best;
+            }
+
+            if (total < bestError) {
+                bestError        = total;
+                bestEndpoints[0] = endpoint0;
+                bestEndpoints[1] = endpoint1;
+                std::memcpy(bestIndices, indices, sizeof(indices));
+            }
+        };
+
+        if (hi > lo) { evaluate(hi, lo); }
+        evaluate(innerLo, innerHi);
+
+        u64 indexBits {0};
+        for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+            indexBits |= CAST<u64>(bestIndices[i]) << (i * 3);
+        }
+
+        block[0] = bestEndpoints[0];
+        block[1] = bestEndpoints[1];
+        for (u32 i = 0; i < 6; ++i) {
+            block[2 + i] = CAST<u8>(indexBits >> (i * 8));
+        }
+    }
+
+    // Picks the closest of the 16 colors a pair of mode 6 endpoints decodes to for every pixel. `endpoints` are the
+    // 8 bit values with the p-bits already applied. Returns the squared error.
+    static f32 SelectBC7Indices(const f32 (*points)[4], const u32 (*endpoints)[4], u8* indices) {
+        f32 palette[16][4];
+        for (u32 index = 0; index < 16; ++index) {
+            const u32 weight = kBC7Weights[index];
+            for (u32 c = 0; c < 4; ++c) {
+                palette[index][c] = CAST<f32>(((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6);
+            }
+        }
+
+        f32 total {0};
+        for (u32 i = 0; i < BlockCompression::kBlockPixels; ++i) {
+            f32 best = std::numeric_limits<f32>::max();
+            for (u8 index = 0; index < 16; ++index) {
+                f32 error {0};
+                for (u32 c = 0; c < 4; ++c) {
+                    const f32 delta = points[i][c] - palette[index][c];
+                    error += delta * delta;
+                }
+                if (error < best) {
+                    best       = error;
+                    indices[i] = index;
+                }
+            }
+            total += best;
+        }
+        return total;
+    }
+
+    void BlockCompression::EncodeBC1(const u8* pixels, u8* block) {
+        EncodeBC1Color(pixels, block);
+    }
+
+    void BlockCompression::EncodeBC3(const u8* pixels, u8* block) {
+        EncodeBC4(pixels + 3, 4, block);
+        EncodeBC1Color(pixels, block + 8);
+    }
+
+    void BlockCompression::EncodeBC5(const u8* pixels, u8* block) {
+        EncodeBC4(pixels, 4, block);
+        EncodeBC4(pixels + 1, 4, block + 8);
+    }
+
+    void BlockCompression::EncodeBC7(const u8* pixels, u8* block) {
+        f32 points[kBlockPixels][4];
+        for (u32 i = 0; i < kBlockPixels; ++i) {
+            for (u32 c = 0; c < 4; ++c) {
+                points[i][c] = pixels[i * 4 + c];
+            }
+        }
+
+        f32 endpoints[2][4];
+        FitPrincipalAxis<4>(points, kBlockPixels, endpoints[0], endpoints[1]);
+
+        // Endpoints are 7 bits per channel plus a p-bit per endpoint that becomes the low bit of every channel
+        u32 bestQuantized[2][4] {};
+        u32 bestPBits[2] {};
+        u8 bestIndices[kBlockPixels] {};
+        f32 bestError = std::numeric_limits<f32>::max();
+
+        for (u32 iteration = 0; iteration <= kRefineIterations; ++iteration) {
+            for (u32 pBits = 0; pBits < 4; ++pBits) {
+                const u32 pBit[2] = {pBits & 1, pBits >> 1};
+
+                u32 quantized[2][4];
+                u32 decoded[2][4];
+                for (u32 e = 0; e < 2; ++e) {
+                    for (u32 c = 0; c < 4; ++c) {
+                        const f32 scaled = std::round((endpoints[e][c] - CAST<f32>(pBit[e])) / 2.0f);
+                        quantized[e][c]  = CAST<u32>(X_CLAMP(scaled, 0.0f, 127.0f));
+                        decoded[e][c]    = (quantized[e][c] << 1) | pBit[e];
+                    }
+                }
+
+                u8 indices[kBlockPixels];
+                const f32 error = SelectBC7Indices(points, decoded, indices);
+                if (error < bestError) {
+                    bestError = error;
+                    std::memcpy(bestQuantized, quantized, sizeof(quantized));
+                    bestPBits[0] = pBit[0];
+                    bestPBits[1] = pBit[1];
+                    std::memcpy(bestIndices, indices, sizeof(indices));
+                }
+            }
+            if (bestError == 0.0f || iteration == kRefineIterations) { break; }
+
+            f32 weights[kBlockPixels];
+            for (u32 i = 0; i < kBlockPixels; ++i) {
+                weights[i] = CAST<f32>(kBC7Weights[bestIndices[i]]) / 64.0f;
+            }
+            if (!RefitEndpoints<4>(points, weights, kBlockPixels, endpoints[0], endpoints[1])) { break; }
+        }
+
+        // The first pixel's index is stored without its high bit, so it has to be in the lower half. Swapping the
+        // endpoints mirrors every index.
+        if (bestIndices[0] & 8) {
+            for (u32 c = 0; c < 4; ++c) {
+                std::swap(bestQuantized[0][c], bestQuantized[1][c]);
+            }
+            std::swap(bestPBits[0], bestPBits[1]);
+            for (auto& index : bestIndices) {
+                index = CAST<u8>(15 - index);
+            }
+        }
+
+        BlockBitWriter writer(block);
+        writer.Write(1 << 6, 7);  // Mode 6
+        for (u32 c = 0; c < 4; ++c) {
+            writer.Write(bestQuantized[0][c], 7);
+            writer.Write(bestQuantized[1][c], 7);
+        }
+        writer.Write(bestPBits[0], 1);
+        writer.Write(bestPBits[1], 1);
+        for (u32 i = 0; i < kBlockPixels; ++i) {
+            writer.Write(bestIndices[i], i == 0 ? 3 : 4);
+        }
+    }
+}  // namespace x
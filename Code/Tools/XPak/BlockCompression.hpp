@@ -0,0 +1,28 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Common/Typedefs.hpp"
+
+namespace x {
+    /// @brief CPU encoders for the BCn block compressed texture formats. Every encoder takes one 4x4 block of RGBA8
+    /// pixels, row by row (64 bytes), and writes a single compressed block. They don't share any state, so blocks can
+    /// be encoded from as many threads as needed.
+    class BlockCompression {
+    public:
+        static constexpr u32 kBlockDim    = 4;
+        static constexpr u32 kBlockPixels = kBlockDim * kBlockDim;
+
+        /// @brief 8 bytes, RGB. Alpha is ignored.
+        static void EncodeBC1(const u8* pixels, u8* block);
+        /// @brief 16 bytes, a BC4 block for alpha followed by a BC1 block for RGB.
+        static void EncodeBC3(const u8* pixels, u8* block);
+        /// @brief 16 bytes, a BC4 block each for red and green. Blue and alpha are dropped.
+        static void EncodeBC5(const u8* pixels, u8* block);
+        /// @brief 16 bytes, RGBA. Only mode 6 is used (a single line through RGBA with 4 bit indices), which is
+        /// accurate for most blocks and a lot faster to search than the partitioned modes.
+        static void EncodeBC7(const u8* pixels, u8* block);
+    };
+}  // namespace x
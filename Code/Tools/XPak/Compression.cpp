@@ -3,10 +3,18 @@
 //
 
 #include "Compression.hpp"
+#include "Common/Hash.hpp"
+#include "Common/Parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 #include <brotli/decode.h>
 
 namespace x {
+#pragma region BrotliCompression
     std::vector<u8> BrotliCompression::Compress(std::span<const u8> data, int quality, int windowSize) {
         const size_t maxCompressedSize = BrotliEncoderMaxCompressedSize(data.size());
         if (maxCompressedSize == 0) { throw std::runtime_error("Input data is too large for Brotli compression."); }
@@ -65,4 +73,617 @@ namespace x {
 
         return result;
     }
-}  // namespace x
\ No newline at end of file
+
+    std::vector<u8> BrotliCompression::Compress(std::span<const u8> data,
+                                                const CompressionDictionary& dictionary,
+                                                int quality,
+                                                int windowSize) {
+        // The one-shot API can't take a dictionary, so this goes through the streaming encoder instead
+        BrotliEncoderState* state = BrotliEncoderCreateInstance(nullptr, nullptr, nullptr);
+        if (!state) { throw std::runtime_error("Failed to create Brotli encoder state."); }
+
+        BrotliEncoderSetParameter(state, BROTLI_PARAM_QUALITY, quality);
+        BrotliEncoderSetParameter(state, BROTLI_PARAM_LGWIN, windowSize);
+        BrotliEncoderSetParameter(state, BROTLI_PARAM_SIZE_HINT, CAST<u32>(X_MIN(data.size(), CAST<size_t>(1 << 30))));
+        if (!BrotliEncoderAttachPreparedDictionary(state, dictionary.GetBrotliDictionary())) {
+            BrotliEncoderDestroyInstance(state);
+            throw std::runtime_error("Failed to attach Brotli dictionary.");
+        }
+
+        std::vector<u8> result(X_MAX(BrotliEncoderMaxCompressedSize(data.size()), CAST<size_t>(1024)));
+        size_t availableIn  = data.size();
+        const u8* nextIn    = data.data();
+        size_t availableOut = result.size();
+        u8* nextOut         = result.data();
+
+        for (;;) {
+            if (!BrotliEncoderCompressStream(state,
+                                             BROTLI_OPERATION_FINISH,
+                                             &availableIn,
+                                             &nextIn,
+                                             &availableOut,
+                                             &nextOut,
+                                             nullptr)) {
+                BrotliEncoderDestroyInstance(state);
+                throw std::runtime_error("Compression failed.");
+            }
+            if (BrotliEncoderIsFinished(state)) { break; }
+            if (availableOut == 0) {
+                const size_t currentPos = nextOut - result.data();
+                result.resize(result.size() * 2);
+                nextOut      = result.data() + currentPos;
+                availableOut = result.size() - currentPos;
+            }
+        }
+
+        result.resize(nextOut - result.data());
+        BrotliEncoderDestroyInstance(state);
+
+        return result;
+    }
+
+    bool BrotliCompression::Decompress(std::span<const u8> data, std::span<u8> output, std::span<const u8> dictionary) {
+        BrotliDecoderState* state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+        if (!state) { return false; }
+
+        if (!dictionary.empty() &&
+            !BrotliDecoderAttachDictionary(state, BROTLI_SHARED_DICTIONARY_RAW, dictionary.size(), dictionary.data())) {
+            BrotliDecoderDestroyInstance(state);
+            return false;
+        }
+
+        size_t availableIn  = data.size();
+        const u8* nextIn    = data.data();
+        size_t availableOut = output.size();
+        u8* nextOut         = output.data();
+
+        const auto result = BrotliDecoderDecompressStream(state, &availableIn, &nextIn, &availableOut, &nextOut, nullptr);
+        BrotliDecoderDestroyInstance(state);
+
+        return result == BROTLI_DECODER_RESULT_SUCCESS && availableOut == 0;
+    }
+#pragma endregion
+
+#pragma region CompressionDictionary
+    CompressionDictionary::CompressionDictionary(std::vector<u8> data)
+        : mData(std::move(data)), mHash(HashFnv1a64(mData)) {}
+
+    CompressionDictionary::~CompressionDictionary() {
+        if (mBrotliDictionary) { BrotliEncoderDestroyPreparedDictionary(mBrotliDictionary); }
+    }
+
+    std::span<const u8> CompressionDictionary::GetData() const {
+        return mData;
+    }
+
+    bool CompressionDictionary::IsEmpty() const {
+        return mData.empty();
+    }
+
+    u64 CompressionDictionary::GetHash() const {
+        return mHash;
+    }
+
+    const BrotliEncoderPreparedDictionary* CompressionDictionary::GetBrotliDictionary() const {
+        std::call_once(mBrotliOnce, [this]() {
+            mBrotliDictionary = BrotliEncoderPrepareDictionary(BROTLI_SHARED_DICTIONARY_RAW,
+                                                               mData.size(),
+                                                               mData.data(),
+                                                               BROTLI_MAX_QUALITY,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr);
+        });
+        return mBrotliDictionary;
+    }
+
+    std::vector<u8> CompressionDictionary::Train(std::span<const std::vector<u8>> samples, size_t maxSize) {
+        // A simplified take on the "cover" trainer: score fixed-size segments of the samples by how many samples
+        // share the 8-byte substrings (d-mers) inside them, then greedily keep the best segment per slice of the
+        // corpus until the dictionary is full.
+        constexpr size_t kDmerSize    = sizeof(u64);
+        constexpr size_t kSegmentSize = 64;
+
+        if (samples.size() < 2 || maxSize < kSegmentSize) { return {}; }
+
+        auto readDmer = [](const u8* p) {
+            u64 dmer;
+            std::memcpy(&dmer, p, sizeof(u64));
+            return dmer;
+        };
+
+        // Number of samples each d-mer appears in. Only d-mers shared by at least two samples are worth anything.
+        std::unordered_map<u64, u32> frequency;
+        std::unordered_set<u64> seen;
+        size_t corpusSize {0};
+        for (const auto& sample : samples) {
+            corpusSize += sample.size();
+            if (sample.size() < kDmerSize) { continue; }
+            seen.clear();
+            for (size_t i = 0; i + kDmerSize <= sample.size(); ++i) {
+                const u64 dmer = readDmer(sample.data() + i);
+                if (seen.insert(dmer).second) { frequency[dmer]++; }
+            }
+        }
+
+        auto score = [&](u64 dmer) -> u64 {
+            const auto it = frequency.find(dmer);
+            return it != frequency.end() && it->second > 1 ? it->second : 0;
+        };
+
+        struct Segment {
+            size_t mSample {0};
+            size_t mOffset {0};
+            u64 mScore {0};
+        };
+        vector<Segment> segments;
+
+        const size_t segmentBudget = maxSize / kSegmentSize;
+        const size_t epochSize     = X_MAX(corpusSize / segmentBudget, kSegmentSize);
+        const size_t dmerSpan      = kSegmentSize - kDmerSize;  // Index of a window's last d-mer
+
+        // Each epoch is a slice of the concatenated samples; slide a segment-sized window over it and keep the best
+        for (size_t epochStart = 0; epochStart < corpusSize && segments.size() < segmentBudget;
+             epochStart += epochSize) {
+            const size_t epochEnd = X_MIN(epochStart + epochSize, corpusSize);
+            Segment best;
+
+            size_t sampleOffset = 0;
+            for (size_t sampleIndex = 0; sampleIndex < samples.size(); ++sampleIndex) {
+                const auto& sample = samples[sampleIndex];
+                const size_t begin = sampleOffset;
+                sampleOffset += sample.size();
+                if (sampleOffset <= epochStart || begin >= epochEnd || sample.size() < kSegmentSize) { continue; }
+
+                const size_t first = epochStart > begin ? epochStart - begin : 0;
+                const size_t last  = X_MIN(sample.size() - kSegmentSize, epochEnd - begin - 1);
+                if (first > last) { continue; }
+
+                u64 windowScore {0};
+                for (size_t i = first; i <= first + dmerSpan; ++i) {
+                    windowScore += score(readDmer(sample.data() + i));
+                }
+                for (size_t start = first;; ++start) {
+                    if (windowScore > best.mScore) { best = {sampleIndex, start, windowScore}; }
+                    if (start == last) { break; }
+                    windowScore -= score(readDmer(sample.data() + start));
+                    windowScore += score(readDmer(sample.data() + start + dmerSpan + 1));
+                }
+            }
+
+            if (best.mScore == 0) { continue; }
+            segments.push_back(best);
+
+            // Content that's already in the dictionary shouldn't be picked again
+            const auto& sample = samples[best.mSample];
+            for (size_t i = best.mOffset; i + kDmerSize <= best.mOffset + kSegmentSize; ++i) {
+                frequency.erase(readDmer(sample.data() + i));
+            }
+        }
+
+        // Matches are cheaper the closer they are to the data, so the highest scoring segments go last
+        std::ranges::stable_sort(segments, {}, &Segment::mScore);
+
+        std::vector<u8> dictionary;
+        dictionary.reserve(segments.size() * kSegmentSize);
+        for (const auto& segment : segments) {
+            const auto& sample = samples[segment.mSample];
+            dictionary.insert(dictionary.end(),
+                              sample.begin() + segment.mOffset,
+                              sample.begin() + segment.mOffset + kSegmentSize);
+        }
+
+        return dictionary;
+    }
+#pragma endregion
+
+#pragma region LZ4Compression
+    namespace {
+        constexpr size_t kLZ4MinMatch     = 4;
+        constexpr size_t kLZ4LastLiterals = 5;   // The last 5 bytes of a block are always literals
+        constexpr size_t kLZ4MatchLimit   = 12;  // The last match must start at least 12 bytes before the end
+        constexpr size_t kLZ4MaxOffset    = 65535;
+        constexpr u32 kLZ4HashBits        = 16;
+
+        u32 LZ4Read32(const u8* p) {
+            u32 value;
+            std::memcpy(&value, p, sizeof(u32));
+            return value;
+        }
+
+        u32 LZ4Hash(u32 sequence) {
+            return (sequence * 2654435761U) >> (32 - kLZ4HashBits);
+        }
+
+        void LZ4WriteLength(std::vector<u8>& out, size_t length) {
+            while (length >= 255) {
+                out.push_back(255);
+                length -= 255;
+            }
+            out.push_back(CAST<u8>(length));
+        }
+
+        void LZ4WriteSequence(std::vector<u8>& out,
+                              const u8* literals,
+                              size_t literalLength,
+                              size_t offset,
+                              size_t matchLength) {
+            const size_t matchCode   = matchLength >= kLZ4MinMatch ? matchLength - kLZ4MinMatch : 0;
+            const size_t literalCode = X_MIN(literalLength, CAST<size_t>(15));
+            const u8 token           = CAST<u8>((literalCode << 4) | X_MIN(matchCode, CAST<size_t>(15)));
+            out.push_back(token);
+            if (literalLength >= 15) { LZ4WriteLength(out, literalLength - 15); }
+            out.insert(out.end(), literals, literals + literalLength);
+
+            // A sequence without a match only ever appears at the end of a block
+            if (matchLength == 0) { return; }
+            out.push_back(CAST<u8>(offset & 0xFF));
+            out.push_back(CAST<u8>(offset >> 8));
+            if (matchCode >= 15) { LZ4WriteLength(out, matchCode - 15); }
+        }
+
+        bool LZ4ReadLength(const u8*& ip, const u8* end, size_t& length) {
+            u8 byte;
+            do {
+                if (ip >= end) { return false; }
+                byte = *ip++;
+                length += byte;
+            } while (byte == 255);
+            return true;
+        }
+    }  // namespace
+
+    std::vector<u8> LZ4Compression::Compress(std::span<const u8> data, std::span<const u8> dictionary) {
+        // Only the tail of the dictionary is reachable, and it has to sit directly in front of the data so matches can
+        // run from one into the other
+        dictionary = dictionary.last(X_MIN(dictionary.size(), kLZ4MaxOffset));
+        std::vector<u8> window;
+        if (!dictionary.empty()) {
+            window.reserve(dictionary.size() + data.size());
+            window.insert(window.end(), dictionary.begin(), dictionary.end());
+            window.insert(window.end(), data.begin(), data.end());
+        }
+
+        const u8* src      = dictionary.empty() ? data.data() : window.data();
+        const size_t start = dictionary.size();
+        const size_t size  = start + data.size();
+
+        std::vector<u8> out;
+        out.reserve(data.size() + data.size() / 255 + 16);
+
+        size_t anchor = start;
+        if (data.size() > kLZ4MatchLimit) {
+            std::vector<u32> table(1u << kLZ4HashBits, 0);
+            const size_t matchLimit = size - kLZ4MatchLimit;
+            const size_t matchEnd   = size - kLZ4LastLiterals;
+
+            // Position 0 is left in the table as the "empty" value
+            for (size_t pos = 1; pos + sizeof(u32) <= start; ++pos) {
+                table[LZ4Hash(LZ4Read32(src + pos))] = CAST<u32>(pos);
+            }
+
+            size_t pos = X_MAX(start, CAST<size_t>(1));
+            u32 misses = 0;
+            while (pos < matchLimit) {
+                const u32 sequence = LZ4Read32(src + pos);
+                const u32 hash     = LZ4Hash(sequence);
+                const size_t ref   = table[hash];
+                table[hash]        = CAST<u32>(pos);
+
+                if (ref == 0 || pos - ref > kLZ4MaxOffset || LZ4Read32(src + ref) != sequence) {
+                    // Step further the longer we go without a match, so incompressible data is skipped quickly
+                    pos += 1 + (misses++ >> 6);
+                    continue;
+                }
+                misses = 0;
+
+                size_t length = kLZ4MinMatch;
+                while (pos + length < matchEnd && src[ref + length] == src[pos + length]) {
+                    ++length;
+                }
+
+                LZ4WriteSequence(out, src + anchor, pos - anchor, pos - ref, length);
+                pos += length;
+                anchor = pos;
+            }
+        }
+
+        LZ4WriteSequence(out, src + anchor, size - anchor, 0, 0);
+        return out;
+    }
+
+    bool LZ4Compression::Decompress(std::span<const u8> data, std::span<u8> output, std::span<const u8> dictionary) {
+        const u8* ip    = data.data();
+        const u8* ipEnd = ip + data.size();
+        u8* op          = output.data();
+        u8* opEnd       = op + output.size();
+
+        while (ip < ipEnd) {
+            const u8 token = *ip++;
+
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !LZ4ReadLength(ip, ipEnd, literalLength)) { return false; }
+            if (literalLength > CAST<size_t>(ipEnd - ip) || literalLength > CAST<size_t>(opEnd - op)) { return false; }
+            if (literalLength <= 16 && ipEnd - ip >= 16 && opEnd - op >= 16) {
+                // Short literal runs (the common case) are copied with one fixed-size copy
+                std::memcpy(op, ip, 16);
+            } else if (literalLength > 0) {
+                std::memcpy(op, ip, literalLength);
+            }
+            ip += literalLength;
+            op += literalLength;
+
+            if (ip == ipEnd) { break; }  // Last sequence has no match
+
+            if (ipEnd - ip < 2) { return false; }
+            const size_t offset = ip[0] | (CAST<size_t>(ip[1]) << 8);
+            ip += 2;
+            const size_t written = CAST<size_t>(op - output.data());
+            if (offset == 0 || offset > written + X_MIN(dictionary.size(), kLZ4MaxOffset)) { return false; }
+
+            size_t matchLength = token & 0x0F;
+            if (matchLength == 15 && !LZ4ReadLength(ip, ipEnd, matchLength)) { return false; }
+            matchLength += kLZ4MinMatch;
+            if (matchLength > CAST<size_t>(opEnd - op)) { return false; }
+
+            if (offset > written) {
+                // Match starts in the dictionary and may continue into the output
+                const size_t back     = offset - written;
+                const size_t fromDict = X_MIN(back, matchLength);
+                std::memcpy(op, dictionary.data() + dictionary.size() - back, fromDict);
+                op += fromDict;
+
+                const u8* match = output.data();
+                for (size_t i = fromDict; i < matchLength; ++i) {
+                    *op++ = *match++;
+                }
+                continue;
+            }
+
+            const u8* match = op - offset;
+            if (offset >= 8 && CAST<size_t>(opEnd - op) >= matchLength + 8) {
+                // Copy in 8 byte steps, overrunning the match by up to 7 bytes that the next sequence overwrites.
+                // Each step reads bytes that have already been written since the offset is at least 8.
+                u8* matchEnd = op + matchLength;
+                do {
+                    std::memcpy(op, match, 8);
+                    op += 8;
+                    match += 8;
+                } while (op < matchEnd);
+                op = matchEnd;
+            } else if (offset >= matchLength) {
+                std::memcpy(op, match, matchLength);
+                op += matchLength;
+            } else {
+                // Overlapping match (e.g. run-length), must be copied forward one byte at a time
+                for (size_t i = 0; i < matchLength; ++i) {
+                    *op++ = *match++;
+                }
+            }
+        }
+
+        return op == opEnd;
+    }
+
+    std::vector<u8> LZ4Compression::Decompress(std::span<const u8> data, size_t size) {
+        std::vector<u8> result(size);
+        if (!Decompress(data, result)) { throw std::runtime_error("Failed to decode LZ4 block."); }
+        return result;
+    }
+#pragma endregion
+
+#pragma region CompressionCodecs
+    namespace {
+        std::vector<u8> StoreCompress(std::span<const u8> data, const CompressionDictionary*) {
+            return {data.begin(), data.end()};
+        }
+
+        bool StoreDecompress(std::span<const u8> data, std::span<u8> output, const CompressionDictionary*) {
+            if (data.size() != output.size()) { return false; }
+            std::copy_n(data.data(), data.size(), output.data());
+            return true;
+        }
+
+        std::vector<u8> BrotliCodecCompress(std::span<const u8> data, const CompressionDictionary* dictionary) {
+            if (dictionary && !dictionary->IsEmpty()) { return BrotliCompression::Compress(data, *dictionary); }
+            return BrotliCompression::Compress(data);
+        }
+
+        bool BrotliCodecDecompress(std::span<const u8> data,
+                                   std::span<u8> output,
+                                   const CompressionDictionary* dictionary) {
+            const auto dictionaryData = dictionary ? dictionary->GetData() : std::span<const u8> {};
+            return BrotliCompression::Decompress(data, output, dictionaryData);
+        }
+
+        std::vector<u8> LZ4CodecCompress(std::span<const u8> data, const CompressionDictionary* dictionary) {
+            return LZ4Compression::Compress(data, dictionary ? dictionary->GetData() : std::span<const u8> {});
+        }
+
+        bool LZ4CodecDecompress(std::span<const u8> data,
+                                std::span<u8> output,
+                                const CompressionDictionary* dictionary) {
+            const auto dictionaryData = dictionary ? dictionary->GetData() : std::span<const u8> {};
+            return LZ4Compression::Decompress(data, output, dictionaryData);
+        }
+
+        // Indexed by codec id
+        constexpr CompressionCodec kCodecs[] = {
+          {kCodec_None, "none", StoreCompress, StoreDecompress},
+          {kCodec_Brotli, "brotli", BrotliCodecCompress, BrotliCodecDecompress},
+          {kCodec_LZ4, "lz4", LZ4CodecCompress, LZ4CodecDecompress},
+        };
+    }  // namespace
+
+    const CompressionCodec* CompressionCodecs::Get(CodecId id) {
+        if (id >= std::size(kCodecs)) { return nullptr; }
+        return &kCodecs[id];
+    }
+
+    const CompressionCodec* CompressionCodecs::Find(std::string_view name) {
+        for (const auto& codec : kCodecs) {
+            if (name == codec.mName) { return &codec; }
+        }
+        return nullptr;
+    }
+
+    std::span<const CompressionCodec> CompressionCodecs::GetAll() {
+        return kCodecs;
+    }
+
+    const char* CompressionCodecs::GetName(CodecId id) {
+        const auto* codec = Get(id);
+        return codec ? codec->mName : "unknown";
+    }
+
+    std::vector<u8>
+    CompressionCodecs::Compress(CodecId id, std::span<const u8> data, const CompressionDictionary* dictionary) {
+        const auto* codec = Get(id);
+        if (!codec) { throw std::runtime_error("Unknown compression codec."); }
+        return codec->mCompress(data, dictionary);
+    }
+
+    std::vector<u8> CompressionCodecs::Decompress(CodecId id,
+                                                  std::span<const u8> data,
+                                                  size_t size,
+                                                  const CompressionDictionary* dictionary) {
+        const auto* codec = Get(id);
+        if (!codec) { throw std::runtime_error("Unknown compression codec."); }
+
+        std::vector<u8> result(size);
+        if (!codec->mDecompress(data, result, dictionary)) {
+            throw std::runtime_error("Failed to decode compressed data.");
+        }
+        return result;
+    }
+#pragma endregion
+
+#pragma region ChunkedCompression
+    std::vector<u8> ChunkedCompression::Compress(std::span<const u8> data, CodecId codec, u32 frameSize) {
+        if (frameSize == 0) { throw std::runtime_error("Frame size must be greater than zero."); }
+
+        const size_t frameCount   = (data.size() + frameSize - 1) / frameSize;
+        const size_t offsetsSize  = (frameCount + 1) * sizeof(u64);
+        const size_t headerSize   = sizeof(u32) * 2 + offsetsSize;
+        const u32 frameCountValue = CAST<u32>(frameCount);
+
+        std::vector<u8> result(headerSize);
+        std::memcpy(result.data(), &frameSize, sizeof(u32));
+        std::memcpy(result.data() + sizeof(u32), &frameCountValue, sizeof(u32));
+
+        u64 frameOffset = 0;
+        for (size_t i = 0; i < frameCount; ++i) {
+            std::memcpy(result.data() + sizeof(u32) * 2 + i * sizeof(u64), &frameOffset, sizeof(u64));
+
+            const size_t start = i * frameSize;
+            const auto frame   = CompressionCodecs::Compress(
+              codec,
+              data.subspan(start, X_MIN(CAST<size_t>(frameSize), data.size() - start)));
+            result.insert(result.end(), frame.begin(), frame.end());
+            frameOffset += frame.size();
+        }
+        std::memcpy(result.data() + sizeof(u32) * 2 + frameCount * sizeof(u64), &frameOffset, sizeof(u64));
+
+        return result;
+    }
+
+    std::vector<u8>
+    ChunkedCompression::Decompress(std::span<const u8> payload, size_t size, CodecId codec, u32 jobs) {
+        const auto* frameCodec = CompressionCodecs::Get(codec);
+        if (!frameCodec) { return {}; }
+
+        FrameIndex index;
+        if (!ReadFrameIndex(payload, size, index)) { return {}; }
+
+        // Frames are decoded on worker threads, where a throw would terminate the process, so failures are only
+        // flagged and reported once every frame is done
+        std::atomic<bool> failed {false};
+        std::vector<u8> result(size);
+        const std::span<u8> output(result);
+        ParallelFor(index.mFrameCount, jobs, [&](size_t frame) {
+            const size_t start = frame * index.mFrameSize;
+            const size_t count = X_MIN(CAST<size_t>(index.mFrameSize), size - start);
+            if (!DecompressFrame(*frameCodec, index.GetFrame(CAST<u32>(frame)), output.subspan(start, count))) {
+                failed = true;
+            }
+        });
+
+        if (failed) { return {}; }
+        return result;
+    }
+
+    std::vector<u8> ChunkedCompression::DecompressRange(std::span<const u8> payload,
+                                                        size_t size,
+                                                        CodecId codec,
+                                                        u64 offset,
+                                                        u64 count) {
+        if (offset > size || count > size - offset) { throw std::runtime_error("Range is outside of the asset."); }
+        if (count == 0) { return {}; }
+
+        const auto* frameCodec = CompressionCodecs::Get(codec);
+        if (!frameCodec) { return {}; }
+
+        FrameIndex index;
+        if (!ReadFrameIndex(payload, size, index)) { return {}; }
+
+        const u32 firstFrame = CAST<u32>(offset / index.mFrameSize);
+        const u32 lastFrame  = CAST<u32>((offset + count - 1) / index.mFrameSize);
+
+        std::vector<u8> result(count);
+        std::vector<u8> scratch(index.mFrameSize);
+        for (u32 frame = firstFrame; frame <= lastFrame; ++frame) {
+            const u64 frameStart = CAST<u64>(frame) * index.mFrameSize;
+            const u64 frameSize  = X_MIN(CAST<u64>(index.mFrameSize), size - frameStart);
+            const std::span<u8> decoded(scratch.data(), frameSize);
+            if (!DecompressFrame(*frameCodec, index.GetFrame(frame), decoded)) { return {}; }
+
+            // Copy the part of this frame that overlaps the requested range
+            const u64 copyStart = X_MAX(offset, frameStart);
+            const u64 copyEnd   = X_MIN(offset + count, frameStart + frameSize);
+            std::memcpy(result.data() + (copyStart - offset),
+                        decoded.data() + (copyStart - frameStart),
+                        copyEnd - copyStart);
+        }
+
+        return result;
+    }
+
+    std::span<const u8> ChunkedCompression::FrameIndex::GetFrame(u32 frame) const {
+        u64 start {0};
+        u64 end {0};
+        std::memcpy(&start, mOffsets.data() + frame * sizeof(u64), sizeof(u64));
+        std::memcpy(&end, mOffsets.data() + (frame + 1) * sizeof(u64), sizeof(u64));
+        return mFrames.subspan(start, end - start);
+    }
+
+    bool ChunkedCompression::ReadFrameIndex(std::span<const u8> payload, size_t size, FrameIndex& index) {
+        if (payload.size() < sizeof(u32) * 2) { return false; }
+        std::memcpy(&index.mFrameSize, payload.data(), sizeof(u32));
+        std::memcpy(&index.mFrameCount, payload.data() + sizeof(u32), sizeof(u32));
+        if (index.mFrameSize == 0) { return false; }
+        if (index.mFrameCount != (size + index.mFrameSize - 1) / index.mFrameSize) { return false; }
+
+        const size_t offsetsSize = (CAST<size_t>(index.mFrameCount) + 1) * sizeof(u64);
+        if (payload.size() - sizeof(u32) * 2 < offsetsSize) { return false; }
+        index.mOffsets = payload.subspan(sizeof(u32) * 2, offsetsSize);
+        index.mFrames  = payload.subspan(sizeof(u32) * 2 + offsetsSize);
+
+        // Offsets must be increasing and stay inside the payload, so GetFrame never needs to check them again
+        u64 previous {0};
+        for (u32 i = 0; i <= index.mFrameCount; ++i) {
+            u64 current {0};
+            std::memcpy(&current, index.mOffsets.data() + i * sizeof(u64), sizeof(u64));
+            if (current < previous || current > index.mFrames.size()) { return false; }
+            previous = current;
+        }
+
+        return true;
+    }
+
+    bool ChunkedCompression::DecompressFrame(const CompressionCodec& codec,
+                                             std::span<const u8> frame,
+                                             std::span<u8> output) {
+        return codec.mDecompress(frame, output, nullptr);
+    }
+#pragma endregion
+}  // namespace x
@@ -5,15 +5,143 @@
 #pragma once
 
 #include "Common/Typedefs.hpp"
+#include "Common/Macros.hpp"
+#include <mutex>
 #include <span>
+#include <string_view>
 #include <brotli/encode.h>
 
 namespace x {
+    using CodecId = u8;
+
+    static constexpr CodecId kCodec_None   = 0;  // Stored as-is
+    static constexpr CodecId kCodec_Brotli = 1;  // Best ratio, slowest to decode
+    static constexpr CodecId kCodec_LZ4    = 2;  // Lower ratio, decodes several times faster than Brotli
+
+    /// @brief A dictionary shared by many small, similar payloads (e.g. XML descriptors). Each payload is compressed as
+    /// if the dictionary came right before it, so content common to all of them costs almost nothing to store.
+    class CompressionDictionary {
+    public:
+        static constexpr size_t kDefaultMaxSize = 32 * 1024;  // Must stay within LZ4's 64 KB match distance
+
+        CompressionDictionary() = default;
+        explicit CompressionDictionary(std::vector<u8> data);
+        ~CompressionDictionary();
+
+        CompressionDictionary(const CompressionDictionary&)            = delete;
+        CompressionDictionary& operator=(const CompressionDictionary&) = delete;
+
+        /// @brief Picks the segments shared by the most samples, best ones last (closest to the data being compressed).
+        /// Returns an empty dictionary when the samples have nothing worth sharing.
+        static std::vector<u8> Train(std::span<const std::vector<u8>> samples, size_t maxSize = kDefaultMaxSize);
+
+        X_NODISCARD std::span<const u8> GetData() const;
+        X_NODISCARD bool IsEmpty() const;
+        X_NODISCARD u64 GetHash() const;
+
+        /// @brief Brotli needs the dictionary pre-processed before it can compress against it. This is done once, on
+        /// first use, and is safe to call from multiple threads.
+        X_NODISCARD const BrotliEncoderPreparedDictionary* GetBrotliDictionary() const;
+
+    private:
+        std::vector<u8> mData;
+        u64 mHash {0};
+        mutable std::once_flag mBrotliOnce;
+        mutable BrotliEncoderPreparedDictionary* mBrotliDictionary {nullptr};
+    };
+
     class BrotliCompression {
     public:
         static std::vector<u8> Compress(std::span<const u8> data,
                                         int quality    = BROTLI_DEFAULT_QUALITY,
                                         int windowSize = BROTLI_DEFAULT_WINDOW);
+        static std::vector<u8> Compress(std::span<const u8> data,
+                                        const CompressionDictionary& dictionary,
+                                        int quality    = BROTLI_DEFAULT_QUALITY,
+                                        int windowSize = BROTLI_DEFAULT_WINDOW);
         static std::vector<u8> Decompress(std::span<const u8> data, size_t expectedSize = 0);
+
+        /// @brief Decodes into `output`, which must be exactly the original size. `dictionary` must be the same data
+        /// the payload was compressed against, or empty.
+        static bool Decompress(std::span<const u8> data, std::span<u8> output, std::span<const u8> dictionary);
+    };
+
+    /// @brief Self-contained implementation of the LZ4 block format (no frame format, no external dependency). The
+    /// compressor is a simple greedy single-probe matcher; decode speed is the point, not ratio.
+    ///
+    /// A dictionary is treated as a prefix of the block, so matches can reach back into its last 64 KB.
+    class LZ4Compression {
+    public:
+        static std::vector<u8> Compress(std::span<const u8> data, std::span<const u8> dictionary = {});
+
+        /// @brief Decodes a block into `output`, which must be exactly the original size. Returns false on corrupt or
+        /// truncated input without ever reading or writing out of bounds.
+        static bool Decompress(std::span<const u8> data, std::span<u8> output, std::span<const u8> dictionary = {});
+        static std::vector<u8> Decompress(std::span<const u8> data, size_t size);
+    };
+
+    struct CompressionCodec {
+        CodecId mId {kCodec_None};
+        const char* mName {nullptr};
+        // The dictionary may be null
+        std::vector<u8> (*mCompress)(std::span<const u8> data, const CompressionDictionary* dictionary) {nullptr};
+        // Decodes into a buffer of exactly the original size, returns false on failure
+        bool (*mDecompress)(std::span<const u8> data,
+                            std::span<u8> output,
+                            const CompressionDictionary* dictionary) {nullptr};
+    };
+
+    /// @brief Registry of every codec the pak format knows about. Codec ids are stored in the pak, so existing ids must
+    /// never be renumbered.
+    class CompressionCodecs {
+    public:
+        X_NODISCARD static const CompressionCodec* Get(CodecId id);
+        X_NODISCARD static const CompressionCodec* Find(std::string_view name);
+        X_NODISCARD static std::span<const CompressionCodec> GetAll();
+        X_NODISCARD static const char* GetName(CodecId id);
+
+        static std::vector<u8>
+        Compress(CodecId id, std::span<const u8> data, const CompressionDictionary* dictionary = nullptr);
+        static std::vector<u8> Decompress(CodecId id,
+                                          std::span<const u8> data,
+                                          size_t size,
+                                          const CompressionDictionary* dictionary = nullptr);
+    };
+
+    /// @brief Compression split into independently compressed, fixed-size frames so any byte range can be decoded
+    /// without touching the rest of the asset, and frames can be decoded in parallel. Every frame uses the same codec.
+    ///
+    /// Payload layout:
+    ///   Frame size (uncompressed): 32-bit unsigned
+    ///   Frame count: 32-bit unsigned
+    ///   Frame offsets: (frame count + 1) x 64-bit unsigned, relative to the start of the frame data
+    ///   [Frame data]
+    class ChunkedCompression {
+    public:
+        static constexpr u32 kDefaultFrameSize = 256 * 1024;
+
+        static std::vector<u8> Compress(std::span<const u8> data, CodecId codec, u32 frameSize = kDefaultFrameSize);
+
+        /// @brief Decodes the whole payload across up to `jobs` threads (0 = one per core). Returns empty if the payload
+        /// is corrupt, including when a single frame fails to decode.
+        static std::vector<u8> Decompress(std::span<const u8> payload, size_t size, CodecId codec, u32 jobs = 0);
+
+        /// @brief Decodes only the frames overlapping [offset, offset + count) and returns that range. Returns empty if
+        /// any of those frames are corrupt, throws if the range is outside of the asset.
+        static std::vector<u8>
+        DecompressRange(std::span<const u8> payload, size_t size, CodecId codec, u64 offset, u64 count);
+
+    private:
+        struct FrameIndex {
+            u32 mFrameSize {0};
+            u32 mFrameCount {0};
+            std::span<const u8> mOffsets;
+            std::span<const u8> mFrames;
+
+            X_NODISCARD std::span<const u8> GetFrame(u32 frame) const;
+        };
+
+        static bool ReadFrameIndex(std::span<const u8> payload, size_t size, FrameIndex& index);
+        static bool DecompressFrame(const CompressionCodec& codec, std::span<const u8> frame, std::span<u8> output);
     };
 }  // namespace x
@@ -0,0 +1,375 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "CompressionSelfTest.hpp"
+#include "Compression.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+
+namespace x {
+    namespace {
+        constexpr size_t kWindowSize = 65535;  // Largest offset an LZ4 match can encode
+
+        // Inputs are generated rather than stored, so they have to come out the same on every platform
+        class TestRandom {
+        public:
+            explicit TestRandom(u32 seed) : mState(seed) {}
+
+            u32 Next() {
+                mState ^= mState << 13;
+                mState ^= mState >> 17;
+                mState ^= mState << 5;
+                return mState;
+            }
+
+        private:
+            u32 mState;
+        };
+
+        std::vector<u8> MakeNoise(size_t size, u32 seed) {
+            TestRandom random(seed);
+            std::vector<u8> data(size);
+            for (auto& byte : data) {
+                byte = CAST<u8>(random.Next());
+            }
+            return data;
+        }
+
+        // Compresses about as well as a descriptor does
+        std::vector<u8> MakePhrases(size_t size, u32 seed) {
+            static constexpr const char* kWords[] =
+              {"asset", "mesh", "texture", "scene", "material", "entity", "transform", "<Component>"};
+            TestRandom random(seed);
+            std::vector<u8> data;
+            while (data.size() < size) {
+                const char* word = kWords[random.Next() % std::size(kWords)];
+                data.insert(data.end(), word, word + std::strlen(word));
+                data.push_back(' ');
+            }
+            data.resize(size);
+            return data;
+        }
+
+        std::vector<u8> Concat(std::initializer_list<std::vector<u8>> parts) {
+            std::vector<u8> data;
+            for (const auto& part : parts) {
+                data.insert(data.end(), part.begin(), part.end());
+            }
+            return data;
+        }
+
+        std::vector<u8> Fill(size_t size, u8 value) {
+            return std::vector<u8>(size, value);
+        }
+
+        // 16 random bytes at the very start and again `distance` bytes later, with nothing in between that could
+        // match them. A match that far back has to be found for this to compress.
+        std::vector<u8> MakeDistantRepeat(size_t distance, u32 seed) {
+            const auto marker = MakeNoise(16, seed);
+            return Concat({marker, Fill(distance - marker.size(), 'a'), marker, Fill(40, 'b')});
+        }
+
+        // Made by lz4 1.9.4's LZ4_compress_default (LZ4_loadDict + LZ4_compress_fast_continue for the dictionary one)
+        // from the inputs in SelfTest::RunReferenceBlocks
+        static constexpr u8 kReferencePhrases[] = {
+          0x51, 0x6D, 0x65, 0x73, 0x68, 0x20, 0x05, 0x00, 0xF2, 0x03, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79,
+          0x20, 0x3C, 0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3E, 0x18, 0x00, 0xD5, 0x61,
+          0x73, 0x73, 0x65, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x08, 0x00, 0x03, 0x2E,
+          0x00, 0xE9, 0x6D, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6C, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65,
+          0x3D, 0x00, 0x05, 0x32, 0x00, 0x85, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x34, 0x00,
+          0x00, 0x73, 0x00, 0x02, 0x56, 0x00, 0x02, 0x06, 0x00, 0x01, 0x7F, 0x00, 0x01, 0x05, 0x00, 0x02,
+          0x46, 0x00, 0x07, 0x0B, 0x00, 0x08, 0x8E, 0x00, 0x04, 0x51, 0x00, 0x01, 0x1F, 0x00, 0x04, 0x4C,
+          0x00, 0x0A, 0x80, 0x00, 0x06, 0x6C, 0x00, 0x08, 0x39, 0x00, 0x05, 0xA5, 0x00, 0x01, 0x3A, 0x00,
+          0x02, 0x74, 0x00, 0x02, 0x06, 0x00, 0x05, 0x1A, 0x00, 0x04, 0x5C, 0x00, 0x05, 0x08, 0x00, 0x0F,
+          0x49, 0x00, 0x03, 0x00, 0xBA, 0x00, 0x04, 0x23, 0x00, 0x02, 0xAC, 0x00, 0x08, 0x68, 0x00, 0x08,
+          0x0C, 0x00, 0x01, 0x6B, 0x00, 0x0C, 0xA5, 0x00, 0x03, 0x10, 0x00, 0x03, 0x07, 0x00, 0x02, 0x41,
+          0x00, 0x02, 0x06, 0x00, 0x05, 0x89, 0x00, 0x03, 0x1C, 0x00, 0x05, 0x10, 0x00, 0x0F, 0x09, 0x00,
+          0x08, 0x02, 0x3A, 0x00, 0x03, 0x31, 0x00, 0x03, 0x07, 0x00, 0x06, 0x01, 0x01, 0x02, 0xE1, 0x00,
+          0x08, 0x93, 0x00, 0x02, 0x12, 0x00, 0x02, 0x06, 0x00, 0x90, 0x6D, 0x61, 0x74, 0x65, 0x72, 0x69,
+          0x61, 0x6C, 0x20,
+        };
+        static constexpr u8 kReferenceRuns[] = {
+          0xFF, 0xFF, 0x03, 0x42, 0x02, 0x82, 0x06, 0x1A, 0x23, 0x59, 0xB6, 0x2A, 0x3B, 0xCA, 0x3D, 0x09,
+          0x24, 0x3E, 0xFE, 0xBF, 0xFF, 0x35, 0x9B, 0x88, 0xE8, 0x8A, 0x99, 0xE7, 0x64, 0x04, 0x35, 0x20,
+          0xD9, 0xC3, 0x77, 0xD1, 0x7B, 0x3D, 0x6A, 0x22, 0xA7, 0xE5, 0xDD, 0x54, 0x85, 0x15, 0xB6, 0x22,
+          0x03, 0x5C, 0x34, 0x4C, 0xF3, 0x9A, 0x70, 0x4C, 0xAA, 0xF7, 0x83, 0x60, 0x79, 0x91, 0xF9, 0xCD,
+          0x8F, 0x7C, 0xC2, 0x26, 0x30, 0x82, 0x56, 0x19, 0x8D, 0xE7, 0x73, 0xDC, 0x9E, 0x35, 0x3B, 0x5D,
+          0x9A, 0xD1, 0xD6, 0x0C, 0xA2, 0x43, 0xAA, 0xDD, 0x83, 0x53, 0x51, 0xEF, 0x8E, 0x58, 0xB7, 0xFF,
+          0xB2, 0x40, 0x42, 0x4D, 0x48, 0x3D, 0xC7, 0xBF, 0x2B, 0xED, 0x44, 0x81, 0x57, 0x0A, 0x90, 0xC7,
+          0x11, 0xAD, 0x08, 0xF5, 0x27, 0xE4, 0x12, 0x99, 0x79, 0x72, 0xE3, 0x55, 0xD5, 0xE7, 0x9B, 0x15,
+          0x5C, 0x41, 0xE9, 0x63, 0x9F, 0x9D, 0xB0, 0x3A, 0x6B, 0xDD, 0x42, 0x7A, 0x79, 0x17, 0x9E, 0x2E,
+          0x36, 0xA6, 0xD2, 0x19, 0x08, 0xA8, 0x64, 0xF8, 0xA2, 0x17, 0xCE, 0xFC, 0xAE, 0xC5, 0x25, 0x39,
+          0x4C, 0x2E, 0x4D, 0x2D, 0x80, 0x8F, 0x38, 0xFE, 0x81, 0x07, 0x53, 0x36, 0x8A, 0x0B, 0x3E, 0x46,
+          0x18, 0xB2, 0x0A, 0x8B, 0xAC, 0xCF, 0xE1, 0xAF, 0x8C, 0xC6, 0xE6, 0xE7, 0xD0, 0xB4, 0xB7, 0x85,
+          0x5B, 0xDE, 0xF6, 0xB9, 0x92, 0x42, 0x73, 0x58, 0xE0, 0xBA, 0x3B, 0x05, 0x4D, 0x17, 0x16, 0x5E,
+          0x4C, 0xC9, 0xA6, 0xAE, 0x82, 0xFE, 0x58, 0x58, 0x10, 0x7F, 0x49, 0x74, 0x80, 0x5D, 0xF4, 0x29,
+          0x67, 0x83, 0x44, 0x4D, 0x27, 0x5B, 0x16, 0x77, 0xA0, 0x1E, 0xC2, 0x1F, 0x4C, 0x68, 0xD5, 0xD3,
+          0x40, 0xF5, 0x76, 0x2B, 0x1B, 0x09, 0x99, 0x00, 0xE1, 0xE9, 0xE0, 0x6E, 0x99, 0x90, 0xBB, 0x9C,
+          0xD3, 0x73, 0xEE, 0xF6, 0x48, 0xD0, 0x1D, 0xD0, 0x77, 0x66, 0xE1, 0x05, 0xAA, 0x44, 0xE3, 0xE0,
+          0xE4, 0x2A, 0x2A, 0x2A, 0x03, 0x00, 0xFF, 0xFF, 0x3F, 0x50, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+        };
+        static constexpr u8 kReferenceWindow[] = {
+          0xFF, 0x02, 0x63, 0x03, 0x47, 0x49, 0xCB, 0xF3, 0x43, 0x04, 0x0F, 0x4F, 0x01, 0x0A, 0x83, 0x8A,
+          0xCB, 0x4F, 0x61, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+          0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x0C, 0xFF, 0xFF, 0x1F, 0x62, 0x01, 0x00, 0x0F, 0x50, 0x62,
+          0x62, 0x62, 0x62, 0x62,
+        };
+        static constexpr u8 kReferenceDictionary[] = {
+          0x0C, 0xFF, 0xFF, 0x1F, 0x63, 0x01, 0x00, 0x28, 0x73, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x20,
+          0x07, 0x00, 0xA4, 0x6D, 0x65, 0x73, 0x68, 0x20, 0x73, 0x63, 0x65, 0x6E, 0x65, 0x12, 0x00, 0xB3,
+          0x3C, 0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x3E, 0x19, 0x00, 0x01, 0x24, 0x00,
+          0x08, 0x30, 0x00, 0x08, 0x23, 0x00, 0x01, 0x1D, 0x00, 0x01, 0x05, 0x00, 0x73, 0x74, 0x65, 0x78,
+          0x74, 0x75, 0x72, 0x65, 0x35, 0x00, 0x02, 0x54, 0x00, 0x04, 0x14, 0x00, 0x08, 0x3E, 0x00, 0x59,
+          0x61, 0x73, 0x73, 0x65, 0x74, 0x06, 0x00, 0x01, 0x3F, 0x00, 0x01, 0x05, 0x00, 0x02, 0x36, 0x00,
+          0x01, 0x0B, 0x00, 0x02, 0x21, 0x00, 0x04, 0x41, 0x00, 0x04, 0x08, 0x00, 0xA0, 0x61, 0x73, 0x73,
+          0x65, 0x74, 0x20, 0x74, 0x72, 0x61, 0x6E,
+        };
+
+        struct BlockInfo {
+            size_t mMaxOffset {0};
+        };
+
+        // Walks a block the way the reference decoder (LZ4_decompress_safe) does and checks the end of block rules it
+        // enforces on top of the format itself: the last sequence is literals only and covers at least the last 5
+        // bytes, and no match starts within the last 12 bytes. Blocks breaking them decode here but not there.
+        bool CheckBlockRules(std::span<const u8> block, size_t size, size_t dictionarySize, BlockInfo& info) {
+            constexpr size_t kLastLiterals = 5;
+            constexpr size_t kMatchLimit   = 12;
+
+            const auto readLength = [&block](size_t& pos, size_t& length) {
+                u8 byte;
+                do {
+                    if (pos >= block.size()) { return false; }
+                    byte = block[pos++];
+                    length += byte;
+                } while (byte == 255);
+                return true;
+            };
+
+            size_t pos {0};
+            size_t written {0};
+            while (pos < block.size()) {
+                const u8 token = block[pos++];
+
+                size_t literals = token >> 4;
+                if (literals == 15 && !readLength(pos, literals)) { return false; }
+                if (literals > block.size() - pos || literals > size - written) { return false; }
+                pos += literals;
+                written += literals;
+
+                if (pos == block.size()) { return written == size && literals >= X_MIN(size, kLastLiterals); }
+
+                if (block.size() - pos < 2) { return false; }
+                const size_t offset = block[pos] | (CAST<size_t>(block[pos + 1]) << 8);
+                pos += 2;
+                if (offset == 0 || offset > written + X_MIN(dictionarySize, kWindowSize)) { return false; }
+                if (written + kMatchLimit > size) { return false; }
+                info.mMaxOffset = X_MAX(info.mMaxOffset, offset);
+
+                size_t length = token & 0x0F;
+                if (length == 15 && !readLength(pos, length)) { return false; }
+                length += 4;
+                if (length > size - written - kLastLiterals) { return false; }
+                written += length;
+            }
+
+            return false;  // Ran out of input before the last literals
+        }
+
+        class SelfTest {
+        public:
+            // Blocks from the reference encoder have to decode to their inputs
+            void RunReferenceBlocks() {
+                const auto marker     = MakeNoise(16, 3);
+                const auto dictionary = Concat({MakeNoise(100, 4), marker, Fill(kWindowSize - 16, 'a')});
+
+                ExpectReferenceBlock(kReferencePhrases, MakePhrases(512, 1), {}, "phrases");
+                ExpectReferenceBlock(kReferenceRuns, Concat({MakeNoise(270, 2), Fill(600, 0x2A)}), {}, "long runs");
+                ExpectReferenceBlock(kReferenceWindow, MakeDistantRepeat(kWindowSize, 3), {}, "64 KB match");
+                ExpectReferenceBlock(kReferenceDictionary,
+                                     Concat({marker, Fill(60, 'c'), MakePhrases(200, 5)}),
+                                     dictionary,
+                                     "64 KB dictionary match");
+            }
+
+            // Every codec has to round-trip, and LZ4 blocks have to be ones the reference decoder accepts
+            void RunRoundTrips() {
+                for (const size_t size : {0, 1, 5, 12, 13, 17, 4096, 65535, 65536, 65537, 300000}) {
+                    ExpectRoundTrip(MakeNoise(size, 10), {}, "noise");
+                    ExpectRoundTrip(MakePhrases(size, 11), {}, "phrases");
+                    ExpectRoundTrip(Fill(size, 0), {}, "zeros");
+                }
+
+                // A repeat exactly at the window's edge is matched, one byte further it can't be
+                ExpectRoundTrip(MakeDistantRepeat(kWindowSize - 1, 12), {}, "repeat within the window");
+                ExpectRoundTrip(MakeDistantRepeat(kWindowSize + 1, 12), {}, "repeat past the window");
+                ExpectMaxOffset(MakeDistantRepeat(kWindowSize, 12), {}, kWindowSize, "repeat at the window's edge");
+
+                // Dictionaries smaller than, exactly and larger than the window, only the last 64 KB is reachable
+                for (const size_t size : std::initializer_list<size_t> {1, 16, kWindowSize, kWindowSize + 1, 100000}) {
+                    const auto dictionary = MakePhrases(size, 14);
+                    ExpectRoundTrip({}, dictionary, "empty with dictionary");
+                    ExpectRoundTrip(MakePhrases(3000, 15), dictionary, "phrases with dictionary");
+                    ExpectRoundTrip(MakeNoise(3000, 16), dictionary, "noise with dictionary");
+                    ExpectRoundTrip(Concat({dictionary, MakeNoise(20, 17)}), dictionary, "dictionary repeated");
+                }
+
+                // Matches reaching back to the first byte of a full window dictionary, and to one byte past it
+                const auto marker = MakeNoise(16, 13);
+                const auto edge   = Concat({marker, Fill(kWindowSize - 16, 'a')});
+                ExpectMaxOffset(Concat({marker, Fill(60, 'c')}), edge, kWindowSize, "dictionary's first byte");
+                ExpectRoundTrip(Concat({marker, Fill(60, 'c')}), Concat({edge, Fill(1, 'a')}), "past the dictionary");
+            }
+
+            // Corrupt blocks have to be rejected without touching memory outside the input, output or dictionary
+            void RunCorruptBlocks() {
+                const auto dictionary = MakePhrases(1000, 20);
+                const auto data       = Concat({MakePhrases(20000, 21), MakeNoise(500, 22)});
+                const auto block      = LZ4Compression::Compress(data, dictionary);
+                std::vector<u8> output(data.size());
+
+                // Every truncation is missing something the output needs
+                bool truncatedRejected = true;
+                for (size_t size = 0; size < block.size(); ++size) {
+                    truncatedRejected &= !LZ4Compression::Decompress(std::span(block).first(size), output, dictionary);
+                }
+                Expect(truncatedRejected, "truncated blocks are rejected", "phrases");
+
+                std::vector<u8> shorter(data.size() - 1);
+                std::vector<u8> longer(data.size() + 1);
+                Expect(!LZ4Compression::Decompress(block, shorter, dictionary), "short output is rejected", "phrases");
+                Expect(!LZ4Compression::Decompress(block, longer, dictionary), "long output is rejected", "phrases");
+                Expect(!LZ4Compression::Decompress(block, output), "missing dictionary is rejected", "phrases");
+
+                // Hand-made blocks, each sized so the output length isn't what rejects it: offset 0, a match reaching
+                // back before the output (and before a 1 byte dictionary), a match running past the end of the output
+                // and literals running past the end of the input
+                const std::vector<u8> zeroOffset {0x10, 'a', 0x00, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f'};
+                const std::vector<u8> beforeOutput {0x40, 'a', 'b', 'c', 'd', 0x06, 0x00, 0x50, 'e', 'f', 'g', 'h', 'i'};
+                const std::vector<u8> pastOutput {0x40, 'a', 'b', 'c', 'd', 0x04, 0x00, 0x50, 'e', 'f', 'g', 'h', 'i'};
+                const std::vector<u8> longLiterals {0xF0, 0xFF, 0xFF, 0xFF, 0x01, 'a'};
+                std::vector<u8> craftedOutput(13);
+                std::vector<u8> literalsOutput(15 + 255 * 3 + 1);
+                Expect(!LZ4Compression::Decompress(zeroOffset, std::span(craftedOutput).first(10)),
+                       "zero offset is rejected",
+                       "crafted");
+                Expect(!LZ4Compression::Decompress(beforeOutput, craftedOutput),
+                       "offset before output is rejected",
+                       "crafted");
+                Expect(!LZ4Compression::Decompress(beforeOutput, craftedOutput, Fill(1, 'z')),
+                       "offset before dictionary is rejected",
+                       "crafted");
+                Expect(LZ4Compression::Decompress(beforeOutput, craftedOutput, Fill(2, 'z')),
+                       "offset into dictionary is accepted",
+                       "crafted");
+                Expect(!LZ4Compression::Decompress(pastOutput, std::span(craftedOutput).first(12)),
+                       "match past output is rejected",
+                       "crafted");
+                Expect(!LZ4Compression::Decompress(longLiterals, literalsOutput),
+                       "literals past input are rejected",
+                       "crafted");
+
+                // Random damage only has to be survived, not necessarily detected
+                TestRandom random(23);
+                for (u32 i = 0; i < 20000; ++i) {
+                    auto damaged = block;
+                    damaged[random.Next() % damaged.size()] ^= CAST<u8>(1u << (random.Next() % 8));
+                    (void)LZ4Compression::Decompress(damaged, output, dictionary);
+                    (void)LZ4Compression::Decompress(damaged, output);
+                }
+                for (u32 i = 0; i < 20000; ++i) {
+                    const auto garbage = MakeNoise(random.Next() % 64, random.Next());
+                    std::vector<u8> garbageOutput(random.Next() % 256);
+                    (void)LZ4Compression::Decompress(garbage, garbageOutput, dictionary);
+                }
+            }
+
+            bool Report() const {
+                if (mFailures > 0) {
+                    printf(" - %zu of %zu check(s) failed\n", mFailures, mChecks);
+                    return false;
+                }
+                printf(" - All %zu check(s) passed\n", mChecks);
+                return true;
+            }
+
+        private:
+            size_t mChecks {0};
+            size_t mFailures {0};
+
+            void Expect(bool passed, const char* check, const char* name) {
+                mChecks++;
+                if (passed) { return; }
+                mFailures++;
+                printf("FAILED: %s (%s)\n", check, name);
+            }
+
+            void ExpectReferenceBlock(std::span<const u8> block,
+                                      const std::vector<u8>& data,
+                                      const std::vector<u8>& dictionary,
+                                      const char* name) {
+                std::vector<u8> output(data.size());
+                Expect(LZ4Compression::Decompress(block, output, dictionary) && output == data,
+                       "reference block decodes",
+                       name);
+
+                // Keeps CheckBlockRules honest, it has to accept what the reference encoder makes
+                BlockInfo info;
+                Expect(CheckBlockRules(block, data.size(), dictionary.size(), info), "reference block rules", name);
+            }
+
+            void ExpectRoundTrip(const std::vector<u8>& data, const std::vector<u8>& dictionary, const char* name) {
+                const CompressionDictionary shared(dictionary);
+                const auto* codecDictionary = dictionary.empty() ? nullptr : &shared;
+                for (const auto& codec : CompressionCodecs::GetAll()) {
+                    const auto packed = codec.mCompress(data, codecDictionary);
+                    std::vector<u8> output(data.size());
+                    Expect(codec.mDecompress(packed, output, codecDictionary) && output == data, codec.mName, name);
+                }
+
+                BlockInfo info;
+                const auto block = LZ4Compression::Compress(data, dictionary);
+                Expect(CheckBlockRules(block, data.size(), dictionary.size(), info), "lz4 block rules", name);
+            }
+
+            void ExpectMaxOffset(const std::vector<u8>& data,
+                                 const std::vector<u8>& dictionary,
+                                 size_t offset,
+                                 const char* name) {
+                ExpectRoundTrip(data, dictionary, name);
+
+                BlockInfo info;
+                const auto block = LZ4Compression::Compress(data, dictionary);
+                Expect(CheckBlockRules(block, data.size(), dictionary.size(), info) && info.mMaxOffset == offset,
+                       "lz4 match at the window's edge",
+                       name);
+            }
+        };
+    }  // namespace
+
+    bool CompressionSelfTest::Run() {
+        SelfTest test;
+        test.RunReferenceBlocks();
+        test.RunRoundTrips();
+        test.RunCorruptBlocks();
+        return test.Report();
+    }
+}  // namespace x
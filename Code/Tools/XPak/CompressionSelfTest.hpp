@@ -0,0 +1,22 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Common/Macros.hpp"
+#include "Common/Typedefs.hpp"
+
+namespace x {
+    /// @brief Checks the codecs against known-good data, run with `xpakc selftest`:
+    ///   - Blocks made by the reference LZ4 encoder (lz4 1.9.4) decode to their inputs, with and without a dictionary
+    ///   - LZ4 blocks made here follow the rules the reference decoder enforces, so they decode with it too
+    ///   - Every codec round-trips data around LZ4's 64 KB window and dictionary edges
+    ///   - Truncated and corrupt LZ4 blocks are rejected. That they never read or write out of bounds is only proven
+    ///     under a sanitizer, so run it under one after touching the decoder.
+    class CompressionSelfTest {
+    public:
+        /// @brief Prints every failure, returns false if there were any.
+        static bool Run();
+    };
+}  // namespace x
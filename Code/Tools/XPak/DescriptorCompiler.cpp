@@ -0,0 +1,256 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "DescriptorCompiler.hpp"
+#include "Common/XML.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace x {
+    class StringTableBuilder {
+    public:
+        BinaryString Add(const str& string) {
+            const BinaryString slice {CAST<u32>(mData.size()), CAST<u32>(string.size())};
+            mData.insert(mData.end(), string.begin(), string.end());
+            return slice;
+        }
+
+        X_NODISCARD const vector<u8>& GetData() const {
+            return mData;
+        }
+
+    private:
+        vector<u8> mData;
+    };
+
+    // Same as XML::GetAttrStr, but a missing attribute is an empty string rather than a crash
+    static str GetAttrStr(const rapidxml::xml_attribute<>* attr) {
+        return attr ? XML::GetAttrStr(attr) : str {};
+    }
+
+    static void GetAttrColor(const rapidxml::xml_node<>* node, f32* color) {
+        if (!node) { return; }
+        color[0] = XML::GetAttrFloat(node->first_attribute("r"));
+        color[1] = XML::GetAttrFloat(node->first_attribute("g"));
+        color[2] = XML::GetAttrFloat(node->first_attribute("b"));
+    }
+
+    static void GetAttrFloat3(const rapidxml::xml_node<>* node, f32* value) {
+        const Float3 float3 = XML::GetAttrFloat3(node);
+        value[0]            = float3.x;
+        value[1]            = float3.y;
+        value[2]            = float3.z;
+    }
+
+    // rapidxml needs a mutable, null-terminated copy to parse
+    static bool ReadDocument(std::span<const u8> xml, vector<char>& buffer, rapidxml::xml_document<>& doc) {
+        if (xml.empty()) { return false; }
+        buffer.assign(xml.begin(), xml.end());
+        buffer.push_back('\0');
+        return XML::ReadBytes(buffer.data(), buffer.size(), doc);
+    }
+
+    // Header, fixed-size records, then the string table
+    template<typename Header, typename Record>
+    static vector<u8> Assemble(const Header& header, const vector<Record>& records, const StringTableBuilder& strings) {
+        const auto& table = strings.GetData();
+        vector<u8> data(sizeof(Header) + records.size() * sizeof(Record) + table.size());
+
+        u8* out = data.data();
+        std::memcpy(out, &header, sizeof(Header));
+        out += sizeof(Header);
+        std::memcpy(out, records.data(), records.size() * sizeof(Record));
+        out += records.size() * sizeof(Record);
+        std::memcpy(out, table.data(), table.size());
+
+        return data;
+    }
+
+    static bool CompileWorld(const rapidxml::xml_node<>* worldNode, BinarySceneHeader& header) {
+        const auto* lightsNode = worldNode->first_node("Lights");
+        if (!lightsNode) {
+            std::cerr << "Scene->World->Lights node not found" << std::endl;
+            return false;
+        }
+
+        const auto* sunNode = lightsNode->first_node("Sun");
+        if (!sunNode) {
+            std::cerr << "Scene->World->Lights->Sun node not found" << std::endl;
+            return false;
+        }
+
+        header.mSunEnabled      = XML::GetNodeBool(sunNode, "Enabled") ? 1 : 0;
+        header.mSunIntensity    = XML::GetNodeF32(sunNode, "Intensity");
+        header.mSunCastsShadows = XML::GetNodeBool(sunNode, "CastsShadows") ? 1 : 0;
+        GetAttrColor(sunNode->first_node("Color"), header.mSunColor);
+        GetAttrFloat3(sunNode->first_node("Direction"), header.mSunDirection);
+
+        const auto* skyNode = worldNode->first_node("Sky");
+        if (!skyNode) {
+            std::cerr << "Scene->World->Sky node not found" << std::endl;
+            return false;
+        }
+        GetAttrColor(skyNode->first_node("Color"), header.mSkyColor);
+
+        return true;
+    }
+
+    static bool CompileEntities(const rapidxml::xml_node<>* entitiesNode,
+                                vector<BinaryEntity>& entities,
+                                StringTableBuilder& strings) {
+        for (const auto* entity = entitiesNode->first_node("Entity"); entity; entity = entity->next_sibling()) {
+            BinaryEntity record;
+
+            const auto* idAttr = entity->first_attribute("id");
+            if (!idAttr) {
+                std::cerr << "Scene->Entities->Entity is missing its id" << std::endl;
+                return false;
+            }
+            record.mId   = std::stoull(idAttr->value());
+            record.mName = strings.Add(GetAttrStr(entity->first_attribute("name")));
+
+            const auto* componentsNode = entity->first_node("Components");
+            if (!componentsNode) {
+                std::cerr << "Scene->Entities->Entity->Components node not found" << std::endl;
+                return false;
+            }
+
+            const auto* transformNode = componentsNode->first_node("Transform");
+            if (!transformNode) {
+                std::cerr << "Scene->Entities->Entity->Components->Transform node not found" << std::endl;
+                return false;
+            }
+            GetAttrFloat3(transformNode->first_node("Position"), record.mPosition);
+            GetAttrFloat3(transformNode->first_node("Rotation"), record.mRotation);
+            GetAttrFloat3(transformNode->first_node("Scale"), record.mScale);
+
+            if (const auto* modelNode = componentsNode->first_node("Model")) {
+                record.mComponents |= kBinaryEntity_Model;
+                record.mMeshId     = XML::GetAttrId(modelNode->first_node("Mesh"));
+                record.mMaterialId = XML::GetAttrId(modelNode->first_node("Material"));
+                if (XML::GetNodeBool(modelNode, "CastsShadows")) { record.mModelFlags |= kBinaryModel_CastsShadows; }
+                if (XML::GetNodeBool(modelNode, "ReceiveShadows")) {
+                    record.mModelFlags |= kBinaryModel_ReceiveShadows;
+                }
+            }
+
+            if (const auto* cameraNode = componentsNode->first_node("Camera")) {
+                record.mComponents |= kBinaryEntity_Camera;
+                record.mCameraFOV          = XML::GetNodeF32(cameraNode, "FOV");
+                record.mCameraNearZ        = XML::GetNodeF32(cameraNode, "NearZ");
+                record.mCameraFarZ         = XML::GetNodeF32(cameraNode, "FarZ");
+                record.mCameraOrthographic = XML::GetNodeBool(cameraNode, "Orthographic") ? 1 : 0;
+                record.mCameraWidth        = XML::GetNodeF32(cameraNode, "Width");
+                record.mCameraHeight       = XML::GetNodeF32(cameraNode, "Height");
+            }
+
+            if (const auto* behaviorNode = componentsNode->first_node("Behavior")) {
+                record.mComponents |= kBinaryEntity_Behavior;
+                record.mScriptId = XML::GetAttrId(behaviorNode->first_node("Script"));
+            }
+
+            entities.push_back(record);
+        }
+
+        return true;
+    }
+
+    vector<u8> DescriptorCompiler::CompileScene(std::span<const u8> xml) {
+        vector<char> buffer;
+        rapidxml::xml_document<> doc;
+        if (!ReadDocument(xml, buffer, doc)) { return {}; }
+
+        const auto* sceneNode = doc.first_node("Scene");
+        if (!sceneNode) {
+            std::cerr << "Scene node not found" << std::endl;
+            return {};
+        }
+
+        BinarySceneHeader header;
+        StringTableBuilder strings;
+        vector<BinaryEntity> entities;
+
+        try {
+            header.mName        = strings.Add(GetAttrStr(sceneNode->first_attribute("name")));
+            header.mDescription = strings.Add(GetAttrStr(sceneNode->first_attribute("description")));
+
+            const auto* worldNode = sceneNode->first_node("World");
+            if (!worldNode) {
+                std::cerr << "Scene->World node not found" << std::endl;
+                return {};
+            }
+            if (!CompileWorld(worldNode, header)) { return {}; }
+
+            const auto* entitiesNode = sceneNode->first_node("Entities");
+            if (!entitiesNode) {
+                std::cerr << "Scene->Entities node not found" << std::endl;
+                return {};
+            }
+            if (!CompileEntities(entitiesNode, entities, strings)) { return {}; }
+        } catch (const std::exception& e) {
+            // Malformed numbers or IDs
+            std::cerr << "Failed to compile scene: " << e.what() << std::endl;
+            return {};
+        }
+
+        header.mEntityCount     = CAST<u32>(entities.size());
+        header.mStringTableSize = CAST<u32>(strings.GetData().size());
+        return Assemble(header, entities, strings);
+    }
+
+    vector<u8> DescriptorCompiler::CompileMaterial(std::span<const u8> xml) {
+        vector<char> buffer;
+        rapidxml::xml_document<> doc;
+        if (!ReadDocument(xml, buffer, doc)) { return {}; }
+
+        const auto* materialNode = doc.first_node("Material");
+        if (!materialNode) {
+            std::cerr << "Material node not found" << std::endl;
+            return {};
+        }
+
+        BinaryMaterialHeader header;
+        StringTableBuilder strings;
+        vector<BinaryTexture> textures;
+
+        header.mName         = strings.Add(GetAttrStr(materialNode->first_attribute("name")));
+        header.mBaseMaterial = strings.Add(GetAttrStr(materialNode->first_attribute("base")));
+        if (XML::GetAttrBool(materialNode->first_attribute("transparent"))) {
+            header.mFlags |= kBinaryMaterial_Transparent;
+        }
+
+        if (const auto* texturesNode = materialNode->first_node("Textures")) {
+            for (const auto* texture = texturesNode->first_node("Texture"); texture;
+                 texture             = texture->next_sibling()) {
+                const auto* assetAttr = texture->first_attribute("asset");
+                if (!assetAttr) {
+                    std::cerr << "Material->Textures->Texture is missing its asset" << std::endl;
+                    return {};
+                }
+
+                BinaryTexture record;
+                record.mName = strings.Add(GetAttrStr(texture->first_attribute("name")));
+                try {
+                    record.mAssetId = std::stoull(assetAttr->value());
+                } catch (const std::exception& e) {
+                    std::cerr << "Failed to compile material: " << e.what() << std::endl;
+                    return {};
+                }
+                textures.push_back(record);
+            }
+        }
+
+        header.mTextureCount    = CAST<u32>(textures.size());
+        header.mStringTableSize = CAST<u32>(strings.GetData().size());
+        return Assemble(header, textures, strings);
+    }
+
+    bool DescriptorCompiler::IsCompiled(std::span<const u8> data, u32 magic, size_t headerSize) {
+        if (data.size() < headerSize || data.size() < sizeof(u32)) { return false; }
+        u32 value;
+        std::memcpy(&value, data.data(), sizeof(u32));
+        return value == magic;
+    }
+}  // namespace x
@@ -0,0 +1,113 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Common/Macros.hpp"
+#include "Common/Typedefs.hpp"
+
+#include <span>
+#include <string_view>
+
+namespace x {
+    // Compiled descriptor layout. Fixed-size records that are read with a memcpy each, followed by a string table the
+    // records point into:
+    //
+    //   Scene:    BinarySceneHeader, BinaryEntity[mEntityCount], string table (mStringTableSize bytes)
+    //   Material: BinaryMaterialHeader, BinaryTexture[mTextureCount], string table (mStringTableSize bytes)
+    static constexpr u32 kBinarySceneMagic        = 0x4E435358;  // 'XSCN'
+    static constexpr u32 kBinaryMaterialMagic     = 0x544D5358;  // 'XSMT'
+    static constexpr u16 kBinaryDescriptorVersion = 1;
+
+    static constexpr u32 kBinaryEntity_Model    = 1 << 0;
+    static constexpr u32 kBinaryEntity_Behavior = 1 << 1;
+    static constexpr u32 kBinaryEntity_Camera   = 1 << 2;
+
+    static constexpr u32 kBinaryModel_CastsShadows   = 1 << 0;
+    static constexpr u32 kBinaryModel_ReceiveShadows = 1 << 1;
+
+    static constexpr u16 kBinaryMaterial_Transparent = 1 << 0;
+
+    /// @brief Slice of the string table. Strings aren't null-terminated.
+    struct BinaryString {
+        u32 mOffset {0};
+        u32 mLength {0};
+    };
+
+    struct BinarySceneHeader {
+        u32 mMagic {kBinarySceneMagic};
+        u16 mVersion {kBinaryDescriptorVersion};
+        u16 mFlags {0};
+        u32 mEntityCount {0};
+        u32 mStringTableSize {0};
+        BinaryString mName;
+        BinaryString mDescription;
+        u32 mSunEnabled {0};
+        f32 mSunIntensity {0};
+        f32 mSunColor[3] {};
+        f32 mSunDirection[3] {};
+        u32 mSunCastsShadows {0};
+        f32 mSkyColor[3] {};
+        u32 mReserved[2] {};  // Keeps the entity records 8 byte aligned
+    };
+
+    struct BinaryEntity {
+        u64 mId {0};
+        BinaryString mName;
+        u32 mComponents {0};  // kBinaryEntity_* flags, the fields of components that aren't present are zeroed
+        f32 mPosition[3] {};
+        f32 mRotation[3] {};
+        f32 mScale[3] {};
+        u64 mMeshId {0};
+        u64 mMaterialId {0};
+        u32 mModelFlags {0};
+        u32 mCameraOrthographic {0};
+        u64 mScriptId {0};
+        f32 mCameraFOV {0};
+        f32 mCameraNearZ {0};
+        f32 mCameraFarZ {0};
+        f32 mCameraWidth {0};
+        f32 mCameraHeight {0};
+        u32 mReserved {0};
+    };
+
+    struct BinaryMaterialHeader {
+        u32 mMagic {kBinaryMaterialMagic};
+        u16 mVersion {kBinaryDescriptorVersion};
+        u16 mFlags {0};
+        u32 mTextureCount {0};
+        u32 mStringTableSize {0};
+        BinaryString mName;
+        BinaryString mBaseMaterial;
+    };
+
+    struct BinaryTexture {
+        u64 mAssetId {0};
+        BinaryString mName;
+    };
+
+    static_assert(sizeof(BinarySceneHeader) == 88);
+    static_assert(sizeof(BinaryEntity) == 112);
+    static_assert(sizeof(BinaryMaterialHeader) == 32);
+    static_assert(sizeof(BinaryTexture) == 16);
+
+    /// @brief Compiles scene and material XML into the binary layout above, so the runtime can load them without
+    /// parsing. The XML stays the source of truth; the editor and loose content keep reading it directly.
+    class DescriptorCompiler {
+    public:
+        /// @brief Returns an empty vector if the XML couldn't be parsed or isn't a valid scene.
+        static vector<u8> CompileScene(std::span<const u8> xml);
+        /// @brief Returns an empty vector if the XML couldn't be parsed or isn't a valid material.
+        static vector<u8> CompileMaterial(std::span<const u8> xml);
+
+        /// @brief True if `data` starts with `magic` and is at least `headerSize` bytes long.
+        static bool IsCompiled(std::span<const u8> data, u32 magic, size_t headerSize);
+
+        /// @brief Returns the string or an empty view if it's out of bounds.
+        static std::string_view GetString(std::span<const u8> stringTable, const BinaryString& string) {
+            if (CAST<u64>(string.mOffset) + string.mLength > stringTable.size()) { return {}; }
+            return {RCAST<const char*>(stringTable.data()) + string.mOffset, string.mLength};
+        }
+    };
+}  // namespace x
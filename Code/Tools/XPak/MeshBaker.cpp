@@ -0,0 +1,429 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "MeshBaker.hpp"
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <limits>
+#include <assimp/mesh.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+
+namespace x {
+    static constexpr u32 kProcessFlags =
+      aiProcess_Triangulate | aiProcess_ConvertToLeftHanded | aiProcess_GenNormals | aiProcess_CalcTangentSpace;
+
+    bool BakedMesh::Open(std::span<const u8> data) {
+        mSubmeshes.clear();
+        mVertexData = nullptr;
+        mIndexData  = nullptr;
+
+        if (!MeshBaker::IsBaked(data)) { return false; }
+        std::memcpy(&mHeader, data.data(), sizeof(BakedMeshHeader));
+        const u32 stride = IsQuantized() ? sizeof(BakedMeshVertexQuantized) : sizeof(BakedMeshVertex);
+        if (mHeader.mVersion != kBakedMeshVersion || mHeader.mVertexStride != stride) { return false; }
+
+        const u64 tableSize  = CAST<u64>(mHeader.mSubmeshCount) * sizeof(BakedSubmesh);
+        const u64 vertexSize = CAST<u64>(mHeader.mVertexCount) * mHeader.mVertexStride;
+        const u64 indexSize  = CAST<u64>(mHeader.mIndexCount) * (HasIndex16() ? sizeof(u16) : sizeof(u32));
+        if (sizeof(BakedMeshHeader) + tableSize + vertexSize + indexSize != data.size()) { return false; }
+
+        const u8* table = data.data() + sizeof(BakedMeshHeader);
+        mSubmeshes.resize(mHeader.mSubmeshCount);
+        std::memcpy(mSubmeshes.data(), table, tableSize);
+
+        for (const auto& submesh : mSubmeshes) {
+            if (CAST<u64>(submesh.mFirstVertex) + submesh.mVertexCount > mHeader.mVertexCount ||
+                CAST<u64>(submesh.mFirstIndex) + submesh.mIndexCount > mHeader.mIndexCount) {
+                mSubmeshes.clear();
+                return false;
+            }
+        }
+
+        mVertexData = table + tableSize;
+        mIndexData  = mVertexData + vertexSize;
+        return true;
+    }
+
+    const u8* BakedMesh::GetVertices(const BakedSubmesh& submesh) const {
+        return mVertexData + CAST<size_t>(submesh.mFirstVertex) * mHeader.mVertexStride;
+    }
+
+    const void* BakedMesh::GetIndices(const BakedSubmesh& submesh) const {
+        return mIndexData + CAST<size_t>(submesh.mFirstIndex) * (HasIndex16() ? sizeof(u16) : sizeof(u32));
+    }
+
+    static i16 ToSnorm16(f32 value) {
+        return CAST<i16>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    static f32 FromSnorm16(i16 value) {
+        return X_MAX(CAST<f32>(value) / 32767.0f, -1.0f);
+    }
+
+    static f32 SignNotZero(f32 value) {
+        return value >= 0.0f ? 1.0f : -1.0f;
+    }
+
+    // Projects the unit vector onto an octahedron and unfolds it into a square, two components instead of three
+    static void EncodeOctahedral(const f32* vector, i16* encoded) {
+        const f32 sum = std::abs(vector[0]) + std::abs(vector[1]) + std::abs(vector[2]);
+        if (sum <= 0.0f) {
+            // No direction (e.g. a mesh without tangents), decodes to +Z
+            encoded[0] = encoded[1] = 0;
+            return;
+        }
+
+        f32 x = vector[0] / sum;
+        f32 y = vector[1] / sum;
+        if (vector[2] < 0.0f) {
+            const f32 folded = x;
+            x                = (1.0f - std::abs(y)) * SignNotZero(folded);
+            y                = (1.0f - std::abs(folded)) * SignNotZero(y);
+        }
+
+        encoded[0] = ToSnorm16(x);
+        encoded[1] = ToSnorm16(y);
+    }
+
+    static void DecodeOctahedral(const i16* encoded, f32* vector) {
+        f32 x       = FromSnorm16(encoded[0]);
+        f32 y       = FromSnorm16(encoded[1]);
+        const f32 z = 1.0f - std::abs(x) - std::abs(y);
+        if (z < 0.0f) {
+            const f32 folded = x;
+            x                = (1.0f - std::abs(y)) * SignNotZero(folded);
+            y                = (1.0f - std::abs(folded)) * SignNotZero(y);
+        }
+
+        const f32 length = std::sqrt(x * x + y * y + z * z);
+        vector[0]        = x / length;
+        vector[1]        = y / length;
+        vector[2]        = z / length;
+    }
+
+    // IEEE 754 binary16 conversion, rounding to nearest even
+    static u16 FloatToHalf(f32 value) {
+        u32 bits;
+        std::memcpy(&bits, &value, sizeof(u32));
+
+        const u32 sign     = (bits >> 16) & 0x8000;
+        const u32 biased   = (bits >> 23) & 0xFF;
+        const i32 exponent = CAST<i32>(biased) - 127 + 15;
+        u32 mantissa       = bits & 0x7FFFFF;
+
+        if (biased == 0xFF) { return CAST<u16>(sign | 0x7C00 | (mantissa ? 0x200 : 0)); }  // Inf/NaN
+        if (exponent >= 31) { return CAST<u16>(sign | 0x7C00); }                           // Overflows to Inf
+
+        if (exponent <= 0) {
+            // Subnormal, or too small to represent at all
+            if (exponent < -10) { return CAST<u16>(sign); }
+            mantissa |= 0x800000;
+            const u32 shift    = CAST<u32>(14 - exponent);
+            u32 half           = mantissa >> shift;
+            const u32 rest     = mantissa & ((1u << shift) - 1);
+            const u32 halfway  = 1u << (shift - 1);
+            if (rest > halfway || (rest == halfway && (half & 1))) { ++half; }
+            return CAST<u16>(sign | half);
+        }
+
+        // Rounding can carry into the exponent, which correctly rounds up to the next power of two (or Inf)
+        u32 half       = (CAST<u32>(exponent) << 10) | (mantissa >> 13);
+        const u32 rest = mantissa & 0x1FFF;
+        if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) { ++half; }
+        return CAST<u16>(sign | half);
+    }
+
+    static f32 HalfToFloat(u16 half) {
+        const u32 sign = CAST<u32>(half & 0x8000) << 16;
+        u32 exponent   = (half >> 10) & 0x1F;
+        u32 mantissa   = half & 0x3FF;
+        u32 bits;
+
+        if (exponent == 0) {
+            if (mantissa == 0) {
+                bits = sign;
+            } else {
+                // Subnormal, normalize it
+                exponent = 127 - 15 + 1;
+                while (!(mantissa & 0x400)) {
+                    mantissa <<= 1;
+                    --exponent;
+                }
+                bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+            }
+        } else if (exponent == 31) {
+            bits = sign | 0x7F800000 | (mantissa << 13);
+        } else {
+            bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+        }
+
+        f32 value;
+        std::memcpy(&value, &bits, sizeof(f32));
+        return value;
+    }
+
+    vector<BakedMeshVertex> BakedMesh::DecodeVertices(const BakedSubmesh& submesh) const {
+        vector<BakedMeshVertex> vertices(submesh.mVertexCount);
+        const u8* source = GetVertices(submesh);
+
+        if (!IsQuantized()) {
+            std::memcpy(vertices.data(), source, vertices.size() * sizeof(BakedMeshVertex));
+            return vertices;
+        }
+
+        for (auto& vertex : vertices) {
+            BakedMeshVertexQuantized quantized;
+            std::memcpy(&quantized, source, sizeof(BakedMeshVertexQuantized));
+            source += sizeof(BakedMeshVertexQuantized);
+
+            std::memcpy(vertex.mPosition, quantized.mPosition, sizeof(vertex.mPosition));
+            DecodeOctahedral(quantized.mNormal, vertex.mNormal);
+            DecodeOctahedral(quantized.mTangent, vertex.mTangent);
+            vertex.mTexCoord[0] = HalfToFloat(quantized.mTexCoord[0]);
+            vertex.mTexCoord[1] = HalfToFloat(quantized.mTexCoord[1]);
+        }
+
+        return vertices;
+    }
+
+    static BakedMeshVertexQuantized QuantizeVertex(const BakedMeshVertex& vertex) {
+        BakedMeshVertexQuantized quantized;
+        std::memcpy(quantized.mPosition, vertex.mPosition, sizeof(quantized.mPosition));
+        EncodeOctahedral(vertex.mNormal, quantized.mNormal);
+        EncodeOctahedral(vertex.mTangent, quantized.mTangent);
+        quantized.mTexCoord[0] = FloatToHalf(vertex.mTexCoord[0]);
+        quantized.mTexCoord[1] = FloatToHalf(vertex.mTexCoord[1]);
+        return quantized;
+    }
+
+    static void GrowBounds(BakedMeshBounds& bounds, const f32* position) {
+        for (u32 i = 0; i < 3; ++i) {
+            bounds.mMin[i] = X_MIN(bounds.mMin[i], position[i]);
+            bounds.mMax[i] = X_MAX(bounds.mMax[i], position[i]);
+        }
+    }
+
+    static BakedMeshBounds EmptyBounds() {
+        BakedMeshBounds bounds;
+        for (u32 i = 0; i < 3; ++i) {
+            bounds.mMin[i] = std::numeric_limits<f32>::max();
+            bounds.mMax[i] = std::numeric_limits<f32>::lowest();
+        }
+        return bounds;
+    }
+
+    // Meshes are emitted once per node that references them, in the same depth-first order the runtime loader used
+    static void CollectMeshes(const aiNode* node, const aiScene* scene, vector<const aiMesh*>& meshes) {
+        for (u32 i = 0; i < node->mNumMeshes; ++i) {
+            meshes.push_back(scene->mMeshes[node->mMeshes[i]]);
+        }
+        for (u32 i = 0; i < node->mNumChildren; ++i) {
+            CollectMeshes(node->mChildren[i], scene, meshes);
+        }
+    }
+
+    // Converts an imported mesh into a standalone vertex/index list, indices relative to its own vertices
+    static void ImportSubmesh(const aiMesh* mesh, vector<BakedMeshVertex>& vertices, vector<u32>& indices) {
+        vertices.resize(mesh->mNumVertices);
+        for (u32 i = 0; i < mesh->mNumVertices; ++i) {
+            auto& vertex = vertices[i];
+
+            vertex.mPosition[0] = mesh->mVertices[i].x;
+            vertex.mPosition[1] = mesh->mVertices[i].y;
+            vertex.mPosition[2] = mesh->mVertices[i].z;
+
+            if (mesh->mTextureCoords[0]) {
+                vertex.mTexCoord[0] = mesh->mTextureCoords[0][i].x;
+                vertex.mTexCoord[1] = mesh->mTextureCoords[0][i].y;
+            }
+
+            if (mesh->HasNormals()) {
+                vertex.mNormal[0] = mesh->mNormals[i].x;
+                vertex.mNormal[1] = mesh->mNormals[i].y;
+                vertex.mNormal[2] = mesh->mNormals[i].z;
+            }
+
+            if (mesh->HasTangentsAndBitangents()) {
+                vertex.mTangent[0] = mesh->mTangents[i].x;
+                vertex.mTangent[1] = mesh->mTangents[i].y;
+                vertex.mTangent[2] = mesh->mTangents[i].z;
+            }
+        }
+
+        size_t indexCount = 0;
+        for (u32 i = 0; i < mesh->mNumFaces; ++i) {
+            indexCount += mesh->mFaces[i].mNumIndices;
+        }
+
+        indices.clear();
+        indices.reserve(indexCount);
+        for (u32 i = 0; i < mesh->mNumFaces; ++i) {
+            const auto& face = mesh->mFaces[i];
+            indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+        }
+    }
+
+    vector<u8> MeshBaker::Bake(std::span<const u8> source,
+                               const str& formatHint,
+                               const MeshBakeOptions& options,
+                               MeshBakeStats* stats) {
+        Assimp::Importer importer;
+        const auto* scene =
+          importer.ReadFileFromMemory(source.data(), source.size(), kProcessFlags, formatHint.c_str());
+        if (!scene || !scene->mRootNode) {
+            std::cerr << "Failed to import mesh: " << importer.GetErrorString() << std::endl;
+            return {};
+        }
+
+        vector<const aiMesh*> meshes;
+        CollectMeshes(scene->mRootNode, scene, meshes);
+
+        // Empty meshes would end up as zero sized GPU buffers, which can't be created
+        std::erase_if(meshes, [](const aiMesh* mesh) { return mesh->mNumVertices == 0 || mesh->mNumFaces == 0; });
+
+        BakedMeshHeader header;
+        header.mBounds = EmptyBounds();
+
+        vector<BakedSubmesh> submeshes;
+        vector<BakedMeshVertex> vertices;
+        vector<u32> indices;
+        submeshes.reserve(meshes.size());
+
+        VertexCacheStats sourceCache;
+        VertexCacheStats bakedCache;
+        u64 sourceVertices = 0;
+        bool fitsIndex16   = true;
+
+        vector<BakedMeshVertex> meshVertices;
+        vector<u32> meshIndices;
+        for (const auto* mesh : meshes) {
+            ImportSubmesh(mesh, meshVertices, meshIndices);
+            sourceVertices += meshVertices.size();
+
+            const auto before = MeshOptimizer::AnalyzeVertexCache(meshIndices, meshVertices.size());
+            sourceCache.mTriangles += before.mTriangles;
+            sourceCache.mVertices += before.mVertices;
+            sourceCache.mMisses += before.mMisses;
+
+            if (options.mOptimize) {
+                MeshOptimizer::WeldVertices(meshVertices, meshIndices);
+                MeshOptimizer::OptimizeVertexCache(meshIndices, meshVertices.size());
+                MeshOptimizer::OptimizeOverdraw(meshIndices, meshVertices);
+                MeshOptimizer::OptimizeVertexFetch(meshVertices, meshIndices);
+            }
+
+            const auto after = MeshOptimizer::AnalyzeVertexCache(meshIndices, meshVertices.size());
+            bakedCache.mTriangles += after.mTriangles;
+            bakedCache.mVertices += after.mVertices;
+            bakedCache.mMisses += after.mMisses;
+
+            if (vertices.size() + meshVertices.size() > std::numeric_limits<u32>::max() ||
+                indices.size() + meshIndices.size() > std::numeric_limits<u32>::max()) {
+                std::cerr << "Mesh is too large to bake" << std::endl;
+                return {};
+            }
+
+            BakedSubmesh submesh;
+            submesh.mFirstVertex = CAST<u32>(vertices.size());
+            submesh.mVertexCount = CAST<u32>(meshVertices.size());
+            submesh.mFirstIndex  = CAST<u32>(indices.size());
+            submesh.mIndexCount  = CAST<u32>(meshIndices.size());
+            submesh.mBounds      = EmptyBounds();
+            for (const auto& vertex : meshVertices) {
+                GrowBounds(submesh.mBounds, vertex.mPosition);
+            }
+
+            // Indices are relative to the submesh, so it's the largest submesh that decides whether they fit
+            fitsIndex16 = fitsIndex16 && meshVertices.size() <= std::numeric_limits<u16>::max() + 1;
+
+            GrowBounds(header.mBounds, submesh.mBounds.mMin);
+            GrowBounds(header.mBounds, submesh.mBounds.mMax);
+            submeshes.push_back(submesh);
+            vertices.insert(vertices.end(), meshVertices.begin(), meshVertices.end());
+            indices.insert(indices.end(), meshIndices.begin(), meshIndices.end());
+        }
+
+        if (submeshes.empty()) { header.mBounds = {}; }
+
+        // 16-bit indices are lossless, so they're used whenever they fit
+        if (fitsIndex16) { header.mFlags |= kBakedMeshFlag_Index16; }
+        if (options.mQuantize) { header.mFlags |= kBakedMeshFlag_Quantized; }
+
+        header.mSubmeshCount = CAST<u32>(submeshes.size());
+        header.mVertexStride = options.mQuantize ? sizeof(BakedMeshVertexQuantized) : sizeof(BakedMeshVertex);
+        header.mVertexCount  = CAST<u32>(vertices.size());
+        header.mIndexCount   = CAST<u32>(indices.size());
+
+        const size_t tableSize  = submeshes.size() * sizeof(BakedSubmesh);
+        const size_t vertexSize = vertices.size() * header.mVertexStride;
+        const size_t indexSize  = indices.size() * (fitsIndex16 ? sizeof(u16) : sizeof(u32));
+
+        vector<u8> baked(sizeof(BakedMeshHeader) + tableSize + vertexSize + indexSize);
+        u8* out = baked.data();
+        std::memcpy(out, &header, sizeof(BakedMeshHeader));
+        out += sizeof(BakedMeshHeader);
+        std::memcpy(out, submeshes.data(), tableSize);
+        out += tableSize;
+
+        if (options.mQuantize) {
+            for (const auto& vertex : vertices) {
+                const auto quantized = QuantizeVertex(vertex);
+                std::memcpy(out, &quantized, sizeof(BakedMeshVertexQuantized));
+                out += sizeof(BakedMeshVertexQuantized);
+            }
+        } else {
+            std::memcpy(out, vertices.data(), vertexSize);
+            out += vertexSize;
+        }
+
+        if (fitsIndex16) {
+            for (const auto index : indices) {
+                const u16 narrow = CAST<u16>(index);
+                std::memcpy(out, &narrow, sizeof(u16));
+                out += sizeof(u16);
+            }
+        } else {
+            std::memcpy(out, indices.data(), indexSize);
+        }
+
+        if (stats) {
+            stats->mSubmeshCount   = header.mSubmeshCount;
+            stats->mTriangles      = bakedCache.mTriangles;
+            stats->mSourceVertices = sourceVertices;
+            stats->mVertices       = vertices.size();
+            stats->mSourceBytes    = sizeof(BakedMeshHeader) + tableSize + sourceVertices * sizeof(BakedMeshVertex) +
+                                  indices.size() * sizeof(u32);
+            stats->mBytes      = baked.size();
+            stats->mSourceAcmr = sourceCache.GetAcmr();
+            stats->mAcmr       = bakedCache.GetAcmr();
+            stats->mSourceAtvr = sourceCache.GetAtvr();
+            stats->mAtvr       = bakedCache.GetAtvr();
+        }
+
+        return baked;
+    }
+
+    bool MeshBaker::IsBaked(std::span<const u8> data) {
+        if (data.size() < sizeof(BakedMeshHeader)) { return false; }
+        u32 magic;
+        std::memcpy(&magic, data.data(), sizeof(u32));
+        return magic == kBakedMeshMagic;
+    }
+
+    str MeshBaker::GetCacheSalt(const str& formatHint, const MeshBakeOptions& options) {
+        // The format hint picks the importer
+        return std::format("{}:{}:{}{}",
+                           formatHint,
+                           kBakedMeshVersion,
+                           options.mOptimize ? "o" : "",
+                           options.mQuantize ? "q" : "");
+    }
+}  // namespace x
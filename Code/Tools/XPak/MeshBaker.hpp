@@ -0,0 +1,147 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Common/Macros.hpp"
+#include "Common/Typedefs.hpp"
+
+#include <span>
+
+namespace x {
+    // Baked mesh layout, every section starts on a 4 byte boundary:
+    //
+    //   BakedMeshHeader
+    //   BakedSubmesh[mSubmeshCount]
+    //   Vertex blob (mVertexCount * mVertexStride bytes), BakedMeshVertex or BakedMeshVertexQuantized
+    //   Index blob (mIndexCount * u32, or u16 with kBakedMeshFlag_Index16), each submesh's indices are relative to
+    //   its first vertex
+    static constexpr u32 kBakedMeshMagic   = 0x48534D58;  // 'XMSH'
+    static constexpr u16 kBakedMeshVersion = 2;
+
+    static constexpr u16 kBakedMeshFlag_Index16   = 1 << 0;  // Every submesh has fewer than 65536 vertices
+    static constexpr u16 kBakedMeshFlag_Quantized = 1 << 1;  // Vertices are BakedMeshVertexQuantized
+
+    struct BakedMeshBounds {
+        f32 mMin[3] {};
+        f32 mMax[3] {};
+    };
+
+    struct BakedMeshHeader {
+        u32 mMagic {kBakedMeshMagic};
+        u16 mVersion {kBakedMeshVersion};
+        u16 mFlags {0};
+        u32 mSubmeshCount {0};
+        u32 mVertexStride {0};
+        u32 mVertexCount {0};
+        u32 mIndexCount {0};
+        BakedMeshBounds mBounds;
+    };
+
+    struct BakedSubmesh {
+        u32 mFirstVertex {0};
+        u32 mVertexCount {0};
+        u32 mFirstIndex {0};
+        u32 mIndexCount {0};
+        BakedMeshBounds mBounds;
+    };
+
+    /// @brief Full precision vertex. Matches VSInputPBR on the engine side.
+    struct BakedMeshVertex {
+        f32 mPosition[3] {};
+        f32 mNormal[3] {};
+        f32 mTangent[3] {};
+        f32 mTexCoord[2] {};
+    };
+
+    /// @brief Quantized vertex, a little over half the size of BakedMeshVertex. Positions stay full precision.
+    struct BakedMeshVertexQuantized {
+        f32 mPosition[3] {};
+        i16 mNormal[2] {};    // Octahedral encoded, snorm16
+        i16 mTangent[2] {};   // Octahedral encoded, snorm16
+        u16 mTexCoord[2] {};  // Half floats
+    };
+
+    static_assert(sizeof(BakedMeshHeader) == 48);
+    static_assert(sizeof(BakedSubmesh) == 40);
+    static_assert(sizeof(BakedMeshVertex) == 44);
+    static_assert(sizeof(BakedMeshVertexQuantized) == 24);
+
+    struct MeshBakeOptions {
+        bool mOptimize {true};   // Weld vertices and reorder them/the triangles for the post-transform cache
+        bool mQuantize {false};  // Store BakedMeshVertexQuantized instead of full precision vertices
+    };
+
+    /// @brief Totals across a mesh's submeshes, comparing the mesh as imported with how it was baked.
+    struct MeshBakeStats {
+        u32 mSubmeshCount {0};
+        u64 mTriangles {0};
+        u64 mSourceVertices {0};
+        u64 mVertices {0};
+        u64 mSourceBytes {0};  // Size the mesh would have been baked at with no welding or quantization
+        u64 mBytes {0};
+        f64 mSourceAcmr {0};
+        f64 mAcmr {0};
+        f64 mSourceAtvr {0};
+        f64 mAtvr {0};
+    };
+
+    /// @brief Read-only view over a baked mesh. Doesn't own or copy anything, the blobs point straight into the bytes
+    /// it was opened with, so those must outlive it.
+    class BakedMesh {
+    public:
+        /// @brief Validates the header and section sizes. Returns false if `data` isn't a baked mesh this version of
+        /// the engine understands.
+        bool Open(std::span<const u8> data);
+
+        X_NODISCARD const BakedMeshHeader& GetHeader() const {
+            return mHeader;
+        }
+
+        X_NODISCARD std::span<const BakedSubmesh> GetSubmeshes() const {
+            return mSubmeshes;
+        }
+
+        X_NODISCARD bool IsQuantized() const {
+            return CHECK_FLAG(mHeader.mFlags, kBakedMeshFlag_Quantized);
+        }
+
+        X_NODISCARD bool HasIndex16() const {
+            return CHECK_FLAG(mHeader.mFlags, kBakedMeshFlag_Index16);
+        }
+
+        /// @brief First vertex of `submesh`, `mVertexStride` bytes apart.
+        X_NODISCARD const u8* GetVertices(const BakedSubmesh& submesh) const;
+        /// @brief First index of `submesh`, u16 or u32 depending on HasIndex16.
+        X_NODISCARD const void* GetIndices(const BakedSubmesh& submesh) const;
+
+        /// @brief Expands a quantized submesh's vertices back to full precision.
+        X_NODISCARD vector<BakedMeshVertex> DecodeVertices(const BakedSubmesh& submesh) const;
+
+    private:
+        BakedMeshHeader mHeader;
+        vector<BakedSubmesh> mSubmeshes;
+        const u8* mVertexData {nullptr};
+        const u8* mIndexData {nullptr};
+    };
+
+    /// @brief Imports a source mesh (anything Assimp reads) and flattens it into the baked layout above, so loading it
+    /// at runtime is just a matter of handing the blobs to the GPU.
+    class MeshBaker {
+    public:
+        /// @brief `formatHint` is the source file's extension, used by the importer when the format can't be told
+        /// from the contents alone. Returns an empty vector if the mesh couldn't be imported. `stats` is filled in
+        /// if provided.
+        static vector<u8> Bake(std::span<const u8> source,
+                               const str& formatHint          = {},
+                               const MeshBakeOptions& options = {},
+                               MeshBakeStats* stats           = nullptr);
+
+        static bool IsBaked(std::span<const u8> data);
+
+        /// @brief Everything besides the source bytes that affects what Bake produces, for build cache keys (see
+        /// XPakCache::MakeKey).
+        static str GetCacheSalt(const str& formatHint, const MeshBakeOptions& options);
+    };
+}  // namespace x
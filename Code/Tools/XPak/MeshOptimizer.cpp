@@ -0,0 +1,328 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string_view>
+
+namespace x {
+    // Forsyth's scoring parameters, tuned for a 32 entry LRU cache. See
+    // https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+    static constexpr u32 kScoringCacheSize   = 32;
+    static constexpr f32 kCacheDecayPower    = 1.5f;
+    static constexpr f32 kLastTriangleScore  = 0.75f;
+    static constexpr f32 kValenceBoostScale  = 2.0f;
+    static constexpr f32 kValenceBoostPower  = 0.5f;
+    static constexpr u32 kInvalidVertexIndex = ~0u;
+
+    static f32 ScoreVertex(i32 cachePosition, u32 liveTriangles) {
+        // Nothing left to draw with this vertex, it shouldn't pull any triangles towards it
+        if (liveTriangles == 0) { return -1.0f; }
+
+        f32 score = 0.0f;
+        if (cachePosition >= 0) {
+            if (cachePosition < 3) {
+                // Used by the triangle just drawn. Deliberately lower than the next few slots so strips don't form.
+                score = kLastTriangleScore;
+            } else {
+                const f32 scale = 1.0f / CAST<f32>(kScoringCacheSize - 3);
+                score           = std::pow(1.0f - CAST<f32>(cachePosition - 3) * scale, kCacheDecayPower);
+            }
+        }
+
+        // Vertices with few triangles left are finished off first, so they don't get stranded
+        score += kValenceBoostScale * std::pow(CAST<f32>(liveTriangles), -kValenceBoostPower);
+        return score;
+    }
+
+    // Models a FIFO post-transform cache: a vertex is a hit if it was transformed within the last `cacheSize` misses
+    class FifoCache {
+    public:
+        FifoCache(size_t vertexCount, u32 cacheSize)
+            : mTimestamps(vertexCount, 0), mTime(cacheSize + 1), mSize(cacheSize) {}
+
+        bool Miss(u32 index) {
+            if (mTime - mTimestamps[index] <= mSize) { return false; }
+            mTimestamps[index] = mTime++;
+            return true;
+        }
+
+    private:
+        vector<u32> mTimestamps;
+        u32 mTime;
+        u32 mSize;
+    };
+
+    size_t MeshOptimizer::WeldVertices(vector<BakedMeshVertex>& vertices, vector<u32>& indices) {
+        vector<u8> referenced(vertices.size(), 0);
+        for (const auto index : indices) {
+            referenced[index] = 1;
+        }
+
+        // BakedMeshVertex is all floats with no padding, so comparing its bytes compares the vertex. Distinct bit
+        // patterns that compare equal as floats (0.0/-0.0) are kept apart, which is harmless.
+        unordered_map<std::string_view, u32> unique;
+        unique.reserve(vertices.size());
+
+        vector<u32> remap(vertices.size(), kInvalidVertexIndex);
+        vector<BakedMeshVertex> welded;
+        welded.reserve(vertices.size());
+
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            if (!referenced[i]) { continue; }
+
+            const std::string_view key(RCAST<const char*>(&vertices[i]), sizeof(BakedMeshVertex));
+            const auto [it, inserted] = unique.try_emplace(key, CAST<u32>(welded.size()));
+            if (inserted) { welded.push_back(vertices[i]); }
+            remap[i] = it->second;
+        }
+
+        for (auto& index : indices) {
+            index = remap[index];
+        }
+
+        const size_t removed = vertices.size() - welded.size();
+        vertices             = std::move(welded);
+        return removed;
+    }
+
+    void MeshOptimizer::OptimizeVertexCache(std::span<u32> indices, size_t vertexCount) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0) { return; }
+
+        // Triangles using each vertex. The first live[v] entries of a vertex's range are the ones not yet drawn.
+        vector<u32> live(vertexCount, 0);
+        for (const auto index : indices) {
+            live[index]++;
+        }
+
+        vector<u32> offsets(vertexCount + 1, 0);
+        std::partial_sum(live.begin(), live.end(), offsets.begin() + 1);
+
+        vector<u32> adjacency(indices.size());
+        {
+            vector<u32> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < indices.size(); ++i) {
+                adjacency[cursor[indices[i]]++] = CAST<u32>(i / 3);
+            }
+        }
+
+        vector<i32> cachePosition(vertexCount, -1);
+        vector<f32> vertexScore(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            vertexScore[i] = ScoreVertex(-1, live[i]);
+        }
+
+        vector<f32> triangleScore(triangleCount);
+        vector<u8> emitted(triangleCount, 0);
+        i64 best      = 0;
+        f32 bestScore = -1.0f;
+        for (size_t t = 0; t < triangleCount; ++t) {
+            triangleScore[t] =
+              vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+            if (triangleScore[t] > bestScore) {
+                bestScore = triangleScore[t];
+                best      = CAST<i64>(t);
+            }
+        }
+
+        vector<u32> output;
+        output.reserve(indices.size());
+        vector<u32> cache;
+        vector<u32> nextCache;
+        cache.reserve(kScoringCacheSize + 3);
+        nextCache.reserve(kScoringCacheSize + 3);
+        size_t scan = 0;
+
+        for (size_t n = 0; n < triangleCount; ++n) {
+            if (best < 0) {
+                // Nothing in the cache leads anywhere, start over from the next triangle that hasn't been drawn
+                while (emitted[scan]) {
+                    ++scan;
+                }
+                best = CAST<i64>(scan);
+            }
+
+            const size_t triangle = CAST<size_t>(best);
+            emitted[triangle]     = 1;
+
+            nextCache.clear();
+            for (u32 corner = 0; corner < 3; ++corner) {
+                const u32 vertex = indices[triangle * 3 + corner];
+                output.push_back(vertex);
+
+                // Swap the triangle out of the vertex's live range
+                u32* first = adjacency.data() + offsets[vertex];
+                u32* last  = first + live[vertex] - 1;
+                *std::find(first, last + 1, CAST<u32>(triangle)) = *last;
+                *last                                            = CAST<u32>(triangle);
+                live[vertex]--;
+
+                if (std::find(nextCache.begin(), nextCache.end(), vertex) == nextCache.end()) {
+                    nextCache.push_back(vertex);
+                }
+            }
+
+            for (const auto vertex : cache) {
+                if (std::find(nextCache.begin(), nextCache.end(), vertex) == nextCache.end()) {
+                    nextCache.push_back(vertex);
+                }
+            }
+
+            // Vertices pushed past the end of the cache are rescored as evicted, then dropped
+            for (size_t i = 0; i < nextCache.size(); ++i) {
+                const u32 vertex      = nextCache[i];
+                cachePosition[vertex] = i < kScoringCacheSize ? CAST<i32>(i) : -1;
+                vertexScore[vertex]   = ScoreVertex(cachePosition[vertex], live[vertex]);
+            }
+
+            best      = -1;
+            bestScore = -1.0f;
+            for (const auto vertex : nextCache) {
+                for (u32 i = 0; i < live[vertex]; ++i) {
+                    const u32 t      = adjacency[offsets[vertex] + i];
+                    triangleScore[t] = vertexScore[indices[t * 3]] + vertexScore[indices[t * 3 + 1]] +
+                                       vertexScore[indices[t * 3 + 2]];
+                    if (triangleScore[t] > bestScore) {
+                        bestScore = triangleScore[t];
+                        best      = t;
+                    }
+                }
+            }
+
+            if (nextCache.size() > kScoringCacheSize) { nextCache.resize(kScoringCacheSize); }
+            std::swap(cache, nextCache);
+        }
+
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    void MeshOptimizer::OptimizeOverdraw(std::span<u32> indices, std::span<const BakedMeshVertex> vertices) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2) { return; }
+
+        // A triangle whose vertices all miss starts a cluster. The cache holds nothing useful at that point, so
+        // clusters can be drawn in any order without costing extra vertex shader invocations.
+        vector<size_t> clusters;
+        FifoCache cache(vertices.size(), kModeledCacheSize);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            u32 misses = 0;
+            for (u32 corner = 0; corner < 3; ++corner) {
+                misses += cache.Miss(indices[t * 3 + corner]) ? 1 : 0;
+            }
+            if (misses == 3 || t == 0) { clusters.push_back(t); }
+        }
+        if (clusters.size() < 2) { return; }
+        clusters.push_back(triangleCount);
+
+        const auto position = [&](u32 index) { return vertices[index].mPosition; };
+
+        // Area weighted centroid of the whole mesh
+        f64 meshCentroid[3] {};
+        f64 meshArea {0};
+        vector<f64> triangleArea(triangleCount);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            const f32* a = position(indices[t * 3]);
+            const f32* b = position(indices[t * 3 + 1]);
+            const f32* c = position(indices[t * 3 + 2]);
+
+            const f64 e0[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+            const f64 e1[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+            const f64 n[3]  = {
+              e0[1] * e1[2] - e0[2] * e1[1],
+              e0[2] * e1[0] - e0[0] * e1[2],
+              e0[0] * e1[1] - e0[1] * e1[0],
+            };
+            triangleArea[t] = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) * 0.5;
+
+            for (u32 i = 0; i < 3; ++i) {
+                meshCentroid[i] += triangleArea[t] * (a[i] + b[i] + c[i]) / 3.0;
+            }
+            meshArea += triangleArea[t];
+        }
+        if (meshArea <= 0.0) { return; }
+        for (auto& component : meshCentroid) {
+            component /= meshArea;
+        }
+
+        // Clusters that sit far out along the direction they face are likely on the silhouette and occlude the rest
+        // of the mesh, so they're drawn first. The vertex normals are used rather than the winding, so this works
+        // whichever way the mesh is wound.
+        const size_t clusterCount = clusters.size() - 1;
+        vector<f64> sortKey(clusterCount, 0.0);
+        for (size_t i = 0; i < clusterCount; ++i) {
+            f64 centroid[3] {};
+            f64 normal[3] {};
+            f64 area {0};
+
+            for (size_t t = clusters[i]; t < clusters[i + 1]; ++t) {
+                for (u32 corner = 0; corner < 3; ++corner) {
+                    const auto& vertex = vertices[indices[t * 3 + corner]];
+                    for (u32 axis = 0; axis < 3; ++axis) {
+                        centroid[axis] += triangleArea[t] * vertex.mPosition[axis] / 3.0;
+                        normal[axis] += triangleArea[t] * vertex.mNormal[axis];
+                    }
+                }
+                area += triangleArea[t];
+            }
+
+            const f64 length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+            if (area <= 0.0 || length <= 0.0) { continue; }
+
+            for (u32 axis = 0; axis < 3; ++axis) {
+                sortKey[i] += (centroid[axis] / area - meshCentroid[axis]) * (normal[axis] / length);
+            }
+        }
+
+        vector<size_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sortKey[a] > sortKey[b]; });
+
+        vector<u32> output;
+        output.reserve(indices.size());
+        for (const auto cluster : order) {
+            output.insert(output.end(),
+                          indices.begin() + clusters[cluster] * 3,
+                          indices.begin() + clusters[cluster + 1] * 3);
+        }
+        std::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    void MeshOptimizer::OptimizeVertexFetch(vector<BakedMeshVertex>& vertices, std::span<u32> indices) {
+        vector<u32> remap(vertices.size(), kInvalidVertexIndex);
+        u32 next = 0;
+        for (auto& index : indices) {
+            if (remap[index] == kInvalidVertexIndex) { remap[index] = next++; }
+            index = remap[index];
+        }
+
+        vector<BakedMeshVertex> reordered(next);
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            if (remap[i] != kInvalidVertexIndex) { reordered[remap[i]] = vertices[i]; }
+        }
+        vertices = std::move(reordered);
+    }
+
+    VertexCacheStats MeshOptimizer::AnalyzeVertexCache(std::span<const u32> indices,
+                                                       size_t vertexCount,
+                                                       u32 cacheSize) {
+        VertexCacheStats stats;
+        stats.mTriangles = indices.size() / 3;
+
+        FifoCache cache(vertexCount, cacheSize);
+        vector<u8> seen(vertexCount, 0);
+        for (const auto index : indices) {
+            if (cache.Miss(index)) { stats.mMisses++; }
+            if (!seen[index]) {
+                seen[index] = 1;
+                stats.mVertices++;
+            }
+        }
+
+        return stats;
+    }
+}  // namespace x
@@ -0,0 +1,55 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "MeshBaker.hpp"
+
+namespace x {
+    /// @brief Result of running an index buffer through a modeled FIFO post-transform cache.
+    struct VertexCacheStats {
+        u64 mTriangles {0};
+        u64 mVertices {0};  // Vertices referenced by the index buffer
+        u64 mMisses {0};    // Vertex shader invocations
+
+        /// @brief Average cache miss ratio, vertex shader invocations per triangle. 3.0 is the worst case, 0.5 the
+        /// theoretical best for a regular grid.
+        X_NODISCARD f64 GetAcmr() const {
+            return mTriangles > 0 ? CAST<f64>(mMisses) / CAST<f64>(mTriangles) : 0.0;
+        }
+
+        /// @brief Average transformed vertex ratio, vertex shader invocations per vertex. 1.0 is optimal.
+        X_NODISCARD f64 GetAtvr() const {
+            return mVertices > 0 ? CAST<f64>(mMisses) / CAST<f64>(mVertices) : 0.0;
+        }
+    };
+
+    /// @brief Reorders a single mesh's vertices and triangles for the GPU. Every function works on a triangle list
+    /// whose indices reference `vertices` directly.
+    class MeshOptimizer {
+    public:
+        /// @brief Cache size used to model ACMR and find overdraw cluster boundaries. Small enough that it holds on
+        /// any GPU the engine targets, so the modeled numbers are a conservative estimate.
+        static constexpr u32 kModeledCacheSize = 16;
+
+        /// @brief Merges bit-identical vertices and drops unreferenced ones. Returns the number of vertices removed.
+        static size_t WeldVertices(vector<BakedMeshVertex>& vertices, vector<u32>& indices);
+
+        /// @brief Reorders triangles to maximize post-transform cache hits (Forsyth's linear-speed algorithm).
+        static void OptimizeVertexCache(std::span<u32> indices, size_t vertexCount);
+
+        /// @brief Reorders clusters of triangles so the ones most likely to occlude the rest are drawn first.
+        /// Clusters are split only where the modeled cache is cold anyway, so the ACMR isn't made worse. Expects
+        /// indices that were already optimized with OptimizeVertexCache.
+        static void OptimizeOverdraw(std::span<u32> indices, std::span<const BakedMeshVertex> vertices);
+
+        /// @brief Reorders vertices into the order they're first referenced, so fetches walk the vertex buffer
+        /// linearly. Call last, it remaps the indices.
+        static void OptimizeVertexFetch(vector<BakedMeshVertex>& vertices, std::span<u32> indices);
+
+        static VertexCacheStats AnalyzeVertexCache(std::span<const u32> indices,
+                                                   size_t vertexCount,
+                                                   u32 cacheSize = kModeledCacheSize);
+    };
+}  // namespace x
@@ -23,7 +23,25 @@ namespace x {
 
         mContentDirectory = contentPath.Str();
         mStartupScene     = XML::GetNodeStr(projectNode, "StartupScene");
-        mLoaded           = true;
+
+        // <Compression><Codec type="mesh">lz4</Codec></Compression>
+        mCodecPolicy.clear();
+        if (const auto compressionNode = projectNode->first_node("Compression")) {
+            for (auto codecNode = compressionNode->first_node("Codec"); codecNode;
+                 codecNode      = codecNode->next_sibling("Codec")) {
+                const auto typeName  = XML::GetAttrStr(codecNode->first_attribute("type"));
+                const auto codecName = XML::GetNodeStr(codecNode);
+                const auto type      = AssetDescriptor::GetTypeFromString(typeName);
+                const auto* codec    = CompressionCodecs::Find(codecName);
+                if (type == kAssetType_Invalid || !codec) {
+                    printf("Ignoring codec policy '%s' for asset type '%s'\n", codecName.c_str(), typeName.c_str());
+                    continue;
+                }
+                mCodecPolicy[type] = codec->mId;
+            }
+        }
+
+        mLoaded = true;
 
         return true;
     }
@@ -48,11 +66,35 @@ namespace x {
 
             xml_node<>* startupSceneNode = doc.allocate_node(node_element, "StartupScene", mStartupScene.c_str());
             projectNode->append_node(startupSceneNode);
+
+            if (!mCodecPolicy.empty()) {
+                xml_node<>* compressionNode = doc.allocate_node(node_element, "Compression");
+                for (const auto& [type, codec] : mCodecPolicy) {
+                    const auto typeName   = doc.allocate_string(AssetDescriptor::GetTypeString(type).c_str());
+                    xml_node<>* codecNode = doc.allocate_node(node_element, "Codec", CompressionCodecs::GetName(codec));
+                    codecNode->append_attribute(doc.allocate_attribute("type", typeName));
+                    compressionNode->append_node(codecNode);
+                }
+                projectNode->append_node(compressionNode);
+            }
         }
 
         return XML::WriteFile(filename, doc);
     }
 
+    CodecId ProjectDescriptor::GetCodec(AssetType type) const {
+        if (const auto it = mCodecPolicy.find(type); it != mCodecPolicy.end()) { return it->second; }
+
+        switch (type) {
+            case kAssetType_Mesh:
+            case kAssetType_Material:
+            case kAssetType_Scene:
+                return kCodec_Brotli;
+            default:
+                return kCodec_None;
+        }
+    }
+
     std::string ProjectDescriptor::ToString() const {
         return std::format("Name: {}\nEngine Version: {}\nContent: {}\n", mName, mEngineVersion, mContentDirectory);
     }
@@ -5,6 +5,9 @@
 #pragma once
 
 #include <format>
+#include <map>
+#include "AssetDescriptor.hpp"
+#include "Compression.hpp"
 #include "Common/Typedefs.hpp"
 #include "Common/Filesystem.hpp"
 
@@ -14,8 +17,13 @@ namespace x {
         f32 mEngineVersion;
         str mContentDirectory;
         str mStartupScene;
+        std::map<AssetType, CodecId> mCodecPolicy;  // Per asset type overrides of the default codec
         bool mLoaded {false};
 
+        /// @brief Codec to pack the given asset type with. Without an override in the project's <Compression> block,
+        /// meshes and descriptors use Brotli and everything else is stored as-is.
+        X_NODISCARD CodecId GetCodec(AssetType type) const;
+
         bool FromFile(const Path& filename);
         bool ToFile(const Path& filename) const;
         std::string ToString() const;
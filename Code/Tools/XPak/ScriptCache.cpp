@@ -0,0 +1,117 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "ScriptCache.hpp"
+#include "ScriptCompiler.hpp"
+#include "Common/Parallel.hpp"
+#include "Common/Timer.hpp"
+
+#include <format>
+
+extern "C" {
+#include <luajit.h>
+}
+
+namespace x {
+    bool ScriptCache::Open(const Path& directory) {
+        std::lock_guard lock(mMutex);
+        if (mDisk.IsOpen() && mDisk.GetDirectory() == directory) { return true; }
+        return mDisk.Open(directory);
+    }
+
+    vector<u8> ScriptCache::CompileFile(const Path& file) {
+        const u64 modifiedTime = FileReader::QueryModifiedTime(file);
+        const u64 size         = FileReader::QueryFileSize(file);
+
+        {
+            std::lock_guard lock(mMutex);
+            const auto stamp = mFiles.find(file.Str());
+            if (stamp != mFiles.end() && stamp->second.mModifiedTime == modifiedTime && stamp->second.mSize == size) {
+                if (const auto it = mBytecode.find(stamp->second.mKey); it != mBytecode.end()) {
+                    ++mStats.mMemoryHits;
+                    return it->second;
+                }
+            }
+        }
+
+        const auto source = FileReader::ReadBytes(file);
+        auto bytecode     = Compile(source, file.Str());
+        if (!bytecode.empty()) {
+            std::lock_guard lock(mMutex);
+            mFiles[file.Str()] = {modifiedTime, size, MakeKey(source, file.Str())};
+        }
+        return bytecode;
+    }
+
+    vector<u8> ScriptCache::Compile(std::span<const u8> source, const str& chunkName) {
+        const u64 key = MakeKey(source, chunkName);
+        if (auto bytecode = Find(key)) { return std::move(*bytecode); }
+
+        const Timer timer;
+        auto bytecode = ScriptCompiler::Compile(str(source.begin(), source.end()), chunkName);
+        if (bytecode.empty()) {
+            // Not cached, the script is likely to be fixed before it's loaded again
+            std::lock_guard lock(mMutex);
+            ++mStats.mFailed;
+            return bytecode;
+        }
+
+        Store(key, bytecode, timer.Elapsed());
+        return bytecode;
+    }
+
+    void ScriptCache::CompileFiles(std::span<const Path> files, u32 jobs) {
+        ParallelFor(files.size(), jobs, [&](size_t i) { CompileFile(files[i]); });
+    }
+
+    ScriptCacheStats ScriptCache::GetStats() const {
+        std::lock_guard lock(mMutex);
+        return mStats;
+    }
+
+    void ScriptCache::ResetStats() {
+        std::lock_guard lock(mMutex);
+        mStats = {};
+    }
+
+    u64 ScriptCache::MakeKey(std::span<const u8> source, const str& chunkName) {
+        // The chunk name is embedded in the bytecode, and bytecode is only valid for the LuaJIT version that made it
+        const str salt = std::format("bytecode:{}:{}", LUAJIT_VERSION, chunkName);
+        return XPakCache::MakeKey(source, kAssetType_Script, kCodec_None, 0, 0, salt);
+    }
+
+    std::optional<vector<u8>> ScriptCache::Find(u64 key) {
+        {
+            std::lock_guard lock(mMutex);
+            if (const auto it = mBytecode.find(key); it != mBytecode.end()) {
+                ++mStats.mMemoryHits;
+                return it->second;
+            }
+        }
+
+        // Entries are separate files, so this doesn't need the lock
+        auto record = mDisk.Load(key);
+        if (!record.has_value() || record->mPayload.empty()) { return std::nullopt; }
+
+        std::lock_guard lock(mMutex);
+        ++mStats.mDiskHits;
+        mBytecode[key] = record->mPayload;
+        return std::move(record->mPayload);
+    }
+
+    void ScriptCache::Store(u64 key, const vector<u8>& bytecode, f64 seconds) {
+        {
+            std::lock_guard lock(mMutex);
+            ++mStats.mCompiled;
+            mBytecode[key] = bytecode;
+        }
+
+        XPakCacheRecord record;
+        record.mCodec   = kCodec_None;
+        record.mSize    = bytecode.size();
+        record.mSeconds = seconds;
+        record.mPayload = bytecode;
+        mDisk.Store(key, record);
+    }
+}  // namespace x
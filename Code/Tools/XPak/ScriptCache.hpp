@@ -0,0 +1,65 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "XPakCache.hpp"
+#include "Common/Filesystem.hpp"
+#include "Common/Typedefs.hpp"
+
+#include <mutex>
+#include <optional>
+#include <span>
+
+namespace x {
+    struct ScriptCacheStats {
+        u32 mMemoryHits {0};
+        u32 mDiskHits {0};
+        u32 mCompiled {0};
+        u32 mFailed {0};
+    };
+
+    /// @brief Bytecode for scripts compiled from source at load time (loose content, i.e. dev builds and the editor).
+    ///
+    /// Scripts looked up by file are keyed on the file's modified time and size first, so unchanged ones aren't even
+    /// read again. Otherwise the key is a hash of the source and chunk name. Bytecode stays in memory for the life of
+    /// the cache and is also stored in an XPakCache directory, so it survives restarts. Safe to use from multiple
+    /// threads.
+    class ScriptCache {
+    public:
+        ScriptCache() = default;
+
+        /// @brief Also persists bytecode in `directory`. Until this is called only the in-memory cache is used.
+        bool Open(const Path& directory);
+
+        /// @brief Returns the file's bytecode, compiled with its path as the chunk name. Empty if it fails to compile.
+        vector<u8> CompileFile(const Path& file);
+        vector<u8> Compile(std::span<const u8> source, const str& chunkName);
+
+        /// @brief Makes sure every file's bytecode is cached, compiling the ones that aren't across up to `jobs`
+        /// threads (0 = one per core).
+        void CompileFiles(std::span<const Path> files, u32 jobs = 0);
+
+        X_NODISCARD ScriptCacheStats GetStats() const;
+        void ResetStats();
+
+    private:
+        struct FileStamp {
+            u64 mModifiedTime {0};
+            u64 mSize {0};
+            u64 mKey {0};
+        };
+
+        mutable std::mutex mMutex;
+        unordered_map<str, FileStamp> mFiles;
+        unordered_map<u64, vector<u8>> mBytecode;
+        XPakCache mDisk;
+        ScriptCacheStats mStats;
+
+        static u64 MakeKey(std::span<const u8> source, const str& chunkName);
+
+        std::optional<vector<u8>> Find(u64 key);
+        void Store(u64 key, const vector<u8>& bytecode, f64 seconds);
+    };
+}  // namespace x
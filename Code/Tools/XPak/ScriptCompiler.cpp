@@ -3,7 +3,9 @@
 //
 
 #include "ScriptCompiler.hpp"
+#include "Common/Parallel.hpp"  // For DefaultJobCount
 #include <iostream>
+#include <mutex>
 
 extern "C" {
 #include <lualib.h>
@@ -12,10 +14,51 @@ extern "C" {
 }
 
 namespace x {
+    // Idle compiler states. Loading a chunk doesn't need any of the standard libraries, so a bare state can compile
+    // any number of scripts one after another.
+    class CompilerStatePool {
+    public:
+        ~CompilerStatePool() {
+            for (lua_State* L : mStates) {
+                lua_close(L);
+            }
+        }
+
+        lua_State* Acquire() {
+            {
+                std::lock_guard lock(mMutex);
+                if (!mStates.empty()) {
+                    lua_State* L = mStates.back();
+                    mStates.pop_back();
+                    return L;
+                }
+            }
+            return luaL_newstate();
+        }
+
+        void Release(lua_State* L) {
+            lua_settop(L, 0);  // Drop the compiled chunk (or error message) so it can be collected
+
+            std::lock_guard lock(mMutex);
+            // One per core covers any batch, anything beyond that was created by a burst of callers
+            if (mStates.size() >= DefaultJobCount()) {
+                lua_close(L);
+                return;
+            }
+            mStates.push_back(L);
+        }
+
+    private:
+        std::mutex mMutex;
+        vector<lua_State*> mStates;
+    };
+
+    static CompilerStatePool sStatePool;
+
     vector<u8> ScriptCompiler::Compile(const str& source, const str& chunkName) {
         vector<u8> bytecode;
 
-        lua_State* L = luaL_newstate();
+        lua_State* L = sStatePool.Acquire();
         if (!L) {
             std::cerr << "Failed to create Lua state" << std::endl;
             return bytecode;
@@ -24,7 +67,7 @@ namespace x {
         int loadResult = luaL_loadbuffer(L, source.c_str(), source.size(), chunkName.c_str());
         if (loadResult != 0) {
             std::cerr << "Failed to compile Lua script: " << lua_tostring(L, -1) << std::endl;
-            lua_close(L);
+            sStatePool.Release(L);
             return bytecode;
         }
 
@@ -38,7 +81,7 @@ namespace x {
             bytecode.clear();
         }
 
-        lua_close(L);
+        sStatePool.Release(L);
         return bytecode;
     }
 
@@ -13,6 +13,8 @@ extern "C" {
 namespace x {
     class ScriptCompiler {
     public:
+        /// @brief Compiles Lua source to bytecode, returning an empty vector on failure. Compiler states are pooled and
+        /// reused between calls rather than created for every script, and it's safe to call from multiple threads.
         static vector<u8> Compile(const str& source, const str& chunkName);
 
     private:
@@ -0,0 +1,427 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "TextureBaker.hpp"
+#include "BlockCompression.hpp"
+#include "Common/Parallel.hpp"
+#include "Vendor/stb_image.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <numbers>
+
+namespace x {
+    // Every texture is written with the DX10 extension header, since that's the only way to describe BC7
+    static constexpr u32 kDDSMagic        = 0x20534444;  // 'DDS '
+    static constexpr u32 kDDSFourCC_DX10  = 0x30315844;  // 'DX10'
+    static constexpr u32 kDDSD_Caps       = 0x1;
+    static constexpr u32 kDDSD_Height     = 0x2;
+    static constexpr u32 kDDSD_Width      = 0x4;
+    static constexpr u32 kDDSD_PixelFmt   = 0x1000;
+    static constexpr u32 kDDSD_MipCount   = 0x20000;
+    static constexpr u32 kDDSD_LinearSize = 0x80000;
+    static constexpr u32 kDDPF_FourCC     = 0x4;
+    static constexpr u32 kDDSCaps_Complex = 0x8;
+    static constexpr u32 kDDSCaps_Texture = 0x1000;
+    static constexpr u32 kDDSCaps_Mipmap  = 0x400000;
+
+    static constexpr u32 kDXGIFormat_BC1 = 71;  // DXGI_FORMAT_BC1_UNORM
+    static constexpr u32 kDXGIFormat_BC3 = 77;  // DXGI_FORMAT_BC3_UNORM
+    static constexpr u32 kDXGIFormat_BC5 = 83;  // DXGI_FORMAT_BC5_UNORM
+    static constexpr u32 kDXGIFormat_BC7 = 98;  // DXGI_FORMAT_BC7_UNORM
+
+    static constexpr u32 kResourceDimension_Texture2D = 3;
+
+    struct DDSPixelFormat {
+        u32 mSize {sizeof(DDSPixelFormat)};
+        u32 mFlags {0};
+        u32 mFourCC {0};
+        u32 mRGBBitCount {0};
+        u32 mBitMasks[4] {};
+    };
+
+    struct DDSHeader {
+        u32 mSize {124};
+        u32 mFlags {0};
+        u32 mHeight {0};
+        u32 mWidth {0};
+        u32 mPitchOrLinearSize {0};
+        u32 mDepth {0};
+        u32 mMipMapCount {0};
+        u32 mReserved1[11] {};
+        DDSPixelFormat mPixelFormat;
+        u32 mCaps {0};
+        u32 mCaps2 {0};
+        u32 mCaps3 {0};
+        u32 mCaps4 {0};
+        u32 mReserved2 {0};
+    };
+
+    struct DDSHeaderDX10 {
+        u32 mDXGIFormat {0};
+        u32 mResourceDimension {kResourceDimension_Texture2D};
+        u32 mMiscFlag {0};
+        u32 mArraySize {1};
+        u32 mMiscFlags2 {0};
+    };
+
+    static_assert(sizeof(DDSPixelFormat) == 32);
+    static_assert(sizeof(DDSHeader) == 124);
+    static_assert(sizeof(DDSHeaderDX10) == 20);
+
+    static constexpr size_t kDDSHeaderSize = sizeof(u32) + sizeof(DDSHeader) + sizeof(DDSHeaderDX10);
+
+    // Lobes of the Lanczos kernel used to resample the mips. Sharper than a box or tent filter without the ringing of
+    // a wider kernel.
+    static constexpr f32 kFilterLobes = 3.0f;
+
+    // A mip while it's being filtered. Color is linear and premultiplied by alpha so transparent texels don't bleed
+    // into their neighbours, normal maps hold vectors in [-1, 1].
+    struct MipLevel {
+        u32 mWidth {0};
+        u32 mHeight {0};
+        vector<f32> mTexels;  // RGBA
+    };
+
+    struct FilterTap {
+        u32 mIndex;
+        f32 mWeight;
+    };
+
+    using EncodeBlockFunc = void (*)(const u8*, u8*);
+
+    static f32 SrgbToLinear(f32 value) {
+        return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    static f32 LinearToSrgb(f32 value) {
+        return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    }
+
+    static u8 ToUnorm8(f32 value) {
+        return CAST<u8>(std::lround(X_CLAMP(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    static f32 Lanczos(f32 x) {
+        x = std::abs(x);
+        if (x < 1e-5f) { return 1.0f; }
+        if (x >= kFilterLobes) { return 0.0f; }
+        const f32 px = std::numbers::pi_v<f32> * x;
+        return kFilterLobes * std::sin(px) * std::sin(px / kFilterLobes) / (px * px);
+    }
+
+    // Weights for resampling a row of `srcSize` texels to `dstSize`, one list per destination texel. When shrinking,
+    // the kernel is stretched to cover every source texel that folds into the destination texel. Edges wrap, like
+    // the engine's samplers.
+    static vector<vector<FilterTap>> ComputeFilter(u32 srcSize, u32 dstSize) {
+        const f32 scale   = CAST<f32>(srcSize) / CAST<f32>(dstSize);
+        const f32 stretch = X_MAX(scale, 1.0f);
+        const f32 support = kFilterLobes * stretch;
+
+        vector<vector<FilterTap>> filter(dstSize);
+        for (u32 i = 0; i < dstSize; ++i) {
+            const f32 center = (CAST<f32>(i) + 0.5f) * scale - 0.5f;
+            const i32 first  = CAST<i32>(std::floor(center - support));
+            const i32 last   = CAST<i32>(std::ceil(center + support));
+
+            f32 total {0};
+            for (i32 j = first; j <= last; ++j) {
+                const f32 weight = Lanczos((CAST<f32>(j) - center) / stretch);
+                if (weight == 0.0f) { continue; }
+                const i32 size = CAST<i32>(srcSize);
+                filter[i].push_back({CAST<u32>(((j % size) + size) % size), weight});
+                total += weight;
+            }
+
+            for (auto& tap : filter[i]) {
+                tap.mWeight /= total;
+            }
+        }
+
+        return filter;
+    }
+
+    // Separable resample, horizontally into an intermediate image and then vertically. The negative lobes can push
+    // texels out of range, so the result still has to go through Normalize.
+    static MipLevel Resample(const MipLevel& source, u32 width, u32 height, u32 jobs) {
+        const auto horizontal = ComputeFilter(source.mWidth, width);
+        const auto vertical   = ComputeFilter(source.mHeight, height);
+
+        vector<f32> rows(CAST<size_t>(width) * source.mHeight * 4);
+        ParallelFor(source.mHeight, jobs, [&](size_t y) {
+            const f32* in = &source.mTexels[y * source.mWidth * 4];
+            f32* out      = &rows[y * width * 4];
+            for (u32 x = 0; x < width; ++x) {
+                f32 sum[4] {};
+                for (const auto& tap : horizontal[x]) {
+                    for (u32 c = 0; c < 4; ++c) {
+                        sum[c] += in[tap.mIndex * 4 + c] * tap.mWeight;
+                    }
+                }
+                std::memcpy(out + x * 4, sum, sizeof(sum));
+            }
+        });
+
+        MipLevel result {width, height, vector<f32>(CAST<size_t>(width) * height * 4)};
+        ParallelFor(height, jobs, [&](size_t y) {
+            f32* out = &result.mTexels[y * width * 4];
+            for (const auto& tap : vertical[y]) {
+                const f32* in = &rows[CAST<size_t>(tap.mIndex) * width * 4];
+                for (u32 i = 0; i < width * 4; ++i) {
+                    out[i] += in[i] * tap.mWeight;
+                }
+            }
+        });
+
+        return result;
+    }
+
+    // Brings filtered texels back into range: premultiplied color can't exceed its alpha, normals are unit length
+    static void Normalize(MipLevel& level, bool normalMap) {
+        const size_t count = CAST<size_t>(level.mWidth) * level.mHeight;
+        for (size_t i = 0; i < count; ++i) {
+            f32* texel = &level.mTexels[i * 4];
+            texel[3]   = X_CLAMP(texel[3], 0.0f, 1.0f);
+
+            if (normalMap) {
+                const f32 length = std::sqrt(texel[0] * texel[0] + texel[1] * texel[1] + texel[2] * texel[2]);
+                for (u32 c = 0; c < 3; ++c) {
+                    texel[c] = length > 1e-6f ? texel[c] / length : (c == 2 ? 1.0f : 0.0f);
+                }
+            } else {
+                for (u32 c = 0; c < 3; ++c) {
+                    texel[c] = X_CLAMP(texel[c], 0.0f, texel[3]);
+                }
+            }
+        }
+    }
+
+    static MipLevel ToMipLevel(const u8* pixels, u32 width, u32 height, bool normalMap) {
+        f32 srgbToLinear[256];
+        for (u32 i = 0; i < 256; ++i) {
+            srgbToLinear[i] = SrgbToLinear(CAST<f32>(i) / 255.0f);
+        }
+
+        MipLevel level {width, height, vector<f32>(CAST<size_t>(width) * height * 4)};
+        for (size_t i = 0; i < level.mTexels.size(); i += 4) {
+            const f32 alpha = CAST<f32>(pixels[i + 3]) / 255.0f;
+            for (u32 c = 0; c < 3; ++c) {
+                level.mTexels[i + c] =
+                  normalMap ? CAST<f32>(pixels[i + c]) / 255.0f * 2.0f - 1.0f : srgbToLinear[pixels[i + c]] * alpha;
+            }
+            level.mTexels[i + 3] = alpha;
+        }
+
+        return level;
+    }
+
+    static vector<u8> ToRgba8(const MipLevel& level, bool normalMap) {
+        vector<u8> pixels(level.mTexels.size());
+        for (size_t i = 0; i < pixels.size(); i += 4) {
+            const f32* texel = &level.mTexels[i];
+            for (u32 c = 0; c < 3; ++c) {
+                if (normalMap) {
+                    pixels[i + c] = ToUnorm8(texel[c] * 0.5f + 0.5f);
+                } else {
+                    pixels[i + c] = ToUnorm8(texel[3] > 0.0f ? LinearToSrgb(texel[c] / texel[3]) : 0.0f);
+                }
+            }
+            pixels[i + 3] = ToUnorm8(texel[3]);
+        }
+        return pixels;
+    }
+
+    // Encodes block rows in parallel. Blocks hanging over the edge of small mips repeat the edge texels.
+    static void EncodeLevel(const vector<u8>& pixels,
+                            u32 width,
+                            u32 height,
+                            EncodeBlockFunc encode,
+                            size_t blockSize,
+                            u32 jobs,
+                            u8* out) {
+        constexpr u32 kDim = BlockCompression::kBlockDim;
+        const u32 blocksX  = (width + kDim - 1) / kDim;
+        const u32 blocksY  = (height + kDim - 1) / kDim;
+
+        ParallelFor(blocksY, jobs, [&](size_t blockY) {
+            u8 block[BlockCompression::kBlockPixels * 4];
+            for (u32 blockX = 0; blockX < blocksX; ++blockX) {
+                for (u32 y = 0; y < kDim; ++y) {
+                    const u32 sourceY = X_MIN(CAST<u32>(blockY) * kDim + y, height - 1);
+                    for (u32 x = 0; x < kDim; ++x) {
+                        const u32 sourceX = X_MIN(blockX * kDim + x, width - 1);
+                        const size_t texel = CAST<size_t>(sourceY) * width + sourceX;
+                        std::memcpy(&block[(y * kDim + x) * 4], &pixels[texel * 4], 4);
+                    }
+                }
+                encode(block, out + (blockY * blocksX + blockX) * blockSize);
+            }
+        });
+    }
+
+    static size_t GetLevelSize(u32 width, u32 height, size_t blockSize) {
+        constexpr u32 kDim = BlockCompression::kBlockDim;
+        return CAST<size_t>((width + kDim - 1) / kDim) * ((height + kDim - 1) / kDim) * blockSize;
+    }
+
+    static u32 RoundUpToBlock(u32 size) {
+        constexpr u32 kDim = BlockCompression::kBlockDim;
+        return (size + kDim - 1) / kDim * kDim;
+    }
+
+    vector<u8> TextureBaker::Bake(std::span<const u8> source,
+                                  const TextureBakeOptions& options,
+                                  TextureBakeStats* stats) {
+        i32 sourceWidth {0};
+        i32 sourceHeight {0};
+        i32 channels {0};
+        stbi_uc* decoded =
+          stbi_load_from_memory(source.data(), CAST<i32>(source.size()), &sourceWidth, &sourceHeight, &channels, 4);
+        if (!decoded) {
+            std::cerr << "Failed to decode image: " << stbi_failure_reason() << std::endl;
+            return {};
+        }
+
+        const u32 width      = CAST<u32>(sourceWidth);
+        const u32 height     = CAST<u32>(sourceHeight);
+        const bool normalMap = options.mNormalMap;
+
+        TextureFormat format = options.mFormat;
+        if (format == kTextureFormat_Auto) {
+            bool hasAlpha {false};
+            for (size_t i = 3; i < CAST<size_t>(width) * height * 4 && !hasAlpha; i += 4) {
+                hasAlpha = decoded[i] != 255;
+            }
+            format = normalMap ? kTextureFormat_BC7 : (hasAlpha ? kTextureFormat_BC3 : kTextureFormat_BC1);
+        }
+
+        MipLevel level = ToMipLevel(decoded, width, height, normalMap);
+        stbi_image_free(decoded);
+
+        const u32 jobs = options.mJobs;
+        if (width % BlockCompression::kBlockDim != 0 || height % BlockCompression::kBlockDim != 0) {
+            level = Resample(level, RoundUpToBlock(width), RoundUpToBlock(height), jobs);
+            Normalize(level, normalMap);
+        }
+
+        EncodeBlockFunc encode {nullptr};
+        u32 dxgiFormat {0};
+        switch (format) {
+            case kTextureFormat_BC1:
+                encode     = BlockCompression::EncodeBC1;
+                dxgiFormat = kDXGIFormat_BC1;
+                break;
+            case kTextureFormat_BC3:
+                encode     = BlockCompression::EncodeBC3;
+                dxgiFormat = kDXGIFormat_BC3;
+                break;
+            case kTextureFormat_BC5:
+                encode     = BlockCompression::EncodeBC5;
+                dxgiFormat = kDXGIFormat_BC5;
+                break;
+            default:
+                encode     = BlockCompression::EncodeBC7;
+                dxgiFormat = kDXGIFormat_BC7;
+                break;
+        }
+        const size_t blockSize = format == kTextureFormat_BC1 ? 8 : 16;
+
+        // Full chain down to 1x1
+        const u32 mipCount = CAST<u32>(std::bit_width(X_MAX(level.mWidth, level.mHeight)));
+
+        size_t dataSize {0};
+        u64 uncompressedSize {0};
+        for (u32 mip = 0; mip < mipCount; ++mip) {
+            const u32 mipWidth  = X_MAX(level.mWidth >> mip, 1u);
+            const u32 mipHeight = X_MAX(level.mHeight >> mip, 1u);
+            dataSize += GetLevelSize(mipWidth, mipHeight, blockSize);
+            uncompressedSize += CAST<u64>(mipWidth) * mipHeight * 4;
+        }
+
+        vector<u8> data(kDDSHeaderSize + dataSize);
+
+        DDSHeader header;
+        header.mFlags = kDDSD_Caps | kDDSD_Height | kDDSD_Width | kDDSD_PixelFmt | kDDSD_MipCount | kDDSD_LinearSize;
+        header.mHeight              = level.mHeight;
+        header.mWidth               = level.mWidth;
+        header.mPitchOrLinearSize   = CAST<u32>(GetLevelSize(level.mWidth, level.mHeight, blockSize));
+        header.mMipMapCount         = mipCount;
+        header.mPixelFormat.mFlags  = kDDPF_FourCC;
+        header.mPixelFormat.mFourCC = kDDSFourCC_DX10;
+        header.mCaps                = kDDSCaps_Texture | (mipCount > 1 ? kDDSCaps_Complex | kDDSCaps_Mipmap : 0);
+
+        DDSHeaderDX10 headerDX10;
+        headerDX10.mDXGIFormat = dxgiFormat;
+
+        std::memcpy(data.data(), &kDDSMagic, sizeof(u32));
+        std::memcpy(data.data() + sizeof(u32), &header, sizeof(DDSHeader));
+        std::memcpy(data.data() + sizeof(u32) + sizeof(DDSHeader), &headerDX10, sizeof(DDSHeaderDX10));
+
+        // Each mip is filtered from the one before it and encoded straight away, so only two float levels are ever
+        // held at once
+        u8* out = data.data() + kDDSHeaderSize;
+        for (u32 mip = 0; mip < mipCount; ++mip) {
+            if (mip > 0) {
+                level = Resample(level, X_MAX(level.mWidth / 2, 1u), X_MAX(level.mHeight / 2, 1u), jobs);
+                Normalize(level, normalMap);
+            }
+
+            const auto pixels = ToRgba8(level, normalMap);
+            EncodeLevel(pixels, level.mWidth, level.mHeight, encode, blockSize, jobs, out);
+            out += GetLevelSize(level.mWidth, level.mHeight, blockSize);
+        }
+
+        if (stats) {
+            stats->mWidth       = header.mWidth;
+            stats->mHeight      = header.mHeight;
+            stats->mMipCount    = mipCount;
+            stats->mFormat      = format;
+            stats->mSourceBytes = uncompressedSize;
+            stats->mBytes       = data.size();
+        }
+
+        return data;
+    }
+
+    bool TextureBaker::IsSourceImage(const str& extension) {
+        str lower = extension;
+        std::ranges::transform(lower, lower.begin(), [](unsigned char c) { return CAST<char>(std::tolower(c)); });
+        return lower == "png" || lower == "tga" || lower == "jpg" || lower == "jpeg" || lower == "bmp";
+    }
+
+    str TextureBaker::GetCacheSalt(const TextureBakeOptions& options) {
+        return std::format("{}:{}{}",
+                           kBakedTextureVersion,
+                           GetFormatString(options.mFormat),
+                           options.mNormalMap ? ":normal" : "");
+    }
+
+    str TextureBaker::GetFormatString(TextureFormat format) {
+        switch (format) {
+            case kTextureFormat_BC1:
+                return "bc1";
+            case kTextureFormat_BC3:
+                return "bc3";
+            case kTextureFormat_BC5:
+                return "bc5";
+            case kTextureFormat_BC7:
+                return "bc7";
+            default:
+                return "auto";
+        }
+    }
+
+    TextureFormat TextureBaker::GetFormatFromString(const str& format) {
+        if (format == "bc1") return kTextureFormat_BC1;
+        if (format == "bc3") return kTextureFormat_BC3;
+        if (format == "bc5") return kTextureFormat_BC5;
+        if (format == "bc7") return kTextureFormat_BC7;
+        return kTextureFormat_Auto;
+    }
+}  // namespace x
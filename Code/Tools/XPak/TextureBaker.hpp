@@ -0,0 +1,62 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "Common/Macros.hpp"
+#include "Common/Typedefs.hpp"
+
+#include <span>
+
+namespace x {
+    using TextureFormat                                = u8;
+    static constexpr TextureFormat kTextureFormat_Auto = 0;
+    static constexpr TextureFormat kTextureFormat_BC1  = 1;  // RGB, 4 bits per pixel
+    static constexpr TextureFormat kTextureFormat_BC3  = 2;  // RGBA, 8 bits per pixel
+    static constexpr TextureFormat kTextureFormat_BC5  = 3;  // RG, 8 bits per pixel. Shaders must rebuild Z/blue
+    static constexpr TextureFormat kTextureFormat_BC7  = 4;  // RGBA, 8 bits per pixel, highest quality
+
+    /// @brief Bumped whenever the baked output changes, so cached textures get rebaked.
+    static constexpr u32 kBakedTextureVersion = 1;
+
+    struct TextureBakeOptions {
+        // Auto picks BC1 for opaque textures, BC3 for ones with alpha and BC7 for normal maps
+        TextureFormat mFormat {kTextureFormat_Auto};
+        // Normal maps are filtered as vectors and renormalized for every mip. Everything else is treated as sRGB
+        // color and filtered in linear space.
+        bool mNormalMap {false};
+        u32 mJobs {0};  // Threads used to filter and encode, 0 = one per core
+    };
+
+    struct TextureBakeStats {
+        u32 mWidth {0};
+        u32 mHeight {0};
+        u32 mMipCount {0};
+        TextureFormat mFormat {kTextureFormat_Auto};
+        u64 mSourceBytes {0};  // Size of the same mip chain as uncompressed RGBA8
+        u64 mBytes {0};
+    };
+
+    /// @brief Decodes a source image (PNG, TGA, JPEG or BMP), generates a full mip chain and block compresses it into
+    /// a DDS file the engine's texture loader reads directly. Images whose size isn't a multiple of 4 are resampled
+    /// up to one, since block compressed textures can't be created otherwise.
+    class TextureBaker {
+    public:
+        /// @brief Returns an empty vector if the image couldn't be decoded. `stats` is filled in if provided.
+        static vector<u8> Bake(std::span<const u8> source,
+                               const TextureBakeOptions& options = {},
+                               TextureBakeStats* stats           = nullptr);
+
+        /// @brief True for the source image formats Bake reads, by file extension. DDS files aren't baked, they're
+        /// already in the runtime format.
+        static bool IsSourceImage(const str& extension);
+
+        /// @brief Everything besides the source bytes that affects what Bake produces, for build cache keys (see
+        /// XPakCache::MakeKey). The job count doesn't, the output is the same however many threads made it.
+        static str GetCacheSalt(const TextureBakeOptions& options);
+
+        static str GetFormatString(TextureFormat format);
+        static TextureFormat GetFormatFromString(const str& format);
+    };
+}  // namespace x
@@ -3,17 +3,116 @@
 //
 
 #include "XPak.hpp"
+#include "XPakWriter.hpp"
+#include "XPakCache.hpp"
+#include "XPakMount.hpp"
 #include "Compression.hpp"
+#include "DescriptorCompiler.hpp"
+#include "MeshBaker.hpp"
+#include "MeshOptimizer.hpp"
 #include "ScriptCompiler.hpp"
-
+#include "TextureBaker.hpp"
+#include "Common/Checksum.hpp"
+#include "Common/Parallel.hpp"
+#include "Common/Timer.hpp"
+#include "Common/XML.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
 #include <numeric>
+#include <unordered_set>
 #include <brotli/encode.h>
 
 namespace x {
-    static void ProcessAssetDirectory(const Path& directory,
-                                      vector<XPakTableEntry>& tableEntries,
-                                      vector<XPakAssetEntry>& assetEntries) {
+    struct PendingAsset {
+        AssetDescriptor mDescriptor;
+        AssetType mType {kAssetType_Invalid};
+        Path mSourceFile;
+        CodecId mCodec {kCodec_None};
+        bool mNormalMap {false};  // Referenced as a normal map by a material, so it's baked as one
+        optional<size_t> mSharedWith;  // Index of an earlier asset with identical contents, whose payload it reuses
+    };
+
+    struct ProcessedAsset {
+        XPakTableEntry mTableEntry;
+        XPakAssetEntry mAssetEntry;
+        u64 mSourceSize {0};
+        f64 mSeconds {0};
+        bool mCacheable {false};
+        bool mCacheHit {false};
+        f64 mSavedSeconds {0};  // Original processing time minus the time spent loading from the cache
+        f64 mDecodeSeconds {0};  // Only measured with XPakCreateOptions::mVerifyDecode
+        bool mFailed {false};    // Compiling/baking failed or the payload didn't round-trip, see EncodeAsset
+        optional<MeshBakeStats> mMeshStats;  // Only for meshes that were baked, not loaded from the cache
+        optional<TextureBakeStats> mTextureStats;  // Same for textures
+    };
+
+    struct AssetTypeStats {
+        size_t mCount {0};
+        u64 mSourceBytes {0};
+        u64 mOutputBytes {0};
+        f64 mSeconds {0};
+        size_t mCacheHits {0};
+        size_t mCacheMisses {0};
+        f64 mSavedSeconds {0};
+    };
+
+    struct CodecStats {
+        size_t mCount {0};
+        u64 mSize {0};
+        u64 mCompressedSize {0};
+        f64 mDecodeSeconds {0};
+    };
+
+    struct PackStats {
+        std::map<AssetType, AssetTypeStats> mByType;
+        std::map<CodecId, CodecStats> mByCodec;
+        vector<std::pair<str, MeshBakeStats>> mMeshes;
+        vector<std::pair<str, TextureBakeStats>> mTextures;
+        size_t mSharedCount {0};
+        u64 mSharedBytes {0};  // Stored bytes that would have been written again without deduplication
+    };
+
+    static bool IsDescriptorType(AssetType type) {
+        return type == kAssetType_Material || type == kAssetType_Scene;
+    }
+
+    // Descriptors are tiny and made of the same few tags/strings, so on their own they barely compress. They're
+    // compressed against a dictionary shared by all of them instead, which is stored once in the pak.
+    static bool UsesDictionary(const PendingAsset& pending) {
+        return IsDescriptorType(pending.mType) && pending.mCodec != kCodec_None;
+    }
+
+    static bool CompilesDescriptor(AssetType type, const XPakCreateOptions& options) {
+        return IsDescriptorType(type) && options.mCompileDescriptors;
+    }
+
+    // Compiles scene/material XML into the binary form the runtime loads, see DescriptorCompiler
+    static vector<u8> CompileDescriptor(AssetType type, std::span<const u8> xml) {
+        if (type == kAssetType_Scene) { return DescriptorCompiler::CompileScene(xml); }
+        return DescriptorCompiler::CompileMaterial(xml);
+    }
+
+    // PNG/TGA textures are baked to block compressed DDS, textures that are already DDS are stored as authored
+    static bool BakesTexture(AssetType type, const Path& source) {
+        return type == kAssetType_Texture && TextureBaker::IsSourceImage(source.Extension());
+    }
+
+    // The dictionary and dependency blocks are padded like an asset block so the assets after them keep their alignment
+    static size_t GetPaddedBlockSize(size_t size) {
+        if (size % kAssetByteAlignment == 0) { return size; }
+        return size + kAssetByteAlignment - (size % kAssetByteAlignment);
+    }
+
+    static vector<PendingAsset> CollectAssets(const ProjectDescriptor& project) {
+        const auto directory = Path(project.mContentDirectory);
+        vector<PendingAsset> pending;
+
         for (auto& file : directory.Entries()) {
             if (file.IsFile()) {
                 if (file.Extension() == "xasset") {
@@ -36,55 +135,693 @@ namespace x {
                         continue;
                     }
 
-                    XPakTableEntry tableEntry;
-                    tableEntry.mAssetId = asset.mId;
-
-                    const auto filename  = file.Parent() / asset.mFilename;
-                    const auto assetData = FileReader::ReadBytes(filename);
-                    XPakAssetEntry assetEntry;
-
-                    if (assetType == kAssetType_Texture || assetType == kAssetType_Audio) {
-                        // Textures are already compressed (DDS) and audio should not be compressed (WAV)
-                        assetEntry.mCompressedData = assetData;
-                        // Both textures and audio assets can be streamed, no decompression is required
-                        tableEntry.mAssetFlags |= kAssetFlag_Streamable;
-
-                        tableEntry.mSize           = assetData.size();
-                        tableEntry.mCompressedSize = tableEntry.mSize;
-                    } else if (assetType == kAssetType_Script) {
-                        // Scripts can get compiled to bytecode
-                        const str scriptSource    = FileReader::ReadText(filename);
-                        vector<u8> scriptBytecode = ScriptCompiler::Compile(scriptSource, filename.Str());
-                        if (scriptBytecode.size() == 0) {
-                            printf("Failed to compile lua bytecode for script '%s'\n", filename.CStr());
-                        }
-                        assetEntry.mCompressedData = scriptBytecode;
-                        tableEntry.mAssetFlags     = 0;
-
-                        tableEntry.mSize           = scriptBytecode.size();
-                        tableEntry.mCompressedSize = tableEntry.mSize;
-                    } else {
-                        // Everything else gets compressed with Brotli (for now)
-                        assetEntry.mCompressedData = BrotliCompression::Compress(assetData);
-                        auto flags                 = kAssetFlag_Compressed;
-
-                        if (assetType == kAssetType_Material || assetType == kAssetType_Scene) {
-                            flags |= kAssetFlag_Descriptor;
-                        }
+                    pending.push_back({asset, assetType, file.Parent() / asset.mFilename, project.GetCodec(assetType)});
+                }
+            }
+        }
 
-                        tableEntry.mAssetFlags = flags;
+        return pending;
+    }
 
-                        tableEntry.mSize           = assetData.size();
-                        tableEntry.mCompressedSize = assetEntry.mCompressedData.size();
-                    }
+    // Normal maps are filtered and encoded differently from color textures. Nothing on the texture itself says what
+    // it's used for, so this goes by what the materials bind it as.
+    static void FindNormalMaps(vector<PendingAsset>& pending) {
+        std::unordered_set<AssetId> normalMaps;
+        for (const auto& asset : pending) {
+            if (asset.mType != kAssetType_Material) { continue; }
+
+            rapidxml::xml_document<> doc;
+            if (!XML::ReadFile(asset.mSourceFile, doc)) { continue; }
+            const auto* materialNode = doc.first_node("Material");
+            const auto* texturesNode = materialNode ? materialNode->first_node("Textures") : nullptr;
+            if (!texturesNode) { continue; }
+
+            for (const auto* texture = texturesNode->first_node("Texture"); texture;
+                 texture             = texture->next_sibling()) {
+                const auto* name  = texture->first_attribute("name");
+                const auto* asset = texture->first_attribute("asset");
+                if (name && asset && X_STRCMP(name->value(), "normal")) {
+                    normalMaps.insert(std::strtoull(asset->value(), nullptr, 10));
+                }
+            }
+        }
+
+        for (auto& asset : pending) {
+            asset.mNormalMap = asset.mType == kAssetType_Texture && normalMaps.contains(asset.mDescriptor.mId);
+        }
+    }
+
+    static std::unique_ptr<CompressionDictionary> TrainDictionary(const vector<PendingAsset>& pending,
+                                                                  const XPakCreateOptions& options) {
+        if (!options.mDictionary) { return nullptr; }
+
+        vector<vector<u8>> samples;
+        for (const auto& asset : pending) {
+            if (!UsesDictionary(asset)) { continue; }
+
+            // Trained on what's actually going to be compressed
+            auto sample = FileReader::ReadBytes(asset.mSourceFile);
+            if (CompilesDescriptor(asset.mType, options)) { sample = CompileDescriptor(asset.mType, sample); }
+            if (!sample.empty()) { samples.push_back(std::move(sample)); }
+        }
+
+        const Timer timer;
+        auto data = CompressionDictionary::Train(samples);
+        if (data.empty()) { return nullptr; }
+
+        printf(" - Trained %zu byte dictionary from %zu descriptor(s) in %.3f s\n",
+               data.size(),
+               samples.size(),
+               timer.Elapsed());
+        return std::make_unique<CompressionDictionary>(std::move(data));
+    }
+
+    // Reads the asset IDs a scene or material references straight out of its source XML
+    static vector<AssetId> ReadReferences(const PendingAsset& pending) {
+        vector<AssetId> references;
+        rapidxml::xml_document<> doc;
+        if (!XML::ReadFile(pending.mSourceFile, doc)) {
+            printf("Failed to parse descriptor '%s'\n", pending.mSourceFile.CStr());
+            return references;
+        }
+
+        if (pending.mType == kAssetType_Scene) {
+            const auto* sceneNode    = doc.first_node("Scene");
+            const auto* entitiesNode = sceneNode ? sceneNode->first_node("Entities") : nullptr;
+            if (!entitiesNode) { return references; }
+
+            for (const auto* entity = entitiesNode->first_node("Entity"); entity; entity = entity->next_sibling()) {
+                const auto* componentsNode = entity->first_node("Components");
+                if (!componentsNode) { continue; }
+
+                if (const auto* modelNode = componentsNode->first_node("Model")) {
+                    references.push_back(XML::GetAttrId(modelNode->first_node("Mesh")));
+                    references.push_back(XML::GetAttrId(modelNode->first_node("Material")));
+                }
+                if (const auto* behaviorNode = componentsNode->first_node("Behavior")) {
+                    references.push_back(XML::GetAttrId(behaviorNode->first_node("Script")));
+                }
+            }
+        } else if (pending.mType == kAssetType_Material) {
+            const auto* materialNode = doc.first_node("Material");
+            const auto* texturesNode = materialNode ? materialNode->first_node("Textures") : nullptr;
+            if (!texturesNode) { return references; }
+
+            for (const auto* texture = texturesNode->first_node("Texture"); texture;
+                 texture             = texture->next_sibling()) {
+                if (const auto* asset = texture->first_attribute("asset")) {
+                    references.push_back(std::strtoull(asset->value(), nullptr, 10));
+                }
+            }
+        }
+
+        // Missing or malformed IDs read back as 0
+        std::erase(references, 0);
+        return references;
+    }
+
+    // Resolves what every scene and material needs in order to be loaded. Scenes get their whole closure so a loader
+    // can request all of it up front, before instantiating anything. References to assets that aren't part of the
+    // project are reported and dropped.
+    static AssetDependencies ResolveDependencies(const vector<PendingAsset>& pending,
+                                                 const XPakCreateOptions& options) {
+        AssetDependencies dependencies;
+        if (!options.mDependencies) { return dependencies; }
+
+        const Timer timer;
+        std::unordered_set<AssetId> packed;
+        for (const auto& asset : pending) {
+            packed.insert(asset.mDescriptor.mId);
+        }
+
+        unordered_map<AssetId, vector<AssetId>> references;
+        for (const auto& asset : pending) {
+            if (!IsDescriptorType(asset.mType)) { continue; }
+
+            auto& direct = references[asset.mDescriptor.mId];
+            for (const auto reference : ReadReferences(asset)) {
+                if (packed.contains(reference)) {
+                    direct.push_back(reference);
+                } else {
+                    printf("Asset '%s' references asset %llu, which isn't part of the project\n",
+                           asset.mSourceFile.CStr(),
+                           reference);
+                }
+            }
+        }
 
-                    tableEntries.push_back(tableEntry);
-                    assetEntries.push_back(assetEntry);
+        size_t total {0};
+        for (const auto& [id, direct] : references) {
+            // Depth-first, so a material's textures are listed right after the material
+            vector<AssetId> closure;
+            std::unordered_set<AssetId> visited {id};
+            vector<AssetId> stack(direct.rbegin(), direct.rend());
+            while (!stack.empty()) {
+                const AssetId dependency = stack.back();
+                stack.pop_back();
+                if (!visited.insert(dependency).second) { continue; }
+
+                closure.push_back(dependency);
+                if (const auto it = references.find(dependency); it != references.end()) {
+                    stack.insert(stack.end(), it->second.rbegin(), it->second.rend());
                 }
             }
+
+            if (closure.empty()) { continue; }
+            total += closure.size();
+            dependencies[id] = std::move(closure);
+        }
+
+        printf(" - Resolved %zu dependencies for %zu asset(s) in %.3f s\n",
+               total,
+               dependencies.size(),
+               timer.Elapsed());
+        return dependencies;
+    }
+
+    // Reads an access trace recorded by the runtime: one asset ID per line, '#' starts a comment. Returns the IDs in
+    // the order they were first accessed.
+    static vector<AssetId> ReadLayoutTrace(const Path& filename) {
+        vector<AssetId> trace;
+        std::unordered_set<AssetId> seen;
+        for (const auto& line : FileReader::ReadLines(filename)) {
+            if (line.empty() || line[0] == '#') { continue; }
+            const AssetId id = std::strtoull(line.c_str(), nullptr, 10);
+            if (id != 0 && seen.insert(id).second) { trace.push_back(id); }
+        }
+        return trace;
+    }
+
+    // Lays the assets out in the order they get loaded, so loading a scene reads the pak mostly front to back instead
+    // of seeking all over it. Scene descriptors come first since they're all read at startup, followed by the traced
+    // assets in the order they were first accessed. Anything the trace didn't cover follows scene by scene, each
+    // scene's closure in turn. Assets no scene references go last. Ties keep their discovery order.
+    static void OrderAssets(vector<PendingAsset>& pending,
+                            const AssetDependencies& dependencies,
+                            const XPakCreateOptions& options) {
+        unordered_map<AssetId, size_t> rank;
+        const auto place = [&rank](AssetId id) { rank.try_emplace(id, rank.size()); };
+
+        for (const auto& asset : pending) {
+            if (asset.mType == kAssetType_Scene) { place(asset.mDescriptor.mId); }
+        }
+
+        if (!options.mLayoutTrace.Str().empty()) {
+            const auto trace = ReadLayoutTrace(options.mLayoutTrace);
+            for (const auto id : trace) {
+                place(id);
+            }
+
+            // IDs that aren't part of the project (e.g. assets removed since the trace was recorded) are harmless
+            const auto traced = std::ranges::count_if(pending, [&trace](const PendingAsset& asset) {
+                return std::ranges::find(trace, asset.mDescriptor.mId) != trace.end();
+            });
+            printf(" - Ordered %zu of %zu asset(s) by access trace '%s'\n",
+                   CAST<size_t>(traced),
+                   pending.size(),
+                   options.mLayoutTrace.CStr());
+        }
+
+        for (const auto& asset : pending) {
+            if (asset.mType != kAssetType_Scene) { continue; }
+            if (const auto it = dependencies.find(asset.mDescriptor.mId); it != dependencies.end()) {
+                for (const auto id : it->second) {
+                    place(id);
+                }
+            }
+        }
+
+        std::ranges::stable_sort(pending, {}, [&rank](const PendingAsset& asset) {
+            const auto it = rank.find(asset.mDescriptor.mId);
+            return it != rank.end() ? it->second : std::numeric_limits<size_t>::max();
+        });
+    }
+
+    // Several descriptors can point at the same file, or at copies of it. Those would all be processed into the same
+    // payload, so only the first (in layout order) is encoded and written and the rest get table entries pointing at
+    // its data. Files are only read and hashed when another asset of the same type has the same size. The salt covers
+    // everything besides the contents that affects the output: the extension picks the importer, normal maps are baked
+    // differently, and Lua bytecode embeds the chunk name so scripts are only shared if they're the same file.
+    static void FindSharedPayloads(vector<PendingAsset>& pending, const XPakCreateOptions& options) {
+        if (!options.mDeduplicate) { return; }
+
+        std::map<std::pair<AssetType, size_t>, vector<size_t>> bySize;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            bySize[{pending[i].mType, FileReader::QueryFileSize(pending[i].mSourceFile)}].push_back(i);
+        }
+
+        size_t shared {0};
+        for (const auto& [key, indices] : bySize) {
+            if (indices.size() < 2 || key.second == 0) { continue; }
+
+            // The first asset with each hash, along with what it was hashed from
+            struct FirstAsset {
+                size_t mIndex {0};
+                str mSalt;
+                vector<u8> mBytes;
+            };
+            unordered_map<u64, FirstAsset> firstByHash;
+            for (const auto i : indices) {
+                auto& asset = pending[i];
+                str salt =
+                  std::format("{}:{}:{}",
+                              asset.mSourceFile.Extension(),
+                              asset.mNormalMap ? "normal" : "",
+                              asset.mType == kAssetType_Script ? asset.mSourceFile.Str() : "");
+                auto bytes     = FileReader::ReadBytes(asset.mSourceFile);
+                const u64 hash = XPakCache::MakeKey(bytes, asset.mType, asset.mCodec, 0, 0, salt);
+
+                // Indices are in layout order, so the first one seen is the one whose payload gets written
+                const auto it = firstByHash.find(hash);
+                if (it == firstByHash.end()) {
+                    firstByHash.emplace(hash, FirstAsset {i, std::move(salt), std::move(bytes)});
+                    continue;
+                }
+
+                // A matching hash isn't proof, a collision would ship one asset's data under the other's ID. Both
+                // files are the same size, so comparing them is cheap next to processing either.
+                const auto& first = it->second;
+                if (salt != first.mSalt || pending[first.mIndex].mCodec != asset.mCodec ||
+                    bytes.size() != first.mBytes.size() ||
+                    std::memcmp(bytes.data(), first.mBytes.data(), bytes.size()) != 0) {
+                    printf("Assets '%s' and '%s' have colliding content hashes, storing both\n",
+                           pending[first.mIndex].mSourceFile.CStr(),
+                           asset.mSourceFile.CStr());
+                    continue;
+                }
+
+                asset.mSharedWith = first.mIndex;
+                shared++;
+            }
+        }
+
+        if (shared > 0) {
+            printf(" - %zu asset(s) have the same contents as another and will share its payload\n", shared);
+        }
+    }
+
+    // Decodes a freshly compressed payload and checks it against the data it was compressed from, catching a codec
+    // producing something it can't read back before it ends up in a pak. Also times the decode, so the codec choice
+    // for each asset type can be made by measurement. Only done with XPakCreateOptions::mVerifyDecode.
+    static bool VerifyDecode(const XPakTableEntry& entry,
+                             std::span<const u8> payload,
+                             std::span<const u8> original,
+                             const CompressionDictionary* dictionary,
+                             f64& seconds) {
+        const Timer timer;
+        vector<u8> decoded;
+        bool decodedAll;
+        if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Chunked)) {
+            decoded    = ChunkedCompression::Decompress(payload, entry.mSize, entry.GetCodec(), 1);
+            decodedAll = decoded.size() == entry.mSize;
+        } else {
+            const auto* codec = CompressionCodecs::Get(entry.GetCodec());
+            decoded.resize(entry.mSize);
+            decodedAll = codec && codec->mDecompress(payload, decoded, dictionary);
+        }
+        seconds = timer.Elapsed();
+        return decodedAll && std::ranges::equal(decoded, original);
+    }
+
+    // Does the actual (expensive) work of compressing or compiling a single asset. Called from worker threads, so it
+    // must not touch any shared state. When a cache is provided, compressed/compiled payloads are looked up by content
+    // hash first and stored after a miss. `dictionary` is the pak's shared dictionary, or null if it doesn't have one.
+    static void EncodeAsset(const PendingAsset& pending,
+                             ProcessedAsset& processed,
+                             const XPakCache* cache,
+                             const CompressionDictionary* dictionary,
+                             const XPakCreateOptions& options) {
+        const Timer timer;
+
+        const auto assetType = pending.mType;
+        const auto& filename = pending.mSourceFile;
+        const auto codec     = pending.mCodec;
+        auto& tableEntry     = processed.mTableEntry;
+        auto& assetEntry     = processed.mAssetEntry;
+
+        tableEntry.mAssetId = pending.mDescriptor.mId;
+
+        auto assetData        = FileReader::ReadBytes(filename);
+        processed.mSourceSize = assetData.size();
+
+        const u16 typeFlags = IsDescriptorType(assetType) ? kAssetFlag_Descriptor : 0;
+
+        // Scripts, meshes, descriptors and source image textures are compiled/baked into their runtime format,
+        // everything else is stored as authored
+        const bool compiled = assetType == kAssetType_Script || assetType == kAssetType_Mesh ||
+                              CompilesDescriptor(assetType, options) || BakesTexture(assetType, filename);
+
+        if (codec == kCodec_None && !compiled) {
+            // Stored as-is, e.g. textures are already compressed (DDS) and audio should not be compressed (WAV).
+            // Uncompressed assets can be streamed straight out of the pak, no decompression is required.
+            tableEntry.mAssetFlags = typeFlags;
+            if (assetType == kAssetType_Texture || assetType == kAssetType_Audio) {
+                tableEntry.mAssetFlags |= kAssetFlag_Streamable;
+            }
+
+            tableEntry.mSize           = assetData.size();
+            tableEntry.mCompressedSize = tableEntry.mSize;
+            assetEntry.mCompressedData = std::move(assetData);
+
+            processed.mSeconds = timer.Elapsed();
+            return;
+        }
+
+        // Large meshes are split into frames so they can be partially read and decoded in parallel. Descriptors and
+        // scripts are small and parsed in one go, so they stay as a single stream. Meshes are judged on their source
+        // size since the frame size is part of the cache key, the baked mesh is usually in the same ballpark.
+        const bool chunked = codec != kCodec_None && assetType == kAssetType_Mesh && options.mFrameSize > 0 &&
+                             assetData.size() > options.mFrameSize;
+        const u32 frameSize = chunked ? options.mFrameSize : 0;
+
+        if (!UsesDictionary(pending)) { dictionary = nullptr; }
+        const u64 dictionaryHash = dictionary ? dictionary->GetHash() : 0;
+
+        MeshBakeOptions meshOptions;
+        meshOptions.mOptimize = options.mOptimizeMeshes;
+        meshOptions.mQuantize = options.mQuantizeMeshes;
+
+        // This already runs on one of options.mJobs workers, so a texture is baked on this thread alone rather than
+        // fanning out over that many again (and starting new threads for every mip level)
+        TextureBakeOptions textureOptions;
+        textureOptions.mFormat    = options.mTextureFormat;
+        textureOptions.mNormalMap = pending.mNormalMap;
+        textureOptions.mJobs      = 1;
+
+        // Lua bytecode embeds the chunk name, so scripts are keyed on their path as well as their contents. Baked
+        // meshes depend on the importer's format hint and the baked layout version.
+        str salt;
+        if (assetType == kAssetType_Script) {
+            salt = filename.Str();
+        } else if (assetType == kAssetType_Mesh) {
+            salt = MeshBaker::GetCacheSalt(filename.Extension(), meshOptions);
+        } else if (CompilesDescriptor(assetType, options)) {
+            salt = std::format("binary:{}", kBinaryDescriptorVersion);
+        } else if (BakesTexture(assetType, filename)) {
+            salt = TextureBaker::GetCacheSalt(textureOptions);
+        }
+        const u64 key  = XPakCache::MakeKey(assetData, assetType, codec, frameSize, dictionaryHash, salt);
+        processed.mCacheable = cache != nullptr && cache->IsOpen();
+
+        if (processed.mCacheable) {
+            if (auto record = cache->Load(key)) {
+                tableEntry.mAssetFlags     = record->mAssetFlags;
+                tableEntry.mCodec          = record->mCodec;
+                tableEntry.mSize           = record->mSize;
+                tableEntry.mCompressedSize = record->mPayload.size();
+                assetEntry.mCompressedData = std::move(record->mPayload);
+
+                processed.mCacheHit     = true;
+                processed.mSeconds      = timer.Elapsed();
+                processed.mSavedSeconds = X_MAX(record->mSeconds - processed.mSeconds, 0.0);
+                return;
+            }
+        }
+
+        if (assetType == kAssetType_Script) {
+            // Scripts get compiled to bytecode first
+            const str scriptSource = str(assetData.begin(), assetData.end());
+            assetData              = ScriptCompiler::Compile(scriptSource, filename.Str());
+            if (assetData.size() == 0) {
+                printf("Failed to compile lua bytecode for script '%s'\n", filename.CStr());
+                // Don't cache failures, the script is likely to be fixed before the next build
+                processed.mFailed    = true;
+                processed.mCacheable = false;
+                return;
+            }
+        } else if (assetType == kAssetType_Mesh) {
+            // Imported once here so the runtime can hand the vertex/index blobs straight to the GPU
+            MeshBakeStats bakeStats;
+            assetData = MeshBaker::Bake(assetData, filename.Extension(), meshOptions, &bakeStats);
+            if (assetData.size() == 0) {
+                printf("Failed to bake mesh '%s'\n", filename.CStr());
+                processed.mFailed    = true;
+                processed.mCacheable = false;
+                return;
+            }
+            processed.mMeshStats = bakeStats;
+        } else if (CompilesDescriptor(assetType, options)) {
+            assetData = CompileDescriptor(assetType, assetData);
+            if (assetData.size() == 0) {
+                printf("Failed to compile descriptor '%s'\n", filename.CStr());
+                processed.mFailed    = true;
+                processed.mCacheable = false;
+                return;
+            }
+        } else if (BakesTexture(assetType, filename)) {
+            TextureBakeStats bakeStats;
+            assetData = TextureBaker::Bake(assetData, textureOptions, &bakeStats);
+            if (assetData.size() == 0) {
+                printf("Failed to bake texture '%s'\n", filename.CStr());
+                processed.mFailed    = true;
+                processed.mCacheable = false;
+                return;
+            }
+            processed.mTextureStats = bakeStats;
+        }
+
+        tableEntry.mSize = assetData.size();
+        if (codec == kCodec_None) {
+            tableEntry.mAssetFlags     = typeFlags;
+            assetEntry.mCompressedData = std::move(assetData);
+            if (assetType == kAssetType_Texture) { tableEntry.mAssetFlags |= kAssetFlag_Streamable; }
+        } else if (chunked) {
+            // Frames can be decoded independently, so chunked assets are streamable even though they're compressed
+            assetEntry.mCompressedData = ChunkedCompression::Compress(assetData, codec, frameSize);
+            tableEntry.mAssetFlags     = kAssetFlag_Compressed | kAssetFlag_Chunked | kAssetFlag_Streamable;
+            tableEntry.mCodec          = codec;
+        } else {
+            assetEntry.mCompressedData = CompressionCodecs::Compress(codec, assetData, dictionary);
+            tableEntry.mAssetFlags     = kAssetFlag_Compressed | typeFlags;
+            tableEntry.mCodec          = codec;
+            if (dictionary) { tableEntry.mAssetFlags |= kAssetFlag_Dictionary; }
+        }
+        tableEntry.mCompressedSize = assetEntry.mCompressedData.size();
+
+        processed.mSeconds = timer.Elapsed();
+
+        if (codec != kCodec_None && options.mVerifyDecode &&
+            !VerifyDecode(tableEntry, assetEntry.mCompressedData, assetData, dictionary, processed.mDecodeSeconds)) {
+            printf("Codec '%s' failed to round-trip asset '%s'\n", CompressionCodecs::GetName(codec), filename.CStr());
+            processed.mFailed    = true;
+            processed.mCacheable = false;
+            return;
+        }
+
+        if (processed.mCacheable) {
+            XPakCacheRecord record;
+            record.mAssetFlags = tableEntry.mAssetFlags;
+            record.mCodec      = tableEntry.mCodec;
+            record.mSize       = tableEntry.mSize;
+            record.mSeconds    = processed.mSeconds;
+            record.mPayload    = assetEntry.mCompressedData;
+            if (!cache->Store(key, record)) {
+                printf("Failed to write cache entry for asset '%s'\n", filename.CStr());
+            }
+        }
+    }
+
+    // Encodes an asset (see EncodeAsset) and checksums the payload that ends up in the pak. The checksum isn't part of
+    // the cache record, so it's always taken from the exact bytes being written.
+    static void ProcessAsset(const PendingAsset& pending,
+                             ProcessedAsset& processed,
+                             const XPakCache* cache,
+                             const CompressionDictionary* dictionary,
+                             const XPakCreateOptions& options) {
+        // Nothing to encode, the table entry is copied from the asset it shares a payload with
+        if (pending.mSharedWith.has_value()) { return; }
+
+        EncodeAsset(pending, processed, cache, dictionary, options);
+        processed.mTableEntry.mChecksum = Crc32c(processed.mAssetEntry.mCompressedData);
+        processed.mTableEntry.mAssetFlags |= kAssetFlag_Checksum;
+    }
+
+    static void AccumulateStats(PackStats& packStats, const PendingAsset& pending, const ProcessedAsset& asset) {
+        const auto& entry = asset.mTableEntry;
+        if (asset.mMeshStats.has_value()) {
+            packStats.mMeshes.emplace_back(pending.mSourceFile.Filename(), *asset.mMeshStats);
+        }
+        if (asset.mTextureStats.has_value()) {
+            packStats.mTextures.emplace_back(pending.mSourceFile.Filename(), *asset.mTextureStats);
+        }
+
+        if (entry.GetCodec() != kCodec_None) {
+            auto& codecStats = packStats.mByCodec[entry.GetCodec()];
+            codecStats.mCount++;
+            codecStats.mSize += entry.mSize;
+            codecStats.mCompressedSize += entry.mCompressedSize;
+            codecStats.mDecodeSeconds += asset.mDecodeSeconds;
+        }
+
+        auto& stats = packStats.mByType[AssetDescriptor::GetTypeFromId(entry.mAssetId)];
+        stats.mCount++;
+        stats.mSourceBytes += asset.mSourceSize;
+        stats.mOutputBytes += asset.mTableEntry.mCompressedSize;
+        stats.mSeconds += asset.mSeconds;
+        if (asset.mCacheable) {
+            if (asset.mCacheHit) {
+                stats.mCacheHits++;
+                stats.mSavedSeconds += asset.mSavedSeconds;
+            } else {
+                stats.mCacheMisses++;
+            }
+        }
+    }
+
+    static void PrintProcessingStats(const PackStats& packStats, f64 wallSeconds, u32 jobs) {
+        constexpr f64 kMegabyte = 1024.0 * 1024.0;
+        u64 totalSourceBytes {0};
+        size_t cacheHits {0};
+        size_t cacheMisses {0};
+        f64 savedSeconds {0};
+
+        printf("\n");
+        printf(" - %-10s %8s %12s %12s %10s %10s\n", "Type", "Count", "Source (MB)", "Output (MB)", "Time (s)", "MB/s");
+        for (const auto& [type, stats] : packStats.mByType) {
+            const f64 sourceMb = CAST<f64>(stats.mSourceBytes) / kMegabyte;
+            const f64 outputMb = CAST<f64>(stats.mOutputBytes) / kMegabyte;
+            // Time is summed across workers, so this is the per-thread throughput for the asset type
+            const f64 throughput = stats.mSeconds > 0.0 ? sourceMb / stats.mSeconds : 0.0;
+            printf(" - %-10s %8zu %12.2f %12.2f %10.3f %10.2f\n",
+                   AssetDescriptor::GetTypeString(type).c_str(),
+                   stats.mCount,
+                   sourceMb,
+                   outputMb,
+                   stats.mSeconds,
+                   throughput);
+            totalSourceBytes += stats.mSourceBytes;
+            cacheHits += stats.mCacheHits;
+            cacheMisses += stats.mCacheMisses;
+            savedSeconds += stats.mSavedSeconds;
+        }
+
+        const f64 totalMb = CAST<f64>(totalSourceBytes) / kMegabyte;
+        printf(" - Processed %.2f MB in %.3f s on %u thread(s) (%.2f MB/s)\n",
+               totalMb,
+               wallSeconds,
+               jobs,
+               wallSeconds > 0.0 ? totalMb / wallSeconds : 0.0);
+
+        if (cacheHits + cacheMisses > 0) {
+            // Time saved is thread time, like the per-type timings above
+            printf(" - Cache: %zu hit(s), %zu miss(es), %.3f s saved\n", cacheHits, cacheMisses, savedSeconds);
+        }
+
+        if (packStats.mSharedCount > 0) {
+            printf(" - Deduplicated: %zu asset(s) share another's payload, %.2f MB saved\n",
+                   packStats.mSharedCount,
+                   CAST<f64>(packStats.mSharedBytes) / kMegabyte);
+        }
+
+        if (!packStats.mByCodec.empty()) {
+            printf("\n");
+            printf(" - %-10s %8s %12s %12s %10s %12s\n", "Codec", "Count", "Size (MB)", "Packed (MB)", "Ratio", "Decode MB/s");
+            for (const auto& [codec, stats] : packStats.mByCodec) {
+                const f64 sizeMb   = CAST<f64>(stats.mSize) / kMegabyte;
+                const f64 packedMb = CAST<f64>(stats.mCompressedSize) / kMegabyte;
+                // Decodes are only timed with --verify-decode, and never for payloads that came out of the cache
+                const str decode =
+                  stats.mDecodeSeconds > 0.0 ? std::format("{:.2f}", sizeMb / stats.mDecodeSeconds) : "-";
+                printf(" - %-10s %8zu %12.2f %12.2f %10.3f %12s\n",
+                       CompressionCodecs::GetName(codec),
+                       stats.mCount,
+                       sizeMb,
+                       packedMb,
+                       sizeMb > 0.0 ? packedMb / sizeMb : 0.0,
+                       decode.c_str());
+            }
+        }
+
+        if (!packStats.mMeshes.empty()) {
+            printf("\n");
+            printf(" - Meshes baked this run, as imported -> as baked (ACMR modeled with a %u entry FIFO cache)\n",
+                   MeshOptimizer::kModeledCacheSize);
+            printf(" - %-24s %10s %21s %21s %13s %13s\n",
+                   "Mesh",
+                   "Triangles",
+                   "Vertices",
+                   "Size (KB)",
+                   "ACMR",
+                   "ATVR");
+            for (const auto& [name, mesh] : packStats.mMeshes) {
+                printf(" - %-24s %10llu %10llu %10llu %10.1f %10.1f %6.3f %6.3f %6.3f %6.3f\n",
+                       name.c_str(),
+                       mesh.mTriangles,
+                       mesh.mSourceVertices,
+                       mesh.mVertices,
+                       CAST<f64>(mesh.mSourceBytes) / 1024.0,
+                       CAST<f64>(mesh.mBytes) / 1024.0,
+                       mesh.mSourceAcmr,
+                       mesh.mAcmr,
+                       mesh.mSourceAtvr,
+                       mesh.mAtvr);
+            }
+        }
+
+        if (!packStats.mTextures.empty()) {
+            printf("\n");
+            printf(" - Textures baked this run, size as uncompressed RGBA8 -> as block compressed (whole mip chain)\n");
+            printf(" - %-24s %11s %6s %6s %21s %8s\n", "Texture", "Dimensions", "Mips", "Format", "Size (KB)", "Ratio");
+            for (const auto& [name, texture] : packStats.mTextures) {
+                printf(" - %-24s %5ux%-5u %6u %6s %10.1f %10.1f %8.3f\n",
+                       name.c_str(),
+                       texture.mWidth,
+                       texture.mHeight,
+                       texture.mMipCount,
+                       TextureBaker::GetFormatString(texture.mFormat).c_str(),
+                       CAST<f64>(texture.mSourceBytes) / 1024.0,
+                       CAST<f64>(texture.mBytes) / 1024.0,
+                       texture.mSourceBytes > 0 ? CAST<f64>(texture.mBytes) / CAST<f64>(texture.mSourceBytes) : 0.0);
+            }
         }
     }
 
+    static bool ProcessAssetDirectory(const vector<PendingAsset>& pending,
+                                      const XPakCreateOptions& options,
+                                      const XPakCache* cache,
+                                      const CompressionDictionary* dictionary,
+                                      vector<XPakTableEntry>& tableEntries,
+                                      vector<XPakAssetEntry>& assetEntries) {
+        const u32 jobs = options.mJobs == 0 ? DefaultJobCount() : options.mJobs;
+
+        // Each worker writes only to its own slot, and the results are appended in layout order afterward. This
+        // keeps offsets (and therefore the output file) identical no matter how many threads were used.
+        const Timer timer;
+        vector<ProcessedAsset> processed(pending.size());
+        ParallelFor(pending.size(), jobs, [&](size_t i) {
+            ProcessAsset(pending[i], processed[i], cache, dictionary, options);
+        });
+        const f64 wallSeconds = timer.Elapsed();
+
+        PackStats stats;
+        tableEntries.reserve(tableEntries.size() + processed.size());
+        assetEntries.reserve(assetEntries.size() + processed.size());
+        for (size_t i = 0; i < processed.size(); ++i) {
+            auto& asset = processed[i];
+            if (const auto original = pending[i].mSharedWith) {
+                // Only gets a table entry, its offset is set to the original's by the caller
+                XPakTableEntry entry = processed[*original].mTableEntry;
+                entry.mAssetId       = pending[i].mDescriptor.mId;
+                tableEntries.push_back(entry);
+                stats.mSharedCount++;
+                stats.mSharedBytes += entry.mCompressedSize;
+                continue;
+            }
+
+            if (asset.mFailed) {
+                printf("Failed to encode asset %llu\n", asset.mTableEntry.mAssetId);
+                return false;
+            }
+
+            AccumulateStats(stats, pending[i], asset);
+            tableEntries.push_back(asset.mTableEntry);
+            assetEntries.push_back(std::move(asset.mAssetEntry));
+        }
+
+        PrintProcessingStats(stats, wallSeconds, CAST<u32>(X_MIN(CAST<size_t>(jobs), X_MAX(pending.size(), 1))));
+        return true;
+    }
+
     bool XPakHeader::FromBytes(std::span<const u8> data) {
         if (data.size() != sizeof(XPakHeader)) {
             std::cerr << "XPakHeader::FromBytes: Invalid size " << data.size() << std::endl;
@@ -105,8 +842,10 @@ namespace x {
 
         const auto versionSpan = data.subspan(offset, sizeof(mVersion));
         const auto version     = *(RCAST<const u16*>(versionSpan.data()));
-        if (version != kCurrentVersion) {
-            std::cerr << "XPakHeader::FromBytes: Invalid version " << version << std::endl;
+        // Version 1 paks predate codec ids, checksums, the shared dictionary and dependency lists. Their fields were
+        // reserved and zeroed, which everything reading them already treats as Brotli/unchecked/none.
+        if (version != kCurrentVersion && version != kLegacyVersion) {
+            std::cerr << "XPakHeader::FromBytes: Unsupported version " << version << std::endl;
             return false;
         }
         mVersion = version;
@@ -114,12 +853,18 @@ namespace x {
 
         const auto flagsSpan = data.subspan(offset, sizeof(mFlags));
         const auto flags     = *(RCAST<const u16*>(flagsSpan.data()));
+        mFlags               = flags;
         offset += sizeof(mFlags);
-        // Do nothing for now as no flags have been defined
 
         const auto entriesSpan = data.subspan(offset, sizeof(mEntries));
         const auto entries     = *(RCAST<const u64*>(entriesSpan.data()));
         mEntries               = entries;
+        offset += sizeof(mEntries);
+
+        // Stored in what used to be reserved (zeroed) bytes, so older paks read back without a dictionary
+        mDictionaryOffset = *(RCAST<const u64*>(data.subspan(offset, sizeof(mDictionaryOffset)).data()));
+        offset += sizeof(mDictionaryOffset);
+        mDictionarySize = *(RCAST<const u64*>(data.subspan(offset, sizeof(mDictionarySize)).data()));
 
         return true;
     }
@@ -138,7 +883,13 @@ namespace x {
         offset += sizeof(mFlags);
 
         std::copy_n(RCAST<const u8*>(&mEntries), sizeof(mEntries), data.data() + offset);
-        // offset += sizeof(mEntries);
+        offset += sizeof(mEntries);
+
+        std::copy_n(RCAST<const u8*>(&mDictionaryOffset), sizeof(mDictionaryOffset), data.data() + offset);
+        offset += sizeof(mDictionaryOffset);
+
+        std::copy_n(RCAST<const u8*>(&mDictionarySize), sizeof(mDictionarySize), data.data() + offset);
+        // offset += sizeof(mDictionarySize);
 
         return data;
     }
@@ -146,7 +897,12 @@ namespace x {
     std::string XPakHeader::ToString() const {
         char magicBuffer[5] = {'\0'};
         std::copy_n(mMagic, sizeof(mMagic), magicBuffer);  // null terminators are awesome! 🙄
-        return std::format("Magic: {}, Version: {}, Flags: {}, Entries: {}", magicBuffer, mVersion, mFlags, mEntries);
+        return std::format("Magic: {}, Version: {}, Flags: {}, Entries: {}, Dictionary: {} bytes",
+                           magicBuffer,
+                           mVersion,
+                           mFlags,
+                           mEntries,
+                           mDictionarySize);
     }
 
     bool XPakTableEntry::FromBytes(std::span<const u8> data) {
@@ -165,12 +921,26 @@ namespace x {
         auto compressedSizeSpan = data.subspan(offset, sizeof(mCompressedSize));
         offset += sizeof(mCompressedSize);
         auto sizeSpan = data.subspan(offset, sizeof(mSize));
+        offset += sizeof(mSize);
+        auto codecSpan = data.subspan(offset, sizeof(mCodec));
+        offset += sizeof(mCodec);
+        auto dependencyOffsetSpan = data.subspan(offset, sizeof(mDependencyOffset));
+        offset += sizeof(mDependencyOffset);
+        auto dependencyCountSpan = data.subspan(offset, sizeof(mDependencyCount));
+        offset += sizeof(mDependencyCount);
+        auto checksumSpan = data.subspan(offset, sizeof(mChecksum));
 
         mAssetId        = *RCAST<const u64*>(idSpan.data());
         mAssetFlags     = *RCAST<const u16*>(flagsSpan.data());
         mOffset         = *RCAST<const u64*>(offsetSpan.data());
         mCompressedSize = *RCAST<const u64*>(compressedSizeSpan.data());
         mSize           = *RCAST<const u64*>(sizeSpan.data());
+        mCodec          = *RCAST<const CodecId*>(codecSpan.data());
+
+        // Also stored in what used to be padding, older paks read back without any dependencies
+        mDependencyOffset = *RCAST<const u64*>(dependencyOffsetSpan.data());
+        mDependencyCount  = *RCAST<const u32*>(dependencyCountSpan.data());
+        mChecksum         = *RCAST<const u32*>(checksumSpan.data());
 
         return true;
     }
@@ -194,23 +964,136 @@ namespace x {
         std::copy_n(RCAST<const u8*>(&mSize), sizeof(mSize), data.data() + offset);
         offset += sizeof(mSize);
 
+        // Stored after the sizes (in what used to be padding) so older paks read back with a zeroed codec
+        std::copy_n(RCAST<const u8*>(&mCodec), sizeof(mCodec), data.data() + offset);
+        offset += sizeof(mCodec);
+
+        std::copy_n(RCAST<const u8*>(&mDependencyOffset), sizeof(mDependencyOffset), data.data() + offset);
+        offset += sizeof(mDependencyOffset);
+
+        std::copy_n(RCAST<const u8*>(&mDependencyCount), sizeof(mDependencyCount), data.data() + offset);
+        offset += sizeof(mDependencyCount);
+
+        std::copy_n(RCAST<const u8*>(&mChecksum), sizeof(mChecksum), data.data() + offset);
+        offset += sizeof(mChecksum);
+
         std::copy_n(RCAST<const u8*>(mPadding), sizeof(mPadding), data.data() + offset);
 
         return data;
     }
 
+    CodecId XPakTableEntry::GetCodec() const {
+        if (!CHECK_FLAG(mAssetFlags, kAssetFlag_Compressed)) { return kCodec_None; }
+        return mCodec == kCodec_None ? kCodec_Brotli : mCodec;
+    }
+
     std::string XPakTableEntry::ToString() const {
         const AssetType type = AssetDescriptor::GetTypeFromId(mAssetId);
         const str fmt        = std::format(
-          "Asset:\n  ID: {}\n  Type: {}\n  Size: {} bytes\n  Compressed Size: {} bytes\n  Offset: {:#010x}\n",
+          "Asset:\n  ID: {}\n  Type: {}\n  Size: {} bytes\n  Compressed Size: {} bytes\n  Offset: {:#010x}\n  "
+          "Codec: {}\n  Dependencies: {}\n  Checksum: {}\n",
           mAssetId,
           AssetDescriptor::GetTypeString(type),
           mCompressedSize,
           mSize,
-          mOffset);
+          mOffset,
+          CompressionCodecs::GetName(GetCodec()),
+          mDependencyCount,
+          CHECK_FLAG(mAssetFlags, kAssetFlag_Checksum) ? std::format("{:#010x}", mChecksum) : "none");
         return fmt;
     }
 
+    bool XPakTableView::Open(std::span<const u8> data) {
+        mTable  = {};
+        mSorted = false;
+
+        XPakHeader header;
+        if (data.size() < sizeof(XPakHeader) || !header.FromBytes(data.subspan(0, sizeof(XPakHeader)))) {
+            return false;
+        }
+
+        if (header.mEntries > (data.size() - sizeof(XPakHeader)) / sizeof(XPakTableEntry)) {
+            std::cerr << "XPakTableView::Open: Table of contents out of bounds" << std::endl;
+            return false;
+        }
+
+        mTable  = data.subspan(sizeof(XPakHeader), header.mEntries * sizeof(XPakTableEntry));
+        mSorted = CHECK_FLAG(header.mFlags, kPakFlag_SortedTable);
+        return true;
+    }
+
+    size_t XPakTableView::Size() const {
+        return mTable.size() / sizeof(XPakTableEntry);
+    }
+
+    bool XPakTableView::IsEmpty() const {
+        return mTable.empty();
+    }
+
+    bool XPakTableView::IsSorted() const {
+        return mSorted;
+    }
+
+    AssetId XPakTableView::GetAssetId(size_t index) const {
+        // The ID is the first field of an entry, so it can be compared without parsing the rest
+        AssetId id;
+        std::memcpy(&id, mTable.data() + index * sizeof(XPakTableEntry), sizeof(AssetId));
+        return id;
+    }
+
+    XPakTableEntry XPakTableView::GetEntry(size_t index) const {
+        XPakTableEntry entry;
+        entry.FromBytes(mTable.subspan(index * sizeof(XPakTableEntry), sizeof(XPakTableEntry)));
+        return entry;
+    }
+
+    std::optional<XPakTableEntry> XPakTableView::Find(AssetId id) const {
+        const size_t count = Size();
+
+        if (!mSorted) {
+            for (size_t i = 0; i < count; ++i) {
+                if (GetAssetId(i) == id) { return GetEntry(i); }
+            }
+            return std::nullopt;
+        }
+
+        size_t first = 0;
+        size_t last  = count;
+        while (first < last) {
+            const size_t middle = first + (last - first) / 2;
+            if (GetAssetId(middle) < id) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+
+        if (first < count && GetAssetId(first) == id) { return GetEntry(first); }
+        return std::nullopt;
+    }
+
+    XPakDependencyBlock XPakDependencyBlock::Build(const AssetDependencies& dependencies, u64 offset) {
+        XPakDependencyBlock block;
+        block.mOffset = offset;
+
+        for (const auto& [id, list] : dependencies) {
+            if (list.empty()) { continue; }
+            block.mLists[id]  = {offset + block.mData.size(), CAST<u32>(list.size())};
+            const auto* bytes = RCAST<const u8*>(list.data());
+            block.mData.insert(block.mData.end(), bytes, bytes + list.size() * sizeof(AssetId));
+        }
+
+        block.mData.resize(GetPaddedBlockSize(block.mData.size()), 0);
+        return block;
+    }
+
+    void XPakDependencyBlock::Apply(XPakTableEntry& entry) const {
+        if (const auto it = mLists.find(entry.mAssetId); it != mLists.end()) {
+            entry.mDependencyOffset = it->second.first;
+            entry.mDependencyCount  = it->second.second;
+        }
+    }
+
     bool XPakAssetEntry::FromBytes(std::span<const u8> data) {
         return true;
     }
@@ -253,6 +1136,7 @@ namespace x {
         }
 
         offset += tableSize;
+        mDictionary = ReadDictionary(data);
 
         return true;
     }
@@ -266,7 +1150,8 @@ namespace x {
               const size_t entrySize = sizeof(entry.mMagic) + entry.mPadding.size() + entry.mCompressedData.size();
               return size + entrySize;
           });
-        const auto pakSize = headerSize + tableSize + dataSize;
+        const size_t dictionarySize = GetPaddedBlockSize(mDictionary.size());
+        const auto pakSize          = headerSize + tableSize + dictionarySize + mDependencies.size() + dataSize;
         size_t offset      = 0;
         std::vector<u8> pak(pakSize);
 
@@ -283,6 +1168,14 @@ namespace x {
         std::copy_n(tableBytes.data(), tableSize, pak.data() + offset);
         offset += tableSize;
 
+        // Padding is already zeroed
+        std::copy_n(mDictionary.data(), mDictionary.size(), pak.data() + offset);
+        offset += dictionarySize;
+
+        // Already padded, see XPakDependencyBlock::Build
+        std::copy_n(mDependencies.data(), mDependencies.size(), pak.data() + offset);
+        offset += mDependencies.size();
+
         vector<u8> dataBytes(dataSize);
         size_t dataOffset = 0;
         for (size_t i = 0; i < mAssets.size(); i++) {
@@ -301,27 +1194,25 @@ namespace x {
     }
 
     AssetTable XPak::ReadPakTable(const Path& pakFile) {
-        auto pakBytes = FileReader::ReadBytes(pakFile);
-        return ReadPakTable(pakBytes);
+        // Only the header and the table are read, none of the asset data
+        auto bytes = FileReader::ReadBlock(pakFile, sizeof(XPakHeader), 0);
+        XPakHeader header;
+        if (bytes.size() != sizeof(XPakHeader) || !header.FromBytes(bytes)) { return {}; }
+
+        const auto table = FileReader::ReadBlock(pakFile, header.mEntries * sizeof(XPakTableEntry), sizeof(XPakHeader));
+        bytes.insert(bytes.end(), table.begin(), table.end());
+        return ReadPakTable(bytes);
     }
 
     AssetTable XPak::ReadPakTable(std::span<const u8> data) {
         AssetTable assetTable;
 
-        size_t offset   = 0;
-        auto headerSpan = data.subspan(0, sizeof(XPakHeader));
-        offset += sizeof(XPakHeader);
-
-        XPakHeader header;
-        header.FromBytes(headerSpan);
-        const u64 numEntries = header.mEntries;
-
-        size_t tableSize = sizeof(XPakTableEntry) * numEntries;
-        auto tableSpan   = data.subspan(offset, tableSize);
+        XPakTableView table;
+        if (!table.Open(data)) { return assetTable; }
 
-        for (size_t i = 0; i < numEntries; i++) {
-            XPakTableEntry tableEntry;
-            tableEntry.FromBytes(tableSpan.subspan(i * sizeof(XPakTableEntry), sizeof(XPakTableEntry)));
+        assetTable.reserve(table.Size());
+        for (size_t i = 0; i < table.Size(); i++) {
+            const auto tableEntry           = table.GetEntry(i);
             assetTable[tableEntry.mAssetId] = tableEntry;
         }
 
@@ -341,14 +1232,40 @@ namespace x {
             return {};
         }
 
+        if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Checksum) && Crc32c(bytes) != entry.mChecksum) {
+            std::cerr << "Checksum mismatch for asset " << entry.mAssetId << ": " << pakFile.Str() << std::endl;
+            return {};
+        }
+
+        if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Chunked)) {
+            auto decompressed = ChunkedCompression::Decompress(bytes, entry.mSize, entry.GetCodec());
+            if (decompressed.size() != entry.mSize) {
+                std::cerr << "Failed to decode asset " << entry.mAssetId << ": " << pakFile.Str() << std::endl;
+                return {};
+            }
+            return decompressed;
+        }
+
         vector<u8> outBytes(entry.mSize);
         if (compressed) {
-            auto decompressed = BrotliCompression::Decompress(bytes, entry.mSize);
-            if (decompressed.size() != entry.mSize) {
-                std::cerr << "File size mismatch: " << pakFile.Str() << std::endl;
+            std::unique_ptr<CompressionDictionary> dictionary;
+            if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Dictionary)) {
+                // Only the header and the dictionary block are read, not the whole pak
+                XPakHeader header;
+                if (!header.FromBytes(FileReader::ReadBlock(pakFile, sizeof(XPakHeader), 0)) ||
+                    !CHECK_FLAG(header.mFlags, kPakFlag_Dictionary)) {
+                    std::cerr << "Missing shared dictionary: " << pakFile.Str() << std::endl;
+                    return {};
+                }
+                dictionary = std::make_unique<CompressionDictionary>(
+                  FileReader::ReadBlock(pakFile, header.mDictionarySize, header.mDictionaryOffset));
+            }
+
+            const auto* codec = CompressionCodecs::Get(entry.GetCodec());
+            if (!codec || !codec->mDecompress(bytes, outBytes, dictionary.get())) {
+                std::cerr << "Failed to decode asset " << entry.mAssetId << ": " << pakFile.Str() << std::endl;
                 return {};
             }
-            std::copy_n(decompressed.data(), decompressed.size(), outBytes.data());
         } else {
             // The compressed and uncompressed sizes should match in this instance
             if (entry.mSize != entry.mCompressedSize) {
@@ -361,33 +1278,98 @@ namespace x {
         return outBytes;
     }
 
-    std::optional<XPak> XPak::Create(const ProjectDescriptor& project) {
+    vector<u8> XPak::ReadDictionary(std::span<const u8> data) {
+        XPakHeader header;
+        if (data.size() < sizeof(XPakHeader) || !header.FromBytes(data.subspan(0, sizeof(XPakHeader)))) { return {}; }
+        if (!CHECK_FLAG(header.mFlags, kPakFlag_Dictionary)) { return {}; }
+
+        if (header.mDictionaryOffset > data.size() || header.mDictionarySize > data.size() - header.mDictionaryOffset) {
+            std::cerr << "XPak::ReadDictionary: Dictionary out of bounds" << std::endl;
+            return {};
+        }
+
+        const auto dictionary = data.subspan(header.mDictionaryOffset, header.mDictionarySize);
+        return {dictionary.begin(), dictionary.end()};
+    }
+
+    vector<AssetId> XPak::ReadDependencies(std::span<const u8> data, const XPakTableEntry& entry) {
+        if (entry.mDependencyCount == 0) { return {}; }
+
+        const u64 size = CAST<u64>(entry.mDependencyCount) * sizeof(AssetId);
+        if (entry.mDependencyOffset > data.size() || size > data.size() - entry.mDependencyOffset) {
+            std::cerr << "XPak::ReadDependencies: Dependencies out of bounds" << std::endl;
+            return {};
+        }
+
+        // Lists aren't guaranteed to be 8-byte aligned within the mapping, so they're copied out instead of cast
+        vector<AssetId> dependencies(entry.mDependencyCount);
+        std::memcpy(dependencies.data(), data.data() + entry.mDependencyOffset, size);
+        return dependencies;
+    }
+
+    std::optional<XPak> XPak::Create(const ProjectDescriptor& project, const XPakCreateOptions& options) {
         XPak x;
         auto& header    = x.mHeader;
         header.mVersion = kCurrentVersion;
 
         // Parse project directories to scan for assets
         // Directories are relative to the path of the project file
-        const auto contentDir = Path(project.mContentDirectory);
-        ProcessAssetDirectory(contentDir, x.mTableOfContents, x.mAssets);
+        XPakCache cache;
+        if (!options.mCacheDirectory.Str().empty()) { cache.Open(options.mCacheDirectory); }
+        auto pending = CollectAssets(project);
+        FindNormalMaps(pending);
+        const auto dependencies = ResolveDependencies(pending, options);
+        OrderAssets(pending, dependencies, options);
+        FindSharedPayloads(pending, options);
+        const auto dictionary = TrainDictionary(pending, options);
+        if (!ProcessAssetDirectory(pending, options, &cache, dictionary.get(), x.mTableOfContents, x.mAssets)) {
+            return std::nullopt;
+        }
 
-        if (x.mAssets.size() != x.mTableOfContents.size()) {
+        const auto sharedCount = std::ranges::count_if(
+          pending, [](const PendingAsset& asset) { return asset.mSharedWith.has_value(); });
+        if (x.mTableOfContents.size() != pending.size() ||
+            x.mAssets.size() != x.mTableOfContents.size() - CAST<size_t>(sharedCount)) {
             printf("Incorrect number of assets in table of contents\n");
             return std::nullopt;
         }
 
-        header.mEntries    = x.mAssets.size();
+        header.mEntries    = x.mTableOfContents.size();
         size_t assetOffset = sizeof(XPakHeader) + (header.mEntries * sizeof(XPakTableEntry));
 
+        // The dictionary sits between the table and the first asset
+        if (dictionary) {
+            const auto data = dictionary->GetData();
+            x.mDictionary.assign(data.begin(), data.end());
+            header.mFlags |= kPakFlag_Dictionary;
+            header.mDictionaryOffset = assetOffset;
+            header.mDictionarySize   = x.mDictionary.size();
+            assetOffset += GetPaddedBlockSize(x.mDictionary.size());
+        }
+
+        // Followed by the dependency lists
+        const auto dependencyBlock = XPakDependencyBlock::Build(dependencies, assetOffset);
+        x.mDependencies            = dependencyBlock.mData;
+        assetOffset += x.mDependencies.size();
+
+        // The table is still in layout order here, shared entries point at the offset their original was given
+        size_t assetIndex {0};
         for (size_t i = 0; i < header.mEntries; ++i) {
+            dependencyBlock.Apply(x.mTableOfContents[i]);
+            if (const auto original = pending[i].mSharedWith) {
+                x.mTableOfContents[i].mOffset = x.mTableOfContents[*original].mOffset;
+                continue;
+            }
+
             // Update asset offset
             x.mTableOfContents[i].mOffset = assetOffset;
+            auto& asset                   = x.mAssets[assetIndex++];
 
-            const auto currentSize = x.mAssets[i].mCompressedData.size() + kAssetHeaderSize;
+            const auto currentSize = asset.mCompressedData.size() + kAssetHeaderSize;
             if (currentSize % kAssetByteAlignment != 0) {
                 // Calculate appropriate padding
                 const auto paddingNeeded = kAssetByteAlignment - (currentSize % kAssetByteAlignment);
-                x.mAssets[i].mPadding    = vector<u8>(paddingNeeded, 0);
+                asset.mPadding           = vector<u8>(paddingNeeded, 0);
 
                 assetOffset += currentSize + paddingNeeded;
             } else {
@@ -395,9 +1377,318 @@ namespace x {
             }
         }
 
+        // Offsets are already assigned, so the table can be reordered independently of the asset data
+        std::ranges::stable_sort(x.mTableOfContents, {}, &XPakTableEntry::mAssetId);
+        header.mFlags |= kPakFlag_SortedTable;
+
         printf("\n");
-        printf(" - Processed %llu assets.\n", x.mAssets.size());
+        printf(" - Processed %llu assets.\n", x.mTableOfContents.size());
 
         return x;
     }
-}  // namespace x
\ No newline at end of file
+
+    bool XPak::Pack(const ProjectDescriptor& project, const Path& pakFile, const XPakCreateOptions& options) {
+        auto pending   = CollectAssets(project);
+        const u32 jobs = options.mJobs == 0 ? DefaultJobCount() : options.mJobs;
+        FindNormalMaps(pending);
+
+        XPakCache cache;
+        if (!options.mCacheDirectory.Str().empty()) { cache.Open(options.mCacheDirectory); }
+
+        const auto dependencies = ResolveDependencies(pending, options);
+        OrderAssets(pending, dependencies, options);
+        FindSharedPayloads(pending, options);
+        const auto dictionary = TrainDictionary(pending, options);
+
+        XPakWriter writer;
+        if (!writer.Open(pakFile, pending.size())) {
+            printf("Failed to open pak file '%s' for writing\n", pakFile.CStr());
+            return false;
+        }
+
+        if (dictionary && !writer.WriteDictionary(dictionary->GetData())) {
+            printf("Failed to write shared dictionary to pak file\n");
+            return false;
+        }
+
+        if (!writer.WriteDependencies(dependencies)) {
+            printf("Failed to write asset dependencies to pak file\n");
+            return false;
+        }
+
+        // Workers keep encoding assets while the calling thread writes them out in layout order as each one is done,
+        // so one slow bake doesn't stall the rest. They run at most a few assets per job ahead of the writer, which
+        // bounds how many payloads are held in memory, and the layout is the same for any job count.
+        constexpr size_t kWindowPerJob = 4;
+        const Timer timer;
+        PackStats stats;
+        vector<ProcessedAsset> processed(pending.size());
+        vector<u64> storedSizes(pending.size());  // Kept past their payload for the assets sharing it
+
+        const bool written = ParallelForOrdered(
+          pending.size(),
+          jobs,
+          jobs * kWindowPerJob,
+          [&](size_t i) { ProcessAsset(pending[i], processed[i], &cache, dictionary.get(), options); },
+          [&](size_t i) {
+              const auto asset   = std::move(processed[i]);  // Released as soon as it's written
+              const auto& source = pending[i];
+              if (const auto original = source.mSharedWith) {
+                  if (!writer.WriteSharedAsset(source.mDescriptor.mId, pending[*original].mDescriptor.mId)) {
+                      printf("Failed to write asset %llu to pak file\n", source.mDescriptor.mId);
+                      return false;
+                  }
+                  stats.mSharedCount++;
+                  stats.mSharedBytes += storedSizes[*original];
+                  return true;
+              }
+
+              if (asset.mFailed) {
+                  printf("Failed to encode asset %llu\n", asset.mTableEntry.mAssetId);
+                  return false;
+              }
+
+              storedSizes[i] = asset.mTableEntry.mCompressedSize;
+              AccumulateStats(stats, source, asset);
+              if (!writer.WriteAsset(asset.mTableEntry, asset.mAssetEntry.mCompressedData)) {
+                  printf("Failed to write asset %llu to pak file\n", asset.mTableEntry.mAssetId);
+                  return false;
+              }
+              return true;
+          });
+        if (!written) { return false; }
+
+        if (!writer.Finalize()) {
+            printf("Failed to write pak table of contents\n");
+            return false;
+        }
+
+        PrintProcessingStats(stats, timer.Elapsed(), CAST<u32>(X_MIN(CAST<size_t>(jobs), X_MAX(pending.size(), 1))));
+
+        printf("\n");
+        printf(" - Processed %zu assets.\n", pending.size());
+        printf(" - Created pak file.\n");
+        printf(" - Total size: %llu bytes (%llu MB)\n", writer.GetSize(), writer.GetSize() / (1024 * 1024));
+
+        return true;
+    }
+
+    // Entries are the same if their payloads are byte-for-byte identical and decode the same way. A payload compressed
+    // against the shared dictionary only means the same thing if both paks have the same dictionary.
+    static bool IsSameEntry(const XPakMount& base,
+                            const XPakTableEntry& baseEntry,
+                            const XPakMount& next,
+                            const XPakTableEntry& nextEntry) {
+        if (baseEntry.mAssetFlags != nextEntry.mAssetFlags || baseEntry.GetCodec() != nextEntry.GetCodec() ||
+            baseEntry.mSize != nextEntry.mSize || baseEntry.mCompressedSize != nextEntry.mCompressedSize) {
+            return false;
+        }
+
+        if (CHECK_FLAG(nextEntry.mAssetFlags, kAssetFlag_Dictionary)) {
+            if (!base.GetDictionary() || !next.GetDictionary() ||
+                base.GetDictionary()->GetHash() != next.GetDictionary()->GetHash()) {
+                return false;
+            }
+        }
+
+        if (base.GetDependencies(baseEntry) != next.GetDependencies(nextEntry)) { return false; }
+
+        const auto baseBytes = base.GetEntryBytes(baseEntry);
+        const auto nextBytes = next.GetEntryBytes(nextEntry);
+        return baseBytes.size() == nextBytes.size() && std::ranges::equal(baseBytes, nextBytes);
+    }
+
+    bool XPak::Diff(const Path& basePak, const Path& newPak, const Path& patchPak) {
+        XPakMount base;
+        XPakMount next;
+        if (!base.Mount(basePak) || !next.Mount(newPak)) { return false; }
+
+        const auto& table = next.GetTable();
+        vector<XPakTableEntry> changed;
+        for (size_t i = 0; i < table.Size(); ++i) {
+            const auto entry = table.GetEntry(i);
+            const auto bytes = next.GetEntryBytes(entry);
+            if (bytes.size() != entry.mCompressedSize || !next.VerifyEntry(entry, bytes)) {
+                printf("Asset %llu in '%s' is corrupt\n", entry.mAssetId, newPak.CStr());
+                return false;
+            }
+
+            const auto previous = base.GetTable().Find(entry.mAssetId);
+            if (!previous.has_value() || !IsSameEntry(base, *previous, next, entry)) { changed.push_back(entry); }
+        }
+
+        // Patches can only add or replace entries, anything removed since the base pak stays visible through it
+        size_t removed {0};
+        for (size_t i = 0; i < base.GetTable().Size(); ++i) {
+            if (!table.Find(base.GetTable().GetAssetId(i)).has_value()) { removed++; }
+        }
+
+        // Copied in the order they're laid out in the new pak, so the patch keeps its locality
+        std::ranges::sort(changed, {}, &XPakTableEntry::mOffset);
+
+        AssetDependencies dependencies;
+        bool usesDictionary {false};
+        for (const auto& entry : changed) {
+            auto list = next.GetDependencies(entry);
+            if (!list.empty()) { dependencies[entry.mAssetId] = std::move(list); }
+            usesDictionary |= CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Dictionary);
+        }
+
+        XPakWriter writer;
+        if (!writer.Open(patchPak, changed.size())) {
+            printf("Failed to open pak file '%s' for writing\n", patchPak.CStr());
+            return false;
+        }
+
+        // Patched entries are decoded with the patch's own dictionary, so it needs a copy of the new pak's
+        if (usesDictionary && !writer.WriteDictionary(next.GetDictionary()->GetData())) {
+            printf("Failed to write shared dictionary to pak file\n");
+            return false;
+        }
+
+        if (!writer.WriteDependencies(dependencies)) {
+            printf("Failed to write asset dependencies to pak file\n");
+            return false;
+        }
+
+        // Entries sharing a payload in the new pak share it in the patch too, the first one to be written owns it
+        unordered_map<u64, AssetId> writtenAt;
+        for (const auto& entry : changed) {
+            const auto shared = writtenAt.find(entry.mOffset);
+            const bool written =
+              shared != writtenAt.end() ? writer.WriteSharedAsset(entry.mAssetId, shared->second)
+                                        : writer.WriteAsset(entry, next.GetEntryBytes(entry));
+            if (!written) {
+                printf("Failed to write asset %llu to pak file\n", entry.mAssetId);
+                return false;
+            }
+            writtenAt.try_emplace(entry.mOffset, entry.mAssetId);
+        }
+
+        if (!writer.Finalize()) {
+            printf("Failed to write pak table of contents\n");
+            return false;
+        }
+
+        printf(" - %zu of %zu asset(s) changed\n", changed.size(), table.Size());
+        if (removed > 0) {
+            printf(" - %zu asset(s) were removed, patches can't remove assets from the base pak\n", removed);
+        }
+        printf(" - Total size: %llu bytes (%llu MB)\n", writer.GetSize(), writer.GetSize() / (1024 * 1024));
+
+        return true;
+    }
+
+    bool XPak::Verify(const Path& pakFile, u32 jobs) {
+        XPakMount mount;
+        if (!mount.Mount(pakFile)) { return false; }
+        if (jobs == 0) { jobs = DefaultJobCount(); }
+
+        const auto& table = mount.GetTable();
+        std::atomic<size_t> corrupt {0};
+        std::atomic<size_t> unchecked {0};
+        std::atomic<u64> checkedBytes {0};
+
+        const Timer timer;
+        ParallelFor(table.Size(), jobs, [&](size_t i) {
+            const auto entry = table.GetEntry(i);
+            if (!CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Checksum)) {
+                unchecked++;
+                return;
+            }
+
+            const auto bytes = mount.GetEntryBytes(entry);
+            if (bytes.size() != entry.mCompressedSize || !mount.VerifyEntry(entry, bytes)) {
+                printf("Asset %llu is corrupt\n", entry.mAssetId);
+                corrupt++;
+                return;
+            }
+            checkedBytes += bytes.size();
+        });
+        const f64 seconds = timer.Elapsed();
+
+        const f64 checkedMb = CAST<f64>(checkedBytes.load()) / (1024.0 * 1024.0);
+        printf(" - Verified %zu asset(s), %.2f MB in %.3f s on %u thread(s) (%.2f MB/s, %s CRC32C)\n",
+               table.Size() - unchecked - corrupt,
+               checkedMb,
+               seconds,
+               CAST<u32>(X_MIN(CAST<size_t>(jobs), X_MAX(table.Size(), 1))),
+               seconds > 0.0 ? checkedMb / seconds : 0.0,
+               Crc32cIsHardwareAccelerated() ? "hardware" : "software");
+        if (unchecked > 0) { printf(" - %zu asset(s) have no checksum\n", unchecked.load()); }
+        if (corrupt > 0) { printf(" - %zu asset(s) are corrupt\n", corrupt.load()); }
+
+        return corrupt == 0;
+    }
+
+    bool XPak::Benchmark(const Path& pakFile) {
+        XPakMount mount;
+        if (!mount.Mount(pakFile)) { return false; }
+
+        const auto table = ReadPakTable(mount.GetBytes());
+        if (table.empty()) {
+            printf("Pak file '%s' has no assets\n", pakFile.CStr());
+            return false;
+        }
+
+        std::map<AssetType, vector<vector<u8>>> assetsByType;
+        for (const auto& [id, entry] : table) {
+            auto data = mount.FetchAssetData(entry);
+            if (!data.empty()) { assetsByType[AssetDescriptor::GetTypeFromId(id)].push_back(std::move(data)); }
+        }
+
+        constexpr f64 kMegabyte = 1024.0 * 1024.0;
+        printf(" - %-10s %-11s %12s %10s %12s %12s\n", "Type", "Codec", "Size (MB)", "Ratio", "Encode MB/s", "Decode MB/s");
+        for (const auto& [type, assets] : assetsByType) {
+            u64 totalSize {0};
+            for (const auto& data : assets) {
+                totalSize += data.size();
+            }
+            const f64 sizeMb = CAST<f64>(totalSize) / kMegabyte;
+
+            // Descriptors are measured against the pak's shared dictionary as well, when it has one
+            vector<const CompressionDictionary*> dictionaries {nullptr};
+            if (IsDescriptorType(type) && mount.GetDictionary()) { dictionaries.push_back(mount.GetDictionary()); }
+
+            for (const auto& codec : CompressionCodecs::GetAll()) {
+                if (codec.mId == kCodec_None) { continue; }
+
+                for (const auto* dictionary : dictionaries) {
+                    const str name = dictionary ? std::format("{}+dict", codec.mName) : str(codec.mName);
+
+                    u64 packedSize {0};
+                    f64 encodeSeconds {0};
+                    f64 decodeSeconds {0};
+                    for (const auto& data : assets) {
+                        const Timer encodeTimer;
+                        const auto packed = codec.mCompress(data, dictionary);
+                        encodeSeconds += encodeTimer.Elapsed();
+                        packedSize += packed.size();
+
+                        vector<u8> decoded(data.size());
+                        const Timer decodeTimer;
+                        const bool decodedOk = codec.mDecompress(packed, decoded, dictionary);
+                        decodeSeconds += decodeTimer.Elapsed();
+
+                        if (!decodedOk || decoded != data) {
+                            printf("Codec '%s' failed to round-trip a %s asset\n",
+                                   name.c_str(),
+                                   AssetDescriptor::GetTypeString(type).c_str());
+                            return false;
+                        }
+                    }
+
+                    printf(" - %-10s %-11s %12.2f %10.3f %12.2f %12.2f\n",
+                           AssetDescriptor::GetTypeString(type).c_str(),
+                           name.c_str(),
+                           sizeMb,
+                           totalSize > 0 ? CAST<f64>(packedSize) / CAST<f64>(totalSize) : 0.0,
+                           encodeSeconds > 0.0 ? sizeMb / encodeSeconds : 0.0,
+                           decodeSeconds > 0.0 ? sizeMb / decodeSeconds : 0.0);
+                }
+            }
+        }
+
+        return true;
+    }
+}  // namespace x
@@ -6,47 +6,51 @@
 //   Version: 2 bytes
 //   Flags: 2 bytes
 //   Entry count: 64-bit unsigned
-//   Reserved: 16 bytes
+//   Dictionary offset: 64-bit unsigned (0 = no shared dictionary)
+//   Dictionary size: 64-bit unsigned
 //
-// Table of Contents (per entry):
+// Table of Contents (sorted by asset ID when the 'sorted table' flag is set, per entry):
 //   Asset ID: 64-bit unsigned, type embedded in highest 8 bits, ID is 56 bits
-//   Asset flags: 16-bit (compressed, encrypted, streamable)
+//   Asset flags: 16-bit (compressed, encrypted, streamable, descriptor, chunked, dictionary, checksum)
 //   Asset data offset: 64-bit unsigned
 //   Asset data size (compressed): 64-bit unsigned
 //   Asset data size (original): 64-bit unsigned
-//   Asset name hash: 32-bit unsigned (for string-based lookups)
-//   Checksum: 32-bit CRC32 (or 64-bit for better collision avoidance)
+//   Codec ID: 8-bit unsigned (none, brotli, lz4)
+//   Dependency list offset: 64-bit unsigned (0 = no dependencies)
+//   Dependency count: 32-bit unsigned
+//   Checksum: 32-bit CRC32C of the stored (possibly compressed) asset data
 //
-// Assets (aligned to 64-byte boundaries):
+// Shared dictionary (optional, aligned to 64-byte boundaries):
+//   Raw dictionary bytes that entries flagged 'dictionary' were compressed against
+//
+// Dependencies (optional, aligned to 64-byte boundaries):
+//   Asset IDs (64-bit unsigned) referenced by scenes and materials, one list per asset, back to back
+//
+// Assets (aligned to 64-byte boundaries, entries with identical payloads share one):
 //   [Asset Data Block]
-//     Asset Header (16 bytes):
-//       Magic: 4 bytes (e.g., 'ASET')
-//       Flags: 4 bytes
-//       Metadata size: 8 bytes
-//     [Optional Metadata Block]
-//       JSON or binary metadata
+//     Magic: 4 bytes ('ASET')
 //     [Data Block]
 //       Compressed/raw asset data
 //     [Padding]
 //       Padding to 64-byte alignment
-//
-//
-//  TODO: Embed asset type in high bits of asset ID
-//  For example, use 56 bits for the ID and 8 bits for the type information
 
 #pragma once
 
 #include <format>
+#include <map>
 #include <span>
 
 #include "AssetDescriptor.hpp"
 #include "ProjectDescriptor.hpp"
+#include "Compression.hpp"
+#include "TextureBaker.hpp"
 #include "Common/Typedefs.hpp"
 
 #define X_ARRAY_PADDING(sizeInBytes) unsigned char mPadding[sizeInBytes] {0};
 
 namespace x {
-    static constexpr u16 kCurrentVersion        = 1;
+    static constexpr u16 kCurrentVersion        = 2;
+    static constexpr u16 kLegacyVersion         = 1;  // Same layout, codec/dictionary/dependency/checksum fields zeroed
     static constexpr size_t kAssetHeaderSize    = 4;
     static constexpr size_t kAssetByteAlignment = 64;
     static constexpr size_t kTableEntrySize     = 64;
@@ -55,13 +59,20 @@ namespace x {
     static constexpr u16 kAssetFlag_Encrypted  = 1 << 1;
     static constexpr u16 kAssetFlag_Streamable = 1 << 2;
     static constexpr u16 kAssetFlag_Descriptor = 1 << 3;
+    static constexpr u16 kAssetFlag_Chunked    = 1 << 4;  // Compressed as independent frames, see ChunkedCompression
+    static constexpr u16 kAssetFlag_Dictionary = 1 << 5;  // Compressed against the pak's shared dictionary
+    static constexpr u16 kAssetFlag_Checksum   = 1 << 6;  // mChecksum is valid, older paks don't store one
+
+    static constexpr u16 kPakFlag_Dictionary  = 1 << 0;  // The pak stores a shared dictionary, see XPakHeader
+    static constexpr u16 kPakFlag_SortedTable = 1 << 1;  // Table entries are in ascending asset ID order
 
     struct XPakHeader {
         const char mMagic[4] {'X', 'P', 'A', 'K'};
         u16 mVersion {0};
         u16 mFlags {0};
         u64 mEntries {0};
-        X_ARRAY_PADDING(16)
+        u64 mDictionaryOffset {0};  // Only meaningful when kPakFlag_Dictionary is set
+        u64 mDictionarySize {0};
 
         bool FromBytes(std::span<const u8> data);
         std::vector<u8> ToBytes() const;
@@ -71,10 +82,18 @@ namespace x {
     struct XPakTableEntry {
         AssetId mAssetId {0};
         u16 mAssetFlags {0};
+        CodecId mCodec {kCodec_None};  // Only meaningful when kAssetFlag_Compressed is set, see GetCodec
         u64 mOffset {0};
         u64 mCompressedSize {0};
         u64 mSize {0};
-        X_ARRAY_PADDING(24)  // u16 has 6 bits of padding, aligned to 8 bits = 40 bits total
+        u64 mDependencyOffset {0};  // Where the entry's dependency list starts in the pak, see XPak::ReadDependencies
+        u32 mDependencyCount {0};
+        u32 mChecksum {0};  // CRC32C of the stored payload, only meaningful when kAssetFlag_Checksum is set
+        X_ARRAY_PADDING(7)  // u16 + u8 have 5 bytes of padding, aligned to 8 bytes = 64 bytes total
+
+        /// @brief Codec the entry's payload was compressed with. Paks written before codec ids existed leave the
+        /// field zeroed, and every compressed entry in them is Brotli.
+        X_NODISCARD CodecId GetCodec() const;
 
         bool FromBytes(std::span<const u8> data);
         std::vector<u8> ToBytes() const;
@@ -93,6 +112,65 @@ namespace x {
 
     using AssetTable = std::unordered_map<AssetId, XPakTableEntry>;
 
+    /// @brief Every asset each asset needs in order to be loaded. Scenes list their whole closure (meshes, materials,
+    /// scripts and the materials' textures), materials list their textures.
+    using AssetDependencies = std::map<AssetId, vector<AssetId>>;
+
+    /// @brief A pak's dependency lists laid out as a single block, ready to be written at `mOffset`.
+    struct XPakDependencyBlock {
+        u64 mOffset {0};
+        vector<u8> mData;
+        std::map<AssetId, std::pair<u64, u32>> mLists;  // Absolute offset and count of each asset's list
+
+        static XPakDependencyBlock Build(const AssetDependencies& dependencies, u64 offset);
+
+        /// @brief Points the entry at its dependency list, if it has one.
+        void Apply(XPakTableEntry& entry) const;
+    };
+
+    /// @brief Read-only view of a pak's table of contents, searched in place instead of being parsed into an
+    /// AssetTable. Lookups are a binary search over the asset IDs when the table is sorted, and fall back to a linear
+    /// scan for older paks. Nothing is allocated.
+    ///
+    /// The view points into the pak's bytes and is invalidated along with them.
+    class XPakTableView {
+    public:
+        XPakTableView() = default;
+
+        /// @brief Returns false (and leaves the view empty) if `data` isn't a pak or is too small to hold its table.
+        bool Open(std::span<const u8> data);
+
+        X_NODISCARD size_t Size() const;
+        X_NODISCARD bool IsEmpty() const;
+        X_NODISCARD bool IsSorted() const;
+
+        X_NODISCARD AssetId GetAssetId(size_t index) const;
+        X_NODISCARD XPakTableEntry GetEntry(size_t index) const;
+        X_NODISCARD std::optional<XPakTableEntry> Find(AssetId id) const;
+
+    private:
+        std::span<const u8> mTable;
+        bool mSorted {false};
+    };
+
+    struct XPakCreateOptions {
+        u32 mJobs {0};                    // Worker threads used to compress/compile assets, 0 = one per core
+        Path mCacheDirectory;             // Where processed payloads are cached between builds, empty = no cache
+        u32 mFrameSize {256 * 1024};      // Compressed assets larger than this are split into seekable frames, 0 = never
+        bool mDictionary {true};          // Train a shared dictionary for descriptor assets (materials, scenes)
+        bool mDependencies {true};        // Resolve scene/material references and store them in the pak
+        Path mLayoutTrace;                // Access trace to order the assets by, see AssetManager::BeginAccessTrace
+        bool mOptimizeMeshes {true};      // Weld and reorder mesh vertices/triangles for the GPU caches
+        bool mQuantizeMeshes {false};     // Store octahedral normals/tangents and half float UVs, see MeshBaker
+        bool mCompileDescriptors {true};  // Compile scene/material XML to binary, see DescriptorCompiler
+        // Format PNG/TGA textures are baked to, see TextureBaker. DDS textures are always stored as authored.
+        TextureFormat mTextureFormat {kTextureFormat_Auto};
+        bool mDeduplicate {true};  // Assets with identical contents share one payload, see FindSharedPayloads
+        // Decode every freshly compressed payload and fail the pack if it doesn't match what was compressed. Also
+        // times the decodes, but `xpakc bench` is the better measure of decode speed.
+        bool mVerifyDecode {false};
+    };
+
     class XPak {
     public:
         XPak() = default;
@@ -103,12 +181,38 @@ namespace x {
         static AssetTable ReadPakTable(const Path& pakFile);
         static AssetTable ReadPakTable(std::span<const u8> data);
         static vector<u8> FetchAssetData(const Path& pakFile, const XPakTableEntry& entry);
-        static std::optional<XPak> Create(const ProjectDescriptor& project);
+
+        /// @brief Returns a copy of the pak's shared dictionary, or an empty vector if it doesn't have one.
+        static vector<u8> ReadDictionary(std::span<const u8> data);
+        /// @brief Returns the assets the entry depends on, or an empty vector if it doesn't list any.
+        static vector<AssetId> ReadDependencies(std::span<const u8> data, const XPakTableEntry& entry);
+        /// @brief Builds the entire pak in memory. Prefer Pack for anything large, as this holds every compressed
+        /// asset until ToBytes is called.
+        static std::optional<XPak> Create(const ProjectDescriptor& project, const XPakCreateOptions& options = {});
+
+        /// @brief Builds the pak and streams it straight to disk with an XPakWriter. Peak memory is bounded by the
+        /// largest assets being processed at once rather than the size of the whole pak.
+        static bool Pack(const ProjectDescriptor& project, const Path& pakFile, const XPakCreateOptions& options = {});
+
+        /// @brief Writes a patch pak holding only the entries of `newPak` that are new or differ from `basePak`.
+        /// Mounted over the base pak (see XPakMountStack), it makes the stack read like the new pak. Payloads are
+        /// copied as stored, nothing is recompressed.
+        static bool Diff(const Path& basePak, const Path& newPak, const Path& patchPak);
+
+        /// @brief Checks every entry's payload against its checksum across `jobs` threads (0 = one per core) and
+        /// prints the result along with the verification throughput. Returns false if any entry is corrupt.
+        static bool Verify(const Path& pakFile, u32 jobs = 0);
+
+        /// @brief Re-encodes every asset in an existing pak with each registered codec and prints the ratio and
+        /// encode/decode throughput per asset type, so codec policies can be picked by measurement.
+        static bool Benchmark(const Path& pakFile);
 
     private:
         XPakHeader mHeader;
         std::vector<XPakTableEntry> mTableOfContents;
         std::vector<XPakAssetEntry> mAssets;
+        std::vector<u8> mDictionary;
+        std::vector<u8> mDependencies;
     };
 }  // namespace x
 
@@ -0,0 +1,139 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+// Cache entry file (<key>.xcache):
+//   'XPCC': 4 bytes
+//   Version: 2 bytes
+//   Asset flags: 2 bytes
+//   Original size: 64-bit unsigned
+//   Payload size: 64-bit unsigned
+//   Processing time: 64-bit float (seconds)
+//   Codec ID: 8-bit unsigned
+//   Reserved: 7 bytes
+//   [Payload]
+
+#include "XPakCache.hpp"
+#include "XPak.hpp"
+#include "Common/Hash.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <thread>
+#include <brotli/encode.h>
+
+namespace x {
+    static constexpr char kCacheMagic[4]     = {'X', 'P', 'C', 'C'};
+    static constexpr u16 kCacheVersion       = 2;
+    static constexpr size_t kCacheHeaderSize = 40;
+
+    XPakCache::XPakCache(const Path& directory) {
+        Open(directory);
+    }
+
+    bool XPakCache::Open(const Path& directory) {
+        mDirectory = directory;
+        mOpen      = false;
+
+        if (!mDirectory.Exists() && !mDirectory.CreateAll()) {
+            std::cerr << "XPakCache::Open: Failed to create cache directory " << mDirectory.Str() << std::endl;
+            return false;
+        }
+
+        mOpen = true;
+        return true;
+    }
+
+    bool XPakCache::IsOpen() const {
+        return mOpen;
+    }
+
+    const Path& XPakCache::GetDirectory() const {
+        return mDirectory;
+    }
+
+    u64 XPakCache::MakeKey(std::span<const u8> source,
+                           AssetType type,
+                           CodecId codec,
+                           u32 frameSize,
+                           u64 dictionaryHash,
+                           std::string_view salt) {
+        u64 key = HashFnv1a64(source);
+        key     = HashCombine(key, source.size());
+        key     = HashCombine(key, type);
+        key     = HashCombine(key, codec);
+        key     = HashCombine(key, frameSize);
+        key     = HashCombine(key, dictionaryHash);
+        key     = HashFnv1a64(salt, key);
+        // Encoder settings and tool/format versions, so changing any of them invalidates old entries
+        key = HashCombine(key, BROTLI_DEFAULT_QUALITY);
+        key = HashCombine(key, BROTLI_DEFAULT_WINDOW);
+        key = HashCombine(key, kCurrentVersion);
+        key = HashCombine(key, kCacheVersion);
+        return key;
+    }
+
+    std::optional<XPakCacheRecord> XPakCache::Load(u64 key) const {
+        if (!mOpen) { return std::nullopt; }
+
+        const auto entryPath = GetEntryPath(key);
+        if (!entryPath.Exists()) { return std::nullopt; }
+
+        const auto bytes = FileReader::ReadBytes(entryPath);
+        if (bytes.size() < kCacheHeaderSize) { return std::nullopt; }
+        if (std::memcmp(bytes.data(), kCacheMagic, sizeof(kCacheMagic)) != 0) { return std::nullopt; }
+
+        u16 version {0};
+        u64 payloadSize {0};
+        XPakCacheRecord record;
+        std::memcpy(&version, bytes.data() + 4, sizeof(u16));
+        std::memcpy(&record.mAssetFlags, bytes.data() + 6, sizeof(u16));
+        std::memcpy(&record.mSize, bytes.data() + 8, sizeof(u64));
+        std::memcpy(&payloadSize, bytes.data() + 16, sizeof(u64));
+        std::memcpy(&record.mSeconds, bytes.data() + 24, sizeof(f64));
+        std::memcpy(&record.mCodec, bytes.data() + 32, sizeof(CodecId));
+
+        // A truncated entry (e.g. from an interrupted build) is treated as a miss and simply gets overwritten
+        if (version != kCacheVersion || bytes.size() - kCacheHeaderSize != payloadSize) { return std::nullopt; }
+
+        record.mPayload.assign(bytes.begin() + kCacheHeaderSize, bytes.end());
+        return record;
+    }
+
+    bool XPakCache::Store(u64 key, const XPakCacheRecord& record) const {
+        if (!mOpen) { return false; }
+
+        vector<u8> bytes(kCacheHeaderSize + record.mPayload.size());
+        const u64 payloadSize = record.mPayload.size();
+        std::memcpy(bytes.data(), kCacheMagic, sizeof(kCacheMagic));
+        std::memcpy(bytes.data() + 4, &kCacheVersion, sizeof(u16));
+        std::memcpy(bytes.data() + 6, &record.mAssetFlags, sizeof(u16));
+        std::memcpy(bytes.data() + 8, &record.mSize, sizeof(u64));
+        std::memcpy(bytes.data() + 16, &payloadSize, sizeof(u64));
+        std::memcpy(bytes.data() + 24, &record.mSeconds, sizeof(f64));
+        std::memcpy(bytes.data() + 32, &record.mCodec, sizeof(CodecId));
+        if (payloadSize > 0) {
+            std::memcpy(bytes.data() + kCacheHeaderSize, record.mPayload.data(), payloadSize);
+        }
+
+        // Write to a per-thread temp file and rename it into place so a reader never sees a partial entry
+        const auto entryPath = GetEntryPath(key);
+        const auto threadId  = std::hash<std::thread::id> {}(std::this_thread::get_id());
+        const auto tempPath  = Path(std::format("{}.{}.tmp", entryPath.Str(), threadId));
+        if (!FileWriter::WriteBytes(tempPath, bytes)) { return false; }
+
+        std::remove(entryPath.CStr());
+        if (std::rename(tempPath.CStr(), entryPath.CStr()) != 0) {
+            // Another worker produced the same entry first, which is just as good
+            std::remove(tempPath.CStr());
+            return entryPath.Exists();
+        }
+
+        return true;
+    }
+
+    Path XPakCache::GetEntryPath(u64 key) const {
+        return mDirectory / std::format("{:016x}.xcache", key);
+    }
+}  // namespace x
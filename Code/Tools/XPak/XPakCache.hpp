@@ -0,0 +1,58 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include <optional>
+#include <span>
+
+#include "AssetDescriptor.hpp"
+#include "Compression.hpp"
+#include "Common/Typedefs.hpp"
+#include "Common/Filesystem.hpp"
+
+namespace x {
+    /// @brief Output of compressing/compiling a single asset, as stored in the build cache.
+    struct XPakCacheRecord {
+        u16 mAssetFlags {0};
+        CodecId mCodec {kCodec_None};
+        u64 mSize {0};      // Original (decompressed) size
+        f64 mSeconds {0};   // How long it took to produce the payload, used to report time saved on a hit
+        vector<u8> mPayload;
+    };
+
+    /// @brief On-disk cache of processed asset payloads, keyed by a hash of everything that affects the output (source
+    /// bytes, asset type, encoder settings and tool version). Each entry is its own file, so concurrent lookups and
+    /// stores from worker threads are safe.
+    class XPakCache {
+    public:
+        XPakCache() = default;
+        explicit XPakCache(const Path& directory);
+
+        bool Open(const Path& directory);
+
+        X_NODISCARD bool IsOpen() const;
+        X_NODISCARD const Path& GetDirectory() const;
+
+        /// @brief Builds the cache key for a source asset. `frameSize` is the chunked compression frame size (0 when the
+        /// asset isn't chunked), `dictionaryHash` identifies the shared dictionary it's compressed against (0 for none)
+        /// and `salt` covers anything else baked into the output (e.g. the chunk name embedded in Lua bytecode). Bump
+        /// kCacheVersion whenever the processing of any asset type changes in a way that alters its output.
+        static u64 MakeKey(std::span<const u8> source,
+                           AssetType type,
+                           CodecId codec,
+                           u32 frameSize,
+                           u64 dictionaryHash,
+                           std::string_view salt = {});
+
+        X_NODISCARD std::optional<XPakCacheRecord> Load(u64 key) const;
+        bool Store(u64 key, const XPakCacheRecord& record) const;
+
+    private:
+        Path mDirectory;
+        bool mOpen {false};
+
+        X_NODISCARD Path GetEntryPath(u64 key) const;
+    };
+}  // namespace x
@@ -0,0 +1,192 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "XPakMount.hpp"
+#include "Compression.hpp"
+#include "Common/Checksum.hpp"
+
+#include <iostream>
+
+namespace x {
+    bool XPakMount::Mount(const Path& pakFile) {
+        if (!mFile.Open(pakFile)) {
+            std::cerr << "XPakMount::Mount: Failed to map pak file " << pakFile.Str() << std::endl;
+            return false;
+        }
+
+        if (mFile.Size() < sizeof(XPakHeader)) {
+            std::cerr << "XPakMount::Mount: Pak file is too small " << pakFile.Str() << std::endl;
+            mFile.Close();
+            return false;
+        }
+
+        if (!mTable.Open(mFile.Bytes())) {
+            std::cerr << "XPakMount::Mount: Failed to read table of contents " << pakFile.Str() << std::endl;
+            mFile.Close();
+            return false;
+        }
+
+        mPakFile  = pakFile;
+        mVerified = std::make_unique<VerifiedEntries>();
+
+        auto dictionary = XPak::ReadDictionary(mFile.Bytes());
+        mDictionary     = dictionary.empty() ? nullptr : std::make_unique<CompressionDictionary>(std::move(dictionary));
+
+        return true;
+    }
+
+    void XPakMount::Unmount() {
+        mFile.Close();
+        mPakFile = Path();
+        mTable   = {};
+        mDictionary.reset();
+        mVerified.reset();
+    }
+
+    bool XPakMount::IsMounted() const {
+        return mFile.IsOpen();
+    }
+
+    void XPakMount::SetVerifyChecksums(bool verify) {
+        mVerifyChecksums = verify;
+    }
+
+    bool XPakMount::VerifyEntry(const XPakTableEntry& entry, std::span<const u8> bytes) const {
+        if (!CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Checksum)) { return true; }
+        return Crc32c(bytes) == entry.mChecksum;
+    }
+
+    bool XPakMount::VerifyOnce(const XPakTableEntry& entry, std::span<const u8> bytes) const {
+        if (!mVerifyChecksums || !mVerified || !CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Checksum)) { return true; }
+
+        {
+            std::lock_guard lock(mVerified->mMutex);
+            if (mVerified->mOffsets.contains(entry.mOffset)) { return true; }
+        }
+
+        // Checked outside the lock, two threads racing on the same entry just both verify it
+        if (!VerifyEntry(entry, bytes)) {
+            std::cerr << "Checksum mismatch for asset " << entry.mAssetId << ": " << mPakFile.Str() << std::endl;
+            return false;
+        }
+
+        std::lock_guard lock(mVerified->mMutex);
+        mVerified->mOffsets.insert(entry.mOffset);
+        return true;
+    }
+
+    std::span<const u8> XPakMount::GetBytes() const {
+        return mFile.Bytes();
+    }
+
+    const XPakTableView& XPakMount::GetTable() const {
+        return mTable;
+    }
+
+    const CompressionDictionary* XPakMount::GetDictionary() const {
+        return mDictionary.get();
+    }
+
+    vector<AssetId> XPakMount::GetDependencies(const XPakTableEntry& entry) const {
+        return XPak::ReadDependencies(mFile.Bytes(), entry);
+    }
+
+    std::span<const u8> XPakMount::GetEntryBytes(const XPakTableEntry& entry) const {
+        if (!IsMounted()) { return {}; }
+
+        const u64 start = entry.mOffset + kAssetHeaderSize;
+        if (start > mFile.Size() || entry.mCompressedSize > mFile.Size() - start) {
+            std::cerr << "XPakMount::GetEntryBytes: Entry out of bounds " << entry.mAssetId << std::endl;
+            return {};
+        }
+
+        return mFile.Bytes().subspan(start, entry.mCompressedSize);
+    }
+
+    std::span<const u8> XPakMount::GetAssetView(const XPakTableEntry& entry) const {
+        if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Compressed)) { return {}; }
+        if (entry.mSize != entry.mCompressedSize) { return {}; }
+
+        const auto bytes = GetEntryBytes(entry);
+        if (!VerifyOnce(entry, bytes)) { return {}; }
+        return bytes;
+    }
+
+    vector<u8> XPakMount::FetchAssetData(const XPakTableEntry& entry, u32 jobs) const {
+        return DecodeAssetData(entry, GetEntryBytes(entry), jobs);
+    }
+
+    vector<u8> XPakMount::DecodeAssetData(const XPakTableEntry& entry, std::span<const u8> bytes, u32 jobs) const {
+        if (bytes.size() != entry.mCompressedSize || bytes.empty()) {
+            std::cerr << "File size mismatch: " << mPakFile.Str() << std::endl;
+            return {};
+        }
+
+        if (!VerifyOnce(entry, bytes)) { return {}; }
+
+        if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Chunked)) {
+            auto decompressed = ChunkedCompression::Decompress(bytes, entry.mSize, entry.GetCodec(), jobs);
+            if (decompressed.size() != entry.mSize) {
+                std::cerr << "Failed to decode asset " << entry.mAssetId << ": " << mPakFile.Str() << std::endl;
+                return {};
+            }
+            return decompressed;
+        }
+
+        if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Compressed)) {
+            const bool usesDictionary = CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Dictionary);
+            if (usesDictionary && !mDictionary) {
+                std::cerr << "Missing shared dictionary: " << mPakFile.Str() << std::endl;
+                return {};
+            }
+
+            const auto* codec = CompressionCodecs::Get(entry.GetCodec());
+            vector<u8> decompressed(entry.mSize);
+            if (!codec || !codec->mDecompress(bytes, decompressed, usesDictionary ? mDictionary.get() : nullptr)) {
+                std::cerr << "Failed to decode asset " << entry.mAssetId << ": " << mPakFile.Str() << std::endl;
+                return {};
+            }
+            return decompressed;
+        }
+
+        // The compressed and uncompressed sizes should match in this instance
+        if (entry.mSize != entry.mCompressedSize) {
+            std::cerr << "File size mismatch: " << mPakFile.Str() << std::endl;
+            return {};
+        }
+
+        return {bytes.begin(), bytes.end()};
+    }
+
+    vector<u8> XPakMount::FetchAssetRange(const XPakTableEntry& entry, u64 offset, u64 size) const {
+        if (offset > entry.mSize || size > entry.mSize - offset) {
+            std::cerr << "XPakMount::FetchAssetRange: Range out of bounds " << entry.mAssetId << std::endl;
+            return {};
+        }
+
+        if (CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Chunked)) {
+            const auto bytes = GetEntryBytes(entry);
+            if (bytes.size() != entry.mCompressedSize) { return {}; }
+            auto range = ChunkedCompression::DecompressRange(bytes, entry.mSize, entry.GetCodec(), offset, size);
+            if (range.size() != size) {
+                std::cerr << "Failed to decode asset " << entry.mAssetId << ": " << mPakFile.Str() << std::endl;
+                return {};
+            }
+            return range;
+        }
+
+        // Sliced straight out of the mapping without going through GetAssetView, which would verify the whole entry
+        if (!CHECK_FLAG(entry.mAssetFlags, kAssetFlag_Compressed) && entry.mSize == entry.mCompressedSize) {
+            const auto bytes = GetEntryBytes(entry);
+            if (bytes.size() != entry.mSize) { return {}; }
+            const auto range = bytes.subspan(offset, size);
+            return {range.begin(), range.end()};
+        }
+
+        // Single compressed stream, there's no way to start decoding part-way through
+        auto data = FetchAssetData(entry);
+        if (data.size() != entry.mSize) { return {}; }
+        return {data.begin() + offset, data.begin() + offset + size};
+    }
+}  // namespace x
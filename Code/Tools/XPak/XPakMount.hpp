@@ -0,0 +1,97 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_set>
+
+#include "XPak.hpp"
+#include "Common/Typedefs.hpp"
+#include "Common/Filesystem.hpp"
+
+namespace x {
+    /// @brief A pak file mapped into memory once and kept open for the lifetime of the mount. Assets are read straight
+    /// out of the mapping instead of re-opening and seeking the pak file for every fetch.
+    ///
+    /// Entries are checked against their checksum the first time they're fetched or viewed, so a corrupt pak is
+    /// reported as such instead of failing somewhere inside a decoder or importer. Range reads skip the check, since
+    /// it would mean reading the whole entry. Verification can be turned off with SetVerifyChecksums.
+    class XPakMount {
+    public:
+        XPakMount() = default;
+
+        XPakMount(const XPakMount&)            = delete;
+        XPakMount& operator=(const XPakMount&) = delete;
+
+        XPakMount(XPakMount&&) noexcept            = default;
+        XPakMount& operator=(XPakMount&&) noexcept = default;
+
+        bool Mount(const Path& pakFile);
+        void Unmount();
+
+        X_NODISCARD bool IsMounted() const;
+
+        /// @brief Enables or disables checking entries against their checksum on first fetch. On by default.
+        void SetVerifyChecksums(bool verify);
+
+        /// @brief Returns true if the payload matches the entry's checksum, or the entry doesn't have one. Always
+        /// checks, regardless of SetVerifyChecksums or whether the entry was verified before.
+        X_NODISCARD bool VerifyEntry(const XPakTableEntry& entry, std::span<const u8> bytes) const;
+
+        /// @brief Verifies the payload the first time it's seen by any entry, if verification is enabled. Fetches do
+        /// this already, it only needs calling directly for payloads used without going through the mount.
+        X_NODISCARD bool VerifyOnce(const XPakTableEntry& entry, std::span<const u8> bytes) const;
+        X_NODISCARD std::span<const u8> GetBytes() const;
+
+        /// @brief The pak's table of contents, searched in place in the mapping.
+        X_NODISCARD const XPakTableView& GetTable() const;
+
+        /// @brief The pak's shared dictionary, loaded once on mount. Null if the pak doesn't have one.
+        X_NODISCARD const CompressionDictionary* GetDictionary() const;
+
+        /// @brief Returns the assets the entry depends on, as resolved when the pak was built. See AssetDependencies.
+        X_NODISCARD vector<AssetId> GetDependencies(const XPakTableEntry& entry) const;
+
+        /// @brief Returns the stored (possibly compressed) payload for the given entry without copying it.
+        X_NODISCARD std::span<const u8> GetEntryBytes(const XPakTableEntry& entry) const;
+
+        /// @brief Returns a zero-copy view of an asset's data. Only available for uncompressed entries, compressed
+        /// entries return an empty span and must go through FetchAssetData instead.
+        ///
+        /// The view points into the mapping and is invalidated when the pak is unmounted.
+        X_NODISCARD std::span<const u8> GetAssetView(const XPakTableEntry& entry) const;
+
+        /// @brief Returns a copy of the asset's data, decompressing it if needed. Chunked entries are decoded across up
+        /// to `jobs` threads (0 = one per core).
+        X_NODISCARD vector<u8> FetchAssetData(const XPakTableEntry& entry, u32 jobs = 0) const;
+
+        /// @brief Same as FetchAssetData, but decodes a copy of the entry's stored payload (see GetEntryBytes) instead
+        /// of reading it from the mapping. Lets the read and the decode happen on different threads.
+        X_NODISCARD vector<u8>
+        DecodeAssetData(const XPakTableEntry& entry, std::span<const u8> bytes, u32 jobs = 0) const;
+
+        /// @brief Returns a copy of `size` bytes of the asset's data starting at `offset`. Uncompressed entries are
+        /// sliced directly and chunked entries only decode the frames covering the range; other compressed entries
+        /// have to be decoded in full first.
+        X_NODISCARD vector<u8> FetchAssetRange(const XPakTableEntry& entry, u64 offset, u64 size) const;
+
+    private:
+        Path mPakFile;
+        MemoryMappedFile mFile;
+        XPakTableView mTable;
+        std::unique_ptr<CompressionDictionary> mDictionary;
+        bool mVerifyChecksums {true};
+
+        // Payloads that have passed verification, by offset since deduplicated entries share one. Behind a pointer so
+        // the mount stays movable.
+        struct VerifiedEntries {
+            std::mutex mMutex;
+            std::unordered_set<u64> mOffsets;
+        };
+        std::unique_ptr<VerifiedEntries> mVerified;
+    };
+}  // namespace x
@@ -0,0 +1,101 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "XPakMountStack.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+
+namespace x {
+    bool XPakMountStack::Mount(const Path& pakFile, i32 priority) {
+        auto mount = std::make_unique<XPakMount>();
+        if (!mount->Mount(pakFile)) {
+            std::cerr << "XPakMountStack::Mount: Failed to mount " << pakFile.Str() << std::endl;
+            return false;
+        }
+        mount->SetVerifyChecksums(mVerifyChecksums);
+
+        // Inserted after any layer with the same priority, so the pak mounted last wins ties
+        const auto it = std::ranges::upper_bound(mLayers, priority, {}, &Layer::mPriority);
+        mLayers.insert(it, Layer {priority, std::move(mount)});
+
+        RebuildIndex();
+        return true;
+    }
+
+    void XPakMountStack::UnmountAll() {
+        {
+            std::unique_lock lock(mIndexMutex);
+            mIndex.clear();
+        }
+        mLayers.clear();
+    }
+
+    bool XPakMountStack::IsMounted() const {
+        return !mLayers.empty();
+    }
+
+    size_t XPakMountStack::GetLayerCount() const {
+        return mLayers.size();
+    }
+
+    void XPakMountStack::SetVerifyChecksums(bool verify) {
+        mVerifyChecksums = verify;
+        for (auto& layer : mLayers) {
+            layer.mMount->SetVerifyChecksums(verify);
+        }
+    }
+
+    std::optional<XPakStackEntry> XPakMountStack::Find(AssetId id) const {
+        std::shared_lock lock(mIndexMutex);
+        if (const auto it = mIndex.find(id); it != mIndex.end()) { return it->second; }
+        return std::nullopt;
+    }
+
+    AssetId XPakMountStack::GetPayloadId(AssetId id) const {
+        std::shared_lock lock(mIndexMutex);
+        if (const auto it = mIndex.find(id); it != mIndex.end()) { return it->second.mPayloadId; }
+        return id;
+    }
+
+    const unordered_map<AssetId, XPakStackEntry>& XPakMountStack::GetEntries() const {
+        return mIndex;
+    }
+
+    void XPakMountStack::RebuildIndex() {
+        size_t total {0};
+        for (const auto& layer : mLayers) {
+            total += layer.mMount->GetTable().Size();
+        }
+
+        // Built on the side so lookups on other threads keep using the old index until it's swapped in
+        unordered_map<AssetId, XPakStackEntry> index;
+        index.reserve(total);
+
+        // Lowest priority first, so every layer simply overwrites whatever the ones below it provided
+        for (size_t i = 0; i < mLayers.size(); ++i) {
+            const auto* mount = mLayers[i].mMount.get();
+            const auto& table = mount->GetTable();
+            for (size_t j = 0; j < table.Size(); ++j) {
+                const auto entry      = table.GetEntry(j);
+                index[entry.mAssetId] = {mount, CAST<u32>(i), entry, entry.mAssetId};
+            }
+        }
+
+        // Deduplicated entries share an offset within their pak. Only visible entries count, an asset overridden by a
+        // patch no longer shares anything with the copies left in the base pak.
+        std::map<std::pair<u32, u64>, AssetId> payloads;
+        for (const auto& [id, entry] : index) {
+            const auto [it, inserted] = payloads.try_emplace({entry.mLayer, entry.mEntry.mOffset}, id);
+            if (!inserted) { it->second = X_MIN(it->second, id); }
+        }
+        for (auto& [id, entry] : index) {
+            entry.mPayloadId = payloads[{entry.mLayer, entry.mEntry.mOffset}];
+        }
+
+        std::unique_lock lock(mIndexMutex);
+        mIndex.swap(index);
+    }
+}  // namespace x
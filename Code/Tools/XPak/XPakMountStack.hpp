@@ -0,0 +1,76 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+
+#include "XPakMount.hpp"
+#include "Common/Typedefs.hpp"
+#include "Common/Filesystem.hpp"
+
+namespace x {
+    /// @brief Where an asset lives in a mount stack: the pak that provides it and its entry in that pak's table.
+    struct XPakStackEntry {
+        const XPakMount* mMount {nullptr};
+        u32 mLayer {0};  // Position of mMount in the stack, lowest priority first
+        XPakTableEntry mEntry;
+        // Lowest visible ID whose entry points at the same payload, the asset's own ID unless it was deduplicated
+        AssetId mPayloadId {0};
+    };
+
+    /// @brief Several paks mounted as one, e.g. a base pak plus patches built with `xpakc diff`. When paks share an
+    /// asset ID the one with the highest priority wins (the most recently mounted one on a tie), so a patch only has to
+    /// contain what changed.
+    ///
+    /// A merged index of every visible entry is rebuilt whenever a pak is mounted, so a lookup is a single hash lookup
+    /// no matter how many paks are stacked.
+    ///
+    /// Find and GetPayloadId may be called from any thread, including while another pak is being mounted: the new
+    /// index is built on the side and swapped in under a lock, so a lookup sees either the old stack or the new one.
+    /// Everything else (mounting, unmounting, GetEntries) belongs to one thread, and UnmountAll must not race any
+    /// lookup since it destroys the mounts that entries point at.
+    class XPakMountStack {
+    public:
+        XPakMountStack() = default;
+
+        XPakMountStack(const XPakMountStack&)            = delete;
+        XPakMountStack& operator=(const XPakMountStack&) = delete;
+
+        /// @brief Maps the pak and merges its entries into the index. Returns false (leaving the stack as it was) if
+        /// the pak can't be mounted.
+        bool Mount(const Path& pakFile, i32 priority = 0);
+        void UnmountAll();
+
+        X_NODISCARD bool IsMounted() const;
+        X_NODISCARD size_t GetLayerCount() const;
+
+        /// @brief Enables or disables checksum verification for every pak in the stack, see XPakMount.
+        void SetVerifyChecksums(bool verify);
+
+        X_NODISCARD std::optional<XPakStackEntry> Find(AssetId id) const;
+
+        /// @brief The ID every asset sharing this one's payload resolves to, so anything caching loaded or decoded data
+        /// can key on it and hold a single copy. Unknown IDs are returned as-is.
+        X_NODISCARD AssetId GetPayloadId(AssetId id) const;
+
+        /// @brief Every asset visible through the stack, keyed by ID. Invalidated by the next mount, so only use it on
+        /// the thread that mounts.
+        X_NODISCARD const unordered_map<AssetId, XPakStackEntry>& GetEntries() const;
+
+    private:
+        struct Layer {
+            i32 mPriority {0};
+            std::unique_ptr<XPakMount> mMount;  // Heap allocated so index entries can point at it
+        };
+
+        vector<Layer> mLayers;  // Lowest priority first
+        unordered_map<AssetId, XPakStackEntry> mIndex;
+        mutable std::shared_mutex mIndexMutex;  // Guards mIndex against lookups from other threads
+        bool mVerifyChecksums {true};
+
+        void RebuildIndex();
+    };
+}  // namespace x
@@ -0,0 +1,165 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "XPakWriter.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace x {
+    bool XPakWriter::Open(const Path& pakFile, u64 maxEntries) {
+        mStream = StreamWriter(pakFile);
+        if (!mStream.IsOpen()) {
+            std::cerr << "XPakWriter::Open: Failed to open " << pakFile.Str() << std::endl;
+            return false;
+        }
+
+        mHeader.mVersion          = kCurrentVersion;
+        mHeader.mFlags            = 0;
+        mHeader.mEntries          = 0;
+        mHeader.mDictionaryOffset = 0;
+        mHeader.mDictionarySize   = 0;
+        mMaxEntries               = maxEntries;
+        mDependencies             = {};
+        mTableOfContents.clear();
+        mTableOfContents.reserve(maxEntries);
+        mWritten.clear();
+
+        // Header gets rewritten with the final entry count in Finalize, the table is reserved as zeros for now
+        if (!mStream.Write(mHeader.ToBytes())) { return false; }
+        mOffset = sizeof(XPakHeader);
+
+        if (!WritePadding(maxEntries * sizeof(XPakTableEntry))) { return false; }
+        mOffset += maxEntries * sizeof(XPakTableEntry);
+
+        return true;
+    }
+
+    bool XPakWriter::WriteDictionary(std::span<const u8> data) {
+        if (CHECK_FLAG(mHeader.mFlags, kPakFlag_Dictionary)) {
+            std::cerr << "XPakWriter::WriteDictionary: Dictionary already written" << std::endl;
+            return false;
+        }
+
+        if (!data.empty() && !mStream.Write(data)) { return false; }
+
+        size_t paddingNeeded = 0;
+        if (data.size() % kAssetByteAlignment != 0) {
+            paddingNeeded = kAssetByteAlignment - (data.size() % kAssetByteAlignment);
+            if (!WritePadding(paddingNeeded)) { return false; }
+        }
+
+        mHeader.mFlags |= kPakFlag_Dictionary;
+        mHeader.mDictionaryOffset = mOffset;
+        mHeader.mDictionarySize   = data.size();
+        mOffset += data.size() + paddingNeeded;
+
+        return true;
+    }
+
+    bool XPakWriter::WriteDependencies(const AssetDependencies& dependencies) {
+        if (!mDependencies.mLists.empty()) {
+            std::cerr << "XPakWriter::WriteDependencies: Dependencies already written" << std::endl;
+            return false;
+        }
+
+        mDependencies = XPakDependencyBlock::Build(dependencies, mOffset);
+        if (!mDependencies.mData.empty() && !mStream.Write(mDependencies.mData)) { return false; }
+        mOffset += mDependencies.mData.size();
+
+        return true;
+    }
+
+    bool XPakWriter::WriteAsset(const XPakTableEntry& entry, std::span<const u8> data) {
+        if (mTableOfContents.size() >= mMaxEntries) {
+            std::cerr << "XPakWriter::WriteAsset: Table of contents is full" << std::endl;
+            return false;
+        }
+
+        XPakTableEntry tableEntry    = entry;
+        tableEntry.mOffset           = mOffset;
+        tableEntry.mDependencyOffset = 0;
+        tableEntry.mDependencyCount  = 0;
+
+        const XPakAssetEntry assetEntry;
+        if (!mStream.Write(std::span(RCAST<const u8*>(assetEntry.mMagic), sizeof(assetEntry.mMagic)))) {
+            return false;
+        }
+        if (!data.empty() && !mStream.Write(data)) { return false; }
+
+        const size_t currentSize = data.size() + kAssetHeaderSize;
+        size_t paddingNeeded     = 0;
+        if (currentSize % kAssetByteAlignment != 0) {
+            paddingNeeded = kAssetByteAlignment - (currentSize % kAssetByteAlignment);
+            if (!WritePadding(paddingNeeded)) { return false; }
+        }
+
+        mOffset += currentSize + paddingNeeded;
+        mWritten[tableEntry.mAssetId] = mTableOfContents.size();
+        mTableOfContents.push_back(tableEntry);
+
+        return true;
+    }
+
+    bool XPakWriter::WriteSharedAsset(AssetId id, AssetId sharedWith) {
+        if (mTableOfContents.size() >= mMaxEntries) {
+            std::cerr << "XPakWriter::WriteSharedAsset: Table of contents is full" << std::endl;
+            return false;
+        }
+
+        const auto it = mWritten.find(sharedWith);
+        if (it == mWritten.end()) {
+            std::cerr << "XPakWriter::WriteSharedAsset: Asset " << sharedWith << " hasn't been written" << std::endl;
+            return false;
+        }
+
+        // Same payload, flags, sizes and checksum. Only the ID differs, dependencies are assigned in Finalize.
+        XPakTableEntry tableEntry = mTableOfContents[it->second];
+        tableEntry.mAssetId       = id;
+
+        mWritten[id] = mTableOfContents.size();
+        mTableOfContents.push_back(tableEntry);
+
+        return true;
+    }
+
+    bool XPakWriter::Finalize() {
+        if (!mStream.IsOpen()) { return false; }
+
+        for (auto& entry : mTableOfContents) {
+            mDependencies.Apply(entry);
+        }
+
+        // Assets are laid out in the order they were written, but the table is sorted so readers can binary search it
+        std::ranges::stable_sort(mTableOfContents, {}, &XPakTableEntry::mAssetId);
+        mHeader.mFlags |= kPakFlag_SortedTable;
+        mHeader.mEntries = mTableOfContents.size();
+
+        // Back-patch the header and table now that every offset is known
+        if (!mStream.Seek(0)) { return false; }
+        if (!mStream.Write(mHeader.ToBytes())) { return false; }
+        for (const auto& entry : mTableOfContents) {
+            if (!mStream.Write(entry.ToBytes())) { return false; }
+        }
+
+        const bool result = mStream.Flush();
+        mStream.Close();
+
+        return result;
+    }
+
+    u64 XPakWriter::GetSize() const {
+        return mOffset;
+    }
+
+    bool XPakWriter::WritePadding(size_t size) {
+        static constexpr u8 kZeros[kAssetByteAlignment] {0};
+        while (size > 0) {
+            const size_t chunk = X_MIN(size, sizeof(kZeros));
+            if (!mStream.Write(std::span(kZeros, chunk))) { return false; }
+            size -= chunk;
+        }
+        return true;
+    }
+}  // namespace x
@@ -0,0 +1,62 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include <span>
+
+#include "XPak.hpp"
+#include "Common/Typedefs.hpp"
+#include "Common/Filesystem.hpp"
+
+namespace x {
+    /// @brief Writes a pak file to disk incrementally.
+    ///
+    /// The header is written and space for the table of contents is reserved up front. Each asset is then streamed
+    /// straight to disk (with its alignment padding) as soon as it's available, and the table is back-patched with the
+    /// final offsets in Finalize. Only the table itself is kept in memory.
+    class XPakWriter {
+    public:
+        XPakWriter() = default;
+
+        XPakWriter(const XPakWriter&)            = delete;
+        XPakWriter& operator=(const XPakWriter&) = delete;
+
+        /// @brief Creates the pak file and reserves room for up to `maxEntries` table entries.
+        bool Open(const Path& pakFile, u64 maxEntries);
+
+        /// @brief Appends the pak's shared dictionary and records its location in the header. Call at most once,
+        /// any time before Finalize.
+        bool WriteDictionary(std::span<const u8> data);
+
+        /// @brief Appends the pak's dependency lists. The table entries they belong to are pointed at them in Finalize,
+        /// so this can be called before or after the assets are written. Call at most once.
+        bool WriteDependencies(const AssetDependencies& dependencies);
+
+        /// @brief Appends an asset's payload. The entry's offset and dependency list location are assigned by the
+        /// writer, so entries copied out of another pak can be passed as-is.
+        bool WriteAsset(const XPakTableEntry& entry, std::span<const u8> data);
+
+        /// @brief Adds a table entry for `id` that points at the payload already written for `sharedWith`, for assets
+        /// whose stored data is identical. Nothing is appended to the file.
+        bool WriteSharedAsset(AssetId id, AssetId sharedWith);
+
+        /// @brief Writes the final header and table of contents, then closes the file.
+        bool Finalize();
+
+        /// @brief Total size of the pak file written so far, in bytes.
+        X_NODISCARD u64 GetSize() const;
+
+    private:
+        StreamWriter mStream {Path()};
+        XPakHeader mHeader;
+        vector<XPakTableEntry> mTableOfContents;
+        unordered_map<AssetId, size_t> mWritten;  // Index into mTableOfContents of every entry written so far
+        XPakDependencyBlock mDependencies;
+        u64 mMaxEntries {0};
+        u64 mOffset {0};
+
+        bool WritePadding(size_t size);
+    };
+}  // namespace x
@@ -5,9 +5,14 @@
 #include <assert.h>
 
 #include "Common/Filesystem.hpp"
+#include "Common/Timer.hpp"
 #include "ProjectDescriptor.hpp"
 #include "AssetGenerator.hpp"
+#include "CompressionSelfTest.hpp"
+#include "MeshOptimizer.hpp"
+#include "TextureBaker.hpp"
 #include "XPak.hpp"
+#include "XPakMount.hpp"
 #include <ranges>
 #include <CLI/CLI.hpp>
 
@@ -15,7 +20,20 @@ using namespace x;
 
 struct PackArgs {
     str mProjectFile;
-    str mPakName = "Data.xpak";
+    str mPakName   = "Data.xpak";
+    u32 mJobs      = 0;
+    str mCacheDir;
+    bool mNoCache        = false;
+    u32 mFrameSize       = 256 * 1024;
+    bool mNoDictionary   = false;
+    bool mNoDependencies = false;
+    str mLayoutTrace;
+    bool mNoMeshOptimize = false;
+    bool mQuantizeMeshes = false;
+    bool mXmlDescriptors = false;
+    str mTextureFormat   = "auto";
+    bool mNoDedup        = false;
+    bool mVerifyDecode   = false;
 };
 
 struct UnpackArgs {
@@ -33,6 +51,35 @@ struct DumpArgs {
     str mPakFile;
 };
 
+struct BenchArgs {
+    str mPakFile;
+};
+
+struct DiffArgs {
+    str mBasePak;
+    str mNewPak;
+    str mPatchName = "Patch.xpak";
+};
+
+struct VerifyArgs {
+    str mPakFile;
+    u32 mJobs = 0;
+};
+
+struct MeshArgs {
+    str mMeshFile;
+    bool mNoOptimize = false;
+    bool mQuantize   = false;
+};
+
+struct TextureArgs {
+    str mTextureFile;
+    str mOutputFile;
+    str mFormat     = "auto";
+    bool mNormalMap = false;
+    u32 mJobs       = 0;
+};
+
 int main(int argc, char* argv[]) {
     CLI::App app {"XPak CLI"};
 
@@ -40,6 +87,20 @@ int main(int argc, char* argv[]) {
     PackArgs packArgs;
     pack->add_option("project_file", packArgs.mProjectFile, "Project file path")->required(true);
     pack->add_option("-n,--name", packArgs.mPakName, "Output pak file name");
+    pack->add_option("-j,--jobs", packArgs.mJobs, "Number of worker threads (0 = one per core)");
+    pack->add_option("--cache-dir", packArgs.mCacheDir, "Build cache directory (default: .xpakcache next to the project)");
+    pack->add_option("--frame-size", packArgs.mFrameSize, "Frame size in bytes for seekable compression (0 = off)");
+    pack->add_flag("--no-cache", packArgs.mNoCache, "Recompress every asset without reading or writing the build cache");
+    pack->add_flag("--no-dictionary", packArgs.mNoDictionary, "Compress descriptors without a shared dictionary");
+    pack->add_flag("--no-dependencies", packArgs.mNoDependencies, "Don't store scene/material dependency lists");
+    pack->add_option("--layout-trace", packArgs.mLayoutTrace, "Asset access trace to lay the pak out in load order");
+    pack->add_flag("--no-mesh-optimize", packArgs.mNoMeshOptimize, "Bake meshes without welding or reordering them");
+    pack->add_flag("--quantize-meshes", packArgs.mQuantizeMeshes, "Quantize mesh normals, tangents and UVs");
+    pack->add_flag("--xml-descriptors", packArgs.mXmlDescriptors, "Store scenes/materials as XML instead of binary");
+    pack->add_option("--texture-format", packArgs.mTextureFormat, "Format to bake PNG/TGA textures to")
+      ->check(CLI::IsMember({"auto", "bc1", "bc3", "bc5", "bc7"}));
+    pack->add_flag("--no-dedup", packArgs.mNoDedup, "Store assets with identical contents separately");
+    pack->add_flag("--verify-decode", packArgs.mVerifyDecode, "Check newly compressed assets decode to their source");
 
     auto* unpack = app.add_subcommand("unpack", "Unpack assets from pak file");
     UnpackArgs unpackArgs;
@@ -56,6 +117,38 @@ int main(int argc, char* argv[]) {
     DumpArgs dumpArgs;
     dumpTable->add_option("pak_file", dumpArgs.mPakFile, "Pak file to dump")->required(true);
 
+    auto* bench = app.add_subcommand("bench", "Measure compression ratio and speed of every codec on a pak's assets");
+    BenchArgs benchArgs;
+    bench->add_option("pak_file", benchArgs.mPakFile, "Pak file to benchmark")->required(true);
+
+    auto* diff = app.add_subcommand("diff", "Write a patch pak holding only the assets that changed between two paks");
+    DiffArgs diffArgs;
+    diff->add_option("base_pak", diffArgs.mBasePak, "Pak file the patch will be mounted over")->required(true);
+    diff->add_option("new_pak", diffArgs.mNewPak, "Pak file with the updated assets")->required(true);
+    diff->add_option("-n,--name", diffArgs.mPatchName, "Output patch file name");
+
+    auto* verify = app.add_subcommand("verify", "Check every asset in a pak file against its checksum");
+    VerifyArgs verifyArgs;
+    verify->add_option("pak_file", verifyArgs.mPakFile, "Pak file to verify")->required(true);
+    verify->add_option("-j,--jobs", verifyArgs.mJobs, "Number of worker threads (0 = one per core)");
+
+    auto* mesh = app.add_subcommand("mesh", "Bake a mesh and report its size and modeled ACMR");
+    MeshArgs meshArgs;
+    mesh->add_option("mesh_file", meshArgs.mMeshFile, "Source mesh file")->required(true);
+    mesh->add_flag("--no-optimize", meshArgs.mNoOptimize, "Don't weld or reorder the mesh");
+    mesh->add_flag("--quantize", meshArgs.mQuantize, "Quantize normals, tangents and UVs");
+
+    auto* texture = app.add_subcommand("texture", "Bake a PNG/TGA texture to a block compressed DDS with mips");
+    TextureArgs textureArgs;
+    texture->add_option("texture_file", textureArgs.mTextureFile, "Source image file")->required(true);
+    texture->add_option("-o,--output", textureArgs.mOutputFile, "DDS file to write (default: report only)");
+    texture->add_option("-f,--format", textureArgs.mFormat, "Block compression format")
+      ->check(CLI::IsMember({"auto", "bc1", "bc3", "bc5", "bc7"}));
+    texture->add_flag("--normal-map", textureArgs.mNormalMap, "Filter and encode the texture as a normal map");
+    texture->add_option("-j,--jobs", textureArgs.mJobs, "Number of worker threads (0 = one per core)");
+
+    auto* selfTest = app.add_subcommand("selftest", "Check the compression codecs against reference LZ4 blocks");
+
     app.require_subcommand(1);
 
     try {
@@ -72,19 +165,33 @@ int main(int argc, char* argv[]) {
         ProjectDescriptor projectDescriptor;
         projectDescriptor.FromFile(project);
 
-        auto createResult = XPak::Create(projectDescriptor);
-        if (!createResult.has_value()) {
-            std::cerr << "Could not create pak file from project" << std::endl;
-            return EXIT_FAILURE;
+        XPakCreateOptions createOptions;
+        createOptions.mJobs               = packArgs.mJobs;
+        createOptions.mFrameSize          = packArgs.mFrameSize;
+        createOptions.mDictionary         = !packArgs.mNoDictionary;
+        createOptions.mDependencies       = !packArgs.mNoDependencies;
+        createOptions.mOptimizeMeshes     = !packArgs.mNoMeshOptimize;
+        createOptions.mQuantizeMeshes     = packArgs.mQuantizeMeshes;
+        createOptions.mCompileDescriptors = !packArgs.mXmlDescriptors;
+        createOptions.mTextureFormat      = TextureBaker::GetFormatFromString(packArgs.mTextureFormat);
+        createOptions.mDeduplicate        = !packArgs.mNoDedup;
+        createOptions.mVerifyDecode       = packArgs.mVerifyDecode;
+        if (!packArgs.mLayoutTrace.empty()) {
+            createOptions.mLayoutTrace = Path(packArgs.mLayoutTrace);
+            if (!createOptions.mLayoutTrace.Exists()) {
+                std::cerr << "Could not open layout trace " << packArgs.mLayoutTrace << std::endl;
+                return EXIT_FAILURE;
+            }
         }
-        const auto& pak = createResult.value();
-        auto pakFile    = pak.ToBytes();
-        if (pakFile.size() == 0) {
-            std::cerr << "Could not create pak file from project (size 0)" << std::endl;
-            return EXIT_FAILURE;
+        if (!packArgs.mNoCache) {
+            createOptions.mCacheDirectory =
+              packArgs.mCacheDir.empty() ? project.Parent() / ".xpakcache" : Path(packArgs.mCacheDir);
         }
 
-        FileWriter::WriteBytes(Path::Current() / packArgs.mPakName, pakFile);
+        if (!XPak::Pack(projectDescriptor, Path::Current() / packArgs.mPakName, createOptions)) {
+            std::cerr << "Could not create pak file from project" << std::endl;
+            return EXIT_FAILURE;
+        }
     }
 
     else if (unpack->parsed()) {
@@ -94,7 +201,13 @@ int main(int argc, char* argv[]) {
             return EXIT_FAILURE;
         }
 
-        auto assetTable = XPak::ReadPakTable(pakFile);
+        XPakMount mount;
+        if (!mount.Mount(pakFile)) {
+            std::cerr << "Could not read pak file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        auto assetTable = XPak::ReadPakTable(mount.GetBytes());
         if (assetTable.size() == 0) {
             std::cerr << "Could not read pak file" << std::endl;
             return EXIT_FAILURE;
@@ -111,7 +224,7 @@ int main(int argc, char* argv[]) {
         for (const auto& [id, asset] : assetTable) {
             auto assetName  = X_TOSTR(id) + ".bin";
             auto outputFile = Path(outputDir / assetName);
-            auto assetData  = XPak::FetchAssetData(pakFile, asset);
+            auto assetData  = mount.FetchAssetData(asset);
             if (assetData.size() == 0) {
                 std::cerr << "Could not fetch asset data from pak file" << std::endl;
                 return EXIT_FAILURE;
@@ -131,6 +244,7 @@ int main(int argc, char* argv[]) {
         if (genArgs.mAssetType.empty()) {
             // Attempt to detect the type based on the extension
             if (sourceFile.Extension() == "dds") assetType = kAssetType_Texture;
+            else if (TextureBaker::IsSourceImage(sourceFile.Extension())) assetType = kAssetType_Texture;
             else if (sourceFile.Extension() == "glb") assetType = kAssetType_Mesh;
             else if (sourceFile.Extension() == "lua") assetType = kAssetType_Script;
             else if (sourceFile.Extension() == "material") assetType = kAssetType_Material;
@@ -179,4 +293,114 @@ int main(int argc, char* argv[]) {
             std::cout << asset.ToString() << std::endl;
         }
     }
-}
\ No newline at end of file
+
+    else if (bench->parsed()) {
+        auto pakFile = Path(benchArgs.mPakFile);
+        if (!pakFile.Exists()) {
+            std::cerr << "Could not open pak file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (!XPak::Benchmark(pakFile)) {
+            std::cerr << "Could not benchmark pak file" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    else if (diff->parsed()) {
+        const auto basePak = Path(diffArgs.mBasePak);
+        const auto newPak  = Path(diffArgs.mNewPak);
+        if (!basePak.Exists() || !newPak.Exists()) {
+            std::cerr << "Could not open pak file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (!XPak::Diff(basePak, newPak, Path::Current() / diffArgs.mPatchName)) {
+            std::cerr << "Could not create patch pak file" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    else if (verify->parsed()) {
+        auto pakFile = Path(verifyArgs.mPakFile);
+        if (!pakFile.Exists()) {
+            std::cerr << "Could not open pak file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (!XPak::Verify(pakFile, verifyArgs.mJobs)) {
+            std::cerr << "Pak file failed verification" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    else if (mesh->parsed()) {
+        auto meshFile = Path(meshArgs.mMeshFile);
+        if (!meshFile.Exists()) {
+            std::cerr << "Could not open mesh file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        MeshBakeOptions options;
+        options.mOptimize = !meshArgs.mNoOptimize;
+        options.mQuantize = meshArgs.mQuantize;
+
+        MeshBakeStats stats;
+        const auto source = FileReader::ReadBytes(meshFile);
+        if (MeshBaker::Bake(source, meshFile.Extension(), options, &stats).empty()) {
+            std::cerr << "Could not bake mesh" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        printf(" - Submeshes: %u, triangles: %llu\n", stats.mSubmeshCount, stats.mTriangles);
+        printf(" - Vertices: %llu -> %llu\n", stats.mSourceVertices, stats.mVertices);
+        printf(" - Size: %.1f KB -> %.1f KB\n", stats.mSourceBytes / 1024.0, stats.mBytes / 1024.0);
+        printf(" - ACMR: %.3f -> %.3f (%u entry FIFO cache)\n",
+               stats.mSourceAcmr,
+               stats.mAcmr,
+               MeshOptimizer::kModeledCacheSize);
+        printf(" - ATVR: %.3f -> %.3f\n", stats.mSourceAtvr, stats.mAtvr);
+    }
+
+    else if (texture->parsed()) {
+        auto textureFile = Path(textureArgs.mTextureFile);
+        if (!textureFile.Exists()) {
+            std::cerr << "Could not open texture file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        TextureBakeOptions options;
+        options.mFormat    = TextureBaker::GetFormatFromString(textureArgs.mFormat);
+        options.mNormalMap = textureArgs.mNormalMap;
+        options.mJobs      = textureArgs.mJobs;
+
+        TextureBakeStats stats;
+        const auto source = FileReader::ReadBytes(textureFile);
+        const Timer timer;
+        const auto baked = TextureBaker::Bake(source, options, &stats);
+        if (baked.empty()) {
+            std::cerr << "Could not bake texture" << std::endl;
+            return EXIT_FAILURE;
+        }
+        const f64 seconds = timer.Elapsed();
+
+        printf(" - Dimensions: %ux%u, %u mip(s)\n", stats.mWidth, stats.mHeight, stats.mMipCount);
+        printf(" - Format: %s\n", TextureBaker::GetFormatString(stats.mFormat).c_str());
+        printf(" - Size: %.1f KB (RGBA8) -> %.1f KB\n", stats.mSourceBytes / 1024.0, stats.mBytes / 1024.0);
+        printf(" - Baked in %.3f s (%.2f MPixels/s)\n",
+               seconds,
+               seconds > 0.0 ? CAST<f64>(stats.mSourceBytes / 4) / seconds / 1e6 : 0.0);
+
+        if (!textureArgs.mOutputFile.empty() && !FileWriter::WriteBytes(Path(textureArgs.mOutputFile), baked)) {
+            std::cerr << "Could not write DDS file" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    else if (selfTest->parsed()) {
+        if (!CompressionSelfTest::Run()) {
+            std::cerr << "Compression self-test failed" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+}